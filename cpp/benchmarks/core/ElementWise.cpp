@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+
+namespace open3d {
+namespace core {
+
+namespace cpu_launcher = kernel::cpu_launcher;
+
+enum class ElementWiseLayout {
+    Contiguous,  // All operands are contiguous.
+    Broadcast,   // The rhs operand is a broadcasted scalar.
+    Strided,     // The lhs operand is a strided slice.
+};
+
+static Tensor MakeOperand(const SizeVector& shape,
+                          Dtype dtype,
+                          const Device& device,
+                          ElementWiseLayout layout) {
+    if (layout == ElementWiseLayout::Strided) {
+        SizeVector full_shape = shape;
+        full_shape[1] *= 2;
+        Tensor full = Tensor::Ones(full_shape, dtype, device);
+        return full.Slice(1, 0, full_shape[1], 2);
+    } else {
+        return Tensor::Ones(shape, dtype, device);
+    }
+}
+
+void BinaryEW(benchmark::State& state,
+              const Device& device,
+              const std::string& op,
+              ElementWiseLayout layout,
+              cpu_launcher::CPUISA isa) {
+    int64_t large_dim = (1ULL << 24) + 10;
+    SizeVector shape{2, large_dim};
+    Tensor lhs = MakeOperand(shape, core::Float32, device, layout);
+    Tensor rhs = layout == ElementWiseLayout::Broadcast
+                         ? Tensor::Ones({}, core::Float32, device)
+                         : MakeOperand(shape, core::Float32, device, layout);
+
+    auto run_op = [&]() -> Tensor {
+        if (op == "Add") {
+            return lhs.Add(rhs);
+        } else if (op == "Mul") {
+            return lhs.Mul(rhs);
+        } else {
+            return lhs.Gt(rhs);
+        }
+    };
+
+    const cpu_launcher::CPUISA old_isa = cpu_launcher::GetCPUISA();
+    cpu_launcher::SetCPUISA(isa);
+    Tensor warm_up = run_op();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = run_op();
+    }
+    cpu_launcher::SetCPUISA(old_isa);
+}
+
+void UnaryEW(benchmark::State& state,
+             const Device& device,
+             const std::string& op,
+             ElementWiseLayout layout,
+             cpu_launcher::CPUISA isa) {
+    int64_t large_dim = (1ULL << 24) + 10;
+    SizeVector shape{2, large_dim};
+    Tensor src = MakeOperand(shape, core::Float32, device, layout);
+
+    auto run_op = [&]() -> Tensor {
+        if (op == "Sqrt") {
+            return src.Sqrt();
+        } else if (op == "Abs") {
+            return src.Abs();
+        } else {
+            return src.Exp();
+        }
+    };
+
+    const cpu_launcher::CPUISA old_isa = cpu_launcher::GetCPUISA();
+    cpu_launcher::SetCPUISA(isa);
+    Tensor warm_up = run_op();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = run_op();
+    }
+    cpu_launcher::SetCPUISA(old_isa);
+}
+
+#define ENUM_BM_ISA(FN, OP, LAYOUT, DEVICE_NAME, DEVICE)                      \
+    BENCHMARK_CAPTURE(FN, OP##_##LAYOUT##_Default_##DEVICE_NAME, DEVICE, #OP, \
+                      ElementWiseLayout::LAYOUT,                              \
+                      cpu_launcher::CPUISA::Default)                          \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FN, OP##_##LAYOUT##_AVX2_##DEVICE_NAME, DEVICE, #OP,    \
+                      ElementWiseLayout::LAYOUT, cpu_launcher::CPUISA::AVX2)  \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FN, OP##_##LAYOUT##_AVX512_##DEVICE_NAME, DEVICE, #OP,  \
+                      ElementWiseLayout::LAYOUT,                              \
+                      cpu_launcher::CPUISA::AVX512)                           \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_BM_BINARY_LAYOUT(OP, DEVICE_NAME, DEVICE)         \
+    ENUM_BM_ISA(BinaryEW, OP, Contiguous, DEVICE_NAME, DEVICE) \
+    ENUM_BM_ISA(BinaryEW, OP, Broadcast, DEVICE_NAME, DEVICE)  \
+    ENUM_BM_ISA(BinaryEW, OP, Strided, DEVICE_NAME, DEVICE)
+
+#define ENUM_BM_UNARY_LAYOUT(OP, DEVICE_NAME, DEVICE)         \
+    ENUM_BM_ISA(UnaryEW, OP, Contiguous, DEVICE_NAME, DEVICE) \
+    ENUM_BM_ISA(UnaryEW, OP, Strided, DEVICE_NAME, DEVICE)
+
+// The requested ISA is clamped to the best one supported by the machine, so
+// the AVX2 and AVX512 variants fall back gracefully on older CPUs.
+ENUM_BM_BINARY_LAYOUT(Add, CPU, Device("CPU:0"))
+ENUM_BM_BINARY_LAYOUT(Mul, CPU, Device("CPU:0"))
+ENUM_BM_BINARY_LAYOUT(Gt, CPU, Device("CPU:0"))
+ENUM_BM_UNARY_LAYOUT(Sqrt, CPU, Device("CPU:0"))
+ENUM_BM_UNARY_LAYOUT(Abs, CPU, Device("CPU:0"))
+ENUM_BM_UNARY_LAYOUT(Exp, CPU, Device("CPU:0"))
+
+}  // namespace core
+}  // namespace open3d
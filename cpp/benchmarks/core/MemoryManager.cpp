@@ -28,6 +28,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <thread>
+#include <vector>
+
 #ifdef BUILD_CUDA_MODULE
 #include "open3d/core/CUDAUtils.h"
 #endif
@@ -35,7 +38,7 @@
 namespace open3d {
 namespace core {
 
-enum class MemoryManagerBackend { Direct, Cached };
+enum class MemoryManagerBackend { Direct, Cached, CPUCached };
 
 std::shared_ptr<DeviceMemoryManager> MakeMemoryManager(
         const Device& device, const MemoryManagerBackend& backend) {
@@ -63,6 +66,12 @@ std::shared_ptr<DeviceMemoryManager> MakeMemoryManager(
         case MemoryManagerBackend::Cached:
             return std::make_shared<CachedMemoryManager>(device_mm);
 
+        case MemoryManagerBackend::CPUCached:
+            if (device.GetType() != Device::DeviceType::CPU) {
+                utility::LogError("CPUCached backend requires a CPU device");
+            }
+            return std::make_shared<CPUCachedMemoryManager>();
+
         default:
             utility::LogError("Unimplemented backend");
             break;
@@ -158,19 +167,78 @@ void Free(benchmark::State& state,
             ->Unit(benchmark::kMicrosecond);
 
 #ifdef BUILD_CUDA_MODULE
-#define ENUM_BM_BACKEND(FN)                                                \
-    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Direct)   \
-    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Cached)   \
-    ENUM_BM_SIZE(FN, Device("CUDA:0"), CUDA, MemoryManagerBackend::Direct) \
+#define ENUM_BM_BACKEND(FN)                                                 \
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Direct)    \
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Cached)    \
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::CPUCached) \
+    ENUM_BM_SIZE(FN, Device("CUDA:0"), CUDA, MemoryManagerBackend::Direct)  \
     ENUM_BM_SIZE(FN, Device("CUDA:0"), CUDA, MemoryManagerBackend::Cached)
 #else
-#define ENUM_BM_BACKEND(FN)                                              \
-    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Direct) \
-    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Cached)
+#define ENUM_BM_BACKEND(FN)                                                 \
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Direct)    \
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Cached)    \
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::CPUCached)
 #endif
 
 ENUM_BM_BACKEND(Malloc)
 ENUM_BM_BACKEND(Free)
 
+/// Simulates many small temporary tensors created concurrently by several
+/// threads, e.g. in a multi-threaded processing pipeline.
+void MallocFreeMultiThreaded(benchmark::State& state,
+                             int num_threads,
+                             const MemoryManagerBackend& backend) {
+    const Device device("CPU:0");
+    auto device_mm = MakeMemoryManager(device, backend);
+
+    const int num_iterations = 10000;
+    const int num_live_blocks = 16;
+    auto worker = [&device_mm, &device](int thread_id) {
+        std::vector<void*> ptrs(num_live_blocks, nullptr);
+        for (int i = 0; i < num_iterations; ++i) {
+            const int slot = i % num_live_blocks;
+            if (ptrs[slot] != nullptr) {
+                device_mm->Free(ptrs[slot], device);
+            }
+            const size_t byte_size = 64 + 48 * ((i * 7 + thread_id) % 128);
+            ptrs[slot] = device_mm->Malloc(byte_size, device);
+        }
+        for (void* ptr : ptrs) {
+            device_mm->Free(ptr, device);
+        }
+    };
+
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back(worker, t);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    CachedMemoryManager::ReleaseCache(device);
+    CPUCachedMemoryManager::ReleaseCache();
+}
+
+#define ENUM_BM_THREADS(BACKEND)                                            \
+    BENCHMARK_CAPTURE(MallocFreeMultiThreaded, BACKEND##_1_Threads, 1,      \
+                      BACKEND)                                              \
+            ->Unit(benchmark::kMicrosecond)                                 \
+            ->UseRealTime();                                                \
+    BENCHMARK_CAPTURE(MallocFreeMultiThreaded, BACKEND##_4_Threads, 4,      \
+                      BACKEND)                                              \
+            ->Unit(benchmark::kMicrosecond)                                 \
+            ->UseRealTime();                                                \
+    BENCHMARK_CAPTURE(MallocFreeMultiThreaded, BACKEND##_16_Threads, 16,    \
+                      BACKEND)                                              \
+            ->Unit(benchmark::kMicrosecond)                                 \
+            ->UseRealTime();
+
+ENUM_BM_THREADS(MemoryManagerBackend::Direct)
+ENUM_BM_THREADS(MemoryManagerBackend::Cached)
+ENUM_BM_THREADS(MemoryManagerBackend::CPUCached)
+
 }  // namespace core
 }  // namespace open3d
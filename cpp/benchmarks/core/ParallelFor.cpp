@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/kernel/CPULauncher.h"
+
+namespace open3d {
+namespace core {
+
+namespace launcher = core::kernel::cpu_launcher;
+
+/// Restores the previous backend when going out of scope.
+class ScopedCPUBackend {
+public:
+    explicit ScopedCPUBackend(launcher::CPUBackend backend)
+        : prev_backend_(launcher::GetCPUBackend()) {
+        launcher::SetCPUBackend(backend);
+    }
+    ~ScopedCPUBackend() { launcher::SetCPUBackend(prev_backend_); }
+
+private:
+    launcher::CPUBackend prev_backend_;
+};
+
+void ParallelForUniform(benchmark::State& state,
+                        launcher::CPUBackend backend) {
+    ScopedCPUBackend scoped_backend(backend);
+    const int64_t n = 1 << 24;
+    std::vector<float> values(n);
+    float* values_ptr = values.data();
+    for (auto _ : state) {
+        launcher::ParallelFor(n, [values_ptr](int64_t idx) {
+            values_ptr[idx] = std::sqrt(static_cast<float>(idx));
+        });
+    }
+}
+
+void ParallelForNonUniform(benchmark::State& state,
+                           launcher::CPUBackend backend) {
+    ScopedCPUBackend scoped_backend(backend);
+    // The cost of a workload grows with its index, the last quarter of the
+    // workloads takes almost half of the total time.
+    const int64_t n = 1 << 13;
+    std::vector<double> values(n);
+    double* values_ptr = values.data();
+    for (auto _ : state) {
+        launcher::ParallelFor(n, [values_ptr](int64_t idx) {
+            double sum = 0;
+            for (int64_t i = 0; i < idx; ++i) {
+                sum += std::sin(static_cast<double>(i));
+            }
+            values_ptr[idx] = sum;
+        });
+    }
+}
+
+void ParallelForNested(benchmark::State& state, launcher::CPUBackend backend) {
+    ScopedCPUBackend scoped_backend(backend);
+    // Few outer workloads, each one containing a large parallel loop.
+    const int64_t num_outer = 4;
+    const int64_t num_inner = 1 << 22;
+    std::vector<float> values(num_outer * num_inner);
+    float* values_ptr = values.data();
+    for (auto _ : state) {
+        launcher::ParallelFor(num_outer, [=](int64_t outer) {
+            launcher::ParallelFor(num_inner, [=](int64_t inner) {
+                values_ptr[outer * num_inner + inner] =
+                        std::sqrt(static_cast<float>(inner));
+            });
+        });
+    }
+}
+
+BENCHMARK_CAPTURE(ParallelForUniform, OpenMP, launcher::CPUBackend::OpenMP)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForUniform, TBB, launcher::CPUBackend::TBB)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForNonUniform, OpenMP, launcher::CPUBackend::OpenMP)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForNonUniform, TBB, launcher::CPUBackend::TBB)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForNested, OpenMP, launcher::CPUBackend::OpenMP)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForNested, TBB, launcher::CPUBackend::TBB)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
@@ -55,5 +55,60 @@ BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+enum class ReductionOp { Sum, Max, ArgMin };
+
+static Tensor RunReductionOp(const Tensor& src,
+                             ReductionOp op,
+                             const SizeVector& dims) {
+    switch (op) {
+        case ReductionOp::Sum:
+            return src.Sum(dims);
+        case ReductionOp::Max:
+            return src.Max(dims);
+        default:
+            return src.ArgMin(dims);
+    }
+}
+
+// Reductions of a (N, 3) Float32 point tensor, either over the slow axis,
+// e.g. the centroid of a point cloud, or over the fast axis.
+void ReductionPoints(benchmark::State& state,
+                     const Device& device,
+                     ReductionOp op,
+                     const SizeVector& dims) {
+    int64_t num_points = 1 << 24;
+    Tensor src = Tensor::Ones({num_points, 3}, core::Float32, device);
+    Tensor warm_up = RunReductionOp(src, op, dims);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = RunReductionOp(src, op, dims);
+    }
+}
+
+#define ENUM_BM_REDUCTION_POINTS(DEVICE_NAME, DEVICE)                         \
+    BENCHMARK_CAPTURE(ReductionPoints, Sum_SlowAxis_##DEVICE_NAME, DEVICE,    \
+                      ReductionOp::Sum, SizeVector({0}))                      \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(ReductionPoints, Sum_FastAxis_##DEVICE_NAME, DEVICE,    \
+                      ReductionOp::Sum, SizeVector({1}))                      \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(ReductionPoints, Sum_AllAxes_##DEVICE_NAME, DEVICE,     \
+                      ReductionOp::Sum, SizeVector({0, 1}))                   \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(ReductionPoints, Max_SlowAxis_##DEVICE_NAME, DEVICE,    \
+                      ReductionOp::Max, SizeVector({0}))                      \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(ReductionPoints, ArgMin_SlowAxis_##DEVICE_NAME, DEVICE, \
+                      ReductionOp::ArgMin, SizeVector({0}))                   \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(ReductionPoints, ArgMin_FastAxis_##DEVICE_NAME, DEVICE, \
+                      ReductionOp::ArgMin, SizeVector({1}))                   \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_REDUCTION_POINTS(CPU, Device("CPU:0"))
+#ifdef BUILD_CUDA_MODULE
+ENUM_BM_REDUCTION_POINTS(CUDA, Device("CUDA:0"))
+#endif
+
 }  // namespace core
 }  // namespace open3d
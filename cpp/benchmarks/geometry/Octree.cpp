@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "open3d/geometry/Octree.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/geometry/LinearOctree.h"
+#include "open3d/geometry/PointCloud.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Uniformly distributed colored points in the unit cube.
+static geometry::PointCloud CreateRandomPointCloud(int num_points) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d(dist(rng), dist(rng), dist(rng));
+        pcd.colors_[i] = Eigen::Vector3d(dist(rng), dist(rng), dist(rng));
+    }
+    return pcd;
+}
+
+static void OctreeConvertFromPointCloud(benchmark::State& state) {
+    const geometry::PointCloud pcd = CreateRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        geometry::Octree octree(state.range(1));
+        octree.ConvertFromPointCloud(pcd);
+    }
+}
+
+static void LinearOctreeConvertFromPointCloud(benchmark::State& state) {
+    const geometry::PointCloud pcd = CreateRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        geometry::LinearOctree octree(state.range(1));
+        octree.ConvertFromPointCloud(pcd);
+    }
+}
+
+static void OctreeLocateLeafNode(benchmark::State& state) {
+    const geometry::PointCloud pcd = CreateRandomPointCloud(state.range(0));
+    geometry::Octree octree(state.range(1));
+    octree.ConvertFromPointCloud(pcd);
+    size_t idx = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(octree.LocateLeafNode(pcd.points_[idx]));
+        idx = (idx + 1) % pcd.points_.size();
+    }
+}
+
+static void LinearOctreeLocateLeafNode(benchmark::State& state) {
+    const geometry::PointCloud pcd = CreateRandomPointCloud(state.range(0));
+    geometry::LinearOctree octree(state.range(1));
+    octree.ConvertFromPointCloud(pcd);
+    size_t idx = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(octree.LocateLeafNode(pcd.points_[idx]));
+        idx = (idx + 1) % pcd.points_.size();
+    }
+}
+
+// Args: number of points, max depth.
+BENCHMARK(OctreeConvertFromPointCloud)
+        ->Args({100000, 8})
+        ->Args({1000000, 8})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(LinearOctreeConvertFromPointCloud)
+        ->Args({100000, 8})
+        ->Args({1000000, 8})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(OctreeLocateLeafNode)->Args({100000, 8});
+BENCHMARK(LinearOctreeLocateLeafNode)->Args({100000, 8});
+
+}  // namespace benchmarks
+}  // namespace open3d
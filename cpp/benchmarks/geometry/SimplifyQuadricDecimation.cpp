@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class SimplifyQuadricDecimationFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // A bumpy sphere with about 1M triangles.
+        trimesh = geometry::TriangleMesh::CreateSphere(1.0, 500);
+        for (Eigen::Vector3d& vertex : trimesh->vertices_) {
+            vertex *= 1 + 0.05 * std::sin(20 * vertex.x()) *
+                                  std::cos(15 * vertex.y());
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::TriangleMesh> trimesh;
+};
+
+BENCHMARK_DEFINE_F(SimplifyQuadricDecimationFixture, Serial)
+(benchmark::State& state) {
+    int target = int(trimesh->triangles_.size()) / int(state.range(0));
+    for (auto _ : state) {
+        trimesh->SimplifyQuadricDecimation(
+                target, std::numeric_limits<double>::infinity(), 1.0);
+    }
+}
+
+BENCHMARK_REGISTER_F(SimplifyQuadricDecimationFixture, Serial)
+        ->Args({10})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(SimplifyQuadricDecimationFixture, Parallel)
+(benchmark::State& state) {
+    int target = int(trimesh->triangles_.size()) / int(state.range(0));
+    for (auto _ : state) {
+        trimesh->SimplifyQuadricDecimationParallel(
+                target, std::numeric_limits<double>::infinity(), 1.0);
+    }
+}
+
+BENCHMARK_REGISTER_F(SimplifyQuadricDecimationFixture, Parallel)
+        ->Args({10})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
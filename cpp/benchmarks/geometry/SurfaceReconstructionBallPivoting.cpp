@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class BallPivotingFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // 50k evenly spread points on the unit sphere.
+        const int n = 50000;
+        for (int i = 0; i < n; ++i) {
+            double z = 1 - (2 * i + 1) / double(n);
+            double r = std::sqrt(1 - z * z);
+            double phi = i * M_PI * (3 - std::sqrt(5));
+            pcd.points_.emplace_back(r * std::cos(phi), r * std::sin(phi), z);
+        }
+        pcd.normals_ = pcd.points_;
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    geometry::PointCloud pcd;
+    const std::vector<double> radii = {0.02, 0.04};
+};
+
+BENCHMARK_DEFINE_F(BallPivotingFixture, Serial)(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivoting(pcd, radii);
+    }
+}
+
+BENCHMARK_REGISTER_F(BallPivotingFixture, Serial)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(BallPivotingFixture, Parallel)(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivotingParallel(pcd,
+                                                                         radii);
+    }
+}
+
+BENCHMARK_REGISTER_F(BallPivotingFixture, Parallel)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -177,5 +178,45 @@ static void BM_TestPCGrid0_Args(benchmark::internal::Benchmark *b) {
 
 BENCHMARK(BM_TestPCGrid0)->MinTime(0.1)->Apply(BM_TestPCGrid0_Args);
 
+// Reading PLY files with t::io. Binary files go through the bulk reader, ASCII
+// files through the per-value rply callbacks.
+static void BM_TReadPointCloudPLY(::benchmark::State &state) {
+    const bool write_ascii = state.range(0) != 0;
+    const int64_t size = state.range(1);
+    const std::string filename = write_ascii ? "test_ta.ply" : "test_tb.ply";
+
+    std::vector<float> points(size * 3);
+    std::vector<float> normals(size * 3);
+    std::vector<uint8_t> colors(size * 3);
+    for (int64_t i = 0; i < size * 3; ++i) {
+        points[i] = static_cast<float>(std::sin(i * .8969920581) * 1000.);
+        normals[i] = static_cast<float>(std::sin(i * .4472367685));
+        colors[i] = static_cast<uint8_t>(i % 256);
+    }
+    t::geometry::PointCloud pc(
+            core::Tensor(points, {size, 3}, core::Float32));
+    pc.SetPointNormals(core::Tensor(normals, {size, 3}, core::Float32));
+    pc.SetPointColors(core::Tensor(colors, {size, 3}, core::UInt8));
+    if (!t::io::WritePointCloud(filename, pc, {write_ascii, false, false})) {
+        utility::LogError("Failed to write to {}", filename);
+    }
+
+    for (auto _ : state) {
+        t::geometry::PointCloud pc2;
+        if (!t::io::ReadPointCloud(filename, pc2,
+                                   {"auto", false, false, false})) {
+            utility::LogError("Failed to read from {}", filename);
+        }
+        if (pc2.GetPoints().GetLength() != size) {
+            utility::LogError("Read {} points, expected {}",
+                              pc2.GetPoints().GetLength(), size);
+        }
+    }
+}
+
+BENCHMARK(BM_TReadPointCloudPLY)
+        ->ArgsProduct({{0, 1}, {1 << 12, 1 << 16, 1 << 20}})
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace benchmarks
 }  // namespace open3d
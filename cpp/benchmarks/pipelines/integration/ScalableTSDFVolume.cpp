@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <benchmark/benchmark.h>
+
+#include <iomanip>
+#include <sstream>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+
+namespace open3d {
+namespace pipelines {
+namespace integration {
+
+static std::vector<std::shared_ptr<geometry::RGBDImage>> ReadRGBDImages(
+        size_t num_images) {
+    std::vector<std::shared_ptr<geometry::RGBDImage>> rgbd_images;
+    for (size_t i = 0; i < num_images; ++i) {
+        std::ostringstream color_path, depth_path;
+        color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
+                   << std::setw(5) << i << ".jpg";
+        depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
+                   << std::setw(5) << i << ".png";
+        geometry::Image color, depth;
+        io::ReadImage(color_path.str(), color);
+        io::ReadImage(depth_path.str(), depth);
+        rgbd_images.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, /*depth_scale*/ 1000.0, /*depth_trunc*/ 4.0,
+                /*convert_rgb_to_intensity*/ false));
+    }
+    return rgbd_images;
+}
+
+static std::shared_ptr<ScalableTSDFVolume> IntegrateRGBDImages(
+        double voxel_length) {
+    camera::PinholeCameraTrajectory trajectory;
+    io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory);
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    const auto rgbd_images = ReadRGBDImages(trajectory.parameters_.size());
+
+    auto volume = std::make_shared<ScalableTSDFVolume>(
+            voxel_length, 0.04, TSDFVolumeColorType::RGB8);
+    for (size_t i = 0; i < rgbd_images.size(); ++i) {
+        volume->Integrate(*rgbd_images[i], intrinsic,
+                          trajectory.parameters_[i].extrinsic_);
+    }
+    return volume;
+}
+
+static void Integrate(benchmark::State& state, double voxel_length) {
+    camera::PinholeCameraTrajectory trajectory;
+    io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory);
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    const auto rgbd_images = ReadRGBDImages(trajectory.parameters_.size());
+
+    for (auto _ : state) {
+        ScalableTSDFVolume volume(voxel_length, 0.04,
+                                  TSDFVolumeColorType::RGB8);
+        for (size_t i = 0; i < rgbd_images.size(); ++i) {
+            volume.Integrate(*rgbd_images[i], intrinsic,
+                             trajectory.parameters_[i].extrinsic_);
+        }
+    }
+}
+
+static void ExtractTriangleMesh(benchmark::State& state, double voxel_length) {
+    const auto volume = IntegrateRGBDImages(voxel_length);
+    for (auto _ : state) {
+        volume->ExtractTriangleMesh();
+    }
+}
+
+static void ExtractPointCloud(benchmark::State& state, double voxel_length) {
+    const auto volume = IntegrateRGBDImages(voxel_length);
+    for (auto _ : state) {
+        volume->ExtractPointCloud();
+    }
+}
+
+BENCHMARK_CAPTURE(Integrate, 4_512, 4.0 / 512)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Integrate, 4_1024, 4.0 / 1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ExtractTriangleMesh, 4_512, 4.0 / 512)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ExtractTriangleMesh, 4_1024, 4.0 / 1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ExtractPointCloud, 4_512, 4.0 / 512)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ExtractPointCloud, 4_1024, 4.0 / 1024)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace integration
+}  // namespace pipelines
+}  // namespace open3d
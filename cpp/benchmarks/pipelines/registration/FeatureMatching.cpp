@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/FeatureMatching.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/pipelines/registration/Feature.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+// Synthetic FPFH-like features: 33 dimensions drawn around a few hundred
+// centers, so that the inverted file index has structure to exploit.
+static Feature ClusteredFeatures(int num, unsigned seed) {
+    const int dim = 33;
+    const int num_clusters = 200;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> center_dist(0.0, 100.0);
+    Eigen::MatrixXd centers(dim, num_clusters);
+    for (int c = 0; c < num_clusters; c++) {
+        for (int d = 0; d < dim; d++) {
+            centers(d, c) = center_dist(rng);
+        }
+    }
+    rng.seed(seed);
+    std::uniform_int_distribution<int> cluster_dist(0, num_clusters - 1);
+    std::normal_distribution<double> noise(0.0, 5.0);
+    Feature feature;
+    feature.Resize(dim, num);
+    for (int i = 0; i < num; i++) {
+        const int c = cluster_dist(rng);
+        for (int d = 0; d < dim; d++) {
+            feature.data_(d, i) = centers(d, c) + noise(rng);
+        }
+    }
+    return feature;
+}
+
+static void BenchmarkFeatureMatching(benchmark::State& state,
+                                     const FeatureMatchingMethod& method) {
+    const int num_features = static_cast<int>(state.range(0));
+    const Feature target = ClusteredFeatures(num_features, 1);
+    const Feature query = ClusteredFeatures(num_features, 2);
+    const FeatureMatchingOption option(method);
+
+    std::vector<int> matches;
+    for (auto _ : state) {
+        const FeatureMatcher matcher(target, option);
+        matches = matcher.Match(query);
+    }
+
+    // Recall of the nearest neighbor against the exact search.
+    const std::vector<int> exact_matches =
+            FeatureMatcher(target, FeatureMatchingOption(
+                                           FeatureMatchingMethod::BruteForce))
+                    .Match(query);
+    int num_correct = 0;
+    for (size_t i = 0; i < matches.size(); i++) {
+        num_correct += matches[i] == exact_matches[i];
+    }
+    state.counters["recall"] =
+            static_cast<double>(num_correct) / exact_matches.size();
+}
+
+BENCHMARK_CAPTURE(BenchmarkFeatureMatching,
+                  KDTree / CPU,
+                  FeatureMatchingMethod::KDTree)
+        ->Arg(10000)
+        ->Arg(50000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkFeatureMatching,
+                  BruteForce / CPU,
+                  FeatureMatchingMethod::BruteForce)
+        ->Arg(10000)
+        ->Arg(50000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkFeatureMatching,
+                  InvertedFile / CPU,
+                  FeatureMatchingMethod::InvertedFile)
+        ->Arg(10000)
+        ->Arg(50000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
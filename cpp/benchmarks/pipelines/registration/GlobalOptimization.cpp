@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Eigen>
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
+
+// Testing parameters:
+// Number of loop closures per node. Node i is connected to nodes i + 1 (an
+// odometry edge) up to i + 1 + num_loop_closures (uncertain edges).
+static const int num_loop_closures = 3;
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+// Pose graph of a trajectory whose node poses are perturbed away from the
+// poses implied by its edges.
+static PoseGraph CreatePoseGraph(int n_nodes) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d pose_vector;
+        pose_vector << 0.001 * i, -0.002 * i, 0.003 * i, 0.05 * i, 0.01 * i,
+                -0.02 * i;
+        poses.push_back(utility::TransformVector6dToMatrix4d(pose_vector));
+    }
+
+    PoseGraph pose_graph;
+    Eigen::Vector6d noise;
+    noise << 0.02, -0.01, 0.01, 0.05, -0.05, 0.02;
+    for (int i = 0; i < n_nodes; i++) {
+        pose_graph.nodes_.emplace_back(
+                utility::TransformVector6dToMatrix4d(noise * (i % 3)) *
+                poses[i]);
+    }
+    for (int i = 0; i < n_nodes; i++) {
+        for (int step = 1; step <= 1 + num_loop_closures; step++) {
+            int j = i + step;
+            if (j >= n_nodes) break;
+            Eigen::Matrix4d transformation = poses[j].inverse() * poses[i];
+            pose_graph.edges_.emplace_back(i, j, transformation,
+                                           Eigen::Matrix6d::Identity(),
+                                           /*uncertain=*/step > 1);
+        }
+    }
+    return pose_graph;
+}
+
+static void BenchmarkGlobalOptimization(benchmark::State& state,
+                                        const GlobalOptimizationMethod& method,
+                                        int n_nodes) {
+    const PoseGraph pose_graph_init = CreatePoseGraph(n_nodes);
+    GlobalOptimizationConvergenceCriteria criteria;
+    GlobalOptimizationOption option(/*max_correspondence_distance=*/0.075,
+                                    /*edge_prune_threshold=*/0.25,
+                                    /*preference_loop_closure=*/1.0,
+                                    /*reference_node=*/0);
+    for (auto _ : state) {
+        PoseGraph pose_graph = pose_graph_init;
+        GlobalOptimization(pose_graph, method, criteria, option);
+    }
+}
+
+BENCHMARK_CAPTURE(BenchmarkGlobalOptimization,
+                  LevenbergMarquardt / 500,
+                  GlobalOptimizationLevenbergMarquardt(),
+                  500)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkGlobalOptimization,
+                  LevenbergMarquardt / 5000,
+                  GlobalOptimizationLevenbergMarquardt(),
+                  5000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkGlobalOptimization,
+                  GaussNewton / 500,
+                  GlobalOptimizationGaussNewton(),
+                  500)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkGlobalOptimization,
+                  GaussNewton / 5000,
+                  GlobalOptimizationGaussNewton(),
+                  5000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
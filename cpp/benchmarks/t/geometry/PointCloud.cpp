@@ -120,6 +120,70 @@ void Transform(benchmark::State& state, const core::Device& device) {
     }
 }
 
+void LegacySegmentPlane(benchmark::State& state, int preverification_n) {
+    auto pcd = open3d::io::CreatePointCloudFromFile(path);
+    for (auto _ : state) {
+        pcd->SegmentPlane(0.01, 3, 1000, 0.99999999, preverification_n);
+    }
+}
+
+void LegacySegmentPlanes(benchmark::State& state) {
+    auto pcd = open3d::io::CreatePointCloudFromFile(path);
+    for (auto _ : state) {
+        pcd->SegmentPlanes(0.01, 3, 1000, 10, 1000);
+    }
+}
+
+void SegmentPlane(benchmark::State& state,
+                  const core::Device& device,
+                  int preverification_n) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warm up.
+    pcd.SegmentPlane(0.01, 3, 1000, 0.99999999, preverification_n);
+
+    for (auto _ : state) {
+        pcd.SegmentPlane(0.01, 3, 1000, 0.99999999, preverification_n);
+    }
+}
+
+void SegmentPlanes(benchmark::State& state, const core::Device& device) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warm up.
+    pcd.SegmentPlanes(0.01, 3, 1000, 10, 1000);
+
+    for (auto _ : state) {
+        pcd.SegmentPlanes(0.01, 3, 1000, 10, 1000);
+    }
+}
+
+void LegacyClusterDBSCAN(benchmark::State& state, double eps) {
+    auto pcd = open3d::io::CreatePointCloudFromFile(path);
+    for (auto _ : state) {
+        pcd->ClusterDBSCAN(eps, 10);
+    }
+}
+
+void ClusterDBSCAN(benchmark::State& state,
+                   const core::Device& device,
+                   double eps) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warm up.
+    pcd.ClusterDBSCAN(eps, 10);
+
+    for (auto _ : state) {
+        pcd.ClusterDBSCAN(eps, 10);
+    }
+}
+
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -180,6 +244,44 @@ BENCHMARK_CAPTURE(Transform, CUDA, core::Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+BENCHMARK_CAPTURE(LegacySegmentPlane, Legacy, 0)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacySegmentPlane, Legacy_Preverification, 1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(LegacySegmentPlanes)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentPlane, CPU, core::Device("CPU:0"), 0)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentPlane,
+                  CPU_Preverification,
+                  core::Device("CPU:0"),
+                  1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentPlanes, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SegmentPlane, CUDA, core::Device("CUDA:0"), 0)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentPlanes, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+BENCHMARK_CAPTURE(LegacyClusterDBSCAN, Legacy_0_02, 0.02)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacyClusterDBSCAN, Legacy_0_05, 0.05)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN, CPU_0_02, core::Device("CPU:0"), 0.02)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN, CPU_0_05, core::Device("CPU:0"), 0.05)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ClusterDBSCAN, CUDA_0_02, core::Device("CUDA:0"), 0.02)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN, CUDA_0_05, core::Device("CUDA:0"), 0.05)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
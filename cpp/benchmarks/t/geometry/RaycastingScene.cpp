@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const int kWidth = 640;
+static const int kHeight = 480;
+static const int64_t kNumQueryPoints = 100000;
+
+static std::shared_ptr<RaycastingScene> CreateSphereScene() {
+    auto scene = std::make_shared<RaycastingScene>();
+    TriangleMesh mesh = TriangleMesh::FromLegacyTriangleMesh(
+            *open3d::geometry::TriangleMesh::CreateSphere(1.0, 200));
+    scene->AddTriangles(mesh.GetVertices().To(core::Float32),
+                        mesh.GetTriangles().To(core::UInt32));
+    return scene;
+}
+
+static core::Tensor RandomQueryPoints() {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-1.5f, 1.5f);
+    core::Tensor points({kNumQueryPoints, 3}, core::Float32);
+    float* points_ptr = points.GetDataPtr<float>();
+    for (int64_t i = 0; i < 3 * kNumQueryPoints; ++i) {
+        points_ptr[i] = dist(rng);
+    }
+    return points;
+}
+
+// Rays of a {height, width, 6} pinhole image are traced in coherent packets,
+// while the flattened {height * width, 6} rays are traced one by one.
+void CastRays(benchmark::State& state, bool coherent) {
+    auto scene = CreateSphereScene();
+    core::Tensor rays = RaycastingScene::CreateRaysPinhole(
+            60, core::Tensor::Init<float>({0, 0, 0}),
+            core::Tensor::Init<float>({2, 1, 1}),
+            core::Tensor::Init<float>({0, 0, 1}), kWidth, kHeight);
+    if (!coherent) {
+        rays = rays.Reshape({kHeight * kWidth, 6});
+    }
+
+    // Warm up, this also builds the acceleration structure.
+    auto result = scene->CastRays(rays);
+    (void)result;
+
+    for (auto _ : state) {
+        scene->CastRays(rays);
+    }
+}
+
+void ComputeClosestPoints(benchmark::State& state) {
+    auto scene = CreateSphereScene();
+    core::Tensor query_points = RandomQueryPoints();
+
+    // Warm up.
+    auto result = scene->ComputeClosestPoints(query_points);
+    (void)result;
+
+    for (auto _ : state) {
+        scene->ComputeClosestPoints(query_points);
+    }
+}
+
+void ComputeSignedDistance(benchmark::State& state, bool use_winding_number) {
+    auto scene = CreateSphereScene();
+    core::Tensor query_points = RandomQueryPoints();
+
+    // Warm up.
+    core::Tensor result =
+            scene->ComputeSignedDistance(query_points, use_winding_number);
+    (void)result;
+
+    for (auto _ : state) {
+        scene->ComputeSignedDistance(query_points, use_winding_number);
+    }
+}
+
+void ComputeOccupancy(benchmark::State& state, bool use_winding_number) {
+    auto scene = CreateSphereScene();
+    core::Tensor query_points = RandomQueryPoints();
+
+    // Warm up.
+    core::Tensor result =
+            scene->ComputeOccupancy(query_points, use_winding_number);
+    (void)result;
+
+    for (auto _ : state) {
+        scene->ComputeOccupancy(query_points, use_winding_number);
+    }
+}
+
+// Moves a small mesh in a large static scene. The BVH of the static mesh is
+// not rebuilt.
+void SetGeometryTransform(benchmark::State& state) {
+    auto scene = CreateSphereScene();
+    TriangleMesh mesh = TriangleMesh::FromLegacyTriangleMesh(
+            *open3d::geometry::TriangleMesh::CreateSphere(0.1, 20));
+    uint32_t geom_id =
+            scene->AddTriangles(mesh.GetVertices().To(core::Float32),
+                                mesh.GetTriangles().To(core::UInt32));
+    core::Tensor rays = core::Tensor::Init<float>({{0, 0, 0, 1, 0, 0}});
+    core::Tensor transformation = core::Tensor::Eye(4, core::Float64, {});
+
+    // Warm up.
+    scene->SetGeometryTransform(geom_id, transformation);
+    auto result = scene->CastRays(rays);
+    (void)result;
+
+    double x = 0;
+    for (auto _ : state) {
+        x += 1e-3;
+        transformation[0][3] = x;
+        scene->SetGeometryTransform(geom_id, transformation);
+        // Commits the scene.
+        scene->CastRays(rays);
+    }
+}
+
+// Baseline for SetGeometryTransform, which builds the whole scene.
+void RebuildScene(benchmark::State& state) {
+    for (auto _ : state) {
+        auto scene = CreateSphereScene();
+        scene->CastRays(core::Tensor::Init<float>({{0, 0, 0, 1, 0, 0}}));
+    }
+}
+
+BENCHMARK_CAPTURE(CastRays, Coherent, true)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CastRays, Incoherent, false)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(ComputeClosestPoints)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ComputeSignedDistance, RayParity, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeSignedDistance, WindingNumber, true)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ComputeOccupancy, RayParity, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeOccupancy, WindingNumber, true)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(SetGeometryTransform)->Unit(benchmark::kMillisecond);
+BENCHMARK(RebuildScene)->Unit(benchmark::kMillisecond);
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/VoxelGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static open3d::geometry::PointCloud RandomPointCloud(size_t num_points) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    open3d::geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d(dist(rng), dist(rng), dist(rng));
+        pcd.colors_[i] = Eigen::Vector3d(dist(rng), dist(rng), dist(rng));
+    }
+    return pcd;
+}
+
+static const size_t kNumPoints = 1000000;  // 1M
+static const double kVoxelSize = 0.01;
+
+void LegacyCreateFromPointCloud(benchmark::State& state) {
+    open3d::geometry::PointCloud pcd = RandomPointCloud(kNumPoints);
+    for (auto _ : state) {
+        open3d::geometry::VoxelGrid::CreateFromPointCloud(pcd, kVoxelSize);
+    }
+}
+
+void CreateFromPointCloud(benchmark::State& state,
+                          const core::Device& device,
+                          const core::HashmapBackend& backend) {
+    PointCloud pcd = PointCloud::FromLegacyPointCloud(
+            RandomPointCloud(kNumPoints), core::Float32, device);
+
+    // Warm up.
+    VoxelGrid voxel_grid =
+            VoxelGrid::CreateFromPointCloud(pcd, kVoxelSize, backend);
+    (void)voxel_grid;
+
+    for (auto _ : state) {
+        VoxelGrid::CreateFromPointCloud(pcd, kVoxelSize, backend);
+    }
+}
+
+void LegacyCheckIfIncluded(benchmark::State& state) {
+    auto voxel_grid = open3d::geometry::VoxelGrid::CreateFromPointCloud(
+            RandomPointCloud(kNumPoints), kVoxelSize);
+    std::vector<Eigen::Vector3d> queries = RandomPointCloud(kNumPoints).points_;
+    for (auto _ : state) {
+        voxel_grid->CheckIfIncluded(queries);
+    }
+}
+
+void CheckIfIncluded(benchmark::State& state,
+                     const core::Device& device,
+                     const core::HashmapBackend& backend) {
+    VoxelGrid voxel_grid = VoxelGrid::CreateFromPointCloud(
+            PointCloud::FromLegacyPointCloud(RandomPointCloud(kNumPoints),
+                                             core::Float32, device),
+            kVoxelSize, backend);
+    core::Tensor queries = core::eigen_converter::EigenVector3dVectorToTensor(
+            RandomPointCloud(kNumPoints).points_, core::Float32, device);
+
+    // Warm up.
+    core::Tensor included = voxel_grid.CheckIfIncluded(queries);
+    (void)included;
+
+    for (auto _ : state) {
+        voxel_grid.CheckIfIncluded(queries);
+    }
+}
+
+void LegacyCreateFromTriangleMesh(benchmark::State& state) {
+    auto mesh = open3d::geometry::TriangleMesh::CreateSphere(1.0, 40);
+    for (auto _ : state) {
+        open3d::geometry::VoxelGrid::CreateFromTriangleMesh(*mesh, 0.05);
+    }
+}
+
+void CreateFromTriangleMesh(benchmark::State& state,
+                            const core::Device& device) {
+    TriangleMesh mesh = TriangleMesh::FromLegacyTriangleMesh(
+            *open3d::geometry::TriangleMesh::CreateSphere(1.0, 40),
+            core::Float32, core::Int64, device);
+
+    // Warm up.
+    VoxelGrid voxel_grid = VoxelGrid::CreateFromTriangleMesh(mesh, 0.05);
+    (void)voxel_grid;
+
+    for (auto _ : state) {
+        VoxelGrid::CreateFromTriangleMesh(mesh, 0.05);
+    }
+}
+
+BENCHMARK(LegacyCreateFromPointCloud)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CreateFromPointCloud,
+                  CPU,
+                  core::Device("CPU:0"),
+                  core::HashmapBackend::TBB)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(LegacyCheckIfIncluded)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CheckIfIncluded,
+                  CPU,
+                  core::Device("CPU:0"),
+                  core::HashmapBackend::TBB)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(LegacyCreateFromTriangleMesh)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CreateFromTriangleMesh, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(CreateFromPointCloud,
+                  CUDA,
+                  core::Device("CUDA:0"),
+                  core::HashmapBackend::Slab)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CheckIfIncluded,
+                  CUDA,
+                  core::Device("CUDA:0"),
+                  core::HashmapBackend::Slab)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CreateFromTriangleMesh, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+static const std::string source_pointcloud_filename =
+        std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_0.pcd";
+static const std::string target_pointcloud_filename =
+        std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_1.pcd";
+
+static const double voxel_size = 0.05;
+static const double feature_radius = 0.25;
+static const int feature_max_nn = 100;
+
+static geometry::PointCloud LoadDownsampledPointCloud(
+        const std::string &filename, const core::Device &device) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(filename, pcd, {"auto", false, false, true});
+    return pcd.VoxelDownSample(voxel_size).To(device);
+}
+
+static void BenchmarkLegacyComputeFPFHFeature(benchmark::State &state) {
+    const open3d::geometry::PointCloud pcd =
+            LoadDownsampledPointCloud(source_pointcloud_filename,
+                                      core::Device("CPU:0"))
+                    .ToLegacyPointCloud();
+    const open3d::geometry::KDTreeSearchParamHybrid search_param(
+            feature_radius, feature_max_nn);
+
+    for (auto _ : state) {
+        open3d::pipelines::registration::ComputeFPFHFeature(pcd,
+                                                            search_param);
+    }
+}
+
+static void BenchmarkComputeFPFHFeature(benchmark::State &state,
+                                        const core::Device &device) {
+    const geometry::PointCloud pcd =
+            LoadDownsampledPointCloud(source_pointcloud_filename, device);
+
+    // Warm up.
+    core::Tensor fpfh = ComputeFPFHFeature(pcd, feature_radius, feature_max_nn);
+    for (auto _ : state) {
+        fpfh = ComputeFPFHFeature(pcd, feature_radius, feature_max_nn);
+    }
+}
+
+static void BenchmarkRegistrationRANSACBasedOnFeatureMatching(
+        benchmark::State &state, const core::Device &device) {
+    const geometry::PointCloud source =
+            LoadDownsampledPointCloud(source_pointcloud_filename, device);
+    const geometry::PointCloud target =
+            LoadDownsampledPointCloud(target_pointcloud_filename, device);
+    const core::Tensor source_fpfh =
+            ComputeFPFHFeature(source, feature_radius, feature_max_nn);
+    const core::Tensor target_fpfh =
+            ComputeFPFHFeature(target, feature_radius, feature_max_nn);
+
+    for (auto _ : state) {
+        RegistrationRANSACBasedOnFeatureMatching(
+                source, target, source_fpfh, target_fpfh, true,
+                1.5 * voxel_size, 3, 0.9,
+                RANSACConvergenceCriteria(100000, 0.999));
+    }
+}
+
+BENCHMARK(BenchmarkLegacyComputeFPFHFeature)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkComputeFPFHFeature, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(BenchmarkComputeFPFHFeature, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationRANSACBasedOnFeatureMatching,
+                  CPU,
+                  core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -210,6 +210,75 @@ BENCHMARK_CAPTURE(BenchmarkRegistrationICP,
         ->Unit(benchmark::kMillisecond);
 #endif
 
+static void BenchmarkRegistrationMultiScaleICP(benchmark::State& state,
+                                               const core::Device& device,
+                                               bool use_context) {
+    geometry::PointCloud source(device), target(device);
+
+    // Downsampling is part of the multi-scale registration.
+    std::tie(source, target) = LoadTensorPointCloudFromFile(
+            source_pointcloud_filename, target_pointcloud_filename, -1,
+            core::Float32, device);
+
+    const std::vector<double> voxel_sizes = {0.05, 0.025, 0.0125};
+    const std::vector<double> max_correspondence_distances = {0.1, 0.05,
+                                                              0.025};
+    const std::vector<ICPConvergenceCriteria> criteria_list(
+            voxel_sizes.size(),
+            ICPConvergenceCriteria(relative_fitness, relative_rmse, 10));
+    const TransformationEstimationPointToPlane estimation;
+
+    core::Tensor init_trans =
+            core::Tensor(initial_transform_flat, {4, 4}, core::Float32, device)
+                    .To(core::Float64);
+
+    // The context is built once, as for frame-to-map odometry where the
+    // same target is used for many frames.
+    MultiScaleICPContext context(target, voxel_sizes,
+                                 max_correspondence_distances);
+    RegistrationResult reg_result(init_trans);
+
+    // Warm up.
+    reg_result = context.RegisterICP(source, criteria_list, init_trans,
+                                     estimation);
+    for (auto _ : state) {
+        if (use_context) {
+            reg_result = context.RegisterICP(source, criteria_list,
+                                             init_trans, estimation);
+        } else {
+            reg_result = RegistrationMultiScaleICP(
+                    source, target, voxel_sizes, criteria_list,
+                    max_correspondence_distances, init_trans, estimation);
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationMultiScaleICP,
+                  Uncached / CPU,
+                  core::Device("CPU:0"),
+                  false)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationMultiScaleICP,
+                  Cached / CPU,
+                  core::Device("CPU:0"),
+                  true)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(BenchmarkRegistrationMultiScaleICP,
+                  Uncached / CUDA,
+                  core::Device("CUDA:0"),
+                  false)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationMultiScaleICP,
+                  Cached / CUDA,
+                  core::Device("CUDA:0"),
+                  true)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
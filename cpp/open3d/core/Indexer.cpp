@@ -400,6 +400,25 @@ int64_t Indexer::NumWorkloads() const {
     return num_workloads;
 }
 
+bool Indexer::IsContiguousInWorkloadOrder(const TensorRef& tr) const {
+    for (int64_t i = 0; i < ndims_; ++i) {
+        if (master_shape_[i] > 1 &&
+            tr.byte_strides_[i] != master_strides_[i] * tr.dtype_byte_size_) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Indexer::IsBroadcastedScalar(const TensorRef& tr) const {
+    for (int64_t i = 0; i < ndims_; ++i) {
+        if (master_shape_[i] > 1 && tr.byte_strides_[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 int64_t Indexer::NumOutputElements() const {
     // All outputs have the same shape, so  it's okay to use outputs_[0].
     int64_t num_output_elements = 1;
@@ -386,6 +386,24 @@ public:
         return GetOutput(0);
     }
 
+    /// Returns true if the \p i -th input is stored contiguously in the order
+    /// of the workloads, i.e. workload w reads element w of the input.
+    bool IsInputContiguous(int64_t i) const {
+        return IsContiguousInWorkloadOrder(GetInput(i));
+    }
+
+    /// Returns true if the \p i -th input is broadcasted from a single
+    /// element, i.e. all workloads read the same element.
+    bool IsInputScalar(int64_t i) const {
+        return IsBroadcastedScalar(GetInput(i));
+    }
+
+    /// Returns true if the \p i -th output is stored contiguously in the order
+    /// of the workloads, i.e. workload w writes element w of the output.
+    bool IsOutputContiguous(int64_t i = 0) const {
+        return IsContiguousInWorkloadOrder(GetOutput(i));
+    }
+
     /// Returns true if the \p dim -th dimension is reduced.
     bool IsReductionDim(int64_t dim) const {
         // All outputs have the same shape and reduction dims. Even if they
@@ -469,6 +487,10 @@ protected:
                                   const int64_t* src_shape,
                                   const SizeVector& reduction_dims);
 
+    bool IsContiguousInWorkloadOrder(const TensorRef& tr) const;
+
+    bool IsBroadcastedScalar(const TensorRef& tr) const;
+
     /// Get data pointer from a TensorRef with \p workload_idx.
     /// Note: can be optimized by computing all input ptrs and output ptr
     /// together.
@@ -105,8 +105,13 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
                               std::shared_ptr<DeviceMemoryManager>,
                               utility::hash_enum_class>
             map_device_type_to_memory_manager = {
+#ifdef BUILD_CACHED_CPU_MANAGER
+                    {Device::DeviceType::CPU,
+                     std::make_shared<CPUCachedMemoryManager>()},
+#else
                     {Device::DeviceType::CPU,
                      std::make_shared<CPUMemoryManager>()},
+#endif  // BUILD_CACHED_CPU_MANAGER
 #ifdef BUILD_CUDA_MODULE
 #ifdef BUILD_CACHED_CUDA_MANAGER
                     {Device::DeviceType::CUDA,
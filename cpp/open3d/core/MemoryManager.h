@@ -45,7 +45,9 @@ class DeviceMemoryManager;
 ///
 /// The memory managers are dispatched as follows:
 ///
-/// DeviceType = CPU : CPUMemoryManager
+/// DeviceType = CPU :
+///   BUILD_CACHED_CPU_MANAGER = ON : CPUCachedMemoryManager
+///   Otherwise :                     CPUMemoryManager
 /// DeviceType = CUDA :
 ///   BUILD_CACHED_CUDA_MANAGER = ON : CachedMemoryManager w/ CUDAMemoryManager
 ///   Otherwise :                      CUDAMemoryManager
@@ -175,6 +177,52 @@ public:
                 size_t num_bytes) override;
 };
 
+/// Cached memory manager for CPU devices, optimized for many small and
+/// short-lived allocations from multiple threads. MemoryManager only uses it
+/// if Open3D is built with BUILD_CACHED_CPU_MANAGER=ON (default: OFF).
+///
+/// - Allocations are rounded up to size classes (four classes per power of
+/// two, i.e. at most 25% overhead) and returned 64-byte aligned.
+///
+/// - Freed blocks are kept in per-thread free lists, so allocations and
+/// deallocations that hit the thread-local cache are lock-free. Blocks may be
+/// freed by another thread than the one that allocated them.
+///
+/// - Per-thread free lists are bounded per size class and in total (16 MiB);
+/// surplus blocks and the blocks of exiting threads are moved to a
+/// mutex-protected central cache which is shared between all threads. The
+/// central cache is bounded as well, blocks beyond its limit are returned to
+/// the system.
+///
+/// - Allocations larger than the largest size class are not cached. On Linux,
+/// allocations of at least 2 MiB are backed by transparent huge pages.
+///
+/// - Cached blocks are returned to the system by \p ReleaseCache, or
+/// automatically if a direct allocation fails.
+class CPUCachedMemoryManager : public DeviceMemoryManager {
+public:
+    /// Allocates memory of \p byte_size bytes on device \p device and returns a
+    /// pointer to the beginning of the allocated memory block.
+    void* Malloc(size_t byte_size, const Device& device) override;
+
+    /// Frees previously allocated memory at address \p ptr on device \p device.
+    void Free(void* ptr, const Device& device) override;
+
+    /// Copies \p num_bytes bytes of memory at address \p src_ptr on device
+    /// \p src_device to address \p dst_ptr on device \p dst_device.
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Frees all blocks in the central cache and in the cache of the calling
+    /// thread. The caches of other threads are freed on their next allocation
+    /// or deallocation, or when these threads exit.
+    static void ReleaseCache();
+};
+
 #ifdef BUILD_CUDA_MODULE
 /// Direct memory manager which performs allocations and deallocations on CUDA
 /// devices via \p cudaMalloc and \p cudaFree.
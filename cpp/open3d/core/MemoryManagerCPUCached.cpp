@@ -0,0 +1,457 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Logging.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+/// Alignment of all returned pointers, one cache line.
+constexpr size_t kAlignment = 64;
+
+/// Size of the header in front of each block. Keeps the payload aligned.
+constexpr size_t kHeaderSize = kAlignment;
+
+/// Blocks of at least this size are backed by transparent huge pages.
+constexpr size_t kHugePageSize = size_t(1) << 21;
+
+/// Size classes: 64 bytes, then four classes per power of two up to 16 MiB.
+constexpr size_t kMinClassSize = 64;
+constexpr int kMinClassLog2 = 6;
+constexpr int kMaxClassLog2 = 24;
+constexpr int kNumSizeClasses = 1 + (kMaxClassLog2 - kMinClassLog2) * 4;
+
+/// Maximum number of bytes a thread keeps per size class before surplus
+/// blocks are moved to the central cache. At least one block is allowed.
+constexpr size_t kMaxThreadCacheBytesPerClass = size_t(4) << 20;
+
+/// Maximum number of bytes a thread keeps over all size classes. When it is
+/// exceeded, the thread cache is shrunk to half of it, largest blocks first.
+constexpr size_t kMaxThreadCacheBytes = size_t(16) << 20;
+
+/// Maximum number of bytes in the central cache. Blocks returned beyond this
+/// limit are freed to the system.
+constexpr size_t kMaxCentralCacheBytes = size_t(64) << 20;
+
+/// Marks blocks that are not cached.
+constexpr int kUncachedClass = -1;
+
+/// Header stored in front of every block. The payload starts kHeaderSize
+/// bytes after the header.
+struct BlockHeader {
+    /// Pointer returned by the system allocation.
+    void* raw_ptr_;
+    /// Payload size of the block, i.e. the class size for cached blocks.
+    size_t byte_size_;
+    /// Size class index or kUncachedClass.
+    int size_class_;
+};
+static_assert(sizeof(BlockHeader) <= kHeaderSize,
+              "BlockHeader does not fit in kHeaderSize.");
+
+BlockHeader* GetHeader(void* ptr) {
+    return reinterpret_cast<BlockHeader*>(static_cast<char*>(ptr) -
+                                          kHeaderSize);
+}
+
+/// Returns the index of the size class for \p byte_size and sets
+/// \p class_size. Returns kUncachedClass if \p byte_size is too large.
+int GetSizeClass(size_t byte_size, size_t& class_size) {
+    if (byte_size <= kMinClassSize) {
+        class_size = kMinClassSize;
+        return 0;
+    }
+    // 2^p < byte_size <= 2^(p + 1).
+    int p = 0;
+    for (size_t s = byte_size - 1; s > 1; s >>= 1) {
+        ++p;
+    }
+    if (p >= kMaxClassLog2) {
+        class_size = byte_size;
+        return kUncachedClass;
+    }
+    const size_t base = size_t(1) << p;
+    const size_t step = base >> 2;
+    const size_t k = (byte_size - base + step - 1) / step;  // 1, ..., 4.
+    class_size = base + k * step;
+    return 1 + (p - kMinClassLog2) * 4 + int(k) - 1;
+}
+
+/// Inverse of GetSizeClass().
+size_t GetClassSize(int size_class) {
+    if (size_class == 0) {
+        return kMinClassSize;
+    }
+    const size_t base = size_t(1) << (kMinClassLog2 + (size_class - 1) / 4);
+    const size_t k = size_t((size_class - 1) % 4) + 1;
+    return base + k * (base >> 2);
+}
+
+/// Number of blocks of a size class a thread keeps at most.
+size_t GetMaxThreadCacheBlocks(int size_class) {
+    return std::max<size_t>(
+            kMaxThreadCacheBytesPerClass / GetClassSize(size_class), 1);
+}
+
+/// Allocates a block with a header from the system. Returns nullptr on
+/// failure.
+void* SystemMalloc(size_t byte_size, int size_class) {
+    void* raw_ptr = nullptr;
+    char* ptr = nullptr;
+    bool huge = false;
+#ifdef __linux__
+    if (byte_size + kHeaderSize >= kHugePageSize) {
+        const size_t raw_size =
+                (byte_size + kHeaderSize + kHugePageSize - 1) / kHugePageSize *
+                kHugePageSize;
+        if (posix_memalign(&raw_ptr, kHugePageSize, raw_size) != 0) {
+            return nullptr;
+        }
+        // Only a hint, failures are not an error.
+        madvise(raw_ptr, raw_size, MADV_HUGEPAGE);
+        ptr = static_cast<char*>(raw_ptr) + kHeaderSize;
+        huge = true;
+    }
+#endif
+    if (!huge) {
+        // Over-allocate to align the payload manually. This avoids
+        // platform-specific aligned allocation and deallocation functions.
+        raw_ptr = std::malloc(byte_size + kHeaderSize + kAlignment - 1);
+        if (raw_ptr == nullptr) {
+            return nullptr;
+        }
+        const uintptr_t payload =
+                (reinterpret_cast<uintptr_t>(raw_ptr) + kHeaderSize +
+                 kAlignment - 1) /
+                kAlignment * kAlignment;
+        ptr = reinterpret_cast<char*>(payload);
+    }
+    BlockHeader* header = GetHeader(ptr);
+    header->raw_ptr_ = raw_ptr;
+    header->byte_size_ = byte_size;
+    header->size_class_ = size_class;
+    return ptr;
+}
+
+void SystemFree(void* ptr) { std::free(GetHeader(ptr)->raw_ptr_); }
+
+/// Intrusive singly linked list of free blocks. The link is stored in the
+/// first bytes of the payload.
+struct FreeList {
+    void* head_ = nullptr;
+    size_t size_ = 0;
+
+    void Push(void* ptr) {
+        *static_cast<void**>(ptr) = head_;
+        head_ = ptr;
+        ++size_;
+    }
+
+    void* Pop() {
+        void* ptr = head_;
+        if (ptr != nullptr) {
+            head_ = *static_cast<void**>(ptr);
+            --size_;
+        }
+        return ptr;
+    }
+
+    /// Moves the first \p count blocks to \p other.
+    void MoveTo(FreeList& other, size_t count) {
+        for (size_t i = 0; i < count && head_ != nullptr; ++i) {
+            other.Push(Pop());
+        }
+    }
+
+    void ReleaseAll() {
+        while (void* ptr = Pop()) {
+            SystemFree(ptr);
+        }
+    }
+};
+
+/// Cache shared by all threads, protected by a mutex.
+class CentralCache {
+public:
+    static CentralCache& GetInstance() {
+        // Ensure the static Logger instance is destroyed after the cache.
+        utility::Logger::GetInstance();
+        static CentralCache instance;
+        return instance;
+    }
+
+    ~CentralCache() { ReleaseAll(); }
+
+    CentralCache(const CentralCache&) = delete;
+    CentralCache& operator=(const CentralCache&) = delete;
+
+    /// Moves up to \p count blocks of class \p size_class to \p list.
+    void Fetch(int size_class, FreeList& list, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t old_size = list.size_;
+        lists_[size_class].MoveTo(list, count);
+        num_bytes_ -= (list.size_ - old_size) * GetClassSize(size_class);
+    }
+
+    /// Moves up to \p count blocks of \p list to the central cache. Blocks
+    /// that do not fit in the central cache are freed.
+    void Return(int size_class, FreeList& list, size_t count) {
+        const size_t class_size = GetClassSize(size_class);
+        size_t num_moved;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const size_t max_count =
+                    (kMaxCentralCacheBytes - num_bytes_) / class_size;
+            const size_t old_size = list.size_;
+            list.MoveTo(lists_[size_class], std::min(count, max_count));
+            num_moved = old_size - list.size_;
+            num_bytes_ += num_moved * class_size;
+        }
+        // Free the surplus outside of the lock.
+        FreeList surplus;
+        list.MoveTo(surplus, count - num_moved);
+        surplus.ReleaseAll();
+    }
+
+    void ReleaseAll() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (FreeList& list : lists_) {
+            list.ReleaseAll();
+        }
+        num_bytes_ = 0;
+    }
+
+private:
+    CentralCache() = default;
+
+    std::array<FreeList, kNumSizeClasses> lists_;
+    size_t num_bytes_ = 0;
+    std::mutex mutex_;
+};
+
+/// Incremented by ReleaseCache(). Thread caches that see a new value release
+/// their blocks on their next allocation or deallocation.
+std::atomic<uint64_t>& GetReleaseEpoch() {
+    static std::atomic<uint64_t> epoch(0);
+    return epoch;
+}
+
+/// Per-thread cache. Accessed only by its own thread, hence lock-free.
+class ThreadCache {
+public:
+    ThreadCache()
+        : central_(CentralCache::GetInstance()),
+          epoch_(GetReleaseEpoch().load(std::memory_order_relaxed)) {}
+
+    ~ThreadCache() {
+        ReleaseIfRequested();
+        for (int size_class = 0; size_class < kNumSizeClasses;
+             ++size_class) {
+            central_.Return(size_class, lists_[size_class],
+                            lists_[size_class].size_);
+        }
+    }
+
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+
+    void* Malloc(int size_class) {
+        ReleaseIfRequested();
+        FreeList& list = lists_[size_class];
+        if (list.head_ == nullptr) {
+            central_.Fetch(size_class, list,
+                           GetMaxThreadCacheBlocks(size_class) / 2 + 1);
+            num_bytes_ += list.size_ * GetClassSize(size_class);
+        }
+        void* ptr = list.Pop();
+        if (ptr != nullptr) {
+            num_bytes_ -= GetClassSize(size_class);
+        }
+        if (num_bytes_ > kMaxThreadCacheBytes) {
+            Shrink();
+        }
+        return ptr;
+    }
+
+    void Free(void* ptr, int size_class) {
+        ReleaseIfRequested();
+        FreeList& list = lists_[size_class];
+        list.Push(ptr);
+        num_bytes_ += GetClassSize(size_class);
+        const size_t max_blocks = GetMaxThreadCacheBlocks(size_class);
+        if (list.size_ > max_blocks) {
+            Return(size_class, list.size_ - max_blocks / 2);
+        }
+        if (num_bytes_ > kMaxThreadCacheBytes) {
+            Shrink();
+        }
+    }
+
+    void ReleaseAll() {
+        for (FreeList& list : lists_) {
+            list.ReleaseAll();
+        }
+        num_bytes_ = 0;
+        epoch_ = GetReleaseEpoch().load(std::memory_order_relaxed);
+    }
+
+private:
+    /// Moves up to \p count blocks of class \p size_class to the central
+    /// cache.
+    void Return(int size_class, size_t count) {
+        FreeList& list = lists_[size_class];
+        const size_t old_size = list.size_;
+        central_.Return(size_class, list, count);
+        num_bytes_ -= (old_size - list.size_) * GetClassSize(size_class);
+    }
+
+    /// Returns the largest blocks to the central cache until the thread cache
+    /// holds at most half of its byte budget.
+    void Shrink() {
+        for (int size_class = kNumSizeClasses - 1;
+             size_class >= 0 && num_bytes_ > kMaxThreadCacheBytes / 2;
+             --size_class) {
+            const size_t class_size = GetClassSize(size_class);
+            const size_t excess = num_bytes_ - kMaxThreadCacheBytes / 2;
+            Return(size_class, (excess + class_size - 1) / class_size);
+        }
+    }
+
+    void ReleaseIfRequested() {
+        if (epoch_ != GetReleaseEpoch().load(std::memory_order_relaxed)) {
+            ReleaseAll();
+        }
+    }
+
+    CentralCache& central_;
+    std::array<FreeList, kNumSizeClasses> lists_;
+    /// Number of bytes in lists_.
+    size_t num_bytes_ = 0;
+    uint64_t epoch_;
+};
+
+/// Holds the ThreadCache of the calling thread. The raw pointer is reset
+/// when the thread cache is destroyed at thread exit, so that blocks freed
+/// afterwards, e.g. by static objects, are returned to the system directly.
+class ThreadCacheHolder {
+public:
+    ThreadCacheHolder() { GetPointer() = &cache_; }
+    ~ThreadCacheHolder() { GetPointer() = nullptr; }
+
+    /// Returns nullptr if the thread cache has already been destroyed.
+    static ThreadCache* Get() {
+        static thread_local ThreadCacheHolder holder;
+        return GetPointer();
+    }
+
+private:
+    static ThreadCache*& GetPointer() {
+        static thread_local ThreadCache* ptr = nullptr;
+        return ptr;
+    }
+
+    ThreadCache cache_;
+};
+
+}  // unnamed namespace
+
+void* CPUCachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) {
+        return nullptr;
+    }
+
+    size_t class_size;
+    const int size_class = GetSizeClass(byte_size, class_size);
+    if (size_class != kUncachedClass) {
+        if (ThreadCache* cache = ThreadCacheHolder::Get()) {
+            if (void* ptr = cache->Malloc(size_class)) {
+                return ptr;
+            }
+        }
+    }
+
+    void* ptr = SystemMalloc(class_size, size_class);
+    if (ptr == nullptr) {
+        // Free cached memory and try again.
+        ReleaseCache();
+        ptr = SystemMalloc(class_size, size_class);
+    }
+    if (ptr == nullptr) {
+        utility::LogError("CPU malloc of {} bytes failed", byte_size);
+    }
+    return ptr;
+}
+
+void CPUCachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    const int size_class = GetHeader(ptr)->size_class_;
+    if (size_class != kUncachedClass) {
+        if (ThreadCache* cache = ThreadCacheHolder::Get()) {
+            cache->Free(ptr, size_class);
+            return;
+        }
+    }
+    SystemFree(ptr);
+}
+
+void CPUCachedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void CPUCachedMemoryManager::ReleaseCache() {
+    GetReleaseEpoch().fetch_add(1, std::memory_order_relaxed);
+    if (ThreadCache* cache = ThreadCacheHolder::Get()) {
+        cache->ReleaseAll();
+    }
+    CentralCache::GetInstance().ReleaseAll();
+}
+
+}  // namespace core
+}  // namespace open3d
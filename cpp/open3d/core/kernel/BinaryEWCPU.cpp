@@ -38,101 +38,92 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
-template <typename func_t>
-static void LaunchBinaryEWKernel(const Indexer& indexer, const func_t& func) {
-    cpu_launcher::ParallelFor(
-            indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
-            [&indexer, &func](int64_t i) {
-                func(indexer.GetInputPtr(0, i), indexer.GetInputPtr(1, i),
-                     indexer.GetOutputPtr(i));
-            });
-}
-
-template <typename scalar_t>
-static void CPUAddElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) +
-                                   *static_cast<const scalar_t*>(rhs);
-}
-
-template <typename scalar_t>
-static void CPUSubElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) -
-                                   *static_cast<const scalar_t*>(rhs);
-}
-
-template <typename scalar_t>
-static void CPUMulElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) *
-                                   *static_cast<const scalar_t*>(rhs);
-}
-
-template <typename scalar_t>
-static void CPUDivElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) /
-                                   *static_cast<const scalar_t*>(rhs);
-}
-
-template <typename src_t, typename dst_t>
-static void CPULogicalAndElementKernel(const void* lhs,
-                                       const void* rhs,
-                                       void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) &&
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
-
-template <typename src_t, typename dst_t>
-static void CPULogicalOrElementKernel(const void* lhs,
-                                      const void* rhs,
-                                      void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) ||
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
-
-template <typename src_t, typename dst_t>
-static void CPULogicalXorElementKernel(const void* lhs,
-                                       const void* rhs,
-                                       void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) !=
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
-
-template <typename src_t, typename dst_t>
-static void CPUGtElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) > *static_cast<const src_t*>(rhs));
-}
-
-template <typename src_t, typename dst_t>
-static void CPULtElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) < *static_cast<const src_t*>(rhs));
-}
-
-template <typename src_t, typename dst_t>
-static void CPUGeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) >= *static_cast<const src_t*>(rhs));
-}
-
-template <typename src_t, typename dst_t>
-static void CPULeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) <= *static_cast<const src_t*>(rhs));
-}
+// Defines NAME(lhs, rhs, dst, n, lhs_scalar, rhs_scalar, op), computing
+// dst[i] = op(lhs[i], rhs[i]) for i in [0, n) on contiguous arrays. At most one
+// of lhs and rhs can be a broadcasted scalar. The loops are simple enough for
+// the compiler to vectorize them with the instruction set of TARGET.
+#define OPEN3D_DEFINE_BINARY_EW_LOOP(NAME, TARGET)                        \
+    template <typename src_t, typename dst_t, typename op_t>              \
+    TARGET static void NAME(const src_t* lhs, const src_t* rhs,           \
+                            dst_t* dst, int64_t n, bool lhs_scalar,       \
+                            bool rhs_scalar, const op_t& op) {            \
+        if (lhs_scalar) {                                                 \
+            const src_t lhs_value = *lhs;                                 \
+            for (int64_t i = 0; i < n; ++i) {                             \
+                dst[i] = op(lhs_value, rhs[i]);                           \
+            }                                                             \
+        } else if (rhs_scalar) {                                          \
+            const src_t rhs_value = *rhs;                                 \
+            for (int64_t i = 0; i < n; ++i) {                             \
+                dst[i] = op(lhs[i], rhs_value);                           \
+            }                                                             \
+        } else {                                                          \
+            for (int64_t i = 0; i < n; ++i) {                             \
+                dst[i] = op(lhs[i], rhs[i]);                              \
+            }                                                             \
+        }                                                                 \
+    }
 
-template <typename src_t, typename dst_t>
-static void CPUEqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) == *static_cast<const src_t*>(rhs));
-}
+OPEN3D_DEFINE_BINARY_EW_LOOP(BinaryEWLoop, )
+#ifdef OPEN3D_CPU_ISA_DISPATCH
+OPEN3D_DEFINE_BINARY_EW_LOOP(BinaryEWLoopAVX2, OPEN3D_TARGET_AVX2)
+OPEN3D_DEFINE_BINARY_EW_LOOP(BinaryEWLoopAVX512, OPEN3D_TARGET_AVX512)
+#endif
+
+/// Computes dst = op(lhs, rhs) for every workload of \p indexer.
+///
+/// If the output is contiguous and each input is contiguous or a broadcasted
+/// scalar, the workloads are processed by the vectorized loops of
+/// OPEN3D_DEFINE_BINARY_EW_LOOP for the instruction set of
+/// cpu_launcher::GetCPUISA(). Otherwise, the offsets of each workload are
+/// computed by the indexer.
+template <typename src_t, typename dst_t, typename op_t>
+static void LaunchBinaryEWKernel(const Indexer& indexer, const op_t& op) {
+    const int64_t n = indexer.NumWorkloads();
+    const bool lhs_scalar = indexer.IsInputScalar(0);
+    const bool rhs_scalar = indexer.IsInputScalar(1);
+    if (indexer.IsOutputContiguous() && !(lhs_scalar && rhs_scalar) &&
+        (lhs_scalar || indexer.IsInputContiguous(0)) &&
+        (rhs_scalar || indexer.IsInputContiguous(1))) {
+        const src_t* lhs = reinterpret_cast<const src_t*>(
+                indexer.GetInput(0).data_ptr_);
+        const src_t* rhs = reinterpret_cast<const src_t*>(
+                indexer.GetInput(1).data_ptr_);
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutput().data_ptr_);
+        const cpu_launcher::CPUISA isa = cpu_launcher::GetCPUISA();
+        cpu_launcher::ParallelForRange(
+                n, cpu_launcher::SMALL_OP_GRAIN_SIZE,
+                [&](int64_t begin, int64_t end) {
+                    const src_t* lhs_begin = lhs_scalar ? lhs : lhs + begin;
+                    const src_t* rhs_begin = rhs_scalar ? rhs : rhs + begin;
+#ifdef OPEN3D_CPU_ISA_DISPATCH
+                    if (isa == cpu_launcher::CPUISA::AVX512) {
+                        BinaryEWLoopAVX512(lhs_begin, rhs_begin, dst + begin,
+                                           end - begin, lhs_scalar, rhs_scalar,
+                                           op);
+                        return;
+                    } else if (isa == cpu_launcher::CPUISA::AVX2) {
+                        BinaryEWLoopAVX2(lhs_begin, rhs_begin, dst + begin,
+                                         end - begin, lhs_scalar, rhs_scalar,
+                                         op);
+                        return;
+                    }
+#endif
+                    BinaryEWLoop(lhs_begin, rhs_begin, dst + begin,
+                                 end - begin, lhs_scalar, rhs_scalar, op);
+                });
+        return;
+    }
 
-template <typename src_t, typename dst_t>
-static void CPUNeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) != *static_cast<const src_t*>(rhs));
+    cpu_launcher::ParallelFor(
+            n, cpu_launcher::SMALL_OP_GRAIN_SIZE,
+            [&indexer, &op](int64_t i) {
+                *reinterpret_cast<dst_t*>(indexer.GetOutputPtr(i)) =
+                        op(*reinterpret_cast<const src_t*>(
+                                   indexer.GetInputPtr(0, i)),
+                           *reinterpret_cast<const src_t*>(
+                                   indexer.GetInputPtr(1, i)));
+            });
 }
 
 template <typename src_t, typename dst_t>
@@ -143,34 +134,52 @@ static void LaunchBoolBinaryEWCPUKernel(const Tensor& lhs,
                                         const Indexer& indexer) {
     switch (op_code) {
         case BinaryEWOpCode::LogicalAnd:
-            LaunchBinaryEWKernel(indexer,
-                                 CPULogicalAndElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(static_cast<bool>(a) &&
+                                          static_cast<bool>(b));
+            });
             break;
         case BinaryEWOpCode::LogicalOr:
-            LaunchBinaryEWKernel(indexer,
-                                 CPULogicalOrElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(static_cast<bool>(a) ||
+                                          static_cast<bool>(b));
+            });
             break;
         case BinaryEWOpCode::LogicalXor:
-            LaunchBinaryEWKernel(indexer,
-                                 CPULogicalXorElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(static_cast<bool>(a) !=
+                                          static_cast<bool>(b));
+            });
             break;
         case BinaryEWOpCode::Gt:
-            LaunchBinaryEWKernel(indexer, CPUGtElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(a > b);
+            });
             break;
         case BinaryEWOpCode::Lt:
-            LaunchBinaryEWKernel(indexer, CPULtElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(a < b);
+            });
             break;
         case BinaryEWOpCode::Ge:
-            LaunchBinaryEWKernel(indexer, CPUGeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(a >= b);
+            });
             break;
         case BinaryEWOpCode::Le:
-            LaunchBinaryEWKernel(indexer, CPULeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(a <= b);
+            });
             break;
         case BinaryEWOpCode::Eq:
-            LaunchBinaryEWKernel(indexer, CPUEqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(a == b);
+            });
             break;
         case BinaryEWOpCode::Ne:
-            LaunchBinaryEWKernel(indexer, CPUNeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(indexer, [](src_t a, src_t b) {
+                return static_cast<dst_t>(a != b);
+            });
             break;
         default:
             break;
@@ -211,20 +220,24 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    LaunchBinaryEWKernel(indexer,
-                                         CPUAddElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer,
+                            [](scalar_t a, scalar_t b) { return a + b; });
                     break;
                 case BinaryEWOpCode::Sub:
-                    LaunchBinaryEWKernel(indexer,
-                                         CPUSubElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer,
+                            [](scalar_t a, scalar_t b) { return a - b; });
                     break;
                 case BinaryEWOpCode::Mul:
-                    LaunchBinaryEWKernel(indexer,
-                                         CPUMulElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer,
+                            [](scalar_t a, scalar_t b) { return a * b; });
                     break;
                 case BinaryEWOpCode::Div:
-                    LaunchBinaryEWKernel(indexer,
-                                         CPUDivElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer,
+                            [](scalar_t a, scalar_t b) { return a / b; });
                     break;
                 default:
                     break;
@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPULauncher.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+#include "open3d/utility/CPUInfo.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+namespace cpu_launcher {
+
+static CPUBackend GetDefaultCPUBackend() {
+    if (const char* value = std::getenv("OPEN3D_CPU_BACKEND")) {
+        const std::string backend(value);
+        if (backend == "TBB" || backend == "tbb") {
+            return CPUBackend::TBB;
+        } else if (backend != "OpenMP" && backend != "openmp") {
+            utility::LogWarning(
+                    "Unknown OPEN3D_CPU_BACKEND {}, using OpenMP instead.",
+                    backend);
+        }
+    }
+    return CPUBackend::OpenMP;
+}
+
+static std::atomic<CPUBackend>& GetCPUBackendRef() {
+    static std::atomic<CPUBackend> backend(GetDefaultCPUBackend());
+    return backend;
+}
+
+void SetCPUBackend(CPUBackend backend) { GetCPUBackendRef() = backend; }
+
+CPUBackend GetCPUBackend() { return GetCPUBackendRef(); }
+
+static CPUISA GetBestCPUISA() {
+#ifdef OPEN3D_CPU_ISA_DISPATCH
+    const utility::CPUInfo& cpu_info = utility::CPUInfo::GetInstance();
+    if (cpu_info.SupportsAVX512()) {
+        return CPUISA::AVX512;
+    } else if (cpu_info.SupportsAVX2()) {
+        return CPUISA::AVX2;
+    }
+#endif
+    return CPUISA::Default;
+}
+
+static CPUISA GetDefaultCPUISA() {
+    if (const char* value = std::getenv("OPEN3D_CPU_ISA")) {
+        const std::string isa(value);
+        if (isa == "AVX512" || isa == "avx512") {
+            return std::min(CPUISA::AVX512, GetBestCPUISA());
+        } else if (isa == "AVX2" || isa == "avx2") {
+            return std::min(CPUISA::AVX2, GetBestCPUISA());
+        } else if (isa == "Default" || isa == "default") {
+            return CPUISA::Default;
+        }
+        utility::LogWarning("Unknown OPEN3D_CPU_ISA {}, ignored.", isa);
+    }
+    return GetBestCPUISA();
+}
+
+static std::atomic<CPUISA>& GetCPUISARef() {
+    static std::atomic<CPUISA> isa(GetDefaultCPUISA());
+    return isa;
+}
+
+void SetCPUISA(CPUISA isa) {
+    GetCPUISARef() = std::min(isa, GetBestCPUISA());
+}
+
+CPUISA GetCPUISA() { return GetCPUISARef(); }
+
+namespace detail {
+
+void ParallelForTBB(int64_t n,
+                    int64_t min_grain_size,
+                    const std::function<void(int64_t, int64_t)>& func) {
+    if (n <= 0) {
+        return;
+    }
+    // The arena limits the number of workers to the same number of threads
+    // the OpenMP backend uses. Calling execute() from a thread that is
+    // already inside the arena runs the functor directly, so nested calls
+    // share the workers of the outer call.
+    static tbb::task_arena arena(utility::EstimateMaxThreads());
+    const int64_t grain_size = std::max<int64_t>(min_grain_size, 1);
+    arena.execute([&]() {
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, n, grain_size),
+                [&func](const tbb::blocked_range<int64_t>& range) {
+                    func(range.begin(), range.end());
+                },
+                tbb::auto_partitioner());
+    });
+}
+
+}  // namespace detail
+}  // namespace cpu_launcher
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -26,11 +26,25 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 #include "open3d/utility/Parallel.h"
 
+// OPEN3D_CPU_ISA_DISPATCH is defined if functions can be compiled for other
+// instruction sets than the one of the build flags, using the
+// OPEN3D_TARGET_AVX2 and OPEN3D_TARGET_AVX512 function attributes. Such
+// functions must only be called if GetCPUISA() allows it.
+#if (defined(__GNUC__) || defined(__clang__)) && \
+        (defined(__x86_64__) || defined(__i386__))
+#define OPEN3D_CPU_ISA_DISPATCH
+#define OPEN3D_TARGET_AVX2 __attribute__((target("avx2")))
+#define OPEN3D_TARGET_AVX512 \
+    __attribute__((target("avx2,avx512f,avx512bw,avx512dq,avx512vl")))
+#endif
+
 namespace open3d {
 namespace core {
 namespace kernel {
@@ -41,6 +55,55 @@ namespace cpu_launcher {
 /// workloads are executed in serial, otherwise they are executed in parallel.
 static constexpr int64_t SMALL_OP_GRAIN_SIZE = 32767;
 
+/// CPU execution backends of ParallelFor().
+enum class CPUBackend {
+    /// `#pragma omp parallel for`. Nested calls run in serial.
+    OpenMP = 0,
+    /// TBB work-stealing task scheduler. Workloads are split adaptively and
+    /// nested calls are executed in parallel without oversubscription.
+    TBB = 1,
+};
+
+/// \brief Selects the backend used by ParallelFor() at runtime.
+///
+/// The default backend is OpenMP, unless the environment variable
+/// `OPEN3D_CPU_BACKEND` is set to `TBB` when the library is loaded.
+void SetCPUBackend(CPUBackend backend);
+
+/// Returns the backend currently used by ParallelFor().
+CPUBackend GetCPUBackend();
+
+/// Instruction sets of the vectorized CPU kernels.
+enum class CPUISA {
+    /// Instruction set enabled by the build flags.
+    Default = 0,
+    AVX2 = 1,
+    AVX512 = 2,
+};
+
+/// \brief Selects the instruction set used by the vectorized CPU kernels,
+/// e.g. the element-wise kernels on contiguous tensors.
+///
+/// The default is the best instruction set supported by the CPU, see
+/// utility::CPUInfo, unless the environment variable `OPEN3D_CPU_ISA` is set
+/// to `Default`, `AVX2` or `AVX512` when the library is loaded. Instruction
+/// sets that are not supported fall back to the best supported one.
+void SetCPUISA(CPUISA isa);
+
+/// Returns the instruction set currently used by the vectorized CPU kernels.
+CPUISA GetCPUISA();
+
+namespace detail {
+
+/// Runs `func(begin, end)` on disjoint sub-ranges covering [0, n) on the TBB
+/// task scheduler. Ranges with at most \p min_grain_size workloads are not
+/// split further.
+void ParallelForTBB(int64_t n,
+                    int64_t min_grain_size,
+                    const std::function<void(int64_t, int64_t)>& func);
+
+}  // namespace detail
+
 /// \brief Run a function in parallel on CPU.
 ///
 /// This is typically used together with cuda_launcher::ParallelFor() to
@@ -62,13 +125,22 @@ static constexpr int64_t SMALL_OP_GRAIN_SIZE = 32767;
 /// \param func The function to be executed in parallel. The function should
 /// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
 ///
-/// \note This is optimized for uniform work items, i.e. where each call to \p
-/// func takes the same time.
+/// \note With the OpenMP backend this is optimized for uniform work items,
+/// i.e. where each call to \p func takes the same time. Use the TBB backend,
+/// see SetCPUBackend(), for non-uniform work items.
 /// \note If you use a lambda function, capture only the required variables
 /// instead of all to prevent accidental race conditions. If you want the kernel
 /// to be used on both CPU and CUDA, capture the variables by value.
 template <typename func_t>
 void ParallelFor(int64_t n, const func_t& func) {
+    if (GetCPUBackend() == CPUBackend::TBB) {
+        detail::ParallelForTBB(n, 1, [&func](int64_t begin, int64_t end) {
+            for (int64_t i = begin; i < end; ++i) {
+                func(i);
+            }
+        });
+        return;
+    }
 #pragma omp parallel for num_threads(utility::EstimateMaxThreads())
     for (int64_t i = 0; i < n; ++i) {
         func(i);
@@ -85,6 +157,20 @@ void ParallelFor(int64_t n, const func_t& func) {
 /// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
 template <typename func_t>
 void ParallelFor(int64_t n, int64_t grain_size, const func_t& func) {
+    if (GetCPUBackend() == CPUBackend::TBB) {
+        if (n <= grain_size) {
+            for (int64_t i = 0; i < n; ++i) {
+                func(i);
+            }
+            return;
+        }
+        detail::ParallelForTBB(n, 1, [&func](int64_t begin, int64_t end) {
+            for (int64_t i = begin; i < end; ++i) {
+                func(i);
+            }
+        });
+        return;
+    }
 #pragma omp parallel for schedule(static) if (n > grain_size) \
         num_threads(utility::EstimateMaxThreads())
     for (int64_t i = 0; i < n; ++i) {
@@ -92,6 +178,39 @@ void ParallelFor(int64_t n, int64_t grain_size, const func_t& func) {
     }
 }
 
+/// \brief Run `func(begin, end)` in parallel on contiguous sub-ranges
+/// covering [0, n).
+///
+/// Unlike ParallelFor(), the loop over the workloads of a sub-range is written
+/// in \p func, which allows the compiler to vectorize it.
+///
+/// \param n The number of workloads.
+/// \param grain_size If \p n <= \p grain_size, \p func is called once in
+/// serial. Otherwise, sub-ranges have about \p grain_size workloads or more.
+/// \param func The function to be executed in parallel, i.e.
+/// `void func(int64_t begin, int64_t end)`.
+template <typename func_t>
+void ParallelForRange(int64_t n, int64_t grain_size, const func_t& func) {
+    if (n <= 0) {
+        return;
+    }
+    if (n <= grain_size) {
+        func(0, n);
+        return;
+    }
+    if (GetCPUBackend() == CPUBackend::TBB) {
+        detail::ParallelForTBB(n, grain_size, func);
+        return;
+    }
+    const int num_ranges = static_cast<int>(std::min<int64_t>(
+            utility::EstimateMaxThreads(),
+            (n + grain_size - 1) / std::max<int64_t>(grain_size, 1)));
+#pragma omp parallel for schedule(static) num_threads(num_ranges)
+    for (int i = 0; i < num_ranges; ++i) {
+        func(n * i / num_ranges, n * (i + 1) / num_ranges);
+    }
+}
+
 }  // namespace cpu_launcher
 }  // namespace kernel
 }  // namespace core
@@ -85,6 +85,126 @@ void IndexSet(const Tensor& src,
     }
 }
 
+// Checks that indices is a 1D Int64 tensor on device with values in
+// [0, length).
+static void AssertRowIndices(const Tensor& indices,
+                             const Device& device,
+                             int64_t length) {
+    indices.AssertDtype(core::Int64);
+    indices.AssertDevice(device);
+    if (indices.NumDims() != 1) {
+        utility::LogError("Row indices must be 1D, but got shape {}.",
+                          indices.GetShape());
+    }
+    if (indices.GetLength() > 0) {
+        const int64_t min_index = indices.Min({0}).Item<int64_t>();
+        const int64_t max_index = indices.Max({0}).Item<int64_t>();
+        if (min_index < 0 || max_index >= length) {
+            utility::LogError(
+                    "Row indices must be in [0, {}), but got values in [{}, "
+                    "{}].",
+                    length, min_index, max_index);
+        }
+    }
+}
+
+// Returns the shape of the rows of t, i.e. its shape without the first
+// dimension.
+static SizeVector GetRowShape(const Tensor& t) {
+    if (t.NumDims() == 0) {
+        utility::LogError("Row indexing does not support 0-dim tensors.");
+    }
+    const SizeVector& shape = t.GetShape();
+    return SizeVector(shape.begin() + 1, shape.end());
+}
+
+void IndexGetRows(const std::vector<Tensor>& srcs,
+                  const Tensor& indices,
+                  std::vector<Tensor>& dsts) {
+    dsts.clear();
+    if (srcs.empty()) {
+        return;
+    }
+    const Device device = srcs[0].GetDevice();
+    const int64_t length = srcs[0].GetLength();
+    AssertRowIndices(indices, device, length);
+
+    std::vector<Tensor> srcs_contiguous;
+    for (const Tensor& src : srcs) {
+        src.AssertDevice(device);
+        SizeVector dst_shape = GetRowShape(src);
+        if (src.GetLength() != length) {
+            utility::LogError(
+                    "All tensors must have the same length {}, but got {}.",
+                    length, src.GetLength());
+        }
+        dst_shape.insert(dst_shape.begin(), indices.GetLength());
+        srcs_contiguous.push_back(src.Contiguous());
+        dsts.emplace_back(dst_shape, src.GetDtype(), device);
+    }
+
+    const Tensor indices_contiguous = indices.Contiguous();
+    if (device.GetType() == Device::DeviceType::CPU) {
+        IndexGetRowsCPU(srcs_contiguous, indices_contiguous, dsts);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexGetRowsCUDA(srcs_contiguous, indices_contiguous, dsts);
+#endif
+    } else {
+        utility::LogError("IndexGetRows: Unimplemented device");
+    }
+}
+
+void IndexSetRows(const std::vector<Tensor>& srcs,
+                  const Tensor& indices,
+                  std::vector<Tensor>& dsts) {
+    if (srcs.size() != dsts.size()) {
+        utility::LogError("Number of sources {} != number of destinations {}.",
+                          srcs.size(), dsts.size());
+    }
+    if (srcs.empty()) {
+        return;
+    }
+    const Device device = dsts[0].GetDevice();
+    const int64_t length = dsts[0].GetLength();
+    AssertRowIndices(indices, device, length);
+
+    std::vector<Tensor> srcs_contiguous;
+    for (size_t k = 0; k < srcs.size(); ++k) {
+        dsts[k].AssertDevice(device);
+        dsts[k].AssertDtype(srcs[k].GetDtype());
+        if (!dsts[k].IsContiguous()) {
+            utility::LogError("Destination tensors must be contiguous.");
+        }
+        if (dsts[k].GetLength() != length) {
+            utility::LogError(
+                    "All destination tensors must have the same length {}, "
+                    "but got {}.",
+                    length, dsts[k].GetLength());
+        }
+        if (srcs[k].GetLength() != indices.GetLength() ||
+            GetRowShape(srcs[k]) != GetRowShape(dsts[k])) {
+            utility::LogError(
+                    "Source shape {} is not compatible with {} indices and "
+                    "destination shape {}.",
+                    srcs[k].GetShape(), indices.GetLength(),
+                    dsts[k].GetShape());
+        }
+        srcs_contiguous.push_back(srcs[k].To(device).Contiguous());
+    }
+
+    const Tensor indices_contiguous = indices.Contiguous();
+    if (device.GetType() == Device::DeviceType::CPU) {
+        IndexSetRowsCPU(srcs_contiguous, indices_contiguous, dsts);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexSetRowsCUDA(srcs_contiguous, indices_contiguous, dsts);
+#endif
+    } else {
+        utility::LogError("IndexSetRows: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
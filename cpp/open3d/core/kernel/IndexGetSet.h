@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
 
@@ -73,6 +75,55 @@ void IndexSetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// \brief Gathers the rows \p indices of all tensors in \p srcs in a single
+/// pass, i.e. `dsts[k][i] = srcs[k][indices[i]]` along the first dimension.
+///
+/// This is equivalent to calling `srcs[k].IndexGet({indices})` for every k,
+/// but \p indices is read once for all tensors. It is typically used to
+/// select the attributes of a geometry, e.g. points, colors and normals.
+///
+/// \param srcs Tensors with the same length and device. Other dimensions and
+/// dtypes may differ.
+/// \param indices Int64 tensor of shape {N}, with values in [0, length).
+/// \param dsts Output tensors, allocated with shape {N, ...} of each source
+/// tensor.
+void IndexGetRows(const std::vector<Tensor>& srcs,
+                  const Tensor& indices,
+                  std::vector<Tensor>& dsts);
+
+/// \brief Scatters the rows of all tensors in \p srcs to the rows \p indices
+/// of \p dsts in a single pass, i.e. `dsts[k][indices[i]] = srcs[k][i]`
+/// along the first dimension.
+///
+/// If \p indices contains duplicates, which of the rows is written is
+/// unspecified.
+///
+/// \param srcs Tensors of length N.
+/// \param indices Int64 tensor of shape {N}, with values in [0, length).
+/// \param dsts Contiguous tensors with the same length, where dsts[k] has
+/// the dtype and the shape of the rows of srcs[k].
+void IndexSetRows(const std::vector<Tensor>& srcs,
+                  const Tensor& indices,
+                  std::vector<Tensor>& dsts);
+
+void IndexGetRowsCPU(const std::vector<Tensor>& srcs,
+                     const Tensor& indices,
+                     std::vector<Tensor>& dsts);
+
+void IndexSetRowsCPU(const std::vector<Tensor>& srcs,
+                     const Tensor& indices,
+                     std::vector<Tensor>& dsts);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexGetRowsCUDA(const std::vector<Tensor>& srcs,
+                      const Tensor& indices,
+                      std::vector<Tensor>& dsts);
+
+void IndexSetRowsCUDA(const std::vector<Tensor>& srcs,
+                      const Tensor& indices,
+                      std::vector<Tensor>& dsts);
+#endif
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
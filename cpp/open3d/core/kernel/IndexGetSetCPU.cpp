@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+#include <vector>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
@@ -98,6 +101,52 @@ void IndexSetCPU(const Tensor& src,
     }
 }
 
+// Gathers (if gather is true) or scatters the rows of the contiguous tensors
+// srcs to dsts, with one pass over indices.
+static void CopyRowsCPU(const std::vector<Tensor>& srcs,
+                        const Tensor& indices,
+                        std::vector<Tensor>& dsts,
+                        bool gather) {
+    const int64_t num_tensors = static_cast<int64_t>(srcs.size());
+    std::vector<const char*> src_ptrs(num_tensors);
+    std::vector<char*> dst_ptrs(num_tensors);
+    std::vector<int64_t> row_byte_sizes(num_tensors);
+    for (int64_t k = 0; k < num_tensors; ++k) {
+        const SizeVector& shape = srcs[k].GetShape();
+        src_ptrs[k] = static_cast<const char*>(srcs[k].GetDataPtr());
+        dst_ptrs[k] = static_cast<char*>(dsts[k].GetDataPtr());
+        row_byte_sizes[k] =
+                SizeVector(shape.begin() + 1, shape.end()).NumElements() *
+                srcs[k].GetDtype().ByteSize();
+    }
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+
+    cpu_launcher::ParallelFor(
+            indices.GetLength(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
+            [&](int64_t i) {
+                const int64_t src_row = gather ? indices_ptr[i] : i;
+                const int64_t dst_row = gather ? i : indices_ptr[i];
+                for (int64_t k = 0; k < num_tensors; ++k) {
+                    const int64_t row_byte_size = row_byte_sizes[k];
+                    memcpy(dst_ptrs[k] + dst_row * row_byte_size,
+                           src_ptrs[k] + src_row * row_byte_size,
+                           row_byte_size);
+                }
+            });
+}
+
+void IndexGetRowsCPU(const std::vector<Tensor>& srcs,
+                     const Tensor& indices,
+                     std::vector<Tensor>& dsts) {
+    CopyRowsCPU(srcs, indices, dsts, /*gather=*/true);
+}
+
+void IndexSetRowsCPU(const std::vector<Tensor>& srcs,
+                     const Tensor& indices,
+                     std::vector<Tensor>& dsts) {
+    CopyRowsCPU(srcs, indices, dsts, /*gather=*/false);
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
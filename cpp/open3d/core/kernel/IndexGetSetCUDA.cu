@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <vector>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
@@ -118,6 +121,70 @@ void IndexSetCUDA(const Tensor& src,
     }
 }
 
+static constexpr int64_t MAX_ROW_TENSORS = 16;
+
+// Pointers and row sizes of a batch of tensors, passed by value to the kernel.
+struct CUDARowTensors {
+    int64_t num_tensors_ = 0;
+    const char* srcs_[MAX_ROW_TENSORS];
+    char* dsts_[MAX_ROW_TENSORS];
+    int64_t row_byte_sizes_[MAX_ROW_TENSORS];
+};
+
+// Gathers (if gather is true) or scatters the rows of the contiguous tensors
+// srcs to dsts, with one pass over indices per batch of MAX_ROW_TENSORS
+// tensors.
+static void CopyRowsCUDA(const std::vector<Tensor>& srcs,
+                         const Tensor& indices,
+                         std::vector<Tensor>& dsts,
+                         bool gather) {
+    CUDAScopedDevice scoped_device(indices.GetDevice());
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    const int64_t num_tensors = static_cast<int64_t>(srcs.size());
+    for (int64_t begin = 0; begin < num_tensors; begin += MAX_ROW_TENSORS) {
+        CUDARowTensors batch;
+        batch.num_tensors_ =
+                std::min(num_tensors - begin, MAX_ROW_TENSORS);
+        for (int64_t k = 0; k < batch.num_tensors_; ++k) {
+            const Tensor& src = srcs[begin + k];
+            const SizeVector& shape = src.GetShape();
+            batch.srcs_[k] = static_cast<const char*>(src.GetDataPtr());
+            batch.dsts_[k] = static_cast<char*>(dsts[begin + k].GetDataPtr());
+            batch.row_byte_sizes_[k] =
+                    SizeVector(shape.begin() + 1, shape.end()).NumElements() *
+                    src.GetDtype().ByteSize();
+        }
+        cuda_launcher::ParallelFor(
+                indices.GetLength(), [=] OPEN3D_DEVICE(int64_t i) {
+                    const int64_t src_row = gather ? indices_ptr[i] : i;
+                    const int64_t dst_row = gather ? i : indices_ptr[i];
+                    for (int64_t k = 0; k < batch.num_tensors_; ++k) {
+                        const int64_t row_byte_size = batch.row_byte_sizes_[k];
+                        const char* src_bytes =
+                                batch.srcs_[k] + src_row * row_byte_size;
+                        char* dst_bytes =
+                                batch.dsts_[k] + dst_row * row_byte_size;
+                        for (int64_t b = 0; b < row_byte_size; ++b) {
+                            dst_bytes[b] = src_bytes[b];
+                        }
+                    }
+                });
+        OPEN3D_GET_LAST_CUDA_ERROR("CopyRowsCUDA failed.");
+    }
+}
+
+void IndexGetRowsCUDA(const std::vector<Tensor>& srcs,
+                      const Tensor& indices,
+                      std::vector<Tensor>& dsts) {
+    CopyRowsCUDA(srcs, indices, dsts, /*gather=*/true);
+}
+
+void IndexSetRowsCUDA(const std::vector<Tensor>& srcs,
+                      const Tensor& indices,
+                      std::vector<Tensor>& dsts) {
+    CopyRowsCUDA(srcs, indices, dsts, /*gather=*/false);
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,11 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
@@ -38,53 +43,253 @@ namespace core {
 namespace kernel {
 
 template <typename scalar_t>
-static inline scalar_t CPUSumReductionKernel(scalar_t a, scalar_t b) {
-    return a + b;
+static inline std::pair<int64_t, scalar_t> CPUArgMinReductionKernel(
+        int64_t a_idx, scalar_t a, int64_t b_idx, scalar_t b) {
+    if (a < b) {
+        return {a_idx, a};
+    } else {
+        return {b_idx, b};
+    }
 }
 
 template <typename scalar_t>
-static inline scalar_t CPUProdReductionKernel(scalar_t a, scalar_t b) {
-    return a * b;
+static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
+        int64_t a_idx, scalar_t a, int64_t b_idx, scalar_t b) {
+    if (a > b) {
+        return {a_idx, a};
+    } else {
+        return {b_idx, b};
+    }
 }
 
+/// Number of elements, or rows of an outer reduction, reduced sequentially by
+/// the leaves of the pairwise reduction. Pairwise reduction bounds the
+/// rounding error of floating point sums to grow with log(n) instead of n.
+static constexpr int64_t PAIRWISE_BLOCK_SIZE = 128;
+
+/// Number of independent partial results in the leaves of the pairwise
+/// reduction. This breaks the dependency chain of the accumulator so that the
+/// leaves can be vectorized.
+static constexpr int64_t NUM_ACCUMULATORS = 8;
+
+/// Size in bytes of the tiles of output elements of an outer reduction. A
+/// tile and a block of rows fit into the L1 cache.
+static constexpr int64_t ROW_TILE_BYTE_SIZE = 4096;
+
 template <typename scalar_t>
-static inline scalar_t CPUMinReductionKernel(scalar_t a, scalar_t b) {
-    return std::min(a, b);
+static constexpr int64_t GetRowTileSize() {
+    return ROW_TILE_BYTE_SIZE / static_cast<int64_t>(sizeof(scalar_t));
 }
 
-template <typename scalar_t>
-static inline scalar_t CPUMaxReductionKernel(scalar_t a, scalar_t b) {
-    return std::max(a, b);
+// Defines the inner loops of the reductions for the instruction set of TARGET:
+// - PairwiseReduceLoop##SUFFIX(src, n, stride, op, identity) reduces n
+//   elements with a stride, e.g. the contiguous elements of the fast axis.
+// - AccumulateRowLoop##SUFFIX(acc, src, n, op) reduces the contiguous row src
+//   into the row of partial results acc, i.e. one step along a slow axis.
+// The reduce op is called as op(new_value, accumulated_value).
+#define OPEN3D_DEFINE_REDUCTION_LOOPS(SUFFIX, TARGET)                         \
+    template <typename scalar_t, typename func_t>                             \
+    TARGET static scalar_t PairwiseReduceLoop##SUFFIX(                        \
+            const scalar_t* src, int64_t n, int64_t stride, const func_t& op, \
+            scalar_t identity) {                                              \
+        if (n > PAIRWISE_BLOCK_SIZE) {                                        \
+            const int64_t half = (n / 2 + NUM_ACCUMULATORS - 1) /             \
+                                 NUM_ACCUMULATORS * NUM_ACCUMULATORS;         \
+            return op(PairwiseReduceLoop##SUFFIX(src + half * stride,         \
+                                                 n - half, stride, op,        \
+                                                 identity),                   \
+                      PairwiseReduceLoop##SUFFIX(src, half, stride, op,       \
+                                                 identity));                  \
+        }                                                                     \
+        scalar_t acc[NUM_ACCUMULATORS];                                       \
+        for (int64_t k = 0; k < NUM_ACCUMULATORS; ++k) {                      \
+            acc[k] = identity;                                                \
+        }                                                                     \
+        int64_t i = 0;                                                        \
+        for (; i + NUM_ACCUMULATORS <= n; i += NUM_ACCUMULATORS) {            \
+            for (int64_t k = 0; k < NUM_ACCUMULATORS; ++k) {                  \
+                acc[k] = op(src[(i + k) * stride], acc[k]);                   \
+            }                                                                 \
+        }                                                                     \
+        for (; i < n; ++i) {                                                  \
+            acc[0] = op(src[i * stride], acc[0]);                             \
+        }                                                                     \
+        for (int64_t k = 1; k < NUM_ACCUMULATORS; ++k) {                      \
+            acc[0] = op(acc[k], acc[0]);                                      \
+        }                                                                     \
+        return acc[0];                                                        \
+    }                                                                         \
+                                                                              \
+    template <typename scalar_t, typename func_t>                             \
+    TARGET static void AccumulateRowLoop##SUFFIX(                             \
+            scalar_t* acc, const scalar_t* src, int64_t n, const func_t& op) { \
+        for (int64_t j = 0; j < n; ++j) {                                     \
+            acc[j] = op(src[j], acc[j]);                                      \
+        }                                                                     \
+    }
+
+OPEN3D_DEFINE_REDUCTION_LOOPS(, )
+#ifdef OPEN3D_CPU_ISA_DISPATCH
+OPEN3D_DEFINE_REDUCTION_LOOPS(AVX2, OPEN3D_TARGET_AVX2)
+OPEN3D_DEFINE_REDUCTION_LOOPS(AVX512, OPEN3D_TARGET_AVX512)
+#endif
+
+template <typename scalar_t, typename func_t>
+static scalar_t PairwiseReduce(const scalar_t* src,
+                               int64_t n,
+                               int64_t stride,
+                               const func_t& op,
+                               scalar_t identity,
+                               cpu_launcher::CPUISA isa) {
+#ifdef OPEN3D_CPU_ISA_DISPATCH
+    if (isa == cpu_launcher::CPUISA::AVX512) {
+        return PairwiseReduceLoopAVX512(src, n, stride, op, identity);
+    } else if (isa == cpu_launcher::CPUISA::AVX2) {
+        return PairwiseReduceLoopAVX2(src, n, stride, op, identity);
+    }
+#endif
+    return PairwiseReduceLoop(src, n, stride, op, identity);
 }
 
-static inline uint8_t CPUAllReductionKernel(uint8_t a, uint8_t b) {
-    return a && b;
+template <typename scalar_t, typename func_t>
+static void AccumulateRow(scalar_t* acc,
+                          const scalar_t* src,
+                          int64_t n,
+                          const func_t& op,
+                          cpu_launcher::CPUISA isa) {
+#ifdef OPEN3D_CPU_ISA_DISPATCH
+    if (isa == cpu_launcher::CPUISA::AVX512) {
+        AccumulateRowLoopAVX512(acc, src, n, op);
+        return;
+    } else if (isa == cpu_launcher::CPUISA::AVX2) {
+        AccumulateRowLoopAVX2(acc, src, n, op);
+        return;
+    }
+#endif
+    AccumulateRowLoop(acc, src, n, op);
 }
 
-static inline uint8_t CPUAnyReductionKernel(uint8_t a, uint8_t b) {
-    return a || b;
+/// Returns the number of threads used by a reduction. Reductions called from
+/// a parallel region run in serial.
+static int64_t GetNumReductionThreads() {
+    return utility::InParallel() ? 1 : utility::EstimateMaxThreads();
 }
 
-template <typename scalar_t>
-static inline std::pair<int64_t, scalar_t> CPUArgMinReductionKernel(
-        int64_t a_idx, scalar_t a, int64_t b_idx, scalar_t b) {
-    if (a < b) {
-        return {a_idx, a};
+/// Runs `func(begin, end)` on sub-ranges of [0, n), in parallel if
+/// \p num_threads > 1.
+template <typename func_t>
+static void ReductionParallelFor(int64_t n,
+                                 int64_t grain_size,
+                                 int64_t num_threads,
+                                 const func_t& func) {
+    if (num_threads <= 1) {
+        if (n > 0) {
+            func(0, n);
+        }
     } else {
-        return {b_idx, b};
+        cpu_launcher::ParallelForRange(n, grain_size, func);
     }
 }
 
-template <typename scalar_t>
-static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
-        int64_t a_idx, scalar_t a, int64_t b_idx, scalar_t b) {
-    if (a > b) {
-        return {a_idx, a};
-    } else {
-        return {b_idx, b};
-    }
+/// Returns the number of chunks a reduction of \p num_elements is split into
+/// when it is computed in two passes, i.e. partial results per chunk that are
+/// combined in a second, serial pass.
+static int64_t GetNumReductionChunks(int64_t num_elements,
+                                     int64_t num_threads) {
+    const int64_t grain_size = cpu_launcher::SMALL_OP_GRAIN_SIZE;
+    return std::max<int64_t>(
+            1, std::min(num_threads,
+                        (num_elements + grain_size - 1) / grain_size));
 }
 
+/// Dimensions of a reduction with strides in number of elements. They are
+/// split into the kept dimensions, where each index maps to a different output
+/// element, and the reduced dimensions. Dimensions of size 1 are dropped and
+/// each group is sorted from the outer-most to the inner-most dimension of the
+/// input.
+class CPUReductionLayout {
+public:
+    struct Dim {
+        int64_t size_;
+        int64_t src_stride_;
+        int64_t dst_stride_;
+    };
+
+    explicit CPUReductionLayout(const Indexer& indexer) {
+        const TensorRef& src = indexer.GetInput(0);
+        const TensorRef& dst = indexer.GetOutput(0);
+        const int64_t* shape = indexer.GetMasterShape();
+        for (int64_t dim = 0; dim < indexer.NumDims(); ++dim) {
+            if (shape[dim] <= 1) {
+                continue;
+            }
+            Dim d{shape[dim], src.byte_strides_[dim] / src.dtype_byte_size_,
+                  dst.byte_strides_[dim] / dst.dtype_byte_size_};
+            if (indexer.IsReductionDim(dim)) {
+                reduced_dims_.push_back(d);
+            } else {
+                kept_dims_.push_back(d);
+            }
+        }
+        auto outer_first = [](const Dim& a, const Dim& b) {
+            return a.src_stride_ > b.src_stride_;
+        };
+        std::stable_sort(kept_dims_.begin(), kept_dims_.end(), outer_first);
+        std::stable_sort(reduced_dims_.begin(), reduced_dims_.end(),
+                         outer_first);
+    }
+
+    /// Returns true if the inner-most dimension of the input is contiguous and
+    /// kept, i.e. the reduction is over slow axes only. Then consecutive input
+    /// elements are reduced into consecutive output elements.
+    bool IsOuterReduction() const {
+        if (kept_dims_.empty() || kept_dims_.back().src_stride_ != 1) {
+            return false;
+        }
+        return reduced_dims_.empty() ||
+               reduced_dims_.back().src_stride_ > kept_dims_.back().src_stride_;
+    }
+
+    static int64_t NumElements(const std::vector<Dim>& dims) {
+        int64_t num_elements = 1;
+        for (const Dim& d : dims) {
+            num_elements *= d.size_;
+        }
+        return num_elements;
+    }
+
+    /// Computes the input and output offsets of the \p idx -th element of
+    /// \p dims in row-major order.
+    static void GetOffsets(const std::vector<Dim>& dims,
+                           int64_t idx,
+                           int64_t& src_offset,
+                           int64_t& dst_offset) {
+        src_offset = 0;
+        dst_offset = 0;
+        for (auto it = dims.rbegin(); it != dims.rend(); ++it) {
+            const int64_t i = idx % it->size_;
+            idx /= it->size_;
+            src_offset += i * it->src_stride_;
+            dst_offset += i * it->dst_stride_;
+        }
+    }
+
+    std::vector<Dim> kept_dims_;
+    std::vector<Dim> reduced_dims_;
+};
+
+/// Reduction engine for associative ops with a single output, e.g. Sum.
+///
+/// The reduction is computed directly on the strided input without per
+/// element index computations, with one of two strategies:
+/// - Inner reduction, e.g. Sum({1}) of a (N, 3) tensor: the elements of the
+///   inner-most reduced dimension are reduced pairwise by vectorized loops.
+/// - Outer reduction, e.g. Sum({0}) of a (N, 3) tensor: contiguous rows of the
+///   input are accumulated into cache-sized tiles of the output with
+///   vectorized loops, in blocks of rows.
+/// Work is split over the output elements if there are enough of them, and
+/// over the reduced elements otherwise, in which case the partial results are
+/// combined in a second pass.
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
@@ -93,106 +298,252 @@ public:
 
     template <typename func_t, typename scalar_t>
     void Run(const func_t& reduce_func, scalar_t identity) {
-        // See: PyTorch's TensorIterator::parallel_reduce for the reference
-        // design of reduction strategy.
-        if (utility::EstimateMaxThreads() == 1 || utility::InParallel()) {
-            LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
-        } else if (indexer_.NumOutputElements() <= 1) {
-            LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
-                                                   identity);
+        if (indexer_.NumWorkloads() == 0) {
+            return;
+        }
+        CPUReductionLayout layout(indexer_);
+        const scalar_t* src = static_cast<const scalar_t*>(
+                indexer_.GetInput(0).data_ptr_);
+        scalar_t* dst = static_cast<scalar_t*>(indexer_.GetOutput().data_ptr_);
+        if (layout.IsOuterReduction()) {
+            RunOuter(layout, src, dst, reduce_func, identity);
         } else {
-            LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
+            RunInner(layout, src, dst, reduce_func, identity);
         }
     }
 
 private:
     template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelSerial(const Indexer& indexer,
-                                            func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            scalar_t* src = reinterpret_cast<scalar_t*>(
-                    indexer.GetInputPtr(0, workload_idx));
-            scalar_t* dst = reinterpret_cast<scalar_t*>(
-                    indexer.GetOutputPtr(workload_idx));
-            *dst = element_kernel(*src, *dst);
+    static void RunInner(const CPUReductionLayout& layout,
+                         const scalar_t* src,
+                         scalar_t* dst,
+                         const func_t& reduce_func,
+                         scalar_t identity) {
+        // The inner-most reduced dimension is reduced pairwise, the other
+        // reduced dimensions are iterated over.
+        using Dim = CPUReductionLayout::Dim;
+        std::vector<Dim> outer_dims = layout.reduced_dims_;
+        Dim inner_dim{1, 0, 0};
+        if (!outer_dims.empty()) {
+            inner_dim = outer_dims.back();
+            outer_dims.pop_back();
         }
-    }
+        const std::vector<Dim>& kept_dims = layout.kept_dims_;
+        const int64_t num_outputs = CPUReductionLayout::NumElements(kept_dims);
+        const int64_t num_lines = CPUReductionLayout::NumElements(outer_dims);
+        const int64_t line_size = inner_dim.size_;
+        const int64_t num_reduced = num_lines * line_size;
+        const int64_t num_threads = GetNumReductionThreads();
+        const cpu_launcher::CPUISA isa = cpu_launcher::GetCPUISA();
 
-    /// Create num_threads workers to compute partial reductions and then reduce
-    /// to the final results. This only applies to reduction op with one output.
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelTwoPass(const Indexer& indexer,
-                                             func_t element_kernel,
-                                             scalar_t identity) {
-        if (indexer.NumOutputElements() > 1) {
-            utility::LogError(
-                    "Internal error: two-pass reduction only works for "
-                    "single-output reduction ops.");
+        // Reduces the elements [begin, end) of the reduced dimensions of the
+        // output element with the input offset src_offset.
+        auto reduce_range = [&](int64_t src_offset, int64_t begin,
+                                int64_t end) -> scalar_t {
+            scalar_t acc = identity;
+            while (begin < end) {
+                const int64_t line_idx = begin / line_size;
+                const int64_t line_begin = begin % line_size;
+                const int64_t line_end =
+                        std::min(line_size, line_begin + end - begin);
+                int64_t line_offset, unused;
+                CPUReductionLayout::GetOffsets(outer_dims, line_idx,
+                                               line_offset, unused);
+                acc = reduce_func(
+                        PairwiseReduce(src + src_offset + line_offset +
+                                               line_begin *
+                                                       inner_dim.src_stride_,
+                                       line_end - line_begin,
+                                       inner_dim.src_stride_, reduce_func,
+                                       identity, isa),
+                        acc);
+                begin += line_end - line_begin;
+            }
+            return acc;
+        };
+
+        if (num_outputs >= num_threads) {
+            const int64_t grain_size = std::max<int64_t>(
+                    1, cpu_launcher::SMALL_OP_GRAIN_SIZE / num_reduced);
+            ReductionParallelFor(
+                    num_outputs, grain_size, num_threads,
+                    [&](int64_t begin, int64_t end) {
+                        for (int64_t i = begin; i < end; ++i) {
+                            int64_t src_offset, dst_offset;
+                            CPUReductionLayout::GetOffsets(
+                                    kept_dims, i, src_offset, dst_offset);
+                            dst[dst_offset] = reduce_func(
+                                    reduce_range(src_offset, 0, num_reduced),
+                                    dst[dst_offset]);
+                        }
+                    });
+            return;
         }
-        int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = utility::EstimateMaxThreads();
-        int64_t workload_per_thread =
-                (num_workloads + num_threads - 1) / num_threads;
-        std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
+        // Few outputs: split the reduced elements of each output into chunks.
+        const int64_t num_chunks =
+                GetNumReductionChunks(num_reduced, num_threads);
+        std::vector<scalar_t> partials(num_chunks);
+        for (int64_t i = 0; i < num_outputs; ++i) {
+            int64_t src_offset, dst_offset;
+            CPUReductionLayout::GetOffsets(kept_dims, i, src_offset,
+                                           dst_offset);
+            ReductionParallelFor(
+                    num_chunks, 1, num_threads,
+                    [&](int64_t begin, int64_t end) {
+                        for (int64_t c = begin; c < end; ++c) {
+                            partials[c] = reduce_range(
+                                    src_offset, num_reduced * c / num_chunks,
+                                    num_reduced * (c + 1) / num_chunks);
+                        }
+                    });
+            scalar_t acc = identity;
+            for (int64_t c = 0; c < num_chunks; ++c) {
+                acc = reduce_func(partials[c], acc);
             }
-        }
-        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            *dst = element_kernel(thread_results[thread_idx], *dst);
+            dst[dst_offset] = reduce_func(acc, dst[dst_offset]);
         }
     }
 
+    /// Reduces the rows [begin, end) of the tile starting at \p src_tile
+    /// pairwise, and combines the result into \p acc.
     template <typename scalar_t, typename func_t>
-    static void LaunchReductionParallelDim(const Indexer& indexer,
-                                           func_t element_kernel) {
-        // Prefers outer dimension >= num_threads.
-        const int64_t* indexer_shape = indexer.GetMasterShape();
-        const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = utility::EstimateMaxThreads();
-
-        // Init best_dim as the outer-most non-reduction dim.
-        int64_t best_dim = num_dims - 1;
-        while (best_dim >= 0 && indexer.IsReductionDim(best_dim)) {
-            best_dim--;
-        }
-        for (int64_t dim = best_dim; dim >= 0 && !indexer.IsReductionDim(dim);
-             --dim) {
-            if (indexer_shape[dim] >= num_threads) {
-                best_dim = dim;
-                break;
-            } else if (indexer_shape[dim] > indexer_shape[best_dim]) {
-                best_dim = dim;
+    static void PairwiseReduceRows(
+            const std::vector<CPUReductionLayout::Dim>& reduced_dims,
+            const scalar_t* src_tile,
+            int64_t tile_width,
+            int64_t begin,
+            int64_t end,
+            const func_t& reduce_func,
+            scalar_t identity,
+            cpu_launcher::CPUISA isa,
+            scalar_t* acc) {
+        scalar_t block[GetRowTileSize<scalar_t>()];
+        std::fill(block, block + tile_width, identity);
+        if (end - begin > PAIRWISE_BLOCK_SIZE) {
+            const int64_t mid = begin + (end - begin) / 2;
+            PairwiseReduceRows(reduced_dims, src_tile, tile_width, begin, mid,
+                               reduce_func, identity, isa, block);
+            PairwiseReduceRows(reduced_dims, src_tile, tile_width, mid, end,
+                               reduce_func, identity, isa, block);
+        } else {
+            for (int64_t r = begin; r < end; ++r) {
+                int64_t src_offset, unused;
+                CPUReductionLayout::GetOffsets(reduced_dims, r, src_offset,
+                                               unused);
+                AccumulateRow(block, src_tile + src_offset, tile_width,
+                              reduce_func, isa);
             }
         }
-        if (best_dim == -1) {
-            utility::LogError(
-                    "Internal error: all dims are reduction dims, use "
-                    "LaunchReductionKernelTwoPass instead.");
+        AccumulateRow(acc, block, tile_width, reduce_func, isa);
+    }
+
+    template <typename scalar_t, typename func_t>
+    static void RunOuter(const CPUReductionLayout& layout,
+                         const scalar_t* src,
+                         scalar_t* dst,
+                         const func_t& reduce_func,
+                         scalar_t identity) {
+        // The inner-most kept dimension forms contiguous rows, which are split
+        // into tiles. A task reduces the rows of one tile of one output row.
+        using Dim = CPUReductionLayout::Dim;
+        std::vector<Dim> outer_dims = layout.kept_dims_;
+        const Dim row_dim = outer_dims.back();
+        outer_dims.pop_back();
+        const std::vector<Dim>& reduced_dims = layout.reduced_dims_;
+        const int64_t num_rows = CPUReductionLayout::NumElements(outer_dims);
+        const int64_t row_size = row_dim.size_;
+        const int64_t num_reduced =
+                CPUReductionLayout::NumElements(reduced_dims);
+        constexpr int64_t tile_size = GetRowTileSize<scalar_t>();
+        const int64_t num_tiles = (row_size + tile_size - 1) / tile_size;
+        const int64_t num_tasks = num_rows * num_tiles;
+        const int64_t num_threads = GetNumReductionThreads();
+        const cpu_launcher::CPUISA isa = cpu_launcher::GetCPUISA();
+
+        if (num_tasks >= num_threads) {
+            const int64_t grain_size = std::max<int64_t>(
+                    1, cpu_launcher::SMALL_OP_GRAIN_SIZE /
+                               (num_reduced * std::min(row_size, tile_size)));
+            ReductionParallelFor(
+                    num_tasks, grain_size, num_threads,
+                    [&](int64_t begin, int64_t end) {
+                        scalar_t acc[tile_size];
+                        for (int64_t task = begin; task < end; ++task) {
+                            const int64_t col_begin =
+                                    task % num_tiles * tile_size;
+                            const int64_t tile_width =
+                                    std::min(tile_size, row_size - col_begin);
+                            int64_t src_offset, dst_offset;
+                            CPUReductionLayout::GetOffsets(
+                                    outer_dims, task / num_tiles, src_offset,
+                                    dst_offset);
+                            src_offset += col_begin;
+                            dst_offset += col_begin * row_dim.dst_stride_;
+                            std::fill(acc, acc + tile_width, identity);
+                            PairwiseReduceRows(reduced_dims, src + src_offset,
+                                               tile_width, 0, num_reduced,
+                                               reduce_func, identity, isa,
+                                               acc);
+                            for (int64_t j = 0; j < tile_width; ++j) {
+                                scalar_t& d =
+                                        dst[dst_offset +
+                                            j * row_dim.dst_stride_];
+                                d = reduce_func(acc[j], d);
+                            }
+                        }
+                    });
+            return;
         }
 
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+        // Few outputs, e.g. Sum({0}) of a (N, 3) tensor: split the reduced
+        // rows into chunks, each with its own partial results for all outputs.
+        const int64_t num_outputs = num_rows * row_size;
+        const int64_t num_chunks =
+                GetNumReductionChunks(num_reduced * num_outputs, num_threads);
+        std::vector<scalar_t> partials(num_chunks * num_outputs, identity);
+        ReductionParallelFor(
+                num_chunks, 1, num_threads, [&](int64_t begin, int64_t end) {
+                    for (int64_t c = begin; c < end; ++c) {
+                        const int64_t r_begin = num_reduced * c / num_chunks;
+                        const int64_t r_end =
+                                num_reduced * (c + 1) / num_chunks;
+                        scalar_t* partial =
+                                partials.data() + c * num_outputs;
+                        for (int64_t task = 0; task < num_tasks; ++task) {
+                            const int64_t row = task / num_tiles;
+                            const int64_t col_begin =
+                                    task % num_tiles * tile_size;
+                            const int64_t tile_width =
+                                    std::min(tile_size, row_size - col_begin);
+                            int64_t src_offset, unused;
+                            CPUReductionLayout::GetOffsets(
+                                    outer_dims, row, src_offset, unused);
+                            PairwiseReduceRows(
+                                    reduced_dims,
+                                    src + src_offset + col_begin, tile_width,
+                                    r_begin, r_end, reduce_func, identity, isa,
+                                    partial + row * row_size + col_begin);
+                        }
+                    }
+                });
+        for (int64_t row = 0; row < num_rows; ++row) {
+            int64_t unused, dst_offset;
+            CPUReductionLayout::GetOffsets(outer_dims, row, unused,
+                                           dst_offset);
+            for (int64_t j = 0; j < row_size; ++j) {
+                scalar_t acc = identity;
+                for (int64_t c = 0; c < num_chunks; ++c) {
+                    acc = reduce_func(
+                            partials[c * num_outputs + row * row_size + j],
+                            acc);
+                }
+                scalar_t& d = dst[dst_offset + j * row_dim.dst_stride_];
+                d = reduce_func(acc, d);
+            }
         }
     }
 
-private:
     Indexer indexer_;
 };
 
@@ -204,6 +555,96 @@ public:
 
     template <typename func_t, typename scalar_t>
     void Run(const func_t& reduce_func, scalar_t identity) {
+        if (indexer_.NumWorkloads() == 0) {
+            return;
+        }
+        CPUReductionLayout layout(indexer_);
+        if (layout.reduced_dims_.size() <= 1) {
+            RunSingleReducedDim(layout, reduce_func, identity);
+        } else {
+            RunGeneric(reduce_func, identity);
+        }
+    }
+
+private:
+    /// The reduced elements of each output element are strided along a single
+    /// dimension, thus the arg index is the position along that dimension.
+    template <typename func_t, typename scalar_t>
+    void RunSingleReducedDim(const CPUReductionLayout& layout,
+                             const func_t& reduce_func,
+                             scalar_t identity) {
+        const CPUReductionLayout::Dim reduced_dim =
+                layout.reduced_dims_.empty() ? CPUReductionLayout::Dim{1, 0, 0}
+                                             : layout.reduced_dims_[0];
+        const std::vector<CPUReductionLayout::Dim>& kept_dims =
+                layout.kept_dims_;
+        const scalar_t* src = static_cast<const scalar_t*>(
+                indexer_.GetInput(0).data_ptr_);
+        int64_t* dst = static_cast<int64_t*>(indexer_.GetOutput(0).data_ptr_);
+        const int64_t num_outputs = CPUReductionLayout::NumElements(kept_dims);
+        const int64_t num_reduced = reduced_dim.size_;
+        const int64_t num_threads = GetNumReductionThreads();
+
+        // Reduces the elements [begin, end) of the reduced dimension.
+        auto reduce_range = [&](int64_t src_offset, int64_t begin,
+                                int64_t end) -> std::pair<int64_t, scalar_t> {
+            const scalar_t* src_line = src + src_offset;
+            int64_t acc_idx = begin;
+            scalar_t acc = identity;
+            for (int64_t i = begin; i < end; ++i) {
+                std::tie(acc_idx, acc) = reduce_func(
+                        i, src_line[i * reduced_dim.src_stride_], acc_idx, acc);
+            }
+            return {acc_idx, acc};
+        };
+
+        if (num_outputs >= num_threads) {
+            const int64_t grain_size = std::max<int64_t>(
+                    1, cpu_launcher::SMALL_OP_GRAIN_SIZE / num_reduced);
+            ReductionParallelFor(
+                    num_outputs, grain_size, num_threads,
+                    [&](int64_t begin, int64_t end) {
+                        for (int64_t i = begin; i < end; ++i) {
+                            int64_t src_offset, dst_offset;
+                            CPUReductionLayout::GetOffsets(
+                                    kept_dims, i, src_offset, dst_offset);
+                            dst[dst_offset] =
+                                    reduce_range(src_offset, 0, num_reduced)
+                                            .first;
+                        }
+                    });
+            return;
+        }
+
+        const int64_t num_chunks =
+                GetNumReductionChunks(num_reduced, num_threads);
+        std::vector<std::pair<int64_t, scalar_t>> partials(num_chunks);
+        for (int64_t i = 0; i < num_outputs; ++i) {
+            int64_t src_offset, dst_offset;
+            CPUReductionLayout::GetOffsets(kept_dims, i, src_offset,
+                                           dst_offset);
+            ReductionParallelFor(
+                    num_chunks, 1, num_threads,
+                    [&](int64_t begin, int64_t end) {
+                        for (int64_t c = begin; c < end; ++c) {
+                            partials[c] = reduce_range(
+                                    src_offset, num_reduced * c / num_chunks,
+                                    num_reduced * (c + 1) / num_chunks);
+                        }
+                    });
+            // Combine in order, so that ties resolve to the smallest index.
+            int64_t acc_idx = 0;
+            scalar_t acc = identity;
+            for (int64_t c = 0; c < num_chunks; ++c) {
+                std::tie(acc_idx, acc) = reduce_func(
+                        partials[c].first, partials[c].second, acc_idx, acc);
+            }
+            dst[dst_offset] = acc_idx;
+        }
+    }
+
+    template <typename func_t, typename scalar_t>
+    void RunGeneric(const func_t& reduce_func, scalar_t identity) {
         // Arg-reduction needs to iterate each output element separately in
         // sub-iterations. Each output elemnent corresponds to multiple input
         // elements. We need to keep track of the indices within each
@@ -231,7 +672,6 @@ public:
         }
     }
 
-private:
     Indexer indexer_;
 };
 
@@ -249,12 +689,16 @@ void ReductionCPU(const Tensor& src,
                 case ReductionOpCode::Sum:
                     identity = 0;
                     dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
+                    re.Run([](scalar_t a,
+                              scalar_t b) -> scalar_t { return a + b; },
+                           identity);
                     break;
                 case ReductionOpCode::Prod:
                     identity = 1;
                     dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
+                    re.Run([](scalar_t a,
+                              scalar_t b) -> scalar_t { return a * b; },
+                           identity);
                     break;
                 case ReductionOpCode::Min:
                     if (indexer.NumWorkloads() == 0) {
@@ -263,7 +707,9 @@ void ReductionCPU(const Tensor& src,
                     } else {
                         identity = std::numeric_limits<scalar_t>::max();
                         dst.Fill(identity);
-                        re.Run(CPUMinReductionKernel<scalar_t>, identity);
+                        re.Run([](scalar_t a,
+                                  scalar_t b) { return std::min(a, b); },
+                               identity);
                     }
                     break;
                 case ReductionOpCode::Max:
@@ -273,7 +719,9 @@ void ReductionCPU(const Tensor& src,
                     } else {
                         identity = std::numeric_limits<scalar_t>::lowest();
                         dst.Fill(identity);
-                        re.Run(CPUMaxReductionKernel<scalar_t>, identity);
+                        re.Run([](scalar_t a,
+                                  scalar_t b) { return std::max(a, b); },
+                               identity);
                     }
                     break;
                 default:
@@ -334,12 +782,14 @@ void ReductionCPU(const Tensor& src,
             case ReductionOpCode::All:
                 // Identity == true. 0-sized tensor, returns true.
                 dst.Fill(true);
-                re.Run(CPUAllReductionKernel, static_cast<uint8_t>(true));
+                re.Run([](uint8_t a, uint8_t b) -> uint8_t { return a && b; },
+                       static_cast<uint8_t>(true));
                 break;
             case ReductionOpCode::Any:
                 // Identity == false. 0-sized tensor, returns false.
                 dst.Fill(false);
-                re.Run(CPUAnyReductionKernel, static_cast<uint8_t>(false));
+                re.Run([](uint8_t a, uint8_t b) -> uint8_t { return a || b; },
+                       static_cast<uint8_t>(false));
                 break;
             default:
                 utility::LogError("Unsupported op code.");
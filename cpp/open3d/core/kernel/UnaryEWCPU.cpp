@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 
@@ -42,7 +43,8 @@ namespace core {
 namespace kernel {
 
 template <typename func_t>
-static void LaunchUnaryEWKernel(const Indexer& indexer, const func_t& func) {
+static void LaunchUnaryEWObjectKernel(const Indexer& indexer,
+                                      const func_t& func) {
     cpu_launcher::ParallelFor(
             indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
             [&indexer, &func](int64_t i) {
@@ -50,12 +52,6 @@ static void LaunchUnaryEWKernel(const Indexer& indexer, const func_t& func) {
             });
 }
 
-template <typename src_t, typename dst_t>
-static void CPUCopyElementKernel(const void* src, void* dst) {
-    *static_cast<dst_t*>(dst) =
-            static_cast<dst_t>(*static_cast<const src_t*>(src));
-}
-
 static void CPUCopyObjectElementKernel(const void* src,
                                        void* dst,
                                        int64_t object_byte_size) {
@@ -64,88 +60,76 @@ static void CPUCopyObjectElementKernel(const void* src,
     memcpy(dst_bytes, src_bytes, object_byte_size);
 }
 
-template <typename scalar_t>
-static void CPUSqrtElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::sqrt(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUSinElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::sin(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUCosElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::cos(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUNegElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(-*static_cast<const scalar_t*>(src));
-}
-
-template <typename scalar_t>
-static void CPUExpElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::exp(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUAbsElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::abs(static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
-
-template <typename scalar_t>
-static void CPUIsNanElementKernel(const void* src, void* dst) {
-    *static_cast<bool*>(dst) =
-            std::isnan(static_cast<float>(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUIsInfElementKernel(const void* src, void* dst) {
-    *static_cast<bool*>(dst) =
-            std::isinf(static_cast<float>(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUIsFiniteElementKernel(const void* src, void* dst) {
-    *static_cast<bool*>(dst) = std::isfinite(
-            static_cast<float>(*static_cast<const scalar_t*>(src)));
-}
-
-template <typename scalar_t>
-static void CPUFloorElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::floor(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+// Defines NAME(src, dst, n, op), computing dst[i] = op(src[i]) for i in
+// [0, n) on contiguous arrays. The loop is simple enough for the compiler to
+// vectorize it with the instruction set of TARGET.
+#define OPEN3D_DEFINE_UNARY_EW_LOOP(NAME, TARGET)                        \
+    template <typename src_t, typename dst_t, typename op_t>             \
+    TARGET static void NAME(const src_t* src, dst_t* dst, int64_t n,     \
+                            const op_t& op) {                            \
+        for (int64_t i = 0; i < n; ++i) {                                \
+            dst[i] = op(src[i]);                                         \
+        }                                                                \
+    }
 
-template <typename scalar_t>
-static void CPUCeilElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::ceil(static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+OPEN3D_DEFINE_UNARY_EW_LOOP(UnaryEWLoop, )
+#ifdef OPEN3D_CPU_ISA_DISPATCH
+OPEN3D_DEFINE_UNARY_EW_LOOP(UnaryEWLoopAVX2, OPEN3D_TARGET_AVX2)
+OPEN3D_DEFINE_UNARY_EW_LOOP(UnaryEWLoopAVX512, OPEN3D_TARGET_AVX512)
+#endif
 
-template <typename scalar_t>
-static void CPURoundElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::round(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+/// Computes dst = op(src) for every workload of \p indexer.
+///
+/// If the input and the output are contiguous, the workloads are processed by
+/// the vectorized loops of OPEN3D_DEFINE_UNARY_EW_LOOP for the instruction set
+/// of cpu_launcher::GetCPUISA(). If the input is a broadcasted scalar and the
+/// output is contiguous, op is evaluated once and the output is filled.
+/// Otherwise, the offsets of each workload are computed by the indexer.
+template <typename src_t, typename dst_t, typename op_t>
+static void LaunchUnaryEWKernel(const Indexer& indexer, const op_t& op) {
+    const int64_t n = indexer.NumWorkloads();
+    if (indexer.IsOutputContiguous() && indexer.IsInputContiguous(0)) {
+        const src_t* src =
+                reinterpret_cast<const src_t*>(indexer.GetInput(0).data_ptr_);
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutput().data_ptr_);
+        const cpu_launcher::CPUISA isa = cpu_launcher::GetCPUISA();
+        cpu_launcher::ParallelForRange(
+                n, cpu_launcher::SMALL_OP_GRAIN_SIZE,
+                [&](int64_t begin, int64_t end) {
+#ifdef OPEN3D_CPU_ISA_DISPATCH
+                    if (isa == cpu_launcher::CPUISA::AVX512) {
+                        UnaryEWLoopAVX512(src + begin, dst + begin,
+                                          end - begin, op);
+                        return;
+                    } else if (isa == cpu_launcher::CPUISA::AVX2) {
+                        UnaryEWLoopAVX2(src + begin, dst + begin, end - begin,
+                                        op);
+                        return;
+                    }
+#endif
+                    UnaryEWLoop(src + begin, dst + begin, end - begin, op);
+                });
+        return;
+    }
 
-template <typename scalar_t>
-static void CPUTruncElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::trunc(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+    if (n > 0 && indexer.IsOutputContiguous() && indexer.IsInputScalar(0)) {
+        const dst_t value = op(
+                *reinterpret_cast<const src_t*>(indexer.GetInput(0).data_ptr_));
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutput().data_ptr_);
+        cpu_launcher::ParallelForRange(n, cpu_launcher::SMALL_OP_GRAIN_SIZE,
+                                       [&](int64_t begin, int64_t end) {
+                                           std::fill(dst + begin, dst + end,
+                                                     value);
+                                       });
+        return;
+    }
 
-template <typename src_t, typename dst_t>
-static void CPULogicalNotElementKernel(const void* src, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            !static_cast<bool>(*static_cast<const src_t*>(src)));
+    cpu_launcher::ParallelFor(
+            n, cpu_launcher::SMALL_OP_GRAIN_SIZE, [&indexer, &op](int64_t i) {
+                *reinterpret_cast<dst_t*>(indexer.GetOutputPtr(i)) =
+                        op(*reinterpret_cast<const src_t*>(
+                                indexer.GetInputPtr(0, i)));
+            });
 }
 
 void CopyCPU(const Tensor& src, Tensor& dst) {
@@ -175,17 +159,19 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
         Indexer indexer({src}, dst, DtypePolicy::NONE);
         if (src.GetDtype().IsObject()) {
             int64_t object_byte_size = src.GetDtype().ByteSize();
-            LaunchUnaryEWKernel(indexer, [&](const void* src, void* dst) {
-                CPUCopyObjectElementKernel(src, dst, object_byte_size);
-            });
+            LaunchUnaryEWObjectKernel(
+                    indexer, [&](const void* src, void* dst) {
+                        CPUCopyObjectElementKernel(src, dst, object_byte_size);
+                    });
 
         } else {
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
                 using src_t = scalar_t;
                 DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                     using dst_t = scalar_t;
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUCopyElementKernel<src_t, dst_t>);
+                    LaunchUnaryEWKernel<src_t, dst_t>(indexer, [](src_t a) {
+                        return static_cast<dst_t>(a);
+                    });
                 });
             });
         }
@@ -209,14 +195,17 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-                LaunchUnaryEWKernel(
-                        indexer,
-                        CPULogicalNotElementKernel<scalar_t, scalar_t>);
+                LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                        indexer, [](scalar_t a) {
+                            return static_cast<scalar_t>(
+                                    !static_cast<bool>(a));
+                        });
             } else if (dst_dtype == core::Bool) {
                 Indexer indexer({src}, dst,
                                 DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-                LaunchUnaryEWKernel(indexer,
-                                    CPULogicalNotElementKernel<scalar_t, bool>);
+                LaunchUnaryEWKernel<scalar_t, bool>(indexer, [](scalar_t a) {
+                    return !static_cast<bool>(a);
+                });
             } else {
                 utility::LogError(
                         "Boolean op's output type must be boolean or the "
@@ -230,13 +219,17 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         Indexer indexer({src}, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             if (op_code == UnaryEWOpCode::IsNan) {
-                LaunchUnaryEWKernel(indexer, CPUIsNanElementKernel<scalar_t>);
+                LaunchUnaryEWKernel<scalar_t, bool>(indexer, [](scalar_t a) {
+                    return std::isnan(static_cast<float>(a));
+                });
             } else if (op_code == UnaryEWOpCode::IsInf) {
-                LaunchUnaryEWKernel(indexer, CPUIsInfElementKernel<scalar_t>);
-
+                LaunchUnaryEWKernel<scalar_t, bool>(indexer, [](scalar_t a) {
+                    return std::isinf(static_cast<float>(a));
+                });
             } else if (op_code == UnaryEWOpCode::IsFinite) {
-                LaunchUnaryEWKernel(indexer,
-                                    CPUIsFiniteElementKernel<scalar_t>);
+                LaunchUnaryEWKernel<scalar_t, bool>(indexer, [](scalar_t a) {
+                    return std::isfinite(static_cast<float>(a));
+                });
             }
         });
     } else {
@@ -245,42 +238,72 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUSqrtElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(std::sqrt(a));
+                            });
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel(indexer, CPUSinElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(std::sin(a));
+                            });
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel(indexer, CPUCosElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(std::cos(a));
+                            });
                     break;
                 case UnaryEWOpCode::Neg:
-                    LaunchUnaryEWKernel(indexer, CPUNegElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(-a);
+                            });
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel(indexer, CPUExpElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(std::exp(a));
+                            });
                     break;
                 case UnaryEWOpCode::Abs:
-                    LaunchUnaryEWKernel(indexer, CPUAbsElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(
+                                        std::abs(static_cast<double>(a)));
+                            });
                     break;
                 case UnaryEWOpCode::Floor:
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUFloorElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(
+                                        std::floor(static_cast<double>(a)));
+                            });
                     break;
                 case UnaryEWOpCode::Ceil:
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUCeilElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(
+                                        std::ceil(static_cast<double>(a)));
+                            });
                     break;
                 case UnaryEWOpCode::Round:
-                    LaunchUnaryEWKernel(indexer,
-                                        CPURoundElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(
+                                        std::round(static_cast<double>(a)));
+                            });
                     break;
                 case UnaryEWOpCode::Trunc:
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUTruncElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](scalar_t a) {
+                                return static_cast<scalar_t>(
+                                        std::trunc(static_cast<double>(a)));
+                            });
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
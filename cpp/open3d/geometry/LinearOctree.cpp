@@ -0,0 +1,427 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <algorithm>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+const size_t LinearOctree::MAX_SUPPORTED_DEPTH;
+
+namespace {
+
+/// Number of bits sorted per radix sort pass.
+constexpr int RADIX_BITS = 8;
+constexpr int64_t RADIX_SIZE = int64_t(1) << RADIX_BITS;
+/// Minimum number of codes per radix sort chunk, to amortize the histograms.
+constexpr int64_t MIN_RADIX_CHUNK_SIZE = 1 << 16;
+
+/// Spreads the lowest 21 bits of x such that bit i moves to bit 3 * i.
+uint64_t SpreadBits3(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+/// Inverse of SpreadBits3.
+uint64_t CompactBits3(uint64_t x) {
+    x &= 0x1249249249249249;
+    x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3;
+    x = (x ^ (x >> 4)) & 0x100f00f00f00f00f;
+    x = (x ^ (x >> 8)) & 0x1f0000ff0000ff;
+    x = (x ^ (x >> 16)) & 0x1f00000000ffff;
+    x = (x ^ (x >> 32)) & 0x1fffff;
+    return x;
+}
+
+/// Morton code of the leaf containing point. The point must be in bound.
+uint64_t EncodeMortonCode(const Eigen::Vector3d& point,
+                          const Eigen::Vector3d& origin,
+                          double leaf_size,
+                          uint64_t resolution) {
+    Eigen::Array3d grid =
+            ((point - origin).array() / leaf_size)
+                    .floor()
+                    .max(0.0)
+                    .min(double(resolution - 1));
+    return SpreadBits3(uint64_t(grid(0))) |
+           SpreadBits3(uint64_t(grid(1))) << 1 |
+           SpreadBits3(uint64_t(grid(2))) << 2;
+}
+
+/// Integer grid coordinates of the leaf with the given Morton code.
+Eigen::Vector3i DecodeMortonCode(uint64_t code) {
+    return Eigen::Vector3i(int(CompactBits3(code)),
+                           int(CompactBits3(code >> 1)),
+                           int(CompactBits3(code >> 2)));
+}
+
+/// Stable LSD radix sort of codes on their lowest num_bits bits, permuting
+/// indices alongside. The input is split into one contiguous chunk per
+/// thread. Each pass counts the digits of every chunk in parallel, then every
+/// chunk scatters in parallel to its own offsets from a prefix sum in (digit,
+/// chunk) order, which keeps the sort stable. Passes where all codes share
+/// the same digit are skipped.
+void RadixSortMortonCodes(std::vector<uint64_t>& codes,
+                          std::vector<size_t>& indices,
+                          int num_bits) {
+    const int64_t n = int64_t(codes.size());
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(),
+                                 n / MIN_RADIX_CHUNK_SIZE));
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<uint64_t> codes_sorted(n);
+    std::vector<size_t> indices_sorted(n);
+    std::vector<int64_t> offsets(num_chunks * RADIX_SIZE);
+
+    for (int shift = 0; shift < num_bits; shift += RADIX_BITS) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int64_t chunk = 0; chunk < num_chunks; chunk++) {
+            int64_t* counts = offsets.data() + chunk * RADIX_SIZE;
+            const int64_t end = std::min(n, (chunk + 1) * chunk_size);
+            for (int64_t i = chunk * chunk_size; i < end; i++) {
+                counts[(codes[i] >> shift) & (RADIX_SIZE - 1)]++;
+            }
+        }
+
+        int64_t sum = 0;
+        bool is_single_digit = false;
+        for (int64_t digit = 0; digit < RADIX_SIZE; digit++) {
+            const int64_t digit_begin = sum;
+            for (int64_t chunk = 0; chunk < num_chunks; chunk++) {
+                const int64_t count = offsets[chunk * RADIX_SIZE + digit];
+                offsets[chunk * RADIX_SIZE + digit] = sum;
+                sum += count;
+            }
+            is_single_digit = is_single_digit || sum - digit_begin == n;
+        }
+        if (is_single_digit) {
+            continue;
+        }
+
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int64_t chunk = 0; chunk < num_chunks; chunk++) {
+            int64_t* positions = offsets.data() + chunk * RADIX_SIZE;
+            const int64_t end = std::min(n, (chunk + 1) * chunk_size);
+            for (int64_t i = chunk * chunk_size; i < end; i++) {
+                const int64_t pos =
+                        positions[(codes[i] >> shift) & (RADIX_SIZE - 1)]++;
+                codes_sorted[pos] = codes[i];
+                indices_sorted[pos] = indices[i];
+            }
+        }
+        codes.swap(codes_sorted);
+        indices.swap(indices_sorted);
+    }
+}
+
+/// Calls f(child_node, child_index) for each non-empty child of node, in
+/// child index order. shift is the position of the child index bits in the
+/// leaf codes.
+template <typename F>
+void ForEachChild(const std::vector<uint64_t>& leaf_codes,
+                  const LinearOctreeNode& node,
+                  int shift,
+                  F f) {
+    const auto codes_end = leaf_codes.begin() + node.leaf_end_;
+    size_t child_begin = node.leaf_begin_;
+    while (child_begin < node.leaf_end_) {
+        const uint64_t child_prefix = leaf_codes[child_begin] >> shift;
+        const size_t child_end =
+                std::upper_bound(leaf_codes.begin() + child_begin, codes_end,
+                                 child_prefix,
+                                 [shift](uint64_t prefix, uint64_t code) {
+                                     return prefix < (code >> shift);
+                                 }) -
+                leaf_codes.begin();
+        f(LinearOctreeNode(child_begin, child_end), size_t(child_prefix & 7));
+        child_begin = child_end;
+    }
+}
+
+Eigen::Vector3d GetChildOrigin(const OctreeNodeInfo& node_info,
+                               size_t child_index) {
+    double child_size = node_info.size_ / 2.0;
+    size_t x_index = child_index % 2;
+    size_t y_index = (child_index / 2) % 2;
+    size_t z_index = (child_index / 4) % 2;
+    return node_info.origin_ + Eigen::Vector3d(double(x_index),
+                                               double(y_index),
+                                               double(z_index)) *
+                                       child_size;
+}
+
+std::shared_ptr<OctreeNode> CreateOctreeNode(const LinearOctree& octree,
+                                             const LinearOctreeNode& node,
+                                             size_t depth) {
+    const bool has_points = !octree.point_indices_.empty();
+    const auto indices_begin = octree.point_indices_.begin() +
+                               octree.leaf_point_offsets_[node.leaf_begin_];
+    const auto indices_end = octree.point_indices_.begin() +
+                             octree.leaf_point_offsets_[node.leaf_end_];
+    if (depth == octree.max_depth_) {
+        if (has_points) {
+            auto leaf_node = std::make_shared<OctreePointColorLeafNode>();
+            leaf_node->color_ = octree.leaf_colors_[node.leaf_begin_];
+            leaf_node->indices_.assign(indices_begin, indices_end);
+            return leaf_node;
+        } else {
+            auto leaf_node = std::make_shared<OctreeColorLeafNode>();
+            leaf_node->color_ = octree.leaf_colors_[node.leaf_begin_];
+            return leaf_node;
+        }
+    }
+
+    std::shared_ptr<OctreeInternalNode> internal_node;
+    if (has_points) {
+        auto internal_point_node = std::make_shared<OctreeInternalPointNode>();
+        // Octree lists the points of internal nodes in insertion order.
+        internal_point_node->indices_.assign(indices_begin, indices_end);
+        std::sort(internal_point_node->indices_.begin(),
+                  internal_point_node->indices_.end());
+        internal_node = internal_point_node;
+    } else {
+        internal_node = std::make_shared<OctreeInternalNode>();
+    }
+    const int shift = int(3 * (octree.max_depth_ - depth - 1));
+    ForEachChild(octree.leaf_codes_, node, shift,
+                 [&](const LinearOctreeNode& child_node, size_t child_index) {
+                     internal_node->children_[child_index] =
+                             CreateOctreeNode(octree, child_node, depth + 1);
+                 });
+    return internal_node;
+}
+
+}  // namespace
+
+LinearOctree& LinearOctree::Clear() {
+    leaf_codes_.clear();
+    leaf_colors_.clear();
+    leaf_point_offsets_.clear();
+    point_indices_.clear();
+    return *this;
+}
+
+bool LinearOctree::IsEmpty() const { return leaf_codes_.empty(); }
+
+void LinearOctree::ConvertFromPointCloud(
+        const geometry::PointCloud& point_cloud, double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+
+    // Set bounds
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    BuildFromPoints(point_cloud.points_, point_cloud.colors_);
+}
+
+void LinearOctree::CreateFromVoxelGrid(const geometry::VoxelGrid& voxel_grid) {
+    origin_ = voxel_grid.origin_;
+    size_ = (voxel_grid.GetMaxBound() - origin_).maxCoeff();
+    double half_voxel_size = voxel_grid.voxel_size_ / 2.;
+    std::vector<Eigen::Vector3d> mid_points;
+    std::vector<Eigen::Vector3d> colors;
+    mid_points.reserve(voxel_grid.voxels_.size());
+    colors.reserve(voxel_grid.voxels_.size());
+    for (const auto& voxel_iter : voxel_grid.voxels_) {
+        const geometry::Voxel& voxel = voxel_iter.second;
+        mid_points.push_back(half_voxel_size + origin_.array() +
+                             voxel.grid_index_.array().cast<double>() *
+                                     voxel_grid.voxel_size_);
+        colors.push_back(voxel.color_);
+    }
+
+    BuildFromPoints(mid_points, colors);
+    point_indices_.clear();
+    leaf_point_offsets_.assign(leaf_codes_.size() + 1, 0);
+}
+
+void LinearOctree::BuildFromPoints(const std::vector<Eigen::Vector3d>& points,
+                                   const std::vector<Eigen::Vector3d>& colors) {
+    if (max_depth_ > MAX_SUPPORTED_DEPTH) {
+        utility::LogError("max_depth {} exceeds the supported maximum {}.",
+                          max_depth_, MAX_SUPPORTED_DEPTH);
+    }
+    Clear();
+
+    const int64_t num_points = int64_t(points.size());
+    const uint64_t resolution = uint64_t(1) << max_depth_;
+    const double leaf_size = size_ / double(resolution);
+    std::vector<uint64_t> codes(num_points);
+    std::vector<uint8_t> is_in_bound(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < num_points; idx++) {
+        is_in_bound[idx] = Octree::IsPointInBound(points[idx], origin_, size_);
+        if (is_in_bound[idx]) {
+            codes[idx] = EncodeMortonCode(points[idx], origin_, leaf_size,
+                                          resolution);
+        }
+    }
+
+    // Drop the points out of bound, like Octree::InsertPoint does.
+    std::vector<size_t> indices;
+    indices.reserve(num_points);
+    for (int64_t idx = 0; idx < num_points; idx++) {
+        if (is_in_bound[idx]) {
+            codes[indices.size()] = codes[idx];
+            indices.push_back(size_t(idx));
+        }
+    }
+    codes.resize(indices.size());
+
+    RadixSortMortonCodes(codes, indices, int(3 * max_depth_));
+
+    for (size_t i = 0; i < codes.size(); i++) {
+        if (i == 0 || codes[i] != codes[i - 1]) {
+            leaf_codes_.push_back(codes[i]);
+            leaf_point_offsets_.push_back(i);
+        }
+    }
+    leaf_point_offsets_.push_back(codes.size());
+
+    // As in Octree, the last point inserted to a leaf sets its color.
+    const bool has_colors = colors.size() == points.size();
+    leaf_colors_.resize(leaf_codes_.size(), Eigen::Vector3d::Zero());
+    if (has_colors) {
+        for (size_t leaf = 0; leaf < leaf_codes_.size(); leaf++) {
+            leaf_colors_[leaf] =
+                    colors[indices[leaf_point_offsets_[leaf + 1] - 1]];
+        }
+    }
+    point_indices_ = std::move(indices);
+}
+
+std::shared_ptr<geometry::VoxelGrid> LinearOctree::ToVoxelGrid() const {
+    auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
+    voxel_grid->origin_ = origin_;
+    voxel_grid->voxel_size_ = size_ / double(uint64_t(1) << max_depth_);
+    for (size_t leaf = 0; leaf < leaf_codes_.size(); leaf++) {
+        voxel_grid->AddVoxel(Voxel(DecodeMortonCode(leaf_codes_[leaf]),
+                                   leaf_colors_[leaf]));
+    }
+    return voxel_grid;
+}
+
+std::shared_ptr<geometry::Octree> LinearOctree::ToOctree() const {
+    auto octree =
+            std::make_shared<geometry::Octree>(max_depth_, origin_, size_);
+    if (!IsEmpty()) {
+        octree->root_node_ = CreateOctreeNode(
+                *this, LinearOctreeNode(0, leaf_codes_.size()), 0);
+    }
+    return octree;
+}
+
+void LinearOctree::Traverse(
+        const std::function<bool(const LinearOctreeNode&,
+                                 const OctreeNodeInfo&)>& f) const {
+    if (IsEmpty()) {
+        return;
+    }
+    // The root's child index is 0, though it isn't a child node
+    TraverseRecurse(LinearOctreeNode(0, leaf_codes_.size()),
+                    OctreeNodeInfo(origin_, size_, 0, 0), f);
+}
+
+void LinearOctree::TraverseRecurse(
+        const LinearOctreeNode& node,
+        const OctreeNodeInfo& node_info,
+        const std::function<bool(const LinearOctreeNode&,
+                                 const OctreeNodeInfo&)>& f) const {
+    // Allow caller to avoid traversing further down this tree path
+    if (f(node, node_info) || node_info.depth_ == max_depth_) {
+        return;
+    }
+    const int shift = int(3 * (max_depth_ - node_info.depth_ - 1));
+    ForEachChild(leaf_codes_, node, shift,
+                 [&](const LinearOctreeNode& child_node, size_t child_index) {
+                     TraverseRecurse(
+                             child_node,
+                             OctreeNodeInfo(
+                                     GetChildOrigin(node_info, child_index),
+                                     node_info.size_ / 2.0,
+                                     node_info.depth_ + 1, child_index),
+                             f);
+                 });
+}
+
+std::pair<int64_t, OctreeNodeInfo> LinearOctree::LocateLeafNode(
+        const Eigen::Vector3d& point) const {
+    if (!Octree::IsPointInBound(point, origin_, size_)) {
+        return std::make_pair(int64_t(-1), OctreeNodeInfo());
+    }
+    const uint64_t resolution = uint64_t(1) << max_depth_;
+    const double leaf_size = size_ / double(resolution);
+    const uint64_t code =
+            EncodeMortonCode(point, origin_, leaf_size, resolution);
+
+    auto it = std::lower_bound(leaf_codes_.begin(), leaf_codes_.end(), code);
+    int64_t leaf = -1;
+    if (it != leaf_codes_.end() && *it == code) {
+        leaf = int64_t(it - leaf_codes_.begin());
+    }
+    OctreeNodeInfo leaf_info(
+            origin_ + DecodeMortonCode(code).cast<double>() * leaf_size,
+            leaf_size, max_depth_, max_depth_ == 0 ? 0 : size_t(code & 7));
+    return std::make_pair(leaf, leaf_info);
+}
+
+std::vector<size_t> LinearOctree::GetPointIndices(
+        const LinearOctreeNode& node) const {
+    if (point_indices_.empty()) {
+        return {};
+    }
+    return std::vector<size_t>(
+            point_indices_.begin() + leaf_point_offsets_[node.leaf_begin_],
+            point_indices_.begin() + leaf_point_offsets_[node.leaf_end_]);
+}
+
+}  // namespace geometry
+}  // namespace open3d
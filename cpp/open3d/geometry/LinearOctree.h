@@ -0,0 +1,209 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+class VoxelGrid;
+
+/// \class LinearOctreeNode
+///
+/// \brief A node of a LinearOctree.
+///
+/// A node does not own any data. It refers to the contiguous range of leaves
+/// of the LinearOctree, and hence of point indices, that lie inside of it.
+class LinearOctreeNode {
+public:
+    /// \brief Default Constructor.
+    LinearOctreeNode() : leaf_begin_(0), leaf_end_(0) {}
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param leaf_begin Index of the first leaf inside the node.
+    /// \param leaf_end One past the index of the last leaf inside the node.
+    LinearOctreeNode(size_t leaf_begin, size_t leaf_end)
+        : leaf_begin_(leaf_begin), leaf_end_(leaf_end) {}
+    ~LinearOctreeNode() {}
+
+public:
+    /// Index of the first leaf inside the node.
+    size_t leaf_begin_;
+    /// One past the index of the last leaf inside the node.
+    size_t leaf_end_;
+};
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree stored in arrays sorted by Morton code.
+///
+/// Only the occupied leaves at max_depth_ are stored. Each leaf is identified
+/// by the Morton code of its integer grid coordinates. The 3 most significant
+/// bits of the code are the child index of the root, following the child
+/// ordering of OctreeInternalNode, the next 3 bits are the child index at
+/// depth 1, and so on. Since leaves are sorted by code, every internal node
+/// covers a contiguous range of leaves, and since point indices are grouped
+/// by leaf, the points of every node are a contiguous range of
+/// point_indices_.
+///
+/// Compared to Octree, building does not allocate per node and is done in
+/// parallel with a radix sort of the Morton codes.
+class LinearOctree {
+public:
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the LinearOctree.
+    LinearOctree(const size_t& max_depth)
+        : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the LinearOctree.
+    /// \param origin Sets the global min bound of the LinearOctree.
+    /// \param size Sets the outer bounding box edge size for the whole octree.
+    LinearOctree(const size_t& max_depth,
+                 const Eigen::Vector3d& origin,
+                 const double& size)
+        : origin_(origin), size_(size), max_depth_(max_depth) {}
+    ~LinearOctree() {}
+
+public:
+    /// Clear all leaves, keeping the bounds and max depth.
+    LinearOctree& Clear();
+
+    /// Returns true if the LinearOctree has no leaves.
+    bool IsEmpty() const;
+
+    /// \brief Convert octree from point cloud.
+    ///
+    /// The bounds are computed the same way as Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// \brief Convert from voxel grid.
+    ///
+    /// Each voxel center is inserted with the voxel color. No point indices
+    /// are stored.
+    void CreateFromVoxelGrid(const geometry::VoxelGrid& voxel_grid);
+
+    /// Convert to VoxelGrid, with one voxel per leaf.
+    std::shared_ptr<geometry::VoxelGrid> ToVoxelGrid() const;
+
+    /// \brief Convert to the pointer-based Octree.
+    ///
+    /// If the LinearOctree was built from a point cloud, the nodes are
+    /// OctreeInternalPointNode and OctreePointColorLeafNode, as built by
+    /// Octree::ConvertFromPointCloud. Otherwise they are OctreeInternalNode
+    /// and OctreeColorLeafNode.
+    std::shared_ptr<geometry::Octree> ToOctree() const;
+
+    /// \brief DFS traversal of the LinearOctree from the root, with callback
+    /// function called for each node.
+    ///
+    /// Nodes are visited in the same order as Octree::Traverse.
+    ///
+    /// \param f Callback which fires with each traversed internal/leaf node.
+    /// A node is a leaf iff its depth is max_depth_. If f returns true,
+    /// children of this node will not be traversed.
+    void Traverse(const std::function<bool(const LinearOctreeNode&,
+                                           const OctreeNodeInfo&)>& f) const;
+
+    /// \brief Returns the index of the leaf where the query point should
+    /// reside, and the OctreeNodeInfo of that leaf.
+    ///
+    /// The index is -1 if the leaf is not occupied. If the point is out of
+    /// bound, the index is -1 and the OctreeNodeInfo is default constructed.
+    ///
+    /// \param point Coordinates of the point.
+    std::pair<int64_t, OctreeNodeInfo> LocateLeafNode(
+            const Eigen::Vector3d& point) const;
+
+    /// Returns the indices of the points inside the node.
+    std::vector<size_t> GetPointIndices(const LinearOctreeNode& node) const;
+
+public:
+    /// Deepest supported max_depth_, limited by the 64 bit Morton codes.
+    static const size_t MAX_SUPPORTED_DEPTH = 21;
+
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree. A point is within
+    /// bound iff origin_ <= point < origin_ + size_.
+    double size_;
+
+    /// Max depth of octree. All leaves are at this depth.
+    size_t max_depth_;
+
+    /// Morton codes of the occupied leaves, in increasing order.
+    std::vector<uint64_t> leaf_codes_;
+
+    /// Color of each leaf, from the last point inserted to it.
+    std::vector<Eigen::Vector3d> leaf_colors_;
+
+    /// Points of leaf i are point_indices_[leaf_point_offsets_[i]] to
+    /// point_indices_[leaf_point_offsets_[i + 1] - 1]. Has one more element
+    /// than leaf_codes_.
+    std::vector<size_t> leaf_point_offsets_;
+
+    /// Point indices grouped by leaf, in increasing order within each leaf.
+    /// Empty if the LinearOctree was built from a VoxelGrid.
+    std::vector<size_t> point_indices_;
+
+private:
+    /// Builds the leaves from points and their colors. Points out of bound
+    /// are skipped.
+    void BuildFromPoints(const std::vector<Eigen::Vector3d>& points,
+                         const std::vector<Eigen::Vector3d>& colors);
+
+    void TraverseRecurse(
+            const LinearOctreeNode& node,
+            const OctreeNodeInfo& node_info,
+            const std::function<bool(const LinearOctreeNode&,
+                                     const OctreeNodeInfo&)>& f) const;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -325,17 +325,52 @@ public:
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// The hypotheses are evaluated in parallel and the number of iterations
+    /// is reduced adaptively once a hypothesis with enough inliers has been
+    /// found.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param preverification_n If positive, each hypothesis is first
+    /// evaluated on a random subset of this many points, and is discarded
+    /// without a full evaluation if it fits the subset clearly worse than the
+    /// best hypothesis so far.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            const int preverification_n = 0) const;
+
+    /// \brief Segment multiple planes from the PointCloud by running
+    /// SegmentPlane repeatedly on the points not assigned to a plane yet.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param max_num_planes Maximum number of planes.
+    /// \param min_num_inliers The extraction stops when the next plane has
+    /// less inliers.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param preverification_n See SegmentPlane.
+    /// \return Returns the plane models ax + by + cz + d = 0 and the indices
+    /// of their inliers, in the order they were extracted.
+    std::tuple<std::vector<Eigen::Vector4d>, std::vector<std::vector<size_t>>>
+    SegmentPlanes(const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const int max_num_planes = 10,
+                  const size_t min_num_inliers = 100,
+                  const double probability = 0.99999999,
+                  const int preverification_n = 0) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -33,7 +33,9 @@
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -43,42 +45,60 @@ namespace geometry {
 /// \brief Stores the current best result in the RANSAC algorithm.
 class RANSACResult {
 public:
-    RANSACResult() : fitness_(0), inlier_rmse_(0) {}
+    RANSACResult() : fitness_(0), inlier_rmse_(0), inlier_num_(0) {}
     ~RANSACResult() {}
 
+    bool IsBetterThan(const RANSACResult &other) const {
+        return inlier_num_ > other.inlier_num_ ||
+               (inlier_num_ == other.inlier_num_ &&
+                inlier_rmse_ < other.inlier_rmse_);
+    }
+
 public:
     double fitness_;
     double inlier_rmse_;
+    size_t inlier_num_;
 };
 
 // Calculates the number of inliers given a list of points and a plane model,
 // and the total distance between the inliers and the plane. These numbers are
 // then used to evaluate how well the plane model fits the given points.
-RANSACResult EvaluateRANSACBasedOnDistance(
+//
+// The evaluation stops early, leaving the result with zero fitness, as soon as
+// the remaining points can no longer bring the number of inliers up to
+// min_inlier_num. If indices is not empty, only the indexed points are
+// evaluated.
+static RANSACResult EvaluateRANSACBasedOnDistance(
         const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
+        const std::vector<size_t> &indices,
+        const Eigen::Vector4d &plane_model,
         double distance_threshold,
-        double error) {
+        size_t min_inlier_num) {
     RANSACResult result;
+    const size_t num = indices.empty() ? points.size() : indices.size();
+    if (num < min_inlier_num) {
+        return result;
+    }
 
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
+    double error = 0;
+    size_t inlier_num = 0;
+    for (size_t k = 0; k < num; ++k) {
+        const Eigen::Vector3d &point =
+                indices.empty() ? points[k] : points[indices[k]];
+        double distance =
+                std::abs(plane_model.head<3>().dot(point) + plane_model(3));
 
         if (distance < distance_threshold) {
             error += distance;
-            inliers.emplace_back(idx);
+            inlier_num++;
+        } else if (inlier_num + (num - k - 1) < min_inlier_num) {
+            return result;
         }
     }
 
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
+    if (inlier_num > 0) {
+        result.inlier_num_ = inlier_num;
+        result.fitness_ = (double)inlier_num / (double)num;
         result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
     }
     return result;
@@ -89,8 +109,9 @@ RANSACResult EvaluateRANSACBasedOnDistance(
 //
 // Reference:
 // https://www.ilikebigbits.com/2015_03_04_plane_from_points.html
-Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
-                                   const std::vector<size_t> &inliers) {
+static Eigen::Vector4d GetPlaneFromPoints(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &inliers) {
     Eigen::Vector3d centroid(0, 0, 0);
     for (size_t idx : inliers) {
         centroid += points[idx];
@@ -132,72 +153,149 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
-
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
-
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
-
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
-
-    std::random_device rd;
-    std::mt19937 rng(rd());
+// Samples ransac_n distinct indices in [0, num_points).
+static std::vector<size_t> SampleDistinctIndices(size_t num_points,
+                                                 int ransac_n) {
+    const std::vector<int64_t> sampled = utility::UniformRandDistinctInts(
+            ransac_n, static_cast<int64_t>(num_points));
+    return std::vector<size_t>(sampled.begin(), sampled.end());
+}
 
-    // Return if ransac_n is less than the required plane model parameters.
+static void CheckSegmentPlaneArguments(size_t num_points,
+                                       int ransac_n,
+                                       double probability) {
     if (ransac_n < 3) {
         utility::LogError(
                 "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
     }
     if (num_points < size_t(ransac_n)) {
         utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
     }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("Probability must be > 0 and <= 1.0");
+    }
+}
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
+// RANSAC plane fitting on points. Hypotheses are evaluated in parallel, and
+// the number of iterations is reduced adaptively so that a hypothesis with
+// only inliers is drawn with the given probability.
+static std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability,
+        int preverification_n) {
+    const size_t num_points = points.size();
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
-        }
+    // Random subset the hypotheses are first evaluated on.
+    std::vector<size_t> preverification_indices;
+    if (preverification_n > 0 && size_t(preverification_n) < num_points) {
+        preverification_indices =
+                SampleDistinctIndices(num_points, preverification_n);
+        std::sort(preverification_indices.begin(),
+                  preverification_indices.end());
+    }
+
+    RANSACResult result;
+    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+    int exit_itr = -1;
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        RANSACResult result_local;
+        RANSACResult preverification_result_local;
+        Eigen::Vector4d best_plane_model_local = Eigen::Vector4d(0, 0, 0, 0);
+        int exit_itr_local = num_iterations;
+        std::vector<Eigen::Vector3d> sampled_points(ransac_n);
+        const std::vector<size_t> sampled_point_indices = [ransac_n]() {
+            std::vector<size_t> indices(ransac_n);
+            std::iota(indices.begin(), indices.end(), 0);
+            return indices;
+        }();
+
+#pragma omp for schedule(dynamic) nowait
+        for (int itr = 0; itr < num_iterations; itr++) {
+            if (itr >= exit_itr_local) continue;
+
+            const std::vector<size_t> sampled =
+                    SampleDistinctIndices(num_points, ransac_n);
+            for (int i = 0; i < ransac_n; ++i) {
+                sampled_points[i] = points[sampled[i]];
+            }
+
+            // Fit model to num_model_parameters randomly selected points
+            // among the inliers.
+            Eigen::Vector4d plane_model;
+            if (ransac_n == 3) {
+                plane_model = TriangleMesh::ComputeTrianglePlane(
+                        sampled_points[0], sampled_points[1],
+                        sampled_points[2]);
+            } else {
+                plane_model = GetPlaneFromPoints(sampled_points,
+                                                 sampled_point_indices);
+            }
+            if (plane_model.isZero(0)) {
+                continue;
+            }
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+            // A hypothesis is discarded if its fitness on the subset is more
+            // than three standard deviations below the best fitness so far.
+            if (!preverification_indices.empty() &&
+                result_local.inlier_num_ > 0) {
+                const double n = double(preverification_indices.size());
+                const double f = result_local.fitness_;
+                const double min_fitness =
+                        f - 3.0 * std::sqrt(f * (1.0 - f) / n);
+                const size_t min_inlier_num =
+                        size_t(std::ceil(std::max(0.0, min_fitness) * n));
+                if (min_inlier_num > 0 &&
+                    EvaluateRANSACBasedOnDistance(
+                            points, preverification_indices, plane_model,
+                            distance_threshold, min_inlier_num)
+                                    .inlier_num_ == 0) {
+                    continue;
+                }
+            }
+
+            const RANSACResult this_result = EvaluateRANSACBasedOnDistance(
+                    points, {}, plane_model, distance_threshold,
+                    result_local.inlier_num_);
+            if (this_result.IsBetterThan(result_local)) {
+                result_local = this_result;
+                best_plane_model_local = plane_model;
+
+                // Update exit condition if necessary.
+                if (result_local.fitness_ < 1.0) {
+                    const double exit_itr_d =
+                            std::log(1.0 - probability) /
+                            std::log(1.0 -
+                                     std::pow(result_local.fitness_, ransac_n));
+                    exit_itr_local =
+                            exit_itr_d < double(exit_itr_local)
+                                    ? static_cast<int>(std::ceil(exit_itr_d))
+                                    : exit_itr_local;
+                } else {
+                    exit_itr_local = 0;
+                }
+            }
+        }
+#pragma omp critical(SegmentPlaneRANSAC)
+        {
+            if (result_local.IsBetterThan(result)) {
+                result = result_local;
+                best_plane_model = best_plane_model_local;
+            }
+            if (exit_itr_local > exit_itr) {
+                exit_itr = exit_itr_local;
+            }
         }
     }
 
     // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
+    std::vector<size_t> inliers;
+    for (size_t idx = 0; idx < num_points; ++idx) {
+        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
         double distance = std::abs(best_plane_model.dot(point));
 
@@ -207,12 +305,81 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     }
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    best_plane_model = GetPlaneFromPoints(points, inliers);
 
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
+    utility::LogDebug(
+            "RANSAC exits at {:d}-th iteration | Inliers: {:d}, Fitness: "
+            "{:e}, RMSE: {:e}",
+            std::min(exit_itr, num_iterations), inliers.size(),
+            result.fitness_, result.inlier_rmse_);
     return std::make_tuple(best_plane_model, inliers);
 }
 
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */,
+        const int preverification_n /* = 0 */) const {
+    CheckSegmentPlaneArguments(points_.size(), ransac_n, probability);
+    return SegmentPlaneRANSAC(points_, distance_threshold, ransac_n,
+                              num_iterations, probability, preverification_n);
+}
+
+std::tuple<std::vector<Eigen::Vector4d>, std::vector<std::vector<size_t>>>
+PointCloud::SegmentPlanes(const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const int max_num_planes /* = 10 */,
+                          const size_t min_num_inliers /* = 100 */,
+                          const double probability /* = 0.99999999 */,
+                          const int preverification_n /* = 0 */) const {
+    CheckSegmentPlaneArguments(points_.size(), ransac_n, probability);
+
+    std::vector<Eigen::Vector4d> plane_models;
+    std::vector<std::vector<size_t>> plane_inliers;
+
+    // Indices into points_ of the points not assigned to a plane yet.
+    std::vector<size_t> remaining_indices(points_.size());
+    std::iota(remaining_indices.begin(), remaining_indices.end(), 0);
+    std::vector<Eigen::Vector3d> remaining_points = points_;
+    std::vector<bool> is_inlier;
+
+    while (int(plane_models.size()) < max_num_planes &&
+           remaining_points.size() >= std::max(size_t(ransac_n),
+                                               min_num_inliers)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) = SegmentPlaneRANSAC(
+                remaining_points, distance_threshold, ransac_n,
+                num_iterations, probability, preverification_n);
+        if (plane_model.isZero(0) || inliers.size() < min_num_inliers) {
+            break;
+        }
+
+        is_inlier.assign(remaining_points.size(), false);
+        for (size_t &idx : inliers) {
+            is_inlier[idx] = true;
+            idx = remaining_indices[idx];
+        }
+        size_t num_remaining = 0;
+        for (size_t k = 0; k < remaining_points.size(); ++k) {
+            if (!is_inlier[k]) {
+                remaining_points[num_remaining] = remaining_points[k];
+                remaining_indices[num_remaining] = remaining_indices[k];
+                num_remaining++;
+            }
+        }
+        remaining_points.resize(num_remaining);
+        remaining_indices.resize(num_remaining);
+
+        utility::LogDebug("SegmentPlanes | Plane {:d}: {:d} inliers",
+                          plane_models.size(), inliers.size());
+        plane_models.push_back(plane_model);
+        plane_inliers.push_back(std::move(inliers));
+    }
+    return std::make_tuple(plane_models, plane_inliers);
+}
+
 }  // namespace geometry
 }  // namespace open3d
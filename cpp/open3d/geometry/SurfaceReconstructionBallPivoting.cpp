@@ -25,14 +25,19 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <deque>
 #include <iostream>
 #include <list>
+#include <unordered_map>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -100,6 +105,190 @@ public:
     Eigen::Vector3d ball_center_;
 };
 
+/// Computes the center of the ball of \p radius touching the points
+/// \p vidx1, \p vidx2 and \p vidx3, on the side of their normals. Returns
+/// false if the points are collinear or the ball is too small.
+static bool ComputeBallCenter(const std::vector<Eigen::Vector3d>& points,
+                              const std::vector<Eigen::Vector3d>& normals,
+                              int vidx1,
+                              int vidx2,
+                              int vidx3,
+                              double radius,
+                              Eigen::Vector3d& center) {
+    const Eigen::Vector3d& v1 = points[vidx1];
+    const Eigen::Vector3d& v2 = points[vidx2];
+    const Eigen::Vector3d& v3 = points[vidx3];
+    double c = (v2 - v1).squaredNorm();
+    double b = (v1 - v3).squaredNorm();
+    double a = (v3 - v2).squaredNorm();
+
+    double alpha = a * (b + c - a);
+    double beta = b * (a + c - b);
+    double gamma = c * (a + b - c);
+    double abg = alpha + beta + gamma;
+
+    if (abg < 1e-16) {
+        return false;
+    }
+
+    alpha = alpha / abg;
+    beta = beta / abg;
+    gamma = gamma / abg;
+
+    Eigen::Vector3d circ_center = alpha * v1 + beta * v2 + gamma * v3;
+    double circ_radius2 = a * b * c;
+
+    a = std::sqrt(a);
+    b = std::sqrt(b);
+    c = std::sqrt(c);
+    circ_radius2 = circ_radius2 /
+                   ((a + b + c) * (b + c - a) * (c + a - b) * (a + b - c));
+
+    double height = radius * radius - circ_radius2;
+    if (height >= 0.0) {
+        Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
+        tr_norm /= tr_norm.norm();
+        Eigen::Vector3d pt_norm =
+                normals[vidx1] + normals[vidx2] + normals[vidx3];
+        pt_norm /= pt_norm.norm();
+        if (tr_norm.dot(pt_norm) < 0) {
+            tr_norm *= -1;
+        }
+
+        height = sqrt(height);
+        center = circ_center + height * tr_norm;
+        return true;
+    }
+    return false;
+}
+
+static Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
+                                         const Eigen::Vector3d& v1,
+                                         const Eigen::Vector3d& v2) {
+    Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
+    double norm = normal.norm();
+    if (norm > 0) {
+        normal /= norm;
+    }
+    return normal;
+}
+
+/// Returns whether the triangle \p v0, \p v1, \p v2 can be oriented along
+/// the normals of all three vertices.
+static bool IsCompatible(const std::vector<Eigen::Vector3d>& points,
+                         const std::vector<Eigen::Vector3d>& normals,
+                         int v0,
+                         int v1,
+                         int v2) {
+    Eigen::Vector3d normal =
+            ComputeFaceNormal(points[v0], points[v1], points[v2]);
+    if (normal.dot(normals[v0]) < -1e-16) {
+        normal *= -1;
+    }
+    return normal.dot(normals[v0]) > -1e-16 &&
+           normal.dot(normals[v1]) > -1e-16 &&
+           normal.dot(normals[v2]) > -1e-16;
+}
+
+/// Returns whether the triangle \p source, \p target, \p opposite faces
+/// away from the normals of its vertices, i.e. whether the edge from
+/// \p source to \p target has to be reversed to orient the triangle.
+static bool IsReversedEdge(const Eigen::Vector3d& source,
+                           const Eigen::Vector3d& target,
+                           const Eigen::Vector3d& opposite,
+                           const Eigen::Vector3d& source_normal,
+                           const Eigen::Vector3d& target_normal,
+                           const Eigen::Vector3d& opposite_normal) {
+    Eigen::Vector3d tr_norm = (target - source).cross(opposite - source);
+    Eigen::Vector3d pt_norm = source_normal + target_normal + opposite_normal;
+    return pt_norm.dot(tr_norm) < 0;
+}
+
+/// Returns whether no point other than \p v0, \p v1, \p v2 of \p indices
+/// is inside the ball of \p radius at \p center.
+static bool IsEmptyBall(const std::vector<Eigen::Vector3d>& points,
+                        const Eigen::Vector3d& center,
+                        double radius,
+                        const std::vector<int>& indices,
+                        int v0,
+                        int v1,
+                        int v2) {
+    for (int idx : indices) {
+        if (idx != v0 && idx != v1 && idx != v2 &&
+            (center - points[idx]).norm() < radius - 1e-16) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Pivots the ball of \p radius at \p center around the edge from \p src to
+/// \p tgt of the triangle with \p opp, and returns the first vertex hit with
+/// an empty ball, -1 if none.
+static int PivotBall(const KDTreeFlann& kdtree,
+                     const std::vector<Eigen::Vector3d>& points,
+                     const std::vector<Eigen::Vector3d>& normals,
+                     int src,
+                     int tgt,
+                     int opp,
+                     const Eigen::Vector3d& center,
+                     double radius,
+                     Eigen::Vector3d& candidate_center) {
+    const Eigen::Vector3d mp = 0.5 * (points[src] + points[tgt]);
+    Eigen::Vector3d v = points[tgt] - points[src];
+    v /= v.norm();
+    Eigen::Vector3d a = center - mp;
+    a /= a.norm();
+
+    std::vector<int> indices;
+    std::vector<double> dists2;
+    kdtree.SearchRadius(mp, 2 * radius, indices, dists2);
+
+    int min_candidate = -1;
+    double min_angle = 2 * M_PI;
+    for (int candidate : indices) {
+        if (candidate == src || candidate == tgt || candidate == opp) {
+            continue;
+        }
+
+        bool coplanar = IntersectionTest::PointsCoplanar(
+                points[src], points[tgt], points[opp], points[candidate]);
+        if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
+                                 mp, points[candidate], points[src],
+                                 points[opp]) < 1e-12 ||
+                         IntersectionTest::LineSegmentsMinimumDistance(
+                                 mp, points[candidate], points[tgt],
+                                 points[opp]) < 1e-12)) {
+            continue;
+        }
+
+        Eigen::Vector3d new_center;
+        if (!ComputeBallCenter(points, normals, src, tgt, candidate, radius,
+                               new_center)) {
+            continue;
+        }
+
+        Eigen::Vector3d b = new_center - mp;
+        b /= b.norm();
+        double cosinus = std::max(std::min(a.dot(b), 1.0), -1.0);
+        double angle = std::acos(cosinus);
+        if (a.cross(b).dot(v) < 0) {
+            angle = 2 * M_PI - angle;
+        }
+        if (angle >= min_angle) {
+            continue;
+        }
+
+        if (IsEmptyBall(points, new_center, radius, indices, src, tgt,
+                        candidate)) {
+            min_angle = angle;
+            min_candidate = candidate;
+            candidate_center = new_center;
+        }
+    }
+    return min_candidate;
+}
+
 void BallPivotingVertex::UpdateType() {
     if (edges_.empty()) {
         type_ = Type::Orphan;
@@ -121,14 +310,9 @@ void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
             type_ = Type::Front;
             // update orientation
             if (BallPivotingVertexPtr opp = GetOppositeVertex()) {
-                Eigen::Vector3d tr_norm =
-                        (target_->point_ - source_->point_)
-                                .cross(opp->point_ - source_->point_);
-                tr_norm /= tr_norm.norm();
-                Eigen::Vector3d pt_norm =
-                        source_->normal_ + target_->normal_ + opp->normal_;
-                pt_norm /= pt_norm.norm();
-                if (pt_norm.dot(tr_norm) < 0) {
+                if (IsReversedEdge(source_->point_, target_->point_,
+                                   opp->point_, source_->normal_,
+                                   target_->normal_, opp->normal_)) {
                     std::swap(target_, source_);
                 }
             } else {
@@ -162,7 +346,10 @@ BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
 class BallPivoting {
 public:
     BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
+        : has_normals_(pcd.HasNormals()),
+          points_(pcd.points_),
+          normals_(pcd.normals_),
+          kdtree_(pcd) {
         mesh_ = std::make_shared<TriangleMesh>();
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
@@ -180,59 +367,6 @@ public:
         }
     }
 
-    bool ComputeBallCenter(int vidx1,
-                           int vidx2,
-                           int vidx3,
-                           double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
-        double c = (v2 - v1).squaredNorm();
-        double b = (v1 - v3).squaredNorm();
-        double a = (v3 - v2).squaredNorm();
-
-        double alpha = a * (b + c - a);
-        double beta = b * (a + c - b);
-        double gamma = c * (a + b - c);
-        double abg = alpha + beta + gamma;
-
-        if (abg < 1e-16) {
-            return false;
-        }
-
-        alpha = alpha / abg;
-        beta = beta / abg;
-        gamma = gamma / abg;
-
-        Eigen::Vector3d circ_center = alpha * v1 + beta * v2 + gamma * v3;
-        double circ_radius2 = a * b * c;
-
-        a = std::sqrt(a);
-        b = std::sqrt(b);
-        c = std::sqrt(c);
-        circ_radius2 = circ_radius2 /
-                       ((a + b + c) * (b + c - a) * (c + a - b) * (a + b - c));
-
-        double height = radius * radius - circ_radius2;
-        if (height >= 0.0) {
-            Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
-            tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
-            pt_norm /= pt_norm.norm();
-            if (tr_norm.dot(pt_norm) < 0) {
-                tr_norm *= -1;
-            }
-
-            height = sqrt(height);
-            center = circ_center + height * tr_norm;
-            return true;
-        }
-        return false;
-    }
-
     BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
                                        const BallPivotingVertexPtr& v1) {
         for (BallPivotingEdgePtr edge0 : v0->edges_) {
@@ -296,31 +430,14 @@ public:
         mesh_->triangle_normals_.push_back(face_normal);
     }
 
-    Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
-                                      const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
-        Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
-        double norm = normal.norm();
-        if (norm > 0) {
-            normal /= norm;
-        }
-        return normal;
-    }
-
     bool IsCompatible(const BallPivotingVertexPtr& v0,
                       const BallPivotingVertexPtr& v1,
                       const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
-        Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
-            normal *= -1;
-        }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
-        utility::LogDebug("[IsCompatible] returns = {}", ret);
+        bool ret = geometry::IsCompatible(points_, normals_, v0->idx_,
+                                          v1->idx_, v2->idx_);
+        utility::LogDebug(
+                "[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={} returns {}",
+                v0->idx_, v1->idx_, v2->idx_, ret);
         return ret;
     }
 
@@ -340,141 +457,13 @@ public:
         }
         utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
                           src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
-
-        Eigen::Vector3d v = tgt->point_ - src->point_;
-        v /= v.norm();
-
-        Eigen::Vector3d a = center - mp;
-        a /= a.norm();
 
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
-        utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
-                          indices.size());
-
-        BallPivotingVertexPtr min_candidate = nullptr;
-        double min_angle = 2 * M_PI;
-        for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
-                continue;
-            }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
-
-            bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
-            if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
-                             IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is intersecting "
-                        "the existing triangle",
-                        candidate->idx_);
-                continue;
-            }
-
-            Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} can not compute "
-                        "ball",
-                        candidate->idx_);
-                continue;
-            }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
-
-            Eigen::Vector3d b = new_center - mp;
-            b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
-
-            double cosinus = a.dot(b);
-            cosinus = std::min(cosinus, 1.0);
-            cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
-
-            double angle = std::acos(cosinus);
-
-            Eigen::Vector3d c = a.cross(b);
-            if (c.dot(v) < 0) {
-                angle = 2 * M_PI - angle;
-            }
-
-            if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
-                continue;
-            }
-
-            bool empty_ball = true;
-            for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
-                    continue;
-                }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
-                            "[FindCandidateVertex] candidate {:d} not an empty "
-                            "ball",
-                            candidate->idx_);
-                    empty_ball = false;
-                    break;
-                }
-            }
-
-            if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
-                min_angle = angle;
-                min_candidate = vertices[nbidx];
-                candidate_center = new_center;
-            }
-        }
-
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
-        return min_candidate;
+        const int min_candidate =
+                PivotBall(kdtree_, points_, normals_, src->idx_, tgt->idx_,
+                          opp->idx_, edge->triangle0_->ball_center_, radius,
+                          candidate_center);
+        utility::LogDebug("[FindCandidateVertex] returns {:d}", min_candidate);
+        return min_candidate < 0 ? nullptr : vertices[min_candidate];
     }
 
     void ExpandTriangulation(double radius) {
@@ -549,7 +538,8 @@ public:
             return false;
         }
 
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
+        if (!ComputeBallCenter(points_, normals_, v0->idx_, v1->idx_, v2->idx_,
+                               radius, center)) {
             utility::LogDebug(
                     "[TryTriangleSeed] returns {} could not compute ball "
                     "center",
@@ -558,19 +548,12 @@ public:
         }
 
         // test if no other point is within the ball
-        for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
-                continue;
-            }
-            if ((center - v->point_).norm() < radius - 1e-16) {
-                utility::LogDebug(
-                        "[TryTriangleSeed] returns {} computed ball is not "
-                        "empty",
-                        false);
-                return false;
-            }
+        if (!IsEmptyBall(points_, center, radius, nb_indices, v0->idx_,
+                         v1->idx_, v2->idx_)) {
+            utility::LogDebug(
+                    "[TryTriangleSeed] returns {} computed ball is not empty",
+                    false);
+            return false;
         }
 
         utility::LogDebug("[TryTriangleSeed] returns {}", true);
@@ -698,7 +681,7 @@ public:
                         triangle->vert2_->idx_);
 
                 Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
+                if (ComputeBallCenter(points_, normals_, triangle->vert0_->idx_,
                                       triangle->vert1_->idx_,
                                       triangle->vert2_->idx_, radius, center)) {
                     utility::LogDebug("[Run]   yes, we can work on this");
@@ -746,6 +729,8 @@ public:
 
 private:
     bool has_normals_;
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
     KDTreeFlann kdtree_;
     std::list<BallPivotingEdgePtr> edge_front_;
     std::list<BallPivotingEdgePtr> border_edges_;
@@ -753,11 +738,485 @@ private:
     std::shared_ptr<TriangleMesh> mesh_;
 };
 
+/// Side length of the cells of ParallelBallPivoting in ball radii. Large cells
+/// keep the share of front edges, which reach another cell and are processed
+/// sequentially, small.
+static const double kBallPivotingCellSizeInRadii = 20.0;
+
+/// \class ParallelBallPivoting
+///
+/// \brief Ball pivoting on flat index arrays, run independently on the cells
+/// of a regular grid and stitched along the cell boundaries afterwards.
+///
+/// Every cell only creates triangles whose vertices all lie in the cell, so
+/// the cells touch disjoint vertices and edges and can be processed in
+/// parallel. The empty ball tests still consider all points. A front edge
+/// whose pivoting ball first hits a vertex of another cell is deferred to the
+/// sequential seam pass, which also stores the edges between vertices of
+/// different cells.
+class ParallelBallPivoting {
+public:
+    enum EdgeType : uint8_t { Border = 0, Front = 1, Inner = 2 };
+
+    struct Edge {
+        int source_;
+        int target_;
+        /// Vertex opposite to the edge in its first triangle, -1 if none.
+        int opposite_;
+        /// Center of the ball touching the first triangle.
+        Eigen::Vector3d center_;
+        EdgeType type_;
+    };
+
+    /// Edge \p idx_ of part \p part_.
+    struct EdgeRef {
+        int part_;
+        int idx_;
+    };
+
+    /// Edges and triangles owned by a cell, or by the seams between cells.
+    struct Part {
+        std::vector<Edge> edges_;
+        std::unordered_map<int64_t, int> edge_indices_;
+        std::vector<int> border_edges_;
+        std::vector<Eigen::Vector3i> triangles_;
+        std::vector<Eigen::Vector3d> triangle_normals_;
+    };
+
+    ParallelBallPivoting(const PointCloud& pcd, double cell_size)
+        : points_(pcd.points_),
+          normals_(pcd.normals_),
+          colors_(pcd.colors_),
+          kdtree_(pcd),
+          cell_size_(cell_size),
+          vertex_cells_(pcd.points_.size()),
+          num_edges_(pcd.points_.size(), 0),
+          num_inner_edges_(pcd.points_.size(), 0) {
+        std::unordered_map<Eigen::Vector3i, int,
+                           utility::hash_eigen<Eigen::Vector3i>>
+                cell_indices;
+        for (size_t vidx = 0; vidx < points_.size(); ++vidx) {
+            Eigen::Vector3i cell = (points_[vidx] / cell_size_)
+                                           .array()
+                                           .floor()
+                                           .cast<int>()
+                                           .matrix();
+            auto inserted = cell_indices.emplace(
+                    cell, static_cast<int>(cell_vertices_.size()));
+            if (inserted.second) {
+                cell_vertices_.emplace_back();
+            }
+            vertex_cells_[vidx] = inserted.first->second;
+            cell_vertices_[inserted.first->second].push_back(
+                    static_cast<int>(vidx));
+        }
+        num_cells_ = static_cast<int>(cell_vertices_.size());
+        parts_.resize(num_cells_ + 1);
+    }
+
+    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
+        for (double radius : radii) {
+            std::vector<std::vector<EdgeRef>> deferred(num_cells_);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int cell = 0; cell < num_cells_; ++cell) {
+                std::deque<EdgeRef> front;
+                ReactivateBorderEdges(cell, radius, front);
+                ExpandTriangulation(cell, radius, front, deferred[cell]);
+                FindSeedTriangles(cell, radius, deferred[cell]);
+            }
+
+            // Stitch the cells along their boundaries.
+            std::deque<EdgeRef> front;
+            ReactivateBorderEdges(num_cells_, radius, front);
+            for (const std::vector<EdgeRef>& cell_deferred : deferred) {
+                front.insert(front.end(), cell_deferred.begin(),
+                             cell_deferred.end());
+            }
+            utility::LogDebug(
+                    "[CreateFromPointCloudBallPivotingParallel] radius {:f}: "
+                    "{:d} front edges at the seams",
+                    radius, front.size());
+            std::vector<EdgeRef> seam_deferred;
+            ExpandTriangulation(-1, radius, front, seam_deferred);
+            FindSeedTriangles(-1, radius, seam_deferred);
+        }
+
+        auto mesh = std::make_shared<TriangleMesh>();
+        mesh->vertices_ = points_;
+        mesh->vertex_normals_ = normals_;
+        mesh->vertex_colors_ = colors_;
+        for (const Part& part : parts_) {
+            mesh->triangles_.insert(mesh->triangles_.end(),
+                                    part.triangles_.begin(),
+                                    part.triangles_.end());
+            mesh->triangle_normals_.insert(mesh->triangle_normals_.end(),
+                                           part.triangle_normals_.begin(),
+                                           part.triangle_normals_.end());
+        }
+        return mesh;
+    }
+
+private:
+    /// The part owning the edge between \p v0 and \p v1.
+    int GetPart(int v0, int v1) const {
+        return vertex_cells_[v0] == vertex_cells_[v1] ? vertex_cells_[v0]
+                                                      : num_cells_;
+    }
+
+    static int64_t GetEdgeKey(int v0, int v1) {
+        if (v0 > v1) {
+            std::swap(v0, v1);
+        }
+        return (static_cast<int64_t>(v0) << 32) | static_cast<int64_t>(v1);
+    }
+
+    Edge& GetEdge(const EdgeRef& ref) {
+        return parts_[ref.part_].edges_[ref.idx_];
+    }
+
+    /// Returns the edge between \p v0 and \p v1, with idx_ -1 if none.
+    EdgeRef GetLinkingEdge(int v0, int v1) {
+        const int part = GetPart(v0, v1);
+        const auto& edge_indices = parts_[part].edge_indices_;
+        auto it = edge_indices.find(GetEdgeKey(v0, v1));
+        return {part, it == edge_indices.end() ? -1 : it->second};
+    }
+
+    EdgeRef AddEdge(int v0, int v1) {
+        const int part = GetPart(v0, v1);
+        std::vector<Edge>& edges = parts_[part].edges_;
+        const int idx = static_cast<int>(edges.size());
+        edges.push_back({v0, v1, -1, Eigen::Vector3d::Zero(), Front});
+        parts_[part].edge_indices_.emplace(GetEdgeKey(v0, v1), idx);
+        ++num_edges_[v0];
+        ++num_edges_[v1];
+        return {part, idx};
+    }
+
+    bool IsOrphan(int vidx) const { return num_edges_[vidx] == 0; }
+
+    bool IsInner(int vidx) const {
+        return num_edges_[vidx] > 0 &&
+               num_inner_edges_[vidx] == num_edges_[vidx];
+    }
+
+    void MarkBorder(const EdgeRef& ref) {
+        GetEdge(ref).type_ = Border;
+        parts_[ref.part_].border_edges_.push_back(ref.idx_);
+    }
+
+    void AddAdjacentTriangle(Edge& edge,
+                             int opposite,
+                             const Eigen::Vector3d& center) {
+        if (edge.opposite_ < 0) {
+            edge.opposite_ = opposite;
+            edge.center_ = center;
+            edge.type_ = Front;
+            // update orientation
+            if (IsReversedEdge(points_[edge.source_], points_[edge.target_],
+                               points_[opposite], normals_[edge.source_],
+                               normals_[edge.target_], normals_[opposite])) {
+                std::swap(edge.target_, edge.source_);
+            }
+        } else if (edge.type_ != Inner) {
+            edge.type_ = Inner;
+            ++num_inner_edges_[edge.source_];
+            ++num_inner_edges_[edge.target_];
+        } else {
+            utility::LogDebug(
+                    "[CreateFromPointCloudBallPivotingParallel] edge "
+                    "({:d}, {:d}) has more than two triangles",
+                    edge.source_, edge.target_);
+        }
+    }
+
+    /// Creates the triangle in the part of \p cell, the seams if -1.
+    void CreateTriangle(
+            int cell, int v0, int v1, int v2, const Eigen::Vector3d& center) {
+        const int vertices[3] = {v0, v1, v2};
+        for (int i = 0; i < 3; ++i) {
+            const int source = vertices[i];
+            const int target = vertices[(i + 1) % 3];
+            EdgeRef ref = GetLinkingEdge(source, target);
+            if (ref.idx_ < 0) {
+                ref = AddEdge(source, target);
+            }
+            AddAdjacentTriangle(GetEdge(ref), vertices[(i + 2) % 3], center);
+        }
+
+        Part& part = parts_[cell < 0 ? num_cells_ : cell];
+        Eigen::Vector3d face_normal =
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (face_normal.dot(normals_[v0]) > -1e-16) {
+            part.triangles_.emplace_back(v0, v1, v2);
+            part.triangle_normals_.push_back(face_normal);
+        } else {
+            part.triangles_.emplace_back(v0, v2, v1);
+            part.triangle_normals_.push_back(-face_normal);
+        }
+    }
+
+    /// Pivots the ball around \p edge and returns the first vertex hit, -1 if
+    /// none.
+    int FindCandidateVertex(const Edge& edge,
+                            double radius,
+                            Eigen::Vector3d& candidate_center) const {
+        if (edge.opposite_ < 0) {
+            utility::LogError("edge has no adjacent triangle.");
+        }
+        return PivotBall(kdtree_, points_, normals_, edge.source_,
+                         edge.target_, edge.opposite_, edge.center_, radius,
+                         candidate_center);
+    }
+
+    /// Expands the \p front. With \p cell >= 0, only triangles inside the cell
+    /// are created and the edges pivoting onto other cells are added to
+    /// \p deferred.
+    void ExpandTriangulation(int cell,
+                             double radius,
+                             std::deque<EdgeRef>& front,
+                             std::vector<EdgeRef>& deferred) {
+        while (!front.empty()) {
+            const EdgeRef ref = front.front();
+            front.pop_front();
+            // Copied, since adding edges may reallocate the edges of the part.
+            const Edge edge = GetEdge(ref);
+            if (edge.type_ != Front) {
+                continue;
+            }
+
+            Eigen::Vector3d center;
+            const int candidate = FindCandidateVertex(edge, radius, center);
+            if (cell >= 0 && candidate >= 0 &&
+                vertex_cells_[candidate] != cell) {
+                deferred.push_back(ref);
+                continue;
+            }
+            if (candidate < 0 || IsInner(candidate) ||
+                !IsCompatible(points_, normals_, candidate, edge.source_,
+                              edge.target_)) {
+                MarkBorder(ref);
+                continue;
+            }
+
+            EdgeRef e0 = GetLinkingEdge(candidate, edge.source_);
+            EdgeRef e1 = GetLinkingEdge(candidate, edge.target_);
+            if ((e0.idx_ >= 0 && GetEdge(e0).type_ != Front) ||
+                (e1.idx_ >= 0 && GetEdge(e1).type_ != Front)) {
+                MarkBorder(ref);
+                continue;
+            }
+
+            CreateTriangle(cell, edge.source_, edge.target_, candidate, center);
+
+            e0 = GetLinkingEdge(candidate, edge.source_);
+            e1 = GetLinkingEdge(candidate, edge.target_);
+            if (GetEdge(e0).type_ == Front) {
+                front.push_front(e0);
+            }
+            if (GetEdge(e1).type_ == Front) {
+                front.push_front(e1);
+            }
+        }
+    }
+
+    bool TryTriangleSeed(int v0,
+                         int v1,
+                         int v2,
+                         const std::vector<int>& nb_indices,
+                         double radius,
+                         Eigen::Vector3d& center) {
+        if (!IsCompatible(points_, normals_, v0, v1, v2)) {
+            return false;
+        }
+
+        EdgeRef e0 = GetLinkingEdge(v0, v2);
+        EdgeRef e1 = GetLinkingEdge(v1, v2);
+        if ((e0.idx_ >= 0 && GetEdge(e0).type_ == Inner) ||
+            (e1.idx_ >= 0 && GetEdge(e1).type_ == Inner)) {
+            return false;
+        }
+
+        return ComputeBallCenter(points_, normals_, v0, v1, v2, radius,
+                                 center) &&
+               IsEmptyBall(points_, center, radius, nb_indices, v0, v1, v2);
+    }
+
+    /// Tries to create a seed triangle at \p v, with vertices in \p cell if it
+    /// is not -1, and adds its front edges to \p front.
+    bool TrySeed(int cell, int v, double radius, std::deque<EdgeRef>& front) {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+        kdtree_.SearchRadius(points_[v], 2 * radius, indices, dists2);
+        if (indices.size() < 3u) {
+            return false;
+        }
+
+        auto is_seed_vertex = [&](int nb) {
+            return nb != v && (cell < 0 || vertex_cells_[nb] == cell) &&
+                   IsOrphan(nb);
+        };
+        for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
+            const int nb0 = indices[nbidx0];
+            if (!is_seed_vertex(nb0)) {
+                continue;
+            }
+
+            int nb1 = -1;
+            Eigen::Vector3d center;
+            for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
+                 ++nbidx1) {
+                if (is_seed_vertex(indices[nbidx1]) &&
+                    TryTriangleSeed(v, nb0, indices[nbidx1], indices, radius,
+                                    center)) {
+                    nb1 = indices[nbidx1];
+                    break;
+                }
+            }
+            if (nb1 < 0) {
+                continue;
+            }
+
+            const std::pair<int, int> seed_edges[3] = {
+                    {v, nb1}, {nb0, nb1}, {v, nb0}};
+            bool has_non_front_edge = false;
+            for (const auto& seed_edge : seed_edges) {
+                EdgeRef ref =
+                        GetLinkingEdge(seed_edge.first, seed_edge.second);
+                has_non_front_edge |=
+                        ref.idx_ >= 0 && GetEdge(ref).type_ != Front;
+            }
+            if (has_non_front_edge) {
+                continue;
+            }
+
+            CreateTriangle(cell, v, nb0, nb1, center);
+
+            for (const auto& seed_edge : seed_edges) {
+                EdgeRef ref =
+                        GetLinkingEdge(seed_edge.first, seed_edge.second);
+                if (GetEdge(ref).type_ == Front) {
+                    front.push_front(ref);
+                }
+            }
+            if (!front.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Returns whether the balls of \p radius through \p vidx can reach
+    /// another cell.
+    bool IsNearCellBoundary(int vidx, double radius) const {
+        const Eigen::Array3d p = points_[vidx] / cell_size_;
+        const Eigen::Array3d local = p - p.floor();
+        return (local.min(1 - local) * cell_size_ < 2 * radius).any();
+    }
+
+    /// Seeds and expands new triangulations at the orphan vertices of
+    /// \p cell, or at the orphan vertices near the cell boundaries if -1.
+    void FindSeedTriangles(int cell,
+                           double radius,
+                           std::vector<EdgeRef>& deferred) {
+        auto try_seed = [&](int vidx) {
+            std::deque<EdgeRef> front;
+            if (IsOrphan(vidx) && TrySeed(cell, vidx, radius, front)) {
+                ExpandTriangulation(cell, radius, front, deferred);
+            }
+        };
+        if (cell >= 0) {
+            for (int vidx : cell_vertices_[cell]) {
+                try_seed(vidx);
+            }
+        } else {
+            for (int vidx = 0; vidx < static_cast<int>(points_.size());
+                 ++vidx) {
+                if (IsNearCellBoundary(vidx, radius)) {
+                    try_seed(vidx);
+                }
+            }
+        }
+    }
+
+    /// Moves the border edges of \p part, whose triangle fits an empty ball
+    /// of the new \p radius, back to the \p front.
+    void ReactivateBorderEdges(int part,
+                               double radius,
+                               std::deque<EdgeRef>& front) {
+        std::vector<int>& border_edges = parts_[part].border_edges_;
+        size_t num_border_edges = 0;
+        for (int idx : border_edges) {
+            Edge& edge = parts_[part].edges_[idx];
+            if (edge.type_ != Border) {
+                continue;
+            }
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(points_, normals_, edge.source_,
+                                  edge.target_, edge.opposite_, radius,
+                                  center)) {
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                if (std::all_of(indices.begin(), indices.end(), [&](int idx) {
+                        return idx == edge.source_ || idx == edge.target_ ||
+                               idx == edge.opposite_;
+                    })) {
+                    edge.type_ = Front;
+                    edge.center_ = center;
+                    front.push_back({part, idx});
+                    continue;
+                }
+            }
+            border_edges[num_border_edges++] = idx;
+        }
+        border_edges.resize(num_border_edges);
+    }
+
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
+    const std::vector<Eigen::Vector3d>& colors_;
+    KDTreeFlann kdtree_;
+    double cell_size_;
+    int num_cells_;
+    /// Cell of every vertex.
+    std::vector<int> vertex_cells_;
+    /// Vertices of every cell.
+    std::vector<std::vector<int>> cell_vertices_;
+    /// Number of edges and of inner edges of every vertex. A vertex without
+    /// edges is an orphan, a vertex with only inner edges is inner.
+    std::vector<int> num_edges_;
+    std::vector<int> num_inner_edges_;
+    /// Parts of the cells, followed by the part of the seams.
+    std::vector<Part> parts_;
+};
+
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
         const PointCloud& pcd, const std::vector<double>& radii) {
     BallPivoting bp(pcd);
     return bp.Run(radii);
 }
 
+std::shared_ptr<TriangleMesh>
+TriangleMesh::CreateFromPointCloudBallPivotingParallel(
+        const PointCloud& pcd, const std::vector<double>& radii) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    for (double radius : radii) {
+        if (radius <= 0) {
+            utility::LogError("got an invalid, negative radius as parameter");
+        }
+    }
+    const double cell_size =
+            radii.empty() ? 1.0
+                          : kBallPivotingCellSizeInRadii *
+                                    *std::max_element(radii.begin(),
+                                                      radii.end());
+    ParallelBallPivoting bp(pcd, cell_size);
+    return bp.Run(radii);
+}
+
 }  // namespace geometry
 }  // namespace open3d
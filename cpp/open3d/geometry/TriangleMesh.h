@@ -254,11 +254,12 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh. Candidate pairs are found with a TriangleMeshBVH.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// Tests triangle pairs with overlapping bounding boxes for intersection
+    /// and stops at the first intersecting pair.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -266,7 +267,8 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Tests each triangle against the triangles of the other mesh
+    /// with overlapping bounding boxes.
     bool IsIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the given triangle mesh is orientable, i.e.
@@ -430,6 +432,25 @@ public:
             double maximum_error,
             double boundary_weight) const;
 
+    /// Function to simplify mesh using Quadric Error Metric Decimation by
+    /// Garland and Heckbert, collapsing batches of edges in parallel.
+    /// In every pass, each edge whose cost is the lowest among the edges
+    /// around its two vertices is collapsed. These edges share no triangle,
+    /// so the collapses are independent. The result differs from
+    /// SimplifyQuadricDecimation in the order of collapses, but not in the
+    /// error metric.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param maximum_error defines the maximum error where a vertex is allowed
+    /// to be merged
+    /// \param boundary_weight a weight applied to edge vertices used to
+    /// preserve boundaries
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles,
+            double maximum_error,
+            double boundary_weight) const;
+
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \p indices are selected.
@@ -550,6 +571,23 @@ public:
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
             const PointCloud &pcd, const std::vector<double> &radii);
 
+    /// \brief Parallel variant of CreateFromPointCloudBallPivoting.
+    ///
+    /// The points are partitioned into a grid of cells much larger than the
+    /// balls. Every cell grows its own fronts in parallel, creating only
+    /// triangles inside the cell, and the fronts reaching other cells are then
+    /// stitched in a sequential pass along the cell boundaries. New seed
+    /// triangles are searched for with every radius, so the result differs
+    /// slightly from CreateFromPointCloudBallPivoting, but does not depend on
+    /// the number of threads.
+    /// \param pcd defines the PointCloud from which the TriangleMesh surface is
+    /// reconstructed. Has to contain normals.
+    /// \param radii defines the radii of
+    /// the ball that are used for the surface reconstruction.
+    static std::shared_ptr<TriangleMesh>
+    CreateFromPointCloudBallPivotingParallel(const PointCloud &pcd,
+                                             const std::vector<double> &radii);
+
     /// \brief Function that computes a triangle mesh from an oriented
     /// PointCloud pcd. This implements the Screened Poisson Reconstruction
     /// proposed in Kazhdan and Hoppe, "Screened Poisson Surface
@@ -0,0 +1,306 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Spreads the lower 10 bits of \p v such that there are two zero bits
+/// between each of them.
+uint32_t ExpandBits(uint32_t v) {
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+/// 30 bit Morton code of a point in the unit cube.
+uint32_t MortonCode(const Eigen::Vector3d &p) {
+    auto quantize = [](double x) {
+        return uint32_t(std::min(std::max(x * 1024.0, 0.0), 1023.0));
+    };
+    return (ExpandBits(quantize(p(0))) << 2) |
+           (ExpandBits(quantize(p(1))) << 1) | ExpandBits(quantize(p(2)));
+}
+
+bool TrianglesShareVertex(const Eigen::Vector3i &p, const Eigen::Vector3i &q) {
+    return p(0) == q(0) || p(0) == q(1) || p(0) == q(2) || p(1) == q(0) ||
+           p(1) == q(1) || p(1) == q(2) || p(2) == q(0) || p(2) == q(1) ||
+           p(2) == q(2);
+}
+
+}  // unnamed namespace
+
+TriangleMeshBVH::TriangleMeshBVH(const std::vector<Eigen::Vector3d> &vertices,
+                                 const std::vector<Eigen::Vector3i> &triangles,
+                                 int max_leaf_size /* = 4 */)
+    : vertices_(vertices), triangles_(triangles) {
+    Build(max_leaf_size);
+}
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh &mesh,
+                                 int max_leaf_size /* = 4 */)
+    : TriangleMeshBVH(mesh.vertices_, mesh.triangles_, max_leaf_size) {}
+
+void TriangleMeshBVH::Build(int max_leaf_size) {
+    const int num_triangles = int(triangles_.size());
+    if (num_triangles == 0) {
+        return;
+    }
+    max_leaf_size = std::max(max_leaf_size, 1);
+
+    triangle_min_bounds_.resize(num_triangles);
+    triangle_max_bounds_.resize(num_triangles);
+    std::vector<Eigen::Vector3d> centroids(num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        const Eigen::Vector3d &v0 = vertices_[triangle(0)];
+        const Eigen::Vector3d &v1 = vertices_[triangle(1)];
+        const Eigen::Vector3d &v2 = vertices_[triangle(2)];
+        triangle_min_bounds_[tidx] = v0.cwiseMin(v1).cwiseMin(v2);
+        triangle_max_bounds_[tidx] = v0.cwiseMax(v1).cwiseMax(v2);
+        centroids[tidx] = (v0 + v1 + v2) / 3.0;
+    }
+
+    Eigen::Vector3d centroid_min = centroids[0];
+    Eigen::Vector3d centroid_max = centroids[0];
+    for (const Eigen::Vector3d &c : centroids) {
+        centroid_min = centroid_min.cwiseMin(c);
+        centroid_max = centroid_max.cwiseMax(c);
+    }
+    const Eigen::Vector3d extent = (centroid_max - centroid_min)
+                                           .cwiseMax(Eigen::Vector3d::Constant(
+                                                   1e-12));
+
+    std::vector<uint32_t> codes(num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        codes[tidx] = MortonCode(
+                (centroids[tidx] - centroid_min).cwiseQuotient(extent));
+    }
+
+    triangle_indices_.resize(num_triangles);
+    std::iota(triangle_indices_.begin(), triangle_indices_.end(), 0);
+    std::sort(triangle_indices_.begin(), triangle_indices_.end(),
+              [&](int a, int b) {
+                  return codes[a] < codes[b] || (codes[a] == codes[b] && a < b);
+              });
+    std::vector<uint32_t> sorted_codes(num_triangles);
+    for (int i = 0; i < num_triangles; ++i) {
+        sorted_codes[i] = codes[triangle_indices_[i]];
+    }
+
+    nodes_.reserve(2 * (num_triangles / max_leaf_size + 1));
+    BuildRecursive(sorted_codes, 0, num_triangles, max_leaf_size);
+}
+
+int TriangleMeshBVH::BuildRecursive(const std::vector<uint32_t> &codes,
+                                    int begin,
+                                    int end,
+                                    int max_leaf_size) {
+    const int node_idx = int(nodes_.size());
+    nodes_.emplace_back();
+    if (end - begin <= max_leaf_size) {
+        Node &node = nodes_[node_idx];
+        node.begin_ = begin;
+        node.end_ = end;
+        node.min_bound_ = triangle_min_bounds_[triangle_indices_[begin]];
+        node.max_bound_ = triangle_max_bounds_[triangle_indices_[begin]];
+        for (int i = begin + 1; i < end; ++i) {
+            const int tidx = triangle_indices_[i];
+            node.min_bound_ =
+                    node.min_bound_.cwiseMin(triangle_min_bounds_[tidx]);
+            node.max_bound_ =
+                    node.max_bound_.cwiseMax(triangle_max_bounds_[tidx]);
+        }
+        return node_idx;
+    }
+
+    // Split at the highest bit in which the first and last code of the
+    // range differ, or in the middle if all codes are identical.
+    int split = (begin + end) / 2;
+    const uint32_t first_code = codes[begin];
+    const uint32_t last_code = codes[end - 1];
+    if (first_code != last_code) {
+        uint32_t highest_bit = first_code ^ last_code;
+        highest_bit |= highest_bit >> 1;
+        highest_bit |= highest_bit >> 2;
+        highest_bit |= highest_bit >> 4;
+        highest_bit |= highest_bit >> 8;
+        highest_bit |= highest_bit >> 16;
+        highest_bit ^= highest_bit >> 1;
+        const uint32_t prefix_mask = ~(highest_bit - 1) & ~highest_bit;
+        const uint32_t split_code = (first_code & prefix_mask) | highest_bit;
+        split = int(std::lower_bound(codes.begin() + begin,
+                                     codes.begin() + end, split_code) -
+                    codes.begin());
+    }
+
+    const int left = BuildRecursive(codes, begin, split, max_leaf_size);
+    const int right = BuildRecursive(codes, split, end, max_leaf_size);
+    // nodes_ may have been reallocated by the recursive calls.
+    Node &node = nodes_[node_idx];
+    node.left_ = left;
+    node.right_ = right;
+    node.begin_ = begin;
+    node.end_ = end;
+    node.min_bound_ =
+            nodes_[left].min_bound_.cwiseMin(nodes_[right].min_bound_);
+    node.max_bound_ =
+            nodes_[left].max_bound_.cwiseMax(nodes_[right].max_bound_);
+    return node_idx;
+}
+
+std::vector<int> TriangleMeshBVH::QueryAABB(
+        const Eigen::Vector3d &min_bound,
+        const Eigen::Vector3d &max_bound) const {
+    std::vector<int> result;
+    TraverseAABB(min_bound, max_bound, [&](int tidx) {
+        result.push_back(tidx);
+        return true;
+    });
+    return result;
+}
+
+std::vector<Eigen::Vector2i> TriangleMeshBVH::GetSelfIntersectingTriangles(
+        bool stop_at_first /* = false */) const {
+    std::vector<Eigen::Vector2i> self_intersecting_triangles;
+    const int num_triangles = int(triangles_.size());
+    bool found = false;
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<Eigen::Vector2i> local_pairs;
+#pragma omp for schedule(dynamic, 256)
+        for (int tidx0 = 0; tidx0 < num_triangles; ++tidx0) {
+            if (stop_at_first) {
+                bool found_local;
+#pragma omp atomic read
+                found_local = found;
+                if (found_local) {
+                    continue;
+                }
+            }
+            const Eigen::Vector3i &tria_p = triangles_[tidx0];
+            const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+            const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+            const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+            TraverseAABB(
+                    triangle_min_bounds_[tidx0], triangle_max_bounds_[tidx0],
+                    [&](int tidx1) {
+                        if (tidx1 <= tidx0) {
+                            return true;
+                        }
+                        const Eigen::Vector3i &tria_q = triangles_[tidx1];
+                        if (TrianglesShareVertex(tria_p, tria_q)) {
+                            return true;
+                        }
+                        if (IntersectionTest::TriangleTriangle3d(
+                                    p0, p1, p2, vertices_[tria_q(0)],
+                                    vertices_[tria_q(1)],
+                                    vertices_[tria_q(2)])) {
+                            local_pairs.push_back(
+                                    Eigen::Vector2i(tidx0, tidx1));
+                            if (stop_at_first) {
+#pragma omp atomic write
+                                found = true;
+                                return false;
+                            }
+                        }
+                        return true;
+                    });
+        }
+#pragma omp critical(TriangleMeshBVH_GetSelfIntersectingTriangles)
+        self_intersecting_triangles.insert(self_intersecting_triangles.end(),
+                                           local_pairs.begin(),
+                                           local_pairs.end());
+    }
+    std::sort(self_intersecting_triangles.begin(),
+              self_intersecting_triangles.end(),
+              [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
+    if (stop_at_first && self_intersecting_triangles.size() > 1) {
+        self_intersecting_triangles.resize(1);
+    }
+    return self_intersecting_triangles;
+}
+
+bool TriangleMeshBVH::IsIntersecting(const TriangleMeshBVH &other) const {
+    if (IsEmpty() || other.IsEmpty() ||
+        !IntersectionTest::AABBAABB(nodes_[0].min_bound_, nodes_[0].max_bound_,
+                                    other.nodes_[0].min_bound_,
+                                    other.nodes_[0].max_bound_)) {
+        return false;
+    }
+    const int num_triangles = int(triangles_.size());
+    bool found = false;
+#pragma omp parallel for schedule(dynamic, 256) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx0 = 0; tidx0 < num_triangles; ++tidx0) {
+        bool found_local;
+#pragma omp atomic read
+        found_local = found;
+        if (found_local) {
+            continue;
+        }
+        const Eigen::Vector3i &tria_p = triangles_[tidx0];
+        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+        other.TraverseAABB(
+                triangle_min_bounds_[tidx0], triangle_max_bounds_[tidx0],
+                [&](int tidx1) {
+                    const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
+                    if (IntersectionTest::TriangleTriangle3d(
+                                p0, p1, p2, other.vertices_[tria_q(0)],
+                                other.vertices_[tria_q(1)],
+                                other.vertices_[tria_q(2)])) {
+#pragma omp atomic write
+                        found = true;
+                        return false;
+                    }
+                    return true;
+                });
+    }
+    return found;
+}
+
+}  // namespace geometry
+}  // namespace open3d
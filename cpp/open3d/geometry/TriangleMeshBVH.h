@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a triangle mesh.
+///
+/// The hierarchy is a binary tree of axis aligned bounding boxes stored in a
+/// flat node array. Triangles are ordered along a Morton curve of their
+/// centroids and split at the highest differing Morton bit, which gives a
+/// linear BVH. Per-triangle bounds and Morton codes are computed in parallel.
+/// The BVH references the vertex and triangle arrays it was built from, they
+/// must outlive it and it has to be rebuilt if they change.
+class TriangleMeshBVH {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param vertices Vertex positions of the mesh.
+    /// \param triangles Vertex indices of the triangles.
+    /// \param max_leaf_size Maximum number of triangles in a leaf node.
+    TriangleMeshBVH(const std::vector<Eigen::Vector3d> &vertices,
+                    const std::vector<Eigen::Vector3i> &triangles,
+                    int max_leaf_size = 4);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Triangle mesh from which the BVH is constructed.
+    /// \param max_leaf_size Maximum number of triangles in a leaf node.
+    explicit TriangleMeshBVH(const TriangleMesh &mesh, int max_leaf_size = 4);
+
+    /// \brief Node of the hierarchy.
+    ///
+    /// For leaf nodes \p left_ and \p right_ are -1 and the triangles of the
+    /// node are GetTriangleIndices()[begin_, end_).
+    struct Node {
+        Eigen::Vector3d min_bound_;
+        Eigen::Vector3d max_bound_;
+        int left_ = -1;
+        int right_ = -1;
+        int begin_ = 0;
+        int end_ = 0;
+
+        bool IsLeaf() const { return left_ < 0; }
+    };
+
+public:
+    /// Returns true if the BVH does not contain any triangle.
+    bool IsEmpty() const { return nodes_.empty(); }
+
+    /// Returns the flat node array, the root is at index 0.
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+
+    /// Returns the triangle indices in leaf order.
+    const std::vector<int> &GetTriangleIndices() const {
+        return triangle_indices_;
+    }
+
+    /// Returns the indices of all triangles whose bounding boxes intersect
+    /// the given axis aligned box.
+    std::vector<int> QueryAABB(const Eigen::Vector3d &min_bound,
+                               const Eigen::Vector3d &max_bound) const;
+
+    /// \brief Calls \p func for every triangle whose bounding box intersects
+    /// the given axis aligned box.
+    ///
+    /// \param func Callable with signature bool(int triangle_idx). Returning
+    /// false stops the traversal.
+    /// \return false if the traversal was stopped by \p func.
+    template <typename Func>
+    bool TraverseAABB(const Eigen::Vector3d &min_bound,
+                      const Eigen::Vector3d &max_bound,
+                      Func func) const {
+        if (nodes_.empty()) {
+            return true;
+        }
+        // The tree depth is bounded by the number of Morton bits plus the
+        // median splits of duplicated codes, 128 entries are plenty.
+        int stack[128];
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size > 0) {
+            const Node &node = nodes_[stack[--stack_size]];
+            if ((node.min_bound_.array() > max_bound.array()).any() ||
+                (node.max_bound_.array() < min_bound.array()).any()) {
+                continue;
+            }
+            if (node.IsLeaf()) {
+                for (int i = node.begin_; i < node.end_; ++i) {
+                    const int tidx = triangle_indices_[i];
+                    if ((triangle_min_bounds_[tidx].array() >
+                         max_bound.array())
+                                .any() ||
+                        (triangle_max_bounds_[tidx].array() <
+                         min_bound.array())
+                                .any()) {
+                        continue;
+                    }
+                    if (!func(tidx)) {
+                        return false;
+                    }
+                }
+            } else {
+                stack[stack_size++] = node.right_;
+                stack[stack_size++] = node.left_;
+            }
+        }
+        return true;
+    }
+
+    /// \brief Returns all pairs (i, j), i < j, of triangles that intersect
+    /// each other and do not share a vertex. The pairs are sorted.
+    ///
+    /// \param stop_at_first If true, returns as soon as one intersecting pair
+    /// has been found.
+    std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles(
+            bool stop_at_first = false) const;
+
+    /// \brief Returns true if any triangle of this BVH intersects any
+    /// triangle of \p other.
+    bool IsIntersecting(const TriangleMeshBVH &other) const;
+
+    /// Returns the bounding box of triangle \p tidx.
+    const Eigen::Vector3d &GetTriangleMinBound(int tidx) const {
+        return triangle_min_bounds_[tidx];
+    }
+    const Eigen::Vector3d &GetTriangleMaxBound(int tidx) const {
+        return triangle_max_bounds_[tidx];
+    }
+
+private:
+    void Build(int max_leaf_size);
+    int BuildRecursive(const std::vector<uint32_t> &codes,
+                       int begin,
+                       int end,
+                       int max_leaf_size);
+
+private:
+    const std::vector<Eigen::Vector3d> &vertices_;
+    const std::vector<Eigen::Vector3i> &triangles_;
+    std::vector<Eigen::Vector3d> triangle_min_bounds_;
+    std::vector<Eigen::Vector3d> triangle_max_bounds_;
+    std::vector<int> triangle_indices_;
+    std::vector<Node> nodes_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -25,11 +25,14 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <numeric>
 #include <queue>
 #include <tuple>
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -552,5 +555,466 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     return mesh;
 }
 
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles,
+        double maximum_error = std::numeric_limits<double>::infinity(),
+        double boundary_weight = 1.0) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimationParallel] This mesh contains "
+                "triangle uvs that are not handled in this function");
+    }
+
+    // Best collapse of a vertex: edge (vidx0, vidx1) with vidx0 < vidx1 is
+    // merged into vidx0 at vbar. Candidates are ordered by cost and then by
+    // edge, so that both vertices of an edge agree on their best candidate.
+    struct CollapseCandidate {
+        double cost = std::numeric_limits<double>::infinity();
+        int vidx0 = -1;
+        int vidx1 = -1;
+        Eigen::Vector3d vbar;
+
+        bool operator<(const CollapseCandidate& other) const {
+            return std::tie(cost, vidx0, vidx1) <
+                   std::tie(other.cost, other.vidx0, other.vidx1);
+        }
+        bool IsSameEdge(const CollapseCandidate& other) const {
+            return vidx0 == other.vidx0 && vidx1 == other.vidx1;
+        }
+    };
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+
+    const int num_vertices = static_cast<int>(vertices_.size());
+    const int num_triangles = static_cast<int>(triangles_.size());
+    // Flags are stored as bytes, as neighbouring entries are written by
+    // different threads.
+    std::vector<uint8_t> vertices_deleted(num_vertices, 0);
+    std::vector<uint8_t> triangles_deleted(num_triangles, 0);
+
+    // Map vertices to triangles. The lists may contain deleted triangles,
+    // they are compacted when a vertex is the target of a collapse.
+    std::vector<std::vector<int>> vert_to_triangles(num_vertices);
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i& tria = triangles_[tidx];
+        vert_to_triangles[tria(0)].push_back(tidx);
+        if (tria(1) != tria(0)) {
+            vert_to_triangles[tria(1)].push_back(tidx);
+        }
+        if (tria(2) != tria(0) && tria(2) != tria(1)) {
+            vert_to_triangles[tria(2)].push_back(tidx);
+        }
+    }
+
+    std::vector<Eigen::Vector4d> triangle_planes(num_triangles);
+    std::vector<double> triangle_areas(num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        triangle_planes[tidx] = GetTrianglePlane(tidx);
+        triangle_areas[tidx] = GetTriangleArea(tidx);
+    }
+
+    // Compute the error metric per vertex. For boundary edges, i.e. edges
+    // with a single triangle, add the perpendicular plane quadric.
+    std::vector<Quadric> Qs(num_vertices);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        const std::vector<int>& triangles = vert_to_triangles[vidx];
+        auto IsBoundaryEdge = [&](int other) {
+            int count = 0;
+            for (int tidx : triangles) {
+                const Eigen::Vector3i& tria = triangles_[tidx];
+                if (tria(0) == other || tria(1) == other || tria(2) == other) {
+                    count++;
+                }
+            }
+            return count == 1;
+        };
+        for (int tidx : triangles) {
+            Qs[vidx] += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
+        }
+        for (int tidx : triangles) {
+            const Eigen::Vector3i& tria = triangles_[tidx];
+            for (int i = 0; i < 3; ++i) {
+                int vidx0 = tria(i);
+                int vidx1 = tria((i + 1) % 3);
+                int vidx2 = tria((i + 2) % 3);
+                if ((vidx0 != vidx && vidx1 != vidx) ||
+                    !IsBoundaryEdge(vidx0 == vidx ? vidx1 : vidx0)) {
+                    continue;
+                }
+                const auto& vert0 = vertices_[vidx0];
+                const auto& vert1 = vertices_[vidx1];
+                const auto& vert2 = vertices_[vidx2];
+                Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
+                Eigen::Vector4d plane =
+                        ComputeTrianglePlane(vert0, vert1, vert2p);
+                Qs[vidx] += Quadric(plane,
+                                    triangle_areas[tidx] * boundary_weight);
+            }
+        }
+    }
+
+    auto ComputeCost = [&](int vidx0, int vidx1, Eigen::Vector3d& vbar) {
+        Quadric Qbar = Qs[vidx0] + Qs[vidx1];
+        if (Qbar.IsInvertible()) {
+            vbar = Qbar.Minimum();
+            return Qbar.Eval(vbar);
+        }
+        const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
+        const Eigen::Vector3d& v1 = mesh->vertices_[vidx1];
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        double cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+        return cost;
+    };
+
+    // Avoid flip of the normal of any triangle around the edge.
+    auto IsFlipped = [&](int vidx0, int vidx1, const Eigen::Vector3d& vbar) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (int tidx : vert_to_triangles[vidx]) {
+                if (triangles_deleted[tidx]) {
+                    continue;
+                }
+                const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                bool has_vidx0 = vidx0 == tria(0) || vidx0 == tria(1) ||
+                                 vidx0 == tria(2);
+                bool has_vidx1 = vidx1 == tria(0) || vidx1 == tria(1) ||
+                                 vidx1 == tria(2);
+                if (has_vidx0 && has_vidx1) {
+                    continue;
+                }
+
+                Eigen::Vector3d vert0 = mesh->vertices_[tria(0)];
+                Eigen::Vector3d vert1 = mesh->vertices_[tria(1)];
+                Eigen::Vector3d vert2 = mesh->vertices_[tria(2)];
+                Eigen::Vector3d norm_before =
+                        (vert1 - vert0).cross(vert2 - vert0);
+                if (vidx == tria(0)) {
+                    vert0 = vbar;
+                } else if (vidx == tria(1)) {
+                    vert1 = vbar;
+                } else {
+                    vert2 = vbar;
+                }
+                Eigen::Vector3d norm_after =
+                        (vert1 - vert0).cross(vert2 - vert0);
+                if (norm_before.dot(norm_after) < 0) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    // Calls f for all neighbours of vidx, possibly several times.
+    auto ForEachNeighbor = [&](int vidx, const auto& f) {
+        for (int tidx : vert_to_triangles[vidx]) {
+            if (triangles_deleted[tidx]) {
+                continue;
+            }
+            const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+            for (int i = 0; i < 3; ++i) {
+                if (tria(i) != vidx) {
+                    f(tria(i));
+                }
+            }
+        }
+    };
+
+    // Vertices of the triangles that were modified by a collapse since the
+    // last pass. The candidates of these vertices and of their neighbours
+    // have to be recomputed, as the flip test of an edge depends on the
+    // vertices around both of its ends. Each pass only visits the
+    // neighbourhood of the last collapses instead of all vertices.
+    std::vector<CollapseCandidate> candidates(num_vertices);
+    std::vector<uint8_t> dirty(num_vertices, 1);
+    std::vector<uint8_t> update(num_vertices, 0);
+    std::vector<uint8_t> changed(num_vertices, 0);
+    std::vector<uint8_t> ring(num_vertices, 0);
+    std::vector<int> dirty_list(num_vertices);
+    std::iota(dirty_list.begin(), dirty_list.end(), 0);
+    std::vector<int> update_list;
+    std::vector<int> ring_list;
+    std::vector<int> ring_min(num_vertices);
+    std::vector<int> removed(num_vertices);
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    int n_triangles = num_triangles;
+
+    // Appends the live vertex vidx to list once.
+    auto AddVertex = [&](int vidx, std::vector<uint8_t>& flags,
+                         std::vector<int>& list) {
+        if (!flags[vidx] && !vertices_deleted[vidx]) {
+            flags[vidx] = 1;
+            list.push_back(vidx);
+        }
+    };
+    auto AddWithNeighbors = [&](int vidx, std::vector<uint8_t>& flags,
+                                std::vector<int>& list) {
+        AddVertex(vidx, flags, list);
+        ForEachNeighbor(vidx, [&](int nb) { AddVertex(nb, flags, list); });
+    };
+
+    // Recomputes the best collapse of vidx. The edges between clean vertices
+    // are unchanged since the last pass, so if neither vidx nor the edge of
+    // its best candidate is dirty, only the edges to dirty neighbours are
+    // compared against it. neighbors is a scratch buffer owned by the
+    // calling thread.
+    auto UpdateCandidate = [&](int vidx, std::vector<int>& neighbors,
+                               CollapseCandidate& best) {
+        bool only_dirty =
+                !dirty[vidx] &&
+                (best.vidx0 < 0 || (!dirty[best.vidx0] && !dirty[best.vidx1]));
+        if (!only_dirty) {
+            best = CollapseCandidate();
+        }
+        neighbors.clear();
+        ForEachNeighbor(vidx, [&](int nb) {
+            if ((!only_dirty || dirty[nb]) &&
+                std::find(neighbors.begin(), neighbors.end(), nb) ==
+                        neighbors.end()) {
+                neighbors.push_back(nb);
+            }
+        });
+        for (int nb : neighbors) {
+            CollapseCandidate candidate;
+            candidate.vidx0 = std::min(vidx, nb);
+            candidate.vidx1 = std::max(vidx, nb);
+            candidate.cost = ComputeCost(candidate.vidx0, candidate.vidx1,
+                                         candidate.vbar);
+            if (candidate.cost > maximum_error || !(candidate < best) ||
+                IsFlipped(candidate.vidx0, candidate.vidx1, candidate.vbar)) {
+                continue;
+            }
+            best = candidate;
+        }
+    };
+
+    while (n_triangles > target_number_of_triangles) {
+        update_list.clear();
+        for (int vidx : dirty_list) {
+            AddWithNeighbors(vidx, update, update_list);
+        }
+        const int num_update = static_cast<int>(update_list.size());
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<int> neighbors;
+#pragma omp for schedule(dynamic, 256)
+            for (int i = 0; i < num_update; ++i) {
+                int vidx = update_list[i];
+                const CollapseCandidate before = candidates[vidx];
+                UpdateCandidate(vidx, neighbors, candidates[vidx]);
+                changed[vidx] = before.cost != candidates[vidx].cost ||
+                                !before.IsSameEdge(candidates[vidx]);
+            }
+        }
+
+        // Vertex of the best candidate within the one-ring of each vertex.
+        // It changes around the changed candidates, and at the dirty
+        // vertices whose one-ring changed.
+        ring_list.clear();
+        for (int vidx : dirty_list) {
+            AddVertex(vidx, ring, ring_list);
+        }
+        for (int vidx : update_list) {
+            if (changed[vidx]) {
+                AddWithNeighbors(vidx, ring, ring_list);
+            }
+            update[vidx] = 0;
+        }
+        for (int vidx : dirty_list) {
+            dirty[vidx] = 0;
+        }
+        dirty_list.clear();
+        const int num_ring = static_cast<int>(ring_list.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_ring; ++i) {
+            int vidx = ring_list[i];
+            int min_vidx = vidx;
+            ForEachNeighbor(vidx, [&](int nb) {
+                if (candidates[nb] < candidates[min_vidx]) {
+                    min_vidx = nb;
+                }
+            });
+            ring_min[vidx] = min_vidx;
+        }
+
+        // An edge is collapsed if it is the best candidate around both of
+        // its vertices. Two such edges can not share a triangle, as either
+        // edge would be the better one. The edges away from the updated
+        // one-rings were already rejected by an earlier pass.
+        std::vector<int> selected;
+        for (int vidx : ring_list) {
+            const CollapseCandidate& candidate = candidates[vidx];
+            if (candidate.vidx0 < 0 ||
+                (candidate.vidx0 != vidx && ring[candidate.vidx0])) {
+                continue;
+            }
+            const CollapseCandidate& other =
+                    candidates[vidx == candidate.vidx0 ? candidate.vidx1
+                                                       : candidate.vidx0];
+            if (other.IsSameEdge(candidate) &&
+                candidates[ring_min[candidate.vidx0]].IsSameEdge(candidate) &&
+                candidates[ring_min[candidate.vidx1]].IsSameEdge(candidate)) {
+                selected.push_back(candidate.vidx0);
+            }
+        }
+        for (int vidx : ring_list) {
+            ring[vidx] = 0;
+        }
+        if (selected.empty()) {
+            break;
+        }
+
+        // Only collapse the cheapest edges needed to reach the target.
+        int num_selected = static_cast<int>(selected.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_selected; ++i) {
+            int vidx0 = selected[i];
+            int vidx1 = candidates[vidx0].vidx1;
+            int count = 0;
+            for (int tidx : vert_to_triangles[vidx1]) {
+                const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                if (!triangles_deleted[tidx] &&
+                    (vidx0 == tria(0) || vidx0 == tria(1) ||
+                     vidx0 == tria(2))) {
+                    count++;
+                }
+            }
+            removed[vidx0] = count;
+        }
+        std::sort(selected.begin(), selected.end(), [&](int a, int b) {
+            return candidates[a] < candidates[b];
+        });
+        for (num_selected = 0; num_selected < int(selected.size()) &&
+                               n_triangles > target_number_of_triangles;
+             ++num_selected) {
+            n_triangles -= removed[selected[num_selected]];
+        }
+        selected.resize(num_selected);
+
+        for (int vidx0 : selected) {
+            for (int vidx : {vidx0, candidates[vidx0].vidx1}) {
+                AddWithNeighbors(vidx, dirty, dirty_list);
+            }
+        }
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_selected; ++i) {
+            int vidx0 = selected[i];
+            const CollapseCandidate candidate = candidates[vidx0];
+            int vidx1 = candidate.vidx1;
+
+            // Connect triangles from vidx1 to vidx0, or mark deleted
+            std::vector<int> connected;
+            for (int tidx : vert_to_triangles[vidx1]) {
+                if (triangles_deleted[tidx]) {
+                    continue;
+                }
+                Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                if (vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2)) {
+                    triangles_deleted[tidx] = 1;
+                    continue;
+                }
+                if (vidx1 == tria(0)) {
+                    tria(0) = vidx0;
+                } else if (vidx1 == tria(1)) {
+                    tria(1) = vidx0;
+                } else {
+                    tria(2) = vidx0;
+                }
+                connected.push_back(tidx);
+            }
+            std::vector<int>& triangles = vert_to_triangles[vidx0];
+            triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                           [&](int tidx) {
+                                               return triangles_deleted[tidx];
+                                           }),
+                            triangles.end());
+            triangles.insert(triangles.end(), connected.begin(),
+                             connected.end());
+            std::vector<int>().swap(vert_to_triangles[vidx1]);
+
+            // update vertex vidx0 to vbar
+            mesh->vertices_[vidx0] = candidate.vbar;
+            Qs[vidx0] += Qs[vidx1];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx0] =
+                        0.5 * (mesh->vertex_normals_[vidx0] +
+                               mesh->vertex_normals_[vidx1]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx0] =
+                        0.5 * (mesh->vertex_colors_[vidx0] +
+                               mesh->vertex_colors_[vidx1]);
+            }
+            vertices_deleted[vidx1] = 1;
+            candidates[vidx1] = CollapseCandidate();
+        }
+    }
+
+    // Apply changes to the triangle mesh
+    int next_free = 0;
+    std::vector<int> vert_remapping(num_vertices, -1);
+    for (int idx = 0; idx < num_vertices; ++idx) {
+        if (!vertices_deleted[idx]) {
+            vert_remapping[idx] = next_free;
+            mesh->vertices_[next_free] = mesh->vertices_[idx];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
+            }
+            next_free++;
+        }
+    }
+    mesh->vertices_.resize(next_free);
+    if (has_vert_normal) {
+        mesh->vertex_normals_.resize(next_free);
+    }
+    if (has_vert_color) {
+        mesh->vertex_colors_.resize(next_free);
+    }
+
+    next_free = 0;
+    for (int idx = 0; idx < num_triangles; ++idx) {
+        if (!triangles_deleted[idx]) {
+            const Eigen::Vector3i& tria = mesh->triangles_[idx];
+            mesh->triangles_[next_free] =
+                    Eigen::Vector3i(vert_remapping[tria(0)],
+                                    vert_remapping[tria(1)],
+                                    vert_remapping[tria(2)]);
+            next_free++;
+        }
+    }
+    mesh->triangles_.resize(next_free);
+
+    if (HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
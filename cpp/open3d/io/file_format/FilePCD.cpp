@@ -24,11 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/file_format/FilePCD.h"
+
 #include <liblzf/lzf.h>
 
+#include <cerrno>
 #include <cstdint>
 #include <cstdio>
-#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
@@ -43,43 +48,9 @@
 // https://www.mathworks.com/matlabcentral/fileexchange/40382-matlab-to-point-cloud-library
 
 namespace open3d {
+namespace io {
 
 namespace {
-using namespace io;
-
-enum PCDDataType {
-    PCD_DATA_ASCII = 0,
-    PCD_DATA_BINARY = 1,
-    PCD_DATA_BINARY_COMPRESSED = 2
-};
-
-struct PCLPointField {
-public:
-    std::string name;
-    int size;
-    char type;
-    int count;
-    // helper variable
-    int count_offset;
-    int offset;
-};
-
-struct PCDHeader {
-public:
-    std::string version;
-    std::vector<PCLPointField> fields;
-    int width;
-    int height;
-    int points;
-    PCDDataType datatype;
-    std::string viewpoint;
-    // helper variables
-    int elementnum;
-    int pointsize;
-    bool has_points;
-    bool has_normals;
-    bool has_colors;
-};
 
 bool CheckHeader(PCDHeader &header) {
     if (header.points <= 0 || header.pointsize <= 0) {
@@ -131,20 +102,37 @@ bool CheckHeader(PCDHeader &header) {
     return true;
 }
 
+/// Parses a non-negative integer header value; \p value is untouched on
+/// failure.
+bool ParsePCDHeaderValue(const std::string &str, int64_t &value) {
+    char *end = nullptr;
+    errno = 0;
+    const long long parsed = std::strtoll(str.c_str(), &end, 10);
+    if (end == str.c_str() || *end != '\0' || errno == ERANGE || parsed < 0) {
+        utility::LogWarning("[ReadPCDHeader] Bad PCD header value: {}", str);
+        return false;
+    }
+    value = static_cast<int64_t>(parsed);
+    return true;
+}
+
+}  // unnamed namespace
+
 bool ReadPCDHeader(FILE *file, PCDHeader &header) {
     char line_buffer[DEFAULT_IO_BUFFER_SIZE];
     size_t specified_channel_count = 0;
+    header.width = 0;
+    header.height = 0;
+    header.points = 0;
+    header.datatype = PCD_DATA_ASCII;
 
     while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        std::string line(line_buffer);
-        if (line == "") {
+        std::vector<std::string> st =
+                utility::SplitString(line_buffer, "\t\r\n ");
+        if (st.empty()) {
             continue;
         }
-        std::vector<std::string> st = utility::SplitString(line, "\t\r\n ");
-        std::stringstream sstream(line);
-        sstream.imbue(std::locale::classic());
-        std::string line_type;
-        sstream >> line_type;
+        const std::string &line_type = st[0];
         if (line_type.substr(0, 1) == "#") {
         } else if (line_type.substr(0, 7) == "VERSION") {
             if (st.size() >= 2) {
@@ -158,31 +146,32 @@ bool ReadPCDHeader(FILE *file, PCDHeader &header) {
                 return false;
             }
             header.fields.resize(specified_channel_count);
-            int count_offset = 0, offset = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 i++, count_offset += 1, offset += 4) {
+            for (size_t i = 0; i < specified_channel_count; i++) {
                 header.fields[i].name = st[i + 1];
                 header.fields[i].size = 4;
                 header.fields[i].type = 'F';
                 header.fields[i].count = 1;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
             }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "SIZE") {
+        } else if (line_type.substr(0, 4) == "SIZE" ||
+                   line_type.substr(0, 5) == "COUNT") {
             if (specified_channel_count != st.size() - 1) {
                 utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
                 return false;
             }
-            int offset = 0, col_type = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 i++, offset += col_type) {
-                sstream >> col_type;
-                header.fields[i].size = col_type;
-                header.fields[i].offset = offset;
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                // Bounded so that the record offsets cannot overflow.
+                int64_t value = 0;
+                if (!ParsePCDHeaderValue(st[i + 1], value) || value == 0 ||
+                    value > std::numeric_limits<int16_t>::max()) {
+                    utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                    return false;
+                }
+                if (line_type.substr(0, 4) == "SIZE") {
+                    header.fields[i].size = static_cast<int>(value);
+                } else {
+                    header.fields[i].count = static_cast<int>(value);
+                }
             }
-            header.pointsize = offset;
         } else if (line_type.substr(0, 4) == "TYPE") {
             if (specified_channel_count != st.size() - 1) {
                 utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
@@ -191,33 +180,23 @@ bool ReadPCDHeader(FILE *file, PCDHeader &header) {
             for (size_t i = 0; i < specified_channel_count; i++) {
                 header.fields[i].type = st[i + 1].c_str()[0];
             }
-        } else if (line_type.substr(0, 5) == "COUNT") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+        } else if (line_type.substr(0, 5) == "WIDTH") {
+            if (st.size() < 2 || !ParsePCDHeaderValue(st[1], header.width)) {
                 return false;
             }
-            int count_offset = 0, offset = 0, col_count = 0;
-            for (size_t i = 0; i < specified_channel_count; i++) {
-                sstream >> col_count;
-                header.fields[i].count = col_count;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-                count_offset += col_count;
-                offset += col_count * header.fields[i].size;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 5) == "WIDTH") {
-            sstream >> header.width;
         } else if (line_type.substr(0, 6) == "HEIGHT") {
-            sstream >> header.height;
+            if (st.size() < 2 || !ParsePCDHeaderValue(st[1], header.height)) {
+                return false;
+            }
             header.points = header.width * header.height;
         } else if (line_type.substr(0, 9) == "VIEWPOINT") {
             if (st.size() >= 2) {
                 header.viewpoint = st[1];
             }
         } else if (line_type.substr(0, 6) == "POINTS") {
-            sstream >> header.points;
+            if (st.size() < 2 || !ParsePCDHeaderValue(st[1], header.points)) {
+                return false;
+            }
         } else if (line_type.substr(0, 4) == "DATA") {
             header.datatype = PCD_DATA_ASCII;
             if (st.size() >= 2) {
@@ -230,6 +209,18 @@ bool ReadPCDHeader(FILE *file, PCDHeader &header) {
             break;
         }
     }
+
+    // The offsets are computed once all of FIELDS, SIZE and COUNT are known,
+    // which may come in any order.
+    int count_offset = 0, offset = 0;
+    for (auto &field : header.fields) {
+        field.count_offset = count_offset;
+        field.offset = offset;
+        count_offset += field.count;
+        offset += field.count * field.size;
+    }
+    header.elementnum = count_offset;
+    header.pointsize = offset;
     if (!CheckHeader(header)) {
         return false;
     }
@@ -276,6 +267,10 @@ double UnpackBinaryPCDElement(const char *data_ptr,
             float data;
             memcpy(&data, data_ptr, sizeof(data));
             return (double)data;
+        } else if (size == 8) {
+            double data;
+            memcpy(&data, data_ptr, sizeof(data));
+            return data;
         } else {
             return 0.0;
         }
@@ -332,6 +327,11 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+}  // namespace io
+
+namespace {
+using namespace io;
+
 bool ReadPCDData(FILE *file,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud,
@@ -355,7 +355,7 @@ bool ReadPCDData(FILE *file,
 
     if (header.datatype == PCD_DATA_ASCII) {
         char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-        int idx = 0;
+        int64_t idx = 0;
         while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file) &&
                idx < header.points) {
             std::string line(line_buffer);
@@ -403,7 +403,7 @@ bool ReadPCDData(FILE *file,
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
         std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; i++) {
+        for (int64_t i = 0; i < header.points; i++) {
             if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
                 utility::LogWarning(
                         "[ReadPCDData] Failed to read data record.");
@@ -466,6 +466,13 @@ bool ReadPCDData(FILE *file,
                 "PCD data with {:d} compressed size, and {:d} uncompressed "
                 "size.",
                 compressed_size, uncompressed_size);
+        if (int64_t(uncompressed_size) != header.pointsize * header.points) {
+            utility::LogWarning(
+                    "[ReadPCDData] Uncompressed size does not match the "
+                    "header.");
+            pointcloud.Clear();
+            return false;
+        }
         std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
         reporter.Update(int(reporter_total * .1));
         if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
@@ -490,43 +497,43 @@ bool ReadPCDData(FILE *file,
                     double(base_ptr - buffer.get()) / uncompressed_size;
             reporter.Update(int(reporter_total * (progress + .2)));
             if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
+                for (int64_t i = 0; i < header.points; i++) {
                     pointcloud.points_[i](0) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
+                for (int64_t i = 0; i < header.points; i++) {
                     pointcloud.points_[i](1) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
+                for (int64_t i = 0; i < header.points; i++) {
                     pointcloud.points_[i](2) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
+                for (int64_t i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
+                for (int64_t i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
+                for (int64_t i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; i++) {
+                for (int64_t i = 0; i < header.points; i++) {
                     pointcloud.colors_[i] = UnpackBinaryPCDColor(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
@@ -546,7 +553,7 @@ bool GenerateHeader(const geometry::PointCloud &pointcloud,
         return false;
     }
     header.version = "0.7";
-    header.width = (int)pointcloud.points_.size();
+    header.width = static_cast<int64_t>(pointcloud.points_.size());
     header.height = 1;
     header.points = header.width;
     header.fields.clear();
@@ -614,10 +621,10 @@ bool WritePCDHeader(FILE *file, const PCDHeader &header) {
         fprintf(file, " %d", field.count);
     }
     fprintf(file, "\n");
-    fprintf(file, "WIDTH %d\n", header.width);
-    fprintf(file, "HEIGHT %d\n", header.height);
+    fprintf(file, "WIDTH %lld\n", static_cast<long long>(header.width));
+    fprintf(file, "HEIGHT %lld\n", static_cast<long long>(header.height));
     fprintf(file, "VIEWPOINT 0 0 0 1 0 0 0\n");
-    fprintf(file, "POINTS %d\n", header.points);
+    fprintf(file, "POINTS %lld\n", static_cast<long long>(header.points));
 
     switch (header.datatype) {
         case PCD_DATA_BINARY:
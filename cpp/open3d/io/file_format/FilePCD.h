@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// References for PCD file IO
+// http://pointclouds.org/documentation/tutorials/pcd_file_format.html
+// https://github.com/PointCloudLibrary/pcl/blob/master/io/src/pcd_io.cpp
+
+// Parsing of PCD headers and records, shared by the legacy reader and the
+// chunked reader of t::io.
+
+namespace open3d {
+namespace io {
+
+enum PCDDataType {
+    PCD_DATA_ASCII = 0,
+    PCD_DATA_BINARY = 1,
+    PCD_DATA_BINARY_COMPRESSED = 2
+};
+
+struct PCLPointField {
+public:
+    std::string name;
+    int size;
+    char type;
+    int count;
+    // helper variable
+    int count_offset;
+    int offset;
+};
+
+struct PCDHeader {
+public:
+    std::string version;
+    std::vector<PCLPointField> fields;
+    int64_t width;
+    int64_t height;
+    int64_t points;
+    PCDDataType datatype;
+    std::string viewpoint;
+    // helper variables
+    int elementnum;
+    int pointsize;
+    bool has_points;
+    bool has_normals;
+    bool has_colors;
+};
+
+/// Parses the header of a PCD file and leaves \p file at the start of the
+/// data. Returns false if the header is malformed or has no x, y and z
+/// fields.
+bool ReadPCDHeader(FILE *file, PCDHeader &header);
+
+/// Unpacks a value of \p type ('I', 'U' or 'F') and \p size bytes of a binary
+/// record. Unsupported types return 0.
+double UnpackBinaryPCDElement(const char *data_ptr,
+                              const char type,
+                              const int size);
+
+/// Unpacks a color packed in BGR order into 4 bytes of a binary record.
+Eigen::Vector3d UnpackBinaryPCDColor(const char *data_ptr,
+                                     const char type,
+                                     const int size);
+
+/// Parses a value of \p type ('I', 'U' or 'F') of an ASCII record.
+double UnpackASCIIPCDElement(const char *data_ptr,
+                             const char type,
+                             const int size);
+
+/// Parses a color packed in BGR order into 4 bytes of an ASCII record.
+Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
+                                    const char type,
+                                    const int size);
+
+}  // namespace io
+}  // namespace open3d
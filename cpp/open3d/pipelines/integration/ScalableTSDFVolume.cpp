@@ -26,12 +26,14 @@
 
 #include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -94,123 +96,155 @@ void ScalableTSDFVolume::Integrate(
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+
+    // Each chunk of points collects its touched volume units in first-touch
+    // order. Merging the chunks in order then opens the units in the same
+    // order as a serial sweep over the points, which keeps the iteration
+    // order of volume_units_ (and thus the extracted geometry) deterministic.
+    const int num_points = (int)pointcloud->points_.size();
+    const int num_chunks =
+            std::max(1, std::min(utility::EstimateMaxThreads(), num_points));
+    std::vector<std::vector<Eigen::Vector3i>> chunk_volume_units(num_chunks);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int chunk = 0; chunk < num_chunks; chunk++) {
+        std::unordered_set<Eigen::Vector3i,
+                           utility::hash_eigen<Eigen::Vector3i>>
+                touched_volume_units;
+        const int begin = (int)((int64_t)num_points * chunk / num_chunks);
+        const int end = (int)((int64_t)num_points * (chunk + 1) / num_chunks);
+        for (int i = begin; i < end; i++) {
+            const auto &point = pointcloud->points_[i];
+            auto min_bound = LocateVolumeUnit(
+                    point -
+                    Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+            auto max_bound = LocateVolumeUnit(
+                    point +
+                    Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+            for (auto x = min_bound(0); x <= max_bound(0); x++) {
+                for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                    for (auto z = min_bound(2); z <= max_bound(2); z++) {
+                        auto loc = Eigen::Vector3i(x, y, z);
+                        if (touched_volume_units.insert(loc).second) {
+                            chunk_volume_units[chunk].push_back(loc);
+                        }
                     }
                 }
             }
         }
     }
+
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            touched_volume_units;
+    std::vector<std::shared_ptr<UniformTSDFVolume>> touched_volumes;
+    for (const auto &volume_units : chunk_volume_units) {
+        for (const auto &loc : volume_units) {
+            if (touched_volume_units.insert(loc).second) {
+                touched_volumes.push_back(OpenVolumeUnit(loc));
+            }
+        }
+    }
+
+    // Volume units do not share voxels, so they are integrated independently.
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < (int)touched_volumes.size(); i++) {
+        touched_volumes[i]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
+    }
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
-    auto pointcloud = std::make_shared<geometry::PointCloud>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    float w0, w1, f0, f1;
-    Eigen::Vector3f c0, c1;
+    std::vector<const VolumeUnit *> units;
     for (const auto &unit : volume_units_) {
         if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
-                        if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
-                        if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
-                            Eigen::Vector3d p0 =
-                                    Eigen::Vector3d(half_voxel_length +
-                                                            voxel_length_ * x,
-                                                    half_voxel_length +
-                                                            voxel_length_ * y,
-                                                    half_voxel_length +
-                                                            voxel_length_ * z) +
-                                    index0.cast<double>() * volume_unit_length_;
-                            for (int i = 0; i < 3; i++) {
-                                Eigen::Vector3d p1 = p0;
-                                Eigen::Vector3i idx1 = idx0;
-                                Eigen::Vector3i index1 = index0;
-                                p1(i) += voxel_length_;
-                                idx1(i) += 1;
-                                if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
+            units.push_back(&unit.second);
+        }
+    }
+
+    // Points are extracted per volume unit in parallel and concatenated in
+    // the iteration order of volume_units_.
+    std::vector<geometry::PointCloud> unit_pointclouds(units.size());
+    double half_voxel_length = voxel_length_ * 0.5;
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int u = 0; u < (int)units.size(); u++) {
+        auto &pointcloud = unit_pointclouds[u];
+        float w0, w1, f0, f1;
+        Eigen::Vector3f c0, c1;
+        const auto &volume0 = *units[u]->volume_;
+        const auto &index0 = units[u]->index_;
+        for (int x = 0; x < volume0.resolution_; x++) {
+            for (int y = 0; y < volume0.resolution_; y++) {
+                for (int z = 0; z < volume0.resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
+                    f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
+                    if (color_type_ != TSDFVolumeColorType::NoColor)
+                        c0 = volume0.voxels_[volume0.IndexOf(idx0)]
+                                     .color_.cast<float>();
+                    if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
+                        Eigen::Vector3d p0 =
+                                Eigen::Vector3d(
+                                        half_voxel_length + voxel_length_ * x,
+                                        half_voxel_length + voxel_length_ * y,
+                                        half_voxel_length + voxel_length_ * z) +
+                                index0.cast<double>() * volume_unit_length_;
+                        for (int i = 0; i < 3; i++) {
+                            Eigen::Vector3d p1 = p0;
+                            Eigen::Vector3i idx1 = idx0;
+                            Eigen::Vector3i index1 = index0;
+                            p1(i) += voxel_length_;
+                            idx1(i) += 1;
+                            if (idx1(i) < volume0.resolution_) {
+                                w1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                             .weight_;
+                                f1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                             .tsdf_;
+                                if (color_type_ != TSDFVolumeColorType::NoColor)
+                                    c1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                                 .color_.cast<float>();
+                            } else {
+                                idx1(i) -= volume0.resolution_;
+                                index1(i) += 1;
+                                auto unit_itr = volume_units_.find(index1);
+                                if (unit_itr == volume_units_.end()) {
+                                    w1 = 0.0f;
+                                    f1 = 0.0f;
+                                } else {
+                                    const auto &volume1 =
+                                            *unit_itr->second.volume_;
+                                    w1 = volume1.voxels_[volume1.IndexOf(idx1)]
                                                  .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                    f1 = volume1.voxels_[volume1.IndexOf(idx1)]
                                                  .tsdf_;
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
+                                        c1 = volume1.voxels_[volume1.IndexOf(
                                                                      idx1)]
                                                      .color_.cast<float>();
-                                } else {
-                                    idx1(i) -= volume0.resolution_;
-                                    index1(i) += 1;
-                                    auto unit_itr = volume_units_.find(index1);
-                                    if (unit_itr == volume_units_.end()) {
-                                        w1 = 0.0f;
-                                        f1 = 0.0f;
-                                    } else {
-                                        const auto &volume1 =
-                                                *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
-                                        if (color_type_ !=
-                                            TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
-                                    }
                                 }
-                                if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
-                                    f0 * f1 < 0) {
-                                    float r0 = std::fabs(f0);
-                                    float r1 = std::fabs(f1);
-                                    Eigen::Vector3d p = p0;
-                                    p(i) = (p0(i) * r1 + p1(i) * r0) /
-                                           (r0 + r1);
-                                    pointcloud->points_.push_back(p);
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1) / 255.0f)
-                                                        .cast<double>());
-                                    } else if (color_type_ ==
-                                               TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1))
-                                                        .cast<double>());
-                                    }
-                                    // has_normal
-                                    pointcloud->normals_.push_back(
-                                            GetNormalAt(p));
+                            }
+                            if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
+                                f0 * f1 < 0) {
+                                float r0 = std::fabs(f0);
+                                float r1 = std::fabs(f1);
+                                Eigen::Vector3d p = p0;
+                                p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
+                                pointcloud.points_.push_back(p);
+                                if (color_type_ == TSDFVolumeColorType::RGB8) {
+                                    pointcloud.colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1) /
+                                             255.0f)
+                                                    .cast<double>());
+                                } else if (color_type_ ==
+                                           TSDFVolumeColorType::Gray32) {
+                                    pointcloud.colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1))
+                                                    .cast<double>());
                                 }
+                                // has_normal
+                                pointcloud.normals_.push_back(GetNormalAt(p));
                             }
                         }
                     }
@@ -218,6 +252,28 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
             }
         }
     }
+
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    size_t num_points = 0;
+    for (const auto &unit_pointcloud : unit_pointclouds) {
+        num_points += unit_pointcloud.points_.size();
+    }
+    pointcloud->points_.reserve(num_points);
+    pointcloud->normals_.reserve(num_points);
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        pointcloud->colors_.reserve(num_points);
+    }
+    for (const auto &unit_pointcloud : unit_pointclouds) {
+        pointcloud->points_.insert(pointcloud->points_.end(),
+                                   unit_pointcloud.points_.begin(),
+                                   unit_pointcloud.points_.end());
+        pointcloud->colors_.insert(pointcloud->colors_.end(),
+                                   unit_pointcloud.colors_.begin(),
+                                   unit_pointcloud.colors_.end());
+        pointcloud->normals_.insert(pointcloud->normals_.end(),
+                                    unit_pointcloud.normals_.begin(),
+                                    unit_pointcloud.normals_.end());
+    }
     return pointcloud;
 }
 
@@ -225,149 +281,203 @@ std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
+    typedef std::unordered_map<
             Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
             std::equal_to<Eigen::Vector4i>,
             Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
+            EdgeIndexMap;
+    struct UnitMesh {
+        std::vector<Eigen::Vector3d> vertices_;
+        std::vector<Eigen::Vector3d> vertex_colors_;
+        std::vector<Eigen::Vector3i> triangles_;
+        /// Global edge index of each vertex, used to merge vertices shared
+        /// with neighboring volume units.
+        std::vector<Eigen::Vector4i, Eigen::aligned_allocator<Eigen::Vector4i>>
+                edge_indices_;
+    };
+
+    std::vector<const VolumeUnit *> units;
     for (const auto &unit : volume_units_) {
         if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+            units.push_back(&unit.second);
+        }
+    }
+
+    // Run marching cubes on every volume unit in parallel. Vertices are
+    // de-duplicated within a unit; the triangles index the unit's vertices.
+    std::vector<UnitMesh> unit_meshes(units.size());
+    double half_voxel_length = voxel_length_ * 0.5;
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int u = 0; u < (int)units.size(); u++) {
+        auto &mesh = unit_meshes[u];
+        EdgeIndexMap edgeindex_to_vertexindex;
+        int edge_to_index[12];
+        const auto &volume0 = *units[u]->volume_;
+        const auto &index0 = units[u]->index_;
+        for (int x = 0; x < volume0.resolution_; x++) {
+            for (int y = 0; y < volume0.resolution_; y++) {
+                for (int z = 0; z < volume0.resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    int cube_index = 0;
+                    float w[8];
+                    float f[8];
+                    Eigen::Vector3d c[8];
+                    for (int i = 0; i < 8; i++) {
+                        Eigen::Vector3i index1 = index0;
+                        Eigen::Vector3i idx1 = idx0 + shift[i];
+                        if (idx1(0) < volume_unit_resolution_ &&
+                            idx1(1) < volume_unit_resolution_ &&
+                            idx1(2) < volume_unit_resolution_) {
+                            w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                           .weight_;
+                            f[i] = volume0.voxels_[volume0.IndexOf(idx1)].tsdf_;
+                            if (color_type_ == TSDFVolumeColorType::RGB8)
+                                c[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                               .color_.cast<double>() /
+                                       255.0;
+                            else if (color_type_ == TSDFVolumeColorType::Gray32)
+                                c[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                               .color_.cast<double>();
+                        } else {
+                            for (int j = 0; j < 3; j++) {
+                                if (idx1(j) >= volume_unit_resolution_) {
+                                    idx1(j) -= volume_unit_resolution_;
+                                    index1(j) += 1;
+                                }
+                            }
+                            auto unit_itr1 = volume_units_.find(index1);
+                            if (unit_itr1 == volume_units_.end()) {
+                                w[i] = 0.0f;
+                                f[i] = 0.0f;
+                            } else {
+                                const auto &volume1 =
+                                        *unit_itr1->second.volume_;
+                                w[i] = volume1.voxels_[volume1.IndexOf(idx1)]
                                                .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                f[i] = volume1.voxels_[volume1.IndexOf(idx1)]
                                                .tsdf_;
                                 if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
+                                    c[i] = volume1.voxels_[volume1.IndexOf(
                                                                    idx1)]
                                                    .color_.cast<double>() /
                                            255.0;
                                 else if (color_type_ ==
                                          TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
+                                    c[i] = volume1.voxels_[volume1.IndexOf(
                                                                    idx1)]
                                                    .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
                             }
                         }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
-                        }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
+                        if (w[i] == 0.0f) {
+                            cube_index = 0;
+                            break;
+                        } else {
+                            if (f[i] < 0.0f) {
+                                cube_index |= (1 << i);
                             }
                         }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
+                    }
+                    if (cube_index == 0 || cube_index == 255) {
+                        continue;
+                    }
+                    for (int i = 0; i < 12; i++) {
+                        if (edge_table[cube_index] & (1 << i)) {
+                            Eigen::Vector4i edge_index =
+                                    Eigen::Vector4i(index0(0), index0(1),
+                                                    index0(2), 0) *
+                                            volume_unit_resolution_ +
+                                    Eigen::Vector4i(x, y, z, 0) +
+                                    edge_shift[i];
+                            auto result = edgeindex_to_vertexindex.emplace(
+                                    edge_index, (int)mesh.vertices_.size());
+                            edge_to_index[i] = result.first->second;
+                            if (!result.second) {
+                                continue;
+                            }
+                            Eigen::Vector3d pt(
+                                    half_voxel_length +
+                                            voxel_length_ * edge_index(0),
+                                    half_voxel_length +
+                                            voxel_length_ * edge_index(1),
+                                    half_voxel_length +
+                                            voxel_length_ * edge_index(2));
+                            double f0 =
+                                    std::abs((double)f[edge_to_vert[i][0]]);
+                            double f1 =
+                                    std::abs((double)f[edge_to_vert[i][1]]);
+                            pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
+                            mesh.vertices_.push_back(pt);
+                            mesh.edge_indices_.push_back(edge_index);
+                            if (color_type_ != TSDFVolumeColorType::NoColor) {
+                                const auto &c0 = c[edge_to_vert[i][0]];
+                                const auto &c1 = c[edge_to_vert[i][1]];
+                                mesh.vertex_colors_.push_back(
+                                        (f1 * c0 + f0 * c1) / (f0 + f1));
+                            }
                         }
                     }
+                    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                        mesh.triangles_.push_back(Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index][i + 1]]));
+                    }
                 }
             }
         }
     }
+
+    // Merge the unit meshes in the iteration order of volume_units_. An edge
+    // can only be shared with a neighboring unit if its anchor voxel lies on
+    // a face of the unit, so only those edges go through the global map. The
+    // result matches a serial sweep over all units.
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    size_t num_vertices = 0, num_triangles = 0;
+    for (const auto &unit_mesh : unit_meshes) {
+        num_vertices += unit_mesh.vertices_.size();
+        num_triangles += unit_mesh.triangles_.size();
+    }
+    mesh->vertices_.reserve(num_vertices);
+    mesh->triangles_.reserve(num_triangles);
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        mesh->vertex_colors_.reserve(num_vertices);
+    }
+    EdgeIndexMap edgeindex_to_vertexindex;
+    std::vector<int> vertex_map;
+    for (size_t u = 0; u < units.size(); u++) {
+        const auto &unit_mesh = unit_meshes[u];
+        const Eigen::Vector3i origin =
+                units[u]->index_ * volume_unit_resolution_;
+        vertex_map.resize(unit_mesh.vertices_.size());
+        for (size_t i = 0; i < unit_mesh.vertices_.size(); i++) {
+            const auto &edge_index = unit_mesh.edge_indices_[i];
+            bool on_face = false;
+            for (int j = 0; j < 3; j++) {
+                int local = edge_index(j) - origin(j);
+                on_face |= local == 0 || local == volume_unit_resolution_;
+            }
+            if (on_face) {
+                auto result = edgeindex_to_vertexindex.emplace(
+                        edge_index, (int)mesh->vertices_.size());
+                if (!result.second) {
+                    vertex_map[i] = result.first->second;
+                    continue;
+                }
+            }
+            vertex_map[i] = (int)mesh->vertices_.size();
+            mesh->vertices_.push_back(unit_mesh.vertices_[i]);
+            if (color_type_ != TSDFVolumeColorType::NoColor) {
+                mesh->vertex_colors_.push_back(unit_mesh.vertex_colors_[i]);
+            }
+        }
+        for (const auto &triangle : unit_mesh.triangles_) {
+            mesh->triangles_.push_back(
+                    Eigen::Vector3i(vertex_map[triangle(0)],
+                                    vertex_map[triangle(1)],
+                                    vertex_map[triangle(2)]));
+        }
+    }
     return mesh;
 }
 
@@ -26,7 +26,6 @@
 
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/Registration.h"
@@ -56,27 +55,36 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
     // STEP 1) Initial matching
     int nPti = int(point_cloud_vec[fi].points_.size());
     int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
+    const FeatureMatcher matcher_i(features_vec[fi],
+                                   option.feature_matching_option_);
+    const std::vector<int> j_to_i = matcher_i.Match(features_vec[fj]);
     std::vector<std::pair<int, int>> corres;
     std::vector<std::pair<int, int>> corres_ij;
     std::vector<std::pair<int, int>> corres_ji;
     std::vector<int> i_to_j(nPti, -1);
+    std::vector<int> hit_i;
     for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
+        int i = j_to_i[j];
+        if (i < 0) continue;
         if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
+            i_to_j[i] = 0;
+            hit_i.push_back(i);
         }
         corres_ji.push_back(std::pair<int, int>(i, j));
     }
+    // Only the features of source points hit by a target point are matched
+    // back.
+    Feature hit_feature;
+    hit_feature.Resize(int(features_vec[fi].Dimension()), int(hit_i.size()));
+    for (size_t k = 0; k < hit_i.size(); k++) {
+        hit_feature.data_.col(k) = features_vec[fi].data_.col(hit_i[k]);
+    }
+    const FeatureMatcher matcher_j(features_vec[fj],
+                                   option.feature_matching_option_);
+    const std::vector<int> hit_i_to_j = matcher_j.Match(hit_feature);
+    for (size_t k = 0; k < hit_i.size(); k++) {
+        i_to_j[hit_i[k]] = hit_i_to_j[k];
+    }
     for (int i = 0; i < nPti; i++) {
         if (i_to_j[i] != -1)
             corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
@@ -31,6 +31,8 @@
 #include <tuple>
 #include <vector>
 
+#include "open3d/pipelines/registration/FeatureMatching.h"
+
 namespace open3d {
 
 namespace geometry {
@@ -95,6 +97,8 @@ public:
     double tuple_scale_;
     /// Maximum number of tuples..
     int maximum_tuple_count_;
+    /// Options of the nearest neighbor search used to match the features.
+    FeatureMatchingOption feature_matching_option_;
 };
 
 RegistrationResult FastGlobalRegistration(
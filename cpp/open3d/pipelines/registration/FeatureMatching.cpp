@@ -0,0 +1,411 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/FeatureMatching.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+/// Number of query and indexed features per matrix multiplication in the
+/// brute-force search. A block of distances takes 8 MB.
+static constexpr int64_t kQueryBlockSize = 256;
+static constexpr int64_t kIndexBlockSize = 4096;
+
+/// Number of features per cluster used to train the inverted file index.
+static constexpr int64_t kTrainingFeaturesPerList = 64;
+static constexpr int kKMeansIterations = 10;
+
+/// Returns the features as a {N, D} tensor. Feature::data_ is column major,
+/// so each row of the tensor is one feature.
+static core::Tensor FeatureToTensor(const Feature &feature) {
+    return core::Tensor(feature.data_.data(),
+                        {int64_t(feature.Num()), int64_t(feature.Dimension())},
+                        core::Float64);
+}
+
+static std::vector<double> ComputeSquaredNorms(const core::Tensor &data) {
+    const int64_t n = data.GetLength();
+    const int64_t dim = data.GetShape(1);
+    const double *data_ptr = data.GetDataPtr<double>();
+    std::vector<double> norms(n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        norms[i] = Eigen::Map<const Eigen::VectorXd>(data_ptr + i * dim, dim)
+                           .squaredNorm();
+    }
+    return norms;
+}
+
+/// Finds the knn nearest rows of data for each row of queries with blocked
+/// matrix multiplications, using |q - x|^2 = |q|^2 - 2 q.x + |x|^2. The
+/// returned distances omit |q|^2, which does not change the order. Missing
+/// neighbors have index -1.
+static void SearchKnnBruteForce(const core::Tensor &queries,
+                                const core::Tensor &data,
+                                const std::vector<double> &data_norms,
+                                int knn,
+                                std::vector<int> &indices,
+                                std::vector<double> &distances) {
+    const int64_t num_queries = queries.GetLength();
+    const int64_t num_data = data.GetLength();
+    indices.assign(num_queries * knn, -1);
+    distances.assign(num_queries * knn, std::numeric_limits<double>::max());
+
+    for (int64_t q0 = 0; q0 < num_queries; q0 += kQueryBlockSize) {
+        const int64_t q1 = std::min(q0 + kQueryBlockSize, num_queries);
+        const core::Tensor query_block_t = queries.Slice(0, q0, q1).T();
+        for (int64_t d0 = 0; d0 < num_data; d0 += kIndexBlockSize) {
+            const int64_t d1 = std::min(d0 + kIndexBlockSize, num_data);
+            // Matmul returns the transpose of a contiguous result, so the
+            // dot products of a query are contiguous in the transpose.
+            const core::Tensor dots = data.Slice(0, d0, d1)
+                                              .Matmul(query_block_t)
+                                              .T()
+                                              .Contiguous();
+            const double *dots_ptr = dots.GetDataPtr<double>();
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t q = q0; q < q1; ++q) {
+                const double *row = dots_ptr + (q - q0) * (d1 - d0);
+                int *knn_indices = indices.data() + q * knn;
+                double *knn_distances = distances.data() + q * knn;
+                for (int64_t i = d0; i < d1; ++i) {
+                    const double dist = data_norms[i] - 2 * row[i - d0];
+                    if (dist >= knn_distances[knn - 1]) {
+                        continue;
+                    }
+                    // Insertion into the sorted list of neighbors.
+                    int k = knn - 1;
+                    while (k > 0 && knn_distances[k - 1] > dist) {
+                        knn_distances[k] = knn_distances[k - 1];
+                        knn_indices[k] = knn_indices[k - 1];
+                        --k;
+                    }
+                    knn_distances[k] = dist;
+                    knn_indices[k] = static_cast<int>(i);
+                }
+            }
+        }
+    }
+}
+
+/// Clusters the rows of data with Lloyd's algorithm. The initial centers are
+/// evenly strided rows, so the clustering is deterministic. Empty clusters are
+/// moved to the rows farthest from their centers, but can still be empty at
+/// the end, e.g. with duplicated rows.
+static core::Tensor KMeans(const core::Tensor &data,
+                           int64_t num_clusters,
+                           int num_iterations) {
+    const int64_t n = data.GetLength();
+    const int64_t dim = data.GetShape(1);
+
+    std::vector<int64_t> init_indices(num_clusters);
+    for (int64_t c = 0; c < num_clusters; ++c) {
+        init_indices[c] = c * n / num_clusters;
+    }
+    core::Tensor centroids = data.IndexGet(
+            {core::Tensor(init_indices, {num_clusters}, core::Int64)});
+    double *centroids_ptr = centroids.GetDataPtr<double>();
+    const double *data_ptr = data.GetDataPtr<double>();
+
+    const std::vector<double> data_norms = ComputeSquaredNorms(data);
+    std::vector<int> assignment;
+    std::vector<double> distances;
+    for (int it = 0; it < num_iterations; ++it) {
+        SearchKnnBruteForce(data, centroids, ComputeSquaredNorms(centroids), 1,
+                            assignment, distances);
+        std::vector<double> sums(num_clusters * dim, 0.0);
+        std::vector<int64_t> counts(num_clusters, 0);
+        for (int64_t i = 0; i < n; ++i) {
+            const int64_t c = assignment[i];
+            counts[c]++;
+            for (int64_t d = 0; d < dim; ++d) {
+                sums[c * dim + d] += data_ptr[i * dim + d];
+            }
+        }
+        // Rows sorted by decreasing distance to their center, to reseed the
+        // empty clusters.
+        std::vector<int64_t> farthest;
+        int64_t num_reseeded = 0;
+        for (int64_t c = 0; c < num_clusters; ++c) {
+            if (counts[c] > 0) {
+                for (int64_t d = 0; d < dim; ++d) {
+                    centroids_ptr[c * dim + d] =
+                            sums[c * dim + d] / double(counts[c]);
+                }
+                continue;
+            }
+            if (farthest.empty()) {
+                farthest.resize(n);
+                std::iota(farthest.begin(), farthest.end(), 0);
+                std::sort(farthest.begin(), farthest.end(),
+                          [&](int64_t i, int64_t j) {
+                              return data_norms[i] + distances[i] >
+                                     data_norms[j] + distances[j];
+                          });
+            }
+            const int64_t i = farthest[num_reseeded++ % n];
+            std::copy(data_ptr + i * dim, data_ptr + (i + 1) * dim,
+                      centroids_ptr + c * dim);
+        }
+    }
+    return centroids;
+}
+
+FeatureMatcher::FeatureMatcher(const Feature &features,
+                               const FeatureMatchingOption &option)
+    : option_(option),
+      dimension_(int64_t(features.Dimension())),
+      num_features_(int64_t(features.Num())) {
+    if (num_features_ == 0 || dimension_ == 0) {
+        utility::LogError("[FeatureMatcher] Input features are empty.");
+    }
+
+    switch (option_.method_) {
+        case FeatureMatchingMethod::KDTree:
+            kdtree_.reset(new geometry::KDTreeFlann(features));
+            break;
+        case FeatureMatchingMethod::BruteForce:
+            features_ = FeatureToTensor(features);
+            norms_ = ComputeSquaredNorms(features_);
+            break;
+        case FeatureMatchingMethod::InvertedFile: {
+            const int64_t num_lists = std::min(
+                    num_features_,
+                    option_.num_lists_ > 0
+                            ? int64_t(option_.num_lists_)
+                            : std::max(int64_t(1),
+                                       int64_t(std::llround(std::sqrt(
+                                               double(num_features_))))));
+            const core::Tensor all_features = FeatureToTensor(features);
+
+            // Trains the clusters on evenly strided features.
+            const int64_t num_train = std::min(
+                    num_features_, kTrainingFeaturesPerList * num_lists);
+            std::vector<int64_t> train_indices(num_train);
+            for (int64_t i = 0; i < num_train; ++i) {
+                train_indices[i] = i * num_features_ / num_train;
+            }
+            centroids_ = KMeans(all_features.IndexGet({core::Tensor(
+                                        train_indices, {num_train},
+                                        core::Int64)}),
+                                num_lists, kKMeansIterations);
+            centroid_norms_ = ComputeSquaredNorms(centroids_);
+
+            std::vector<int> assignment;
+            std::vector<double> distances;
+            SearchKnnBruteForce(all_features, centroids_, centroid_norms_, 1,
+                                assignment, distances);
+
+            // Drops the empty clusters, so that every probed list has
+            // features.
+            std::vector<int64_t> counts(centroids_.GetLength(), 0);
+            for (int c : assignment) {
+                counts[c]++;
+            }
+            std::vector<int64_t> kept_lists;
+            std::vector<int> list_map(counts.size(), -1);
+            for (size_t c = 0; c < counts.size(); ++c) {
+                if (counts[c] > 0) {
+                    list_map[c] = static_cast<int>(kept_lists.size());
+                    kept_lists.push_back(int64_t(c));
+                }
+            }
+            const int64_t num_kept_lists = int64_t(kept_lists.size());
+            if (num_kept_lists < centroids_.GetLength()) {
+                centroids_ = centroids_.IndexGet({core::Tensor(
+                        kept_lists, {num_kept_lists}, core::Int64)});
+                centroid_norms_ = ComputeSquaredNorms(centroids_);
+                for (int &c : assignment) {
+                    c = list_map[c];
+                }
+            }
+
+            // Sorts the features by cluster.
+            list_offsets_.assign(num_kept_lists + 1, 0);
+            for (int c : assignment) {
+                list_offsets_[c + 1]++;
+            }
+            for (int64_t c = 0; c < num_kept_lists; ++c) {
+                list_offsets_[c + 1] += list_offsets_[c];
+            }
+            std::vector<int64_t> next(list_offsets_.begin(),
+                                      list_offsets_.end() - 1);
+            std::vector<int64_t> order(num_features_);
+            list_indices_.resize(num_features_);
+            for (int64_t i = 0; i < num_features_; ++i) {
+                const int64_t pos = next[assignment[i]]++;
+                order[pos] = i;
+                list_indices_[pos] = static_cast<int>(i);
+            }
+            features_ = all_features.IndexGet(
+                    {core::Tensor(order, {num_features_}, core::Int64)});
+            norms_ = ComputeSquaredNorms(features_);
+            break;
+        }
+        default:
+            utility::LogError(
+                    "[FeatureMatcher] Unsupported feature matching method.");
+    }
+}
+
+FeatureMatcher::~FeatureMatcher() {}
+
+std::vector<int> FeatureMatcher::Match(const Feature &query) const {
+    if (int64_t(query.Dimension()) != dimension_) {
+        utility::LogError(
+                "[FeatureMatcher::Match] Query dimension {} does not match "
+                "the feature dimension {}.",
+                query.Dimension(), dimension_);
+    }
+    const int64_t num_queries = int64_t(query.Num());
+    std::vector<int> result(num_queries, -1);
+    if (num_queries == 0) {
+        return result;
+    }
+
+    if (option_.method_ == FeatureMatchingMethod::KDTree) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_queries; ++i) {
+            std::vector<int> indices(1);
+            std::vector<double> distance2(1);
+            kdtree_->SearchKNN(Eigen::VectorXd(query.data_.col(i)), 1, indices,
+                               distance2);
+            result[i] = indices[0];
+        }
+        return result;
+    }
+
+    const core::Tensor queries = FeatureToTensor(query);
+    std::vector<double> distances;
+    if (option_.method_ == FeatureMatchingMethod::BruteForce) {
+        SearchKnnBruteForce(queries, features_, norms_, 1, result, distances);
+        return result;
+    }
+
+    // Inverted file: only the clusters closest to a query are searched.
+    const int num_probes = static_cast<int>(std::min(
+            std::max(int64_t(option_.num_probes_), int64_t(1)),
+            centroids_.GetLength()));
+    std::vector<int> probes;
+    SearchKnnBruteForce(queries, centroids_, centroid_norms_, num_probes,
+                        probes, distances);
+
+    const double *queries_ptr = queries.GetDataPtr<double>();
+    const double *features_ptr = features_.GetDataPtr<double>();
+    const int64_t dim = dimension_;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t q = 0; q < num_queries; ++q) {
+        const Eigen::Map<const Eigen::VectorXd> query_vec(
+                queries_ptr + q * dim, dim);
+        double best_dist = std::numeric_limits<double>::max();
+        int64_t best = -1;
+        for (int p = 0; p < num_probes; ++p) {
+            const int list = probes[q * num_probes + p];
+            if (list < 0) continue;
+            for (int64_t i = list_offsets_[list]; i < list_offsets_[list + 1];
+                 ++i) {
+                const double dist =
+                        norms_[i] -
+                        2 * query_vec.dot(Eigen::Map<const Eigen::VectorXd>(
+                                    features_ptr + i * dim, dim));
+                if (dist < best_dist) {
+                    best_dist = dist;
+                    best = i;
+                }
+            }
+        }
+        // Only happens for queries without a finite distance to any feature,
+        // since no list is empty.
+        if (best < 0) {
+            for (int64_t i = 0; i < num_features_; ++i) {
+                const double dist =
+                        norms_[i] -
+                        2 * query_vec.dot(Eigen::Map<const Eigen::VectorXd>(
+                                    features_ptr + i * dim, dim));
+                if (dist < best_dist) {
+                    best_dist = dist;
+                    best = i;
+                }
+            }
+        }
+        result[q] = best >= 0 ? list_indices_[best] : -1;
+    }
+    return result;
+}
+
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_features,
+        const Feature &target_features,
+        bool mutual_filter /* = false */,
+        const FeatureMatchingOption &option /* = FeatureMatchingOption() */) {
+    const FeatureMatcher target_matcher(target_features, option);
+    const std::vector<int> source_to_target =
+            target_matcher.Match(source_features);
+    const int num_source = int(source_to_target.size());
+
+    CorrespondenceSet corres;
+    if (!mutual_filter) {
+        corres.reserve(num_source);
+        for (int i = 0; i < num_source; ++i) {
+            if (source_to_target[i] >= 0) {
+                corres.emplace_back(i, source_to_target[i]);
+            }
+        }
+        return corres;
+    }
+
+    const FeatureMatcher source_matcher(source_features, option);
+    const std::vector<int> target_to_source =
+            source_matcher.Match(target_features);
+    for (int i = 0; i < num_source; ++i) {
+        const int j = source_to_target[i];
+        if (j >= 0 && target_to_source[j] == i) {
+            corres.emplace_back(i, j);
+        }
+    }
+    return corres;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
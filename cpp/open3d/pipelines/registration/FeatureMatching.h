@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
+
+namespace open3d {
+
+namespace geometry {
+class KDTreeFlann;
+}
+
+namespace pipelines {
+namespace registration {
+
+class Feature;
+
+/// \enum FeatureMatchingMethod
+///
+/// \brief Nearest neighbor search method for feature matching.
+enum class FeatureMatchingMethod {
+    /// Exact search with a KD-tree. KD-trees degrade to nearly brute force
+    /// for high-dimensional features such as FPFH.
+    KDTree = 0,
+    /// Exact brute-force search with blocked matrix multiplications.
+    BruteForce = 1,
+    /// Approximate search with an inverted file index. The features are
+    /// clustered with k-means and only the features in the clusters closest
+    /// to a query are compared with it.
+    InvertedFile = 2,
+};
+
+/// \class FeatureMatchingOption
+///
+/// \brief Options for feature matching.
+class FeatureMatchingOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param method Nearest neighbor search method.
+    /// \param num_lists Number of clusters of the inverted file index. 0 uses
+    /// the square root of the number of features.
+    /// \param num_probes Number of clusters that are searched for each query
+    /// with the inverted file index. Higher is more accurate and slower.
+    FeatureMatchingOption(
+            FeatureMatchingMethod method = FeatureMatchingMethod::KDTree,
+            int num_lists = 0,
+            int num_probes = 16)
+        : method_(method), num_lists_(num_lists), num_probes_(num_probes) {}
+    ~FeatureMatchingOption() {}
+
+public:
+    /// Nearest neighbor search method.
+    FeatureMatchingMethod method_;
+    /// Number of clusters of the inverted file index. 0 uses the square root
+    /// of the number of features.
+    int num_lists_;
+    /// Number of clusters that are searched for each query with the inverted
+    /// file index.
+    int num_probes_;
+};
+
+/// \class FeatureMatcher
+///
+/// \brief Index for finding the nearest neighbors of features.
+class FeatureMatcher {
+public:
+    /// \brief Builds the index.
+    ///
+    /// \param features Features to search in.
+    /// \param option Feature matching options.
+    FeatureMatcher(const Feature &features,
+                   const FeatureMatchingOption &option =
+                           FeatureMatchingOption());
+    ~FeatureMatcher();
+    FeatureMatcher(const FeatureMatcher &) = delete;
+    FeatureMatcher &operator=(const FeatureMatcher &) = delete;
+
+public:
+    /// \brief Returns the index of the nearest neighbor of each query
+    /// feature, or -1 if there is none, e.g. for a query with NaN values.
+    ///
+    /// \param query Query features of the same dimension as the index.
+    std::vector<int> Match(const Feature &query) const;
+
+private:
+    FeatureMatchingOption option_;
+    int64_t dimension_ = 0;
+    int64_t num_features_ = 0;
+
+    /// KD-tree for FeatureMatchingMethod::KDTree.
+    std::unique_ptr<geometry::KDTreeFlann> kdtree_;
+
+    /// Features of shape {N, dimension_} and dtype Float64, ordered by
+    /// cluster for FeatureMatchingMethod::InvertedFile.
+    core::Tensor features_;
+    /// Squared norms of features_.
+    std::vector<double> norms_;
+
+    /// Cluster centers of shape {num_lists, dimension_} and their squared
+    /// norms.
+    core::Tensor centroids_;
+    std::vector<double> centroid_norms_;
+    /// Range of features_ that belongs to each cluster.
+    std::vector<int64_t> list_offsets_;
+    /// Original index of each row of features_.
+    std::vector<int> list_indices_;
+};
+
+/// \brief Function to find correspondences between two point clouds by
+/// nearest neighbor matching of their features.
+///
+/// \param source_features Source point cloud feature.
+/// \param target_features Target point cloud feature.
+/// \param mutual_filter Keeps only the correspondences where the source point
+/// is also the nearest neighbor of its corresponding target point.
+/// \param option Feature matching options.
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_features,
+        const Feature &target_features,
+        bool mutual_filter = false,
+        const FeatureMatchingOption &option = FeatureMatchingOption());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
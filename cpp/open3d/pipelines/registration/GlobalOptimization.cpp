@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
@@ -36,6 +37,7 @@
 #include "open3d/pipelines/registration/PoseGraph.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
@@ -184,6 +186,8 @@ static double ComputeResidual(const PoseGraph &pose_graph,
 static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
     int n_edges = (int)pose_graph.edges_.size();
     Eigen::VectorXd output(n_edges * 6);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
         std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
@@ -193,6 +197,85 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
     return output;
 }
 
+/// Sparsity pattern of the Hessian H of a pose graph. H has a 6x6 block on
+/// the diagonal for every node and a pair of off-diagonal blocks for every
+/// pair of nodes connected by an edge, so its size is linear in the size of
+/// the graph. The pattern only depends on the graph topology; it is built once
+/// per optimization and shared by every linearization and factorization.
+struct PoseGraphHessianPattern {
+    /// Compressed column matrix with every entry of every block allocated.
+    Eigen::SparseMatrix<double> H_;
+    /// For every node j, the sorted nodes i such that block (i, j) is stored.
+    std::vector<std::vector<int>> block_rows_;
+    /// For every node, the edges incident to it.
+    std::vector<std::vector<int>> node_edges_;
+    /// Position of every diagonal entry of H in H.valuePtr().
+    std::vector<int> diagonal_index_;
+};
+
+static PoseGraphHessianPattern ComputeHessianPattern(
+        const PoseGraph &pose_graph) {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+    PoseGraphHessianPattern pattern;
+    pattern.block_rows_.resize(n_nodes);
+    pattern.node_edges_.resize(n_nodes);
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        pattern.block_rows_[iter_node].push_back(iter_node);
+    }
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        int id_i = t.source_node_id_;
+        int id_j = t.target_node_id_;
+        pattern.node_edges_[id_i].push_back(iter_edge);
+        if (id_i != id_j) {
+            pattern.node_edges_[id_j].push_back(iter_edge);
+            pattern.block_rows_[id_i].push_back(id_j);
+            pattern.block_rows_[id_j].push_back(id_i);
+        }
+    }
+
+    Eigen::VectorXi nnz_per_col(n_nodes * 6);
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        std::vector<int> &rows = pattern.block_rows_[iter_node];
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        nnz_per_col.segment<6>(iter_node * 6).setConstant(
+                (int)rows.size() * 6);
+    }
+
+    // Insert the entries column by column in increasing row order, so that
+    // every insertion is an append.
+    Eigen::SparseMatrix<double> &H = pattern.H_;
+    H.resize(n_nodes * 6, n_nodes * 6);
+    H.reserve(nnz_per_col);
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        for (int k = 0; k < 6; k++) {
+            int col = iter_node * 6 + k;
+            for (int row_node : pattern.block_rows_[iter_node]) {
+                for (int r = 0; r < 6; r++) {
+                    H.insert(row_node * 6 + r, col) = 0.0;
+                }
+            }
+        }
+    }
+    H.makeCompressed();
+
+    pattern.diagonal_index_.resize(n_nodes * 6);
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        const std::vector<int> &rows = pattern.block_rows_[iter_node];
+        int block_pos = (int)(std::lower_bound(rows.begin(), rows.end(),
+                                               iter_node) -
+                              rows.begin());
+        for (int k = 0; k < 6; k++) {
+            int col = iter_node * 6 + k;
+            pattern.diagonal_index_[col] =
+                    H.outerIndexPtr()[col] + block_pos * 6 + k;
+        }
+    }
+    return pattern;
+}
+
 /// The information matrix used here is consistent with [Choi et al 2015].
 /// It is [-p_x | I]^T[-p_x | I]. \zeta is [\alpha \beta \gamma a b c]
 /// Another definition of information matrix used for [Kümmerle et al 2011] is
@@ -206,47 +289,118 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+///
+/// The Jacobians are computed per edge in parallel. H and b are then
+/// accumulated per block column, again in parallel: column j only receives
+/// the contributions of the edges incident to node j, so no two threads write
+/// to the same block.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeLinearSystem(const PoseGraph &pose_graph,
+                    const Eigen::VectorXd &zeta,
+                    const PoseGraphHessianPattern &pattern) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
 
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> Js(n_edges);
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> Jt(n_edges);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
-
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
         std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+        std::tie(Js[iter_edge], Jt[iter_edge]) =
+                GetJacobian(X_inv, Ts, Tt_inv);
+    }
 
-        Eigen::Matrix6d Js, Jt;
-        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
-        Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
-        Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
-        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
-        double line_process_iter = t.confidence_;
-
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+    Eigen::SparseMatrix<double> H = pattern.H_;
+    Eigen::VectorXd b(n_nodes * 6);
+    double *H_values = H.valuePtr();
+    const int *H_outer = H.outerIndexPtr();
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int id_col = 0; id_col < n_nodes; id_col++) {
+        const std::vector<int> &rows = pattern.block_rows_[id_col];
+        std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_col(
+                rows.size(), Eigen::Matrix6d::Zero());
+        Eigen::Vector6d b_col = Eigen::Vector6d::Zero();
+        auto add_block = [&](int id_row, const Eigen::Matrix6d &block) {
+            size_t block_pos =
+                    std::lower_bound(rows.begin(), rows.end(), id_row) -
+                    rows.begin();
+            H_col[block_pos] += block;
+        };
+
+        for (int iter_edge : pattern.node_edges_[id_col]) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+            Eigen::Matrix6d JsT_Info =
+                    t.confidence_ * Js[iter_edge].transpose() * t.information_;
+            Eigen::Matrix6d JtT_Info =
+                    t.confidence_ * Jt[iter_edge].transpose() * t.information_;
+            Eigen::Vector6d eT_Info =
+                    t.confidence_ * t.information_.transpose() * e;
+
+            int id_i = t.source_node_id_;
+            int id_j = t.target_node_id_;
+            if (id_i == id_col) {
+                add_block(id_i, JsT_Info * Js[iter_edge]);
+                add_block(id_j, JtT_Info * Js[iter_edge]);
+                b_col.noalias() -= Js[iter_edge].transpose() * eT_Info;
+            }
+            if (id_j == id_col) {
+                add_block(id_i, JsT_Info * Jt[iter_edge]);
+                add_block(id_j, JtT_Info * Jt[iter_edge]);
+                b_col.noalias() -= Jt[iter_edge].transpose() * eT_Info;
+            }
+        }
+
+        for (int k = 0; k < 6; k++) {
+            double *values = H_values + H_outer[id_col * 6 + k];
+            for (size_t block_pos = 0; block_pos < rows.size(); block_pos++) {
+                for (int r = 0; r < 6; r++) {
+                    values[block_pos * 6 + r] = H_col[block_pos](r, k);
+                }
+            }
+        }
+        b.block<6, 1>(id_col * 6, 0) = b_col;
     }
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Solves (H + lambda * I) @ delta == b. The sparse LDLT factorization reuses
+/// the symbolic analysis of the Hessian pattern done by the caller. If the
+/// factorization fails, e.g. when the gauge freedom of the graph leaves H
+/// numerically singular, fall back to Jacobi-preconditioned conjugate
+/// gradients, which only needs sparse matrix-vector products.
+static Eigen::VectorXd SolveLinearSystem(
+        const Eigen::SparseMatrix<double> &H,
+        const Eigen::VectorXd &b,
+        double lambda,
+        const PoseGraphHessianPattern &pattern,
+        Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> &solver) {
+    Eigen::SparseMatrix<double> H_LM = H;
+    if (lambda != 0.0) {
+        for (int index : pattern.diagonal_index_) {
+            H_LM.valuePtr()[index] += lambda;
+        }
+    }
+
+    solver.factorize(H_LM);
+    if (solver.info() == Eigen::Success) {
+        Eigen::VectorXd delta = solver.solve(b);
+        if (solver.info() == Eigen::Success && delta.allFinite()) {
+            return delta;
+        }
+    }
+    utility::LogDebug(
+            "Sparse Cholesky failed, switched to conjugate gradient solver");
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                             Eigen::Lower | Eigen::Upper>
+            cg;
+    cg.compute(H_LM);
+    return cg.solve(b);
+}
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -390,53 +544,41 @@ static bool ValidatePoseGraphConnectivity(const PoseGraph &pose_graph,
 
     // Test if the connected component containing the first node is the entire
     // graph
+    std::vector<std::vector<int>> adjacent_nodes(n_nodes);
+    for (size_t j = 0; j < n_edges; j++) {
+        const PoseGraphEdge &t = pose_graph.edges_[j];
+        if (ignore_uncertain_edges && t.uncertain_) {
+            continue;
+        }
+        adjacent_nodes[t.source_node_id_].push_back(t.target_node_id_);
+        adjacent_nodes[t.target_node_id_].push_back(t.source_node_id_);
+    }
     std::vector<int> nodes_to_explore{};
-    std::vector<int> component{};
+    std::vector<bool> in_component(n_nodes, false);
+    size_t component_size = 0;
     if (n_nodes > 0) {
         nodes_to_explore.push_back(0);
-        component.push_back(0);
+        in_component[0] = true;
+        component_size++;
     }
     while (!nodes_to_explore.empty()) {
         int i = nodes_to_explore.back();
         nodes_to_explore.pop_back();
-        for (size_t j = 0; j < n_edges; j++) {
-            const PoseGraphEdge &t = pose_graph.edges_[j];
-            if (ignore_uncertain_edges && t.uncertain_) {
-                continue;
-            }
-            int adjacent_node{-1};
-            if (t.source_node_id_ == i) {
-                adjacent_node = t.target_node_id_;
-            } else if (t.target_node_id_ == i) {
-                adjacent_node = t.source_node_id_;
-            }
-            if (adjacent_node != -1) {
-                auto find_result = std::find(component.begin(), component.end(),
-                                             adjacent_node);
-                if (find_result == component.end()) {
-                    nodes_to_explore.push_back(adjacent_node);
-                    component.push_back(adjacent_node);
-                }
+        for (int adjacent_node : adjacent_nodes[i]) {
+            if (!in_component[adjacent_node]) {
+                nodes_to_explore.push_back(adjacent_node);
+                in_component[adjacent_node] = true;
+                component_size++;
             }
         }
     }
-    return component.size() == n_nodes;
+    return component_size == n_nodes;
 }
 
 static bool ValidatePoseGraph(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
 
-    if (!ValidatePoseGraphConnectivity(pose_graph, false)) {
-        utility::LogWarning("Invalid PoseGraph - graph is not connected.");
-        return false;
-    }
-
-    if (!ValidatePoseGraphConnectivity(pose_graph, true)) {
-        utility::LogWarning(
-                "Certain-edge subset of PoseGraph is not connected.");
-    }
-
     for (int j = 0; j < n_edges; j++) {
         bool valid = false;
         const PoseGraphEdge &t = pose_graph.edges_[j];
@@ -450,6 +592,17 @@ static bool ValidatePoseGraph(const PoseGraph &pose_graph) {
             return false;
         }
     }
+
+    if (!ValidatePoseGraphConnectivity(pose_graph, false)) {
+        utility::LogWarning("Invalid PoseGraph - graph is not connected.");
+        return false;
+    }
+
+    if (!ValidatePoseGraphConnectivity(pose_graph, true)) {
+        utility::LogWarning(
+                "Certain-edge subset of PoseGraph is not connected.");
+    }
+
     for (int j = 0; j < n_edges; j++) {
         const PoseGraphEdge &t = pose_graph.edges_[j];
         if (!t.uncertain_ && t.confidence_ != 1.0) {
@@ -511,11 +664,15 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    const PoseGraphHessianPattern pattern = ComputeHessianPattern(pose_graph);
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+    solver.analyzePattern(pattern.H_);
+
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta, pattern);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
@@ -529,13 +686,8 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
-        bool solver_success = false;
-
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        Eigen::VectorXd delta =
+                SolveLinearSystem(H, b, /*lambda=*/0.0, pattern, solver);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -558,7 +710,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             x = UpdatePoseVector(pose_graph);
             valid_edges_num = UpdateConfidence(pose_graph, zeta,
                                                line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta, pattern);
 
             stop = stop || CheckRightTerm(b, criteria);
             if (stop) break;
@@ -602,16 +754,22 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    const PoseGraphHessianPattern pattern = ComputeHessianPattern(pose_graph);
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+    solver.analyzePattern(pattern.H_);
+
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta, pattern);
 
-    Eigen::VectorXd H_diag = H.diagonal();
+    double H_diag_max = 0.0;
+    for (int index : pattern.diagonal_index_) {
+        H_diag_max = (std::max)(H_diag_max, H.valuePtr()[index]);
+    }
     double tau = 1e-5;
-    double current_lambda = tau * H_diag.maxCoeff();
+    double current_lambda = tau * H_diag_max;
     double ni = 2.0;
     double rho = 0.0;
 
@@ -629,14 +787,8 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
-            bool solver_success = false;
-
-            // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            Eigen::VectorXd delta =
+                    SolveLinearSystem(H, b, current_lambda, pattern, solver);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -667,7 +819,8 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     x = UpdatePoseVector(pose_graph);
                     valid_edges_num = UpdateConfidence(
                             pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    std::tie(H, b) =
+                            ComputeLinearSystem(pose_graph, zeta, pattern);
 
                     stop = stop || CheckRightTerm(b, criteria);
                     if (stop) break;
@@ -294,49 +294,36 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
+        /* = RANSACConvergenceCriteria()*/,
+        const FeatureMatchingOption &matching_option
+        /* = FeatureMatchingOption()*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
 
     int num_src_pts = int(source.points_.size());
-    int num_tgt_pts = int(target.points_.size());
-
-    geometry::KDTreeFlann kdtree_target(target_feature);
-    pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
 
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    const FeatureMatcher target_matcher(target_feature, matching_option);
+    const std::vector<int> source_to_target =
+            target_matcher.Match(source_feature);
+    pipelines::registration::CorrespondenceSet corres_ij;
+    corres_ij.reserve(num_src_pts);
     for (int i = 0; i < num_src_pts; i++) {
-        std::vector<int> corres_tmp(1);
-        std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
+        if (source_to_target[i] >= 0) {
+            corres_ij.emplace_back(i, source_to_target[i]);
+        }
     }
 
     // Do reverse check if mutual_filter is enabled
     if (mutual_filter) {
-        geometry::KDTreeFlann kdtree_source(source_feature);
-        pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
-
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
-        for (int j = 0; j < num_tgt_pts; ++j) {
-            std::vector<int> corres_tmp(1);
-            std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
-        }
+        const FeatureMatcher source_matcher(source_feature, matching_option);
+        const std::vector<int> target_to_source =
+                source_matcher.Match(target_feature);
 
         pipelines::registration::CorrespondenceSet corres_mutual;
-        for (int i = 0; i < num_src_pts; ++i) {
-            int j = corres_ij[i](1);
-            if (corres_ji[j](0) == i) {
-                corres_mutual.emplace_back(i, j);
+        for (const Eigen::Vector2i &corres : corres_ij) {
+            if (target_to_source[corres(1)] == corres(0)) {
+                corres_mutual.push_back(corres);
             }
         }
 
@@ -27,8 +27,12 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 
 #include "open3d/core/EigenConverter.h"
@@ -36,9 +40,11 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace t {
@@ -141,7 +147,7 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
                     core::TensorKey::Slice(length, combined_length, 1),
                     other_attr);
 
-            pcd.SetPointAttr(kv.first, combined_attr.Clone());
+            pcd.SetPointAttr(kv.first, combined_attr);
         } else {
             utility::LogError(
                     "The pointcloud is missing attribute {}. The pointcloud "
@@ -210,20 +216,570 @@ PointCloud PointCloud::VoxelDownSample(
     core::Tensor addrs, masks;
     points_voxeli_hashmap.Activate(points_voxeli, addrs, masks);
 
+    // Gather the voxel coordinates in place of the points, together with the
+    // other attributes.
+    TensorMap point_attr(point_attr_);
+    point_attr["points"] = points_voxeli;
+    TensorMap point_attr_down =
+            point_attr.SelectRows(masks.NonZero().Reshape({-1}));
+
     PointCloud pcd_down(GetPoints().GetDevice());
-    for (auto &kv : point_attr_) {
+    for (auto &kv : point_attr_down) {
         if (kv.first == "points") {
-            pcd_down.SetPointAttr(kv.first, points_voxeli.IndexGet({masks}).To(
-                                                    GetPoints().GetDtype()) *
-                                                    voxel_size);
+            pcd_down.SetPointAttr(
+                    kv.first,
+                    kv.second.To(GetPoints().GetDtype()) * voxel_size);
         } else {
-            pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({masks}));
+            pcd_down.SetPointAttr(kv.first, kv.second);
         }
     }
 
     return pcd_down;
 }
 
+PointCloud PointCloud::SelectByMask(const core::Tensor &boolean_mask,
+                                    bool invert) const {
+    const int64_t length = GetPoints().GetLength();
+    boolean_mask.AssertDtype(core::Bool);
+    boolean_mask.AssertDevice(GetDevice());
+    boolean_mask.AssertShape({length});
+
+    const core::Tensor mask = invert ? boolean_mask.LogicalNot() : boolean_mask;
+    TensorMap point_attr(point_attr_.GetPrimaryKey());
+    for (auto &kv : point_attr_) {
+        if (kv.second.GetLength() == length) {
+            point_attr[kv.first] = kv.second;
+        }
+    }
+    PointCloud pcd(GetDevice());
+    for (auto &kv : point_attr.SelectRows(mask.NonZero().Reshape({-1}))) {
+        pcd.SetPointAttr(kv.first, kv.second);
+    }
+    return pcd;
+}
+
+// Searches the neighbors of every point, returning (indices, counts) where
+// only the first counts[i] entries of indices[i] are valid.
+static std::pair<core::Tensor, core::Tensor> SearchNeighbors(
+        const core::Tensor &points,
+        int max_nn,
+        const utility::optional<double> radius) {
+    if (max_nn <= 0) {
+        utility::LogError("max_nn must be positive, but got {}.", max_nn);
+    }
+    core::nns::NearestNeighborSearch nns(points);
+    core::Tensor indices, distances, counts;
+    if (radius.has_value()) {
+        if (radius.value() <= 0) {
+            utility::LogError("radius must be positive, but got {}.",
+                              radius.value());
+        }
+        nns.HybridIndex(radius.value());
+        std::tie(indices, distances, counts) =
+                nns.HybridSearch(points, radius.value(), max_nn);
+    } else {
+        nns.KnnIndex();
+        std::tie(indices, distances) = nns.KnnSearch(points, max_nn);
+        counts = core::Tensor::Full({points.GetLength()}, indices.GetShape(1),
+                                    core::Int64, points.GetDevice());
+    }
+    return std::make_pair(indices, counts);
+}
+
+void PointCloud::EstimateCovariances(int max_nn,
+                                     const utility::optional<double> radius) {
+    core::Tensor points = GetPoints().Contiguous();
+    core::Tensor indices, counts, covariances;
+    std::tie(indices, counts) = SearchNeighbors(points, max_nn, radius);
+    kernel::pointcloud::EstimateCovariances(points, indices, counts,
+                                            covariances);
+    SetPointAttr("covariances", covariances);
+}
+
+void PointCloud::EstimateNormals(int max_nn,
+                                 const utility::optional<double> radius) {
+    const core::Dtype dtype = GetPoints().GetDtype();
+    if (!HasPointAttr("covariances")) {
+        EstimateCovariances(max_nn, radius);
+    }
+    const core::Tensor covariances =
+            GetPointAttr("covariances").To(dtype).Contiguous();
+
+    const bool has_normals = HasPointNormals();
+    core::Tensor normals;
+    if (has_normals) {
+        normals = GetPointNormals().To(dtype, /*copy=*/true);
+    }
+    kernel::pointcloud::EstimateNormalsFromCovariances(covariances, normals,
+                                                       has_normals);
+    SetPointNormals(normals);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveStatisticalOutliers(
+        size_t nb_neighbors, double std_ratio) const {
+    if (nb_neighbors < 1 || std_ratio <= 0) {
+        utility::LogError(
+                "Illegal input parameters, number of neighbors and standard "
+                "deviation ratio must be positive.");
+    }
+    if (IsEmpty()) {
+        return std::make_tuple(PointCloud(GetDevice()),
+                               core::Tensor({0}, core::Bool, GetDevice()));
+    }
+
+    const core::Tensor points = GetPoints().Contiguous();
+    core::nns::NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+    core::Tensor indices, distances;
+    std::tie(indices, distances) =
+            nns.KnnSearch(points, static_cast<int>(nb_neighbors));
+    const core::Tensor avg_distances =
+            distances.Sqrt().Mean({1}).To(core::Float64);
+
+    // Points with duplicates only have a zero average distance and are
+    // excluded from the statistics, as in the legacy implementation.
+    const core::Tensor valid = avg_distances.Gt(0);
+    const core::Tensor valid_distances = avg_distances.IndexGet({valid});
+    const int64_t num_valid = valid_distances.GetLength();
+    if (num_valid == 0) {
+        return std::make_tuple(PointCloud(GetDevice()), valid);
+    }
+    const double cloud_mean = valid_distances.Mean({0}).Item<double>();
+    // Bessel's correction.
+    const core::Tensor deviations = valid_distances - cloud_mean;
+    const double sq_sum =
+            (deviations * deviations).Sum({0}).Item<double>();
+    const double std_dev =
+            num_valid > 1 ? std::sqrt(sq_sum / (num_valid - 1)) : 0;
+    const double distance_threshold = cloud_mean + std_ratio * std_dev;
+
+    const core::Tensor mask =
+            valid.LogicalAnd(avg_distances.Lt(distance_threshold));
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
+        size_t nb_points, double search_radius) const {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "Illegal input parameters, number of points and radius must be "
+                "positive.");
+    }
+    if (IsEmpty()) {
+        return std::make_tuple(PointCloud(GetDevice()),
+                               core::Tensor({0}, core::Bool, GetDevice()));
+    }
+
+    // Only counts are needed, so the search stops after nb_points + 1
+    // neighbors (including the query point itself).
+    const core::Tensor points = GetPoints().Contiguous();
+    core::nns::NearestNeighborSearch nns(points);
+    nns.HybridIndex(search_radius);
+    core::Tensor indices, distances, counts;
+    std::tie(indices, distances, counts) = nns.HybridSearch(
+            points, search_radius, static_cast<int>(nb_points) + 1);
+
+    const core::Tensor mask = counts.Gt(static_cast<int64_t>(nb_points));
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+// Fits the plane ax + by + cz + d = 0 minimizing the squared distances to
+// points with the given centroid and (unnormalized) covariance. Returns a zero
+// plane if the points do not span a plane.
+static Eigen::Vector4d FitPlane(const Eigen::Vector3d &centroid,
+                                const Eigen::Matrix3d &covariance) {
+    const Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance);
+    const Eigen::Vector3d eigenvalues = solver.eigenvalues();
+    if (!(eigenvalues(1) > 1e-12 * eigenvalues(2))) {
+        return Eigen::Vector4d::Zero();
+    }
+    const Eigen::Vector3d normal = solver.eigenvectors().col(0);
+    return Eigen::Vector4d(normal(0), normal(1), normal(2),
+                           -normal.dot(centroid));
+}
+
+// Absolute distances of shape {N, B} between the points {N, 3} and the planes
+// {B, 4}.
+static core::Tensor ComputePlaneDistances(const core::Tensor &points,
+                                          const core::Tensor &planes) {
+    const core::Tensor normals = planes.Slice(1, 0, 3).T().Contiguous();
+    const core::Tensor offsets = planes.Slice(1, 3, 4).T().Contiguous();
+    return points.Matmul(normals).Add_(offsets).Abs_();
+}
+
+// Counts the inliers {B} and sums their distances {B} for each plane. The
+// points are processed in blocks to bound the size of the distance matrix.
+static std::tuple<std::vector<int64_t>, std::vector<double>>
+EvaluatePlanes(const core::Tensor &points,
+               const core::Tensor &planes,
+               double distance_threshold) {
+    const int64_t num_points = points.GetLength();
+    const int64_t num_planes = planes.GetLength();
+    const int64_t block_size =
+            std::max<int64_t>(1, (int64_t(1) << 22) / num_planes);
+    core::Tensor counts =
+            core::Tensor::Zeros({num_planes}, core::Int64, points.GetDevice());
+    core::Tensor errors = core::Tensor::Zeros({num_planes}, core::Float64,
+                                              points.GetDevice());
+    for (int64_t begin = 0; begin < num_points; begin += block_size) {
+        const int64_t end = std::min(begin + block_size, num_points);
+        core::Tensor distances =
+                ComputePlaneDistances(points.Slice(0, begin, end), planes);
+        const core::Tensor mask = distances.Lt(distance_threshold);
+        counts.Add_(mask.To(core::Int64).Sum({0}));
+        errors.Add_(distances.Mul_(mask.To(distances.GetDtype()))
+                            .Sum({0})
+                            .To(core::Float64));
+    }
+    return std::make_tuple(counts.ToFlatVector<int64_t>(),
+                           errors.ToFlatVector<double>());
+}
+
+// RANSAC plane fitting. Hypotheses are generated on the host and evaluated in
+// batches on the device of the points. Returns the refined plane and the
+// inlier mask; the plane is zero if no plane was found.
+static std::tuple<Eigen::Vector4d, core::Tensor> SegmentPlaneRANSAC(
+        const core::Tensor &points,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability,
+        int preverification_n) {
+    const core::Device device = points.GetDevice();
+    const core::Dtype dtype = points.GetDtype();
+    const int64_t num_points = points.GetLength();
+    const int64_t batch_size = 256;
+
+    // Random subset the hypotheses are first evaluated on.
+    core::Tensor preverification_points;
+    if (preverification_n > 0 && preverification_n < num_points) {
+        const std::vector<int64_t> indices =
+                utility::UniformRandDistinctInts(preverification_n, num_points);
+        preverification_points = points.IndexGet({core::Tensor(
+                indices, {preverification_n}, core::Int64, device)});
+    }
+
+    Eigen::Vector4d best_plane = Eigen::Vector4d::Zero();
+    int64_t best_count = 0;
+    double best_rmse = 0;
+    int64_t exit_itr = num_iterations;
+    for (int64_t itr = 0; itr < std::min<int64_t>(num_iterations, exit_itr);
+         itr += batch_size) {
+        const int64_t num_hypotheses = std::min(
+                batch_size, std::min<int64_t>(num_iterations, exit_itr) - itr);
+
+        // Draw ransac_n distinct points for every hypothesis of the batch.
+        std::vector<int64_t> sampled;
+        sampled.reserve(num_hypotheses * ransac_n);
+        for (int64_t h = 0; h < num_hypotheses; ++h) {
+            const std::vector<int64_t> indices =
+                    utility::UniformRandDistinctInts(ransac_n, num_points);
+            sampled.insert(sampled.end(), indices.begin(), indices.end());
+        }
+        const core::Tensor sampled_points =
+                points.IndexGet({core::Tensor(sampled,
+                                              {num_hypotheses * ransac_n},
+                                              core::Int64, device)})
+                        .To(core::Device("CPU:0"), core::Float64)
+                        .Contiguous();
+        const double *sampled_ptr = sampled_points.GetDataPtr<double>();
+        std::vector<double> planes;
+        planes.reserve(num_hypotheses * 4);
+        for (int64_t h = 0; h < num_hypotheses; ++h) {
+            const Eigen::Map<const Eigen::Matrix3Xd> p(
+                    sampled_ptr + h * ransac_n * 3, 3, ransac_n);
+            const Eigen::Vector3d centroid = p.rowwise().mean();
+            const Eigen::Matrix3Xd centered = p.colwise() - centroid;
+            const Eigen::Vector4d plane =
+                    FitPlane(centroid, centered * centered.transpose());
+            if (!plane.isZero(0)) {
+                planes.insert(planes.end(), plane.data(), plane.data() + 4);
+            }
+        }
+        if (planes.empty()) {
+            continue;
+        }
+        core::Tensor hypotheses =
+                core::Tensor(planes, {int64_t(planes.size() / 4), 4},
+                             core::Float64, device);
+
+        // A hypothesis is discarded if its fitness on the subset is more than
+        // three standard deviations below the best fitness so far.
+        if (preverification_points.NumElements() > 0 && best_count > 0) {
+            const double n = double(preverification_n);
+            const double f = double(best_count) / double(num_points);
+            const double min_count =
+                    (f - 3.0 * std::sqrt(f * (1.0 - f) / n)) * n;
+            std::vector<int64_t> subset_counts;
+            std::tie(subset_counts, std::ignore) =
+                    EvaluatePlanes(preverification_points,
+                                   hypotheses.To(dtype), distance_threshold);
+            std::vector<int64_t> kept;
+            for (int64_t h = 0; h < int64_t(subset_counts.size()); ++h) {
+                if (double(subset_counts[h]) >= min_count) {
+                    kept.push_back(h);
+                }
+            }
+            if (kept.empty()) {
+                continue;
+            }
+            hypotheses = hypotheses.IndexGet({core::Tensor(
+                    kept, {int64_t(kept.size())}, core::Int64, device)});
+        }
+
+        std::vector<int64_t> counts;
+        std::vector<double> errors;
+        std::tie(counts, errors) = EvaluatePlanes(
+                points, hypotheses.To(dtype), distance_threshold);
+        const std::vector<double> hypotheses_host =
+                hypotheses.ToFlatVector<double>();
+        for (int64_t h = 0; h < int64_t(counts.size()); ++h) {
+            if (counts[h] == 0) continue;
+            const double rmse = errors[h] / std::sqrt(double(counts[h]));
+            if (counts[h] > best_count ||
+                (counts[h] == best_count && rmse < best_rmse)) {
+                best_count = counts[h];
+                best_rmse = rmse;
+                best_plane = Eigen::Map<const Eigen::Vector4d>(
+                        hypotheses_host.data() + h * 4);
+            }
+        }
+
+        // Update exit condition if necessary.
+        if (best_count > 0) {
+            const double fitness = double(best_count) / double(num_points);
+            if (fitness >= 1.0) {
+                exit_itr = 0;
+            } else {
+                const double exit_itr_d =
+                        std::log(1.0 - probability) /
+                        std::log(1.0 - std::pow(fitness, ransac_n));
+                if (exit_itr_d < double(exit_itr)) {
+                    exit_itr = static_cast<int64_t>(std::ceil(exit_itr_d));
+                }
+            }
+        }
+    }
+
+    if (best_count == 0) {
+        return std::make_tuple(
+                best_plane, core::Tensor::Zeros({num_points}, core::Bool,
+                                                device));
+    }
+
+    // Find the final inliers and improve the plane using them.
+    const core::Tensor best_plane_t = core::Tensor(
+            std::vector<double>(best_plane.data(), best_plane.data() + 4),
+            {1, 4}, core::Float64, device);
+    const core::Tensor mask =
+            ComputePlaneDistances(points, best_plane_t.To(dtype))
+                    .Lt(distance_threshold)
+                    .Reshape({num_points});
+    const core::Tensor inlier_points =
+            points.IndexGet({mask}).To(core::Float64);
+    const core::Tensor centroid = inlier_points.Mean({0}, true);
+    const core::Tensor centered = inlier_points - centroid;
+    const Eigen::Vector4d refined_plane =
+            FitPlane(core::eigen_converter::TensorToEigenMatrixXd(
+                             centroid.Reshape({3, 1})),
+                     core::eigen_converter::TensorToEigenMatrixXd(
+                             centered.T().Matmul(centered)));
+    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
+                      best_count, double(best_count) / double(num_points),
+                      best_rmse);
+    return std::make_tuple(refined_plane.isZero(0) ? best_plane : refined_plane,
+                           mask);
+}
+
+static void CheckSegmentPlaneArguments(const core::Tensor &points,
+                                       int ransac_n,
+                                       double probability) {
+    if (points.GetDtype() != core::Float32 &&
+        points.GetDtype() != core::Float64) {
+        utility::LogError("Points must be Float32 or Float64, but got {}.",
+                          points.GetDtype().ToString());
+    }
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (points.GetLength() < ransac_n) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("Probability must be > 0 and <= 1.0");
+    }
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        const int preverification_n) const {
+    const core::Tensor points = GetPoints().Contiguous();
+    CheckSegmentPlaneArguments(points, ransac_n, probability);
+
+    Eigen::Vector4d plane;
+    core::Tensor mask;
+    std::tie(plane, mask) =
+            SegmentPlaneRANSAC(points, distance_threshold, ransac_n,
+                               num_iterations, probability, preverification_n);
+    return std::make_tuple(
+            core::Tensor(std::vector<double>(plane.data(), plane.data() + 4),
+                         {4}, core::Float64, GetDevice()),
+            mask.NonZero().Reshape({-1}));
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlanes(
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const int max_num_planes,
+        const int64_t min_num_inliers,
+        const double probability,
+        const int preverification_n) const {
+    const core::Tensor points = GetPoints().Contiguous();
+    CheckSegmentPlaneArguments(points, ransac_n, probability);
+    const int64_t num_points = points.GetLength();
+
+    std::vector<double> planes;
+    core::Tensor labels =
+            core::Tensor::Full({num_points}, -1, core::Int64, GetDevice());
+    // Indices of the points not assigned to a plane yet.
+    core::Tensor remaining_indices =
+            core::Tensor::Arange(0, num_points, 1, core::Int64, GetDevice());
+    core::Tensor remaining_points = points;
+    int num_planes = 0;
+    while (num_planes < max_num_planes &&
+           remaining_points.GetLength() >=
+                   std::max<int64_t>(ransac_n, min_num_inliers)) {
+        Eigen::Vector4d plane;
+        core::Tensor mask;
+        std::tie(plane, mask) = SegmentPlaneRANSAC(
+                remaining_points, distance_threshold, ransac_n,
+                num_iterations, probability, preverification_n);
+        const core::Tensor inlier_indices = remaining_indices.IndexGet({mask});
+        const int64_t num_inliers = inlier_indices.GetLength();
+        if (plane.isZero(0) || num_inliers < min_num_inliers) {
+            break;
+        }
+
+        labels.IndexSet({inlier_indices},
+                        core::Tensor::Full({num_inliers}, num_planes,
+                                           core::Int64, GetDevice()));
+        planes.insert(planes.end(), plane.data(), plane.data() + 4);
+        num_planes++;
+
+        const core::Tensor outlier_mask = mask.LogicalNot();
+        remaining_indices = remaining_indices.IndexGet({outlier_mask});
+        remaining_points = remaining_points.IndexGet({outlier_mask});
+    }
+    return std::make_tuple(core::Tensor(planes, {num_planes, 4},
+                                        core::Float64, GetDevice()),
+                           labels);
+}
+
+core::Tensor PointCloud::ClusterDBSCAN(double eps, size_t min_points) const {
+    if (eps <= 0) {
+        utility::LogError("eps must be positive.");
+    }
+    const core::Tensor points = GetPoints().Contiguous();
+    const int64_t num_points = points.GetLength();
+    if (num_points == 0) {
+        return core::Tensor({0}, core::Int32, GetDevice());
+    }
+
+    // Bucket the points into cells with a diagonal of eps, so that all points
+    // of a cell are neighbors of each other.
+    const double cell_size = eps / std::sqrt(3.0);
+    const core::Tensor keys = (points / cell_size).Floor().To(core::Int32);
+    core::Hashmap hashmap(num_points, core::Int32, core::Int32, {3}, {1},
+                          GetDevice());
+    core::Tensor addrs, masks;
+    hashmap.Activate(keys, addrs, masks);
+    hashmap.Find(keys, addrs, masks);
+
+    core::Tensor active_addrs;
+    hashmap.GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Int64);
+    const int64_t num_cells = active_addrs.GetLength();
+    core::Tensor addr_to_cell = core::Tensor::Full(
+            {hashmap.GetCapacity()}, -1, core::Int32, GetDevice());
+    addr_to_cell.IndexSet({active_addrs},
+                          core::Tensor::Arange(0, num_cells, 1, core::Int32,
+                                               GetDevice()));
+    const core::Tensor point_cells =
+            addr_to_cell.IndexGet({addrs.To(core::Int64)});
+    const core::Tensor cell_keys =
+            hashmap.GetKeyTensor().IndexGet({active_addrs});
+
+    core::Tensor cell_offsets, sorted_indices;
+    kernel::pointcloud::SortPointsByCell(point_cells, num_cells, cell_offsets,
+                                         sorted_indices);
+    const core::Tensor sorted_points =
+            points.IndexGet({sorted_indices.To(core::Int64)});
+
+    // Offsets of the cells that may hold neighbors: the points of two cells
+    // can be closer than eps unless their offset is 2 along all three axes.
+    std::vector<int> offsets;
+    for (int dx = -2; dx <= 2; ++dx) {
+        for (int dy = -2; dy <= 2; ++dy) {
+            for (int dz = -2; dz <= 2; ++dz) {
+                if (std::abs(dx) + std::abs(dy) + std::abs(dz) < 6) {
+                    offsets.insert(offsets.end(), {dx, dy, dz});
+                }
+            }
+        }
+    }
+    const int64_t num_offsets = int64_t(offsets.size() / 3);
+    const core::Tensor offsets_t = core::Tensor(
+            offsets, {1, num_offsets, 3}, core::Int32, GetDevice());
+
+    // Look the neighbor cells up in chunks to bound the memory of the queries,
+    // keeping only the cells that exist.
+    const int64_t chunk_size = std::max<int64_t>(1, (1 << 20) / num_offsets);
+    std::vector<core::Tensor> neighbor_cell_chunks;
+    std::vector<int64_t> neighbor_offsets(1, 0);
+    neighbor_offsets.reserve(num_cells + 1);
+    for (int64_t begin = 0; begin < num_cells; begin += chunk_size) {
+        const int64_t end = std::min(begin + chunk_size, num_cells);
+        const core::Tensor queries =
+                (cell_keys.Slice(0, begin, end).Reshape({end - begin, 1, 3}) +
+                 offsets_t)
+                        .Reshape({(end - begin) * num_offsets, 3});
+        core::Tensor query_addrs, query_masks;
+        hashmap.Find(queries, query_addrs, query_masks);
+        neighbor_cell_chunks.push_back(addr_to_cell.IndexGet(
+                {query_addrs.IndexGet({query_masks}).To(core::Int64)}));
+        const std::vector<int64_t> counts =
+                query_masks.Reshape({end - begin, num_offsets})
+                        .To(core::Int64)
+                        .Sum({1})
+                        .ToFlatVector<int64_t>();
+        for (int64_t count : counts) {
+            neighbor_offsets.push_back(neighbor_offsets.back() + count);
+        }
+    }
+    core::Tensor neighbor_cells = core::Tensor::Empty(
+            {neighbor_offsets.back()}, core::Int32, GetDevice());
+    int64_t neighbor_begin = 0;
+    for (const core::Tensor &chunk : neighbor_cell_chunks) {
+        neighbor_cells
+                .Slice(0, neighbor_begin, neighbor_begin + chunk.GetLength())
+                .AsRvalue() = chunk;
+        neighbor_begin += chunk.GetLength();
+    }
+
+    core::Tensor labels;
+    kernel::pointcloud::ClusterDBSCAN(
+            sorted_points, sorted_indices, cell_offsets,
+            core::Tensor(neighbor_offsets, {num_cells + 1}, core::Int64,
+                         GetDevice()),
+            neighbor_cells, eps, static_cast<int64_t>(min_points), labels);
+    return labels;
+}
+
 static PointCloud CreatePointCloudWithNormals(
         const Image &depth_in, /* UInt16 or Float32 */
         const Image &color_in, /* Float32 */
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -38,6 +39,7 @@
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace t {
@@ -321,6 +323,127 @@ public:
                                const core::HashmapBackend &backend =
                                        core::HashmapBackend::Default) const;
 
+    /// \brief Select points by a boolean mask.
+    ///
+    /// \param boolean_mask Boolean tensor of shape {N}, same device as the
+    /// point cloud.
+    /// \param invert If true, select the points where the mask is false.
+    /// \return Point cloud with all the attributes of the selected points.
+    PointCloud SelectByMask(const core::Tensor &boolean_mask,
+                            bool invert = false) const;
+
+    /// \brief Function to compute the covariance matrix of the neighborhood
+    /// of each point, stored in the "covariances" attribute with shape
+    /// {N, 3, 3}.
+    ///
+    /// \param max_nn Maximum number of neighbors.
+    /// \param radius If set, a hybrid search within \p radius is used,
+    /// otherwise a KNN search.
+    void EstimateCovariances(
+            int max_nn = 30,
+            const utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Function to compute the normals of the point cloud, stored in
+    /// the "normals" attribute.
+    ///
+    /// Normals are oriented with respect to the existing normals, if any.
+    /// The "covariances" attribute is used instead of a neighbor search if it
+    /// exists.
+    ///
+    /// \param max_nn Maximum number of neighbors.
+    /// \param radius If set, a hybrid search within \p radius is used,
+    /// otherwise a KNN search.
+    void EstimateNormals(
+            int max_nn = 30,
+            const utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Function to remove points that are further away from their
+    /// \p nb_neighbors neighbors in average.
+    ///
+    /// \param nb_neighbors Number of neighbors around the target point.
+    /// \param std_ratio Standard deviation ratio.
+    /// \return Tuple of the filtered point cloud and the boolean mask of the
+    /// points that were kept.
+    std::tuple<PointCloud, core::Tensor> RemoveStatisticalOutliers(
+            size_t nb_neighbors, double std_ratio) const;
+
+    /// \brief Function to remove points that have less than \p nb_points
+    /// in a sphere of a given radius.
+    ///
+    /// \param nb_points Number of points within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \return Tuple of the filtered point cloud and the boolean mask of the
+    /// points that were kept.
+    std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
+            size_t nb_points, double search_radius) const;
+
+    /// \brief Cluster the points using the DBSCAN algorithm
+    /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
+    /// in Large Spatial Databases with Noise", 1996
+    ///
+    /// The points are bucketed into cells of a hashmap-backed grid, so that
+    /// the memory is linear in the number of points instead of proportional
+    /// to the total size of their neighborhoods, and the clusters are merged
+    /// across cells in parallel. The labels are the same as those of
+    /// open3d::geometry::PointCloud::ClusterDBSCAN.
+    ///
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \return Int32 tensor of shape {N} with the cluster label of each point,
+    /// -1 indicates noise according to the algorithm.
+    core::Tensor ClusterDBSCAN(double eps, size_t min_points) const;
+
+    /// \brief Segment a plane using the RANSAC algorithm.
+    ///
+    /// The hypotheses are evaluated in batches on the device of the point
+    /// cloud, and the number of iterations is reduced adaptively once a
+    /// hypothesis with enough inliers has been found.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param preverification_n If positive, each hypothesis is first
+    /// evaluated on a random subset of this many points, and is discarded
+    /// without a full evaluation if it fits the subset clearly worse than the
+    /// best hypothesis so far.
+    /// \return Tuple of the plane model ax + by + cz + d = 0 of shape {4} and
+    /// dtype Float64, and the Int64 indices of the plane inliers. If no plane
+    /// is found, the plane model is zero and there are no inliers.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlane(
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            const int preverification_n = 0) const;
+
+    /// \brief Segment multiple planes by running SegmentPlane repeatedly on
+    /// the points not assigned to a plane yet.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param max_num_planes Maximum number of planes.
+    /// \param min_num_inliers The extraction stops when the next plane has
+    /// less inliers.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param preverification_n See SegmentPlane.
+    /// \return Tuple of the plane models of shape {P, 4} and dtype Float64,
+    /// in the order they were extracted, and the Int64 plane label of each
+    /// point, -1 for the points not on any plane.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlanes(
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const int max_num_planes = 10,
+            const int64_t min_num_inliers = 100,
+            const double probability = 0.99999999,
+            const int preverification_n = 0) const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -32,17 +32,26 @@
 
 // This header is in the embree src dir (embree/src/ext_embree/..).
 #include <embree3/rtcore.h>
+#include <tbb/parallel_for.h>
 #include <tutorials/common/math/closest_point.h>
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <numeric>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
-// The maximum number of rays used in calls to embree.
-static const size_t MAX_BATCH_SIZE = 1048576;
+// The number of rays or query points processed by a single task.
+static const size_t BATCH_SIZE = 1024;
+
+// The size of the ray packets used for coherent ray casting. The 8-wide
+// packets match the native SIMD width of the AVX/AVX2 builds of embree.
+static const int64_t PACKET_WIDTH = 4;
+static const int64_t PACKET_HEIGHT = 2;
 
 namespace {
 
@@ -190,6 +199,227 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     return false;
 }
 
+// Output buffers of CastRays.
+struct CastRaysOutput {
+    float* t_hit;
+    unsigned int* geometry_ids;
+    unsigned int* primitive_ids;
+    float* primitive_uvs;
+    float* primitive_normals;
+
+    void Set(size_t idx,
+             float tfar,
+             unsigned int geom_id,
+             unsigned int prim_id,
+             float u,
+             float v,
+             float ng_x,
+             float ng_y,
+             float ng_z) const {
+        t_hit[idx] = tfar;
+        if (geom_id != RTC_INVALID_GEOMETRY_ID) {
+            geometry_ids[idx] = geom_id;
+            primitive_ids[idx] = prim_id;
+            primitive_uvs[idx * 2 + 0] = u;
+            primitive_uvs[idx * 2 + 1] = v;
+            float inv_norm =
+                    1.f / std::sqrt(ng_x * ng_x + ng_y * ng_y + ng_z * ng_z);
+            primitive_normals[idx * 3 + 0] = ng_x * inv_norm;
+            primitive_normals[idx * 3 + 1] = ng_y * inv_norm;
+            primitive_normals[idx * 3 + 2] = ng_z * inv_norm;
+        } else {
+            geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+            primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+            primitive_uvs[idx * 2 + 0] = 0;
+            primitive_uvs[idx * 2 + 1] = 0;
+            primitive_normals[idx * 3 + 0] = 0;
+            primitive_normals[idx * 3 + 1] = 0;
+            primitive_normals[idx * 3 + 2] = 0;
+        }
+    }
+};
+
+// Bounding volume hierarchy over all triangles of the scene for evaluating the
+// generalized winding number. Clusters that are far away from the query point
+// are approximated by a dipole as described in "Fast Winding Numbers for Soups
+// and Clouds", Barill et al., 2018.
+class WindingNumberTree {
+public:
+    WindingNumberTree(
+            const std::vector<std::tuple<RTCGeometryType, const void*,
+                                         const void*>>& geometry_ptrs,
+            const std::vector<size_t>& geometry_num_primitives) {
+        for (size_t g = 0; g < geometry_ptrs.size(); ++g) {
+            if (std::get<0>(geometry_ptrs[g]) != RTC_GEOMETRY_TYPE_TRIANGLE ||
+                std::get<1>(geometry_ptrs[g]) == nullptr) {
+                continue;
+            }
+            const float* vertices =
+                    static_cast<const float*>(std::get<1>(geometry_ptrs[g]));
+            const uint32_t* triangles =
+                    static_cast<const uint32_t*>(std::get<2>(geometry_ptrs[g]));
+            for (size_t i = 0; i < 3 * geometry_num_primitives[g]; ++i) {
+                vertices_.emplace_back(vertices[3 * triangles[i] + 0],
+                                       vertices[3 * triangles[i] + 1],
+                                       vertices[3 * triangles[i] + 2]);
+            }
+        }
+        const size_t num_triangles = vertices_.size() / 3;
+        if (num_triangles == 0) return;
+
+        std::vector<uint32_t> order(num_triangles);
+        std::iota(order.begin(), order.end(), 0);
+        std::vector<Eigen::Vector3f> centroids(num_triangles);
+        for (size_t i = 0; i < num_triangles; ++i) {
+            centroids[i] = (vertices_[3 * i] + vertices_[3 * i + 1] +
+                            vertices_[3 * i + 2]) /
+                           3.f;
+        }
+        Build(order, centroids, 0, num_triangles);
+
+        // Store the triangles in leaf order.
+        std::vector<Eigen::Vector3f> sorted_vertices(vertices_.size());
+        for (size_t i = 0; i < num_triangles; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                sorted_vertices[3 * i + j] = vertices_[3 * order[i] + j];
+            }
+        }
+        vertices_.swap(sorted_vertices);
+        ComputeMoments(0);
+    }
+
+    // Returns the winding number at the query point, which is 1 inside and 0
+    // outside of a closed surface.
+    float WindingNumber(const Eigen::Vector3f& query) const {
+        if (nodes_.empty()) return 0.f;
+
+        double omega = 0;
+        int stack[64];
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size > 0) {
+            const Node& node = nodes_[stack[--stack_size]];
+            const Eigen::Vector3f d = node.center - query;
+            const float dist = d.norm();
+            if (dist > kBeta * node.radius) {
+                omega += node.normal.dot(d) / (dist * dist * dist);
+            } else if (node.left < 0) {
+                for (uint32_t i = node.begin; i < node.end; ++i) {
+                    omega += SolidAngle(vertices_[3 * i + 0] - query,
+                                        vertices_[3 * i + 1] - query,
+                                        vertices_[3 * i + 2] - query);
+                }
+            } else {
+                stack[stack_size++] = node.left;
+                stack[stack_size++] = node.right;
+            }
+        }
+        return float(omega / (4 * M_PI));
+    }
+
+private:
+    struct Node {
+        // Area weighted centroid of the triangles.
+        Eigen::Vector3f center;
+        // Sum of the area weighted normals of the triangles.
+        Eigen::Vector3f normal;
+        // Distance from the center to the farthest vertex.
+        float radius;
+        // Range of triangles in this node.
+        uint32_t begin, end;
+        // Children, or -1 for leaves.
+        int left, right;
+    };
+
+    // The dipole approximation is used if the query point is farther away
+    // than kBeta times the node radius.
+    static constexpr float kBeta = 2.f;
+    static constexpr uint32_t kMaxLeafSize = 8;
+
+    // Signed solid angle of the triangle (a, b, c) relative to the origin, see
+    // "The Solid Angle of a Plane Triangle", Van Oosterom and Strackee, 1983.
+    static double SolidAngle(const Eigen::Vector3f& a,
+                             const Eigen::Vector3f& b,
+                             const Eigen::Vector3f& c) {
+        const double la = a.norm(), lb = b.norm(), lc = c.norm();
+        const double det = a.dot(b.cross(c));
+        const double div = la * lb * lc + a.dot(b) * lc + b.dot(c) * la +
+                           c.dot(a) * lb;
+        return 2 * std::atan2(det, div);
+    }
+
+    // Recursively splits the triangles at the median centroid along the
+    // longest axis. The depth of the tree is logarithmic in the number of
+    // triangles, which bounds the size of the traversal stack.
+    int Build(std::vector<uint32_t>& order,
+              const std::vector<Eigen::Vector3f>& centroids,
+              uint32_t begin,
+              uint32_t end) {
+        const int node_idx = int(nodes_.size());
+        nodes_.emplace_back();
+        nodes_[node_idx].begin = begin;
+        nodes_[node_idx].end = end;
+        nodes_[node_idx].left = -1;
+        nodes_[node_idx].right = -1;
+        if (end - begin <= kMaxLeafSize) return node_idx;
+
+        Eigen::Vector3f min_bound = centroids[order[begin]];
+        Eigen::Vector3f max_bound = min_bound;
+        for (uint32_t i = begin + 1; i < end; ++i) {
+            min_bound = min_bound.cwiseMin(centroids[order[i]]);
+            max_bound = max_bound.cwiseMax(centroids[order[i]]);
+        }
+        int axis;
+        (max_bound - min_bound).maxCoeff(&axis);
+        const uint32_t mid = begin + (end - begin) / 2;
+        std::nth_element(order.begin() + begin, order.begin() + mid,
+                         order.begin() + end, [&](uint32_t x, uint32_t y) {
+                             return centroids[x](axis) < centroids[y](axis);
+                         });
+
+        const int left = Build(order, centroids, begin, mid);
+        const int right = Build(order, centroids, mid, end);
+        nodes_[node_idx].left = left;
+        nodes_[node_idx].right = right;
+        return node_idx;
+    }
+
+    void ComputeMoments(int node_idx) {
+        Node& node = nodes_[node_idx];
+        if (node.left >= 0) {
+            ComputeMoments(node.left);
+            ComputeMoments(node.right);
+        }
+        Eigen::Vector3f weighted_center = Eigen::Vector3f::Zero();
+        Eigen::Vector3f normal = Eigen::Vector3f::Zero();
+        float area = 0;
+        for (uint32_t i = node.begin; i < node.end; ++i) {
+            const Eigen::Vector3f& v0 = vertices_[3 * i + 0];
+            const Eigen::Vector3f& v1 = vertices_[3 * i + 1];
+            const Eigen::Vector3f& v2 = vertices_[3 * i + 2];
+            const Eigen::Vector3f n = 0.5f * (v1 - v0).cross(v2 - v0);
+            const float a = n.norm();
+            weighted_center += a * (v0 + v1 + v2) / 3.f;
+            normal += n;
+            area += a;
+        }
+        if (area > 0) {
+            node.center = weighted_center / area;
+        } else {
+            node.center = vertices_[3 * node.begin];
+        }
+        node.normal = normal;
+        node.radius = 0;
+        for (uint32_t i = 3 * node.begin; i < 3 * node.end; ++i) {
+            node.radius =
+                    std::max(node.radius, (vertices_[i] - node.center).norm());
+        }
+    }
+
+    std::vector<Node> nodes_;
+    std::vector<Eigen::Vector3f> vertices_;
+};
+
 }  // namespace
 
 namespace open3d {
@@ -200,37 +430,58 @@ struct RaycastingScene::Impl {
     RTCDevice device_;
     RTCScene scene_;
     bool scene_committed_;  // true if the scene has been committed.
-    // Vector for storing some information about the added geometry.
+    // Vector for storing some information about the added geometry. The
+    // vector is indexed with the geometry ID. The pointers of removed
+    // geometries are set to nullptr.
     std::vector<std::tuple<RTCGeometryType, const void*, const void*>>
             geometry_ptrs_;
+    // The number of vertices and primitives of each geometry.
+    std::vector<size_t> geometry_num_vertices_;
+    std::vector<size_t> geometry_num_primitives_;
+    // The untransformed vertices of geometries with a transformation.
+    std::unordered_map<uint32_t, core::Tensor> original_vertices_;
+    // Built on demand for winding number queries. Reset when adding geometry.
+    std::unique_ptr<WindingNumberTree> winding_number_tree_;
     core::Device tensor_device_;  // cpu
 
-    template <bool LINE_INTERSECTION>
-    void CastRays(const float* const rays,
-                  const size_t num_rays,
-                  float* t_hit,
-                  unsigned int* geometry_ids,
-                  unsigned int* primitive_ids,
-                  float* primitive_uvs,
-                  float* primitive_normals) {
+    void CommitScene() {
         if (!scene_committed_) {
             rtcCommitScene(scene_);
             scene_committed_ = true;
         }
+    }
 
-        struct RTCIntersectContext context;
-        rtcInitIntersectContext(&context);
+    // Switches the scene to a two-level acceleration structure with one BVH
+    // per geometry. Commits after changing single geometries then only
+    // rebuild or refit the BVHs of the changed geometries and the top level.
+    void MakeDynamic() {
+        RTCSceneFlags flags = rtcGetSceneFlags(scene_);
+        if (!(flags & RTC_SCENE_FLAG_DYNAMIC)) {
+            rtcSetSceneFlags(scene_, flags | RTC_SCENE_FLAG_DYNAMIC);
+        }
+    }
 
-        std::vector<RTCRayHit> rayhits(std::min(num_rays, MAX_BATCH_SIZE));
+    void AssertValidGeometryID(uint32_t geom_id) const {
+        if (geom_id >= geometry_ptrs_.size() ||
+            std::get<1>(geometry_ptrs_[geom_id]) == nullptr) {
+            utility::LogError("Invalid geometry ID {}.", geom_id);
+        }
+    }
 
-        const int num_batches = utility::DivUp(num_rays, rayhits.size());
+    template <bool LINE_INTERSECTION>
+    void CastRays(const float* const rays,
+                  const size_t num_rays,
+                  const CastRaysOutput& output) {
+        CommitScene();
 
-        for (int n = 0; n < num_batches; ++n) {
-            size_t start_idx = n * rayhits.size();
-            size_t end_idx = std::min(num_rays, (n + 1) * rayhits.size());
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            // Each task uses its own context and ray buffer.
+            struct RTCIntersectContext context;
+            rtcInitIntersectContext(&context);
 
-            for (size_t i = start_idx; i < end_idx; ++i) {
-                RTCRayHit& rh = rayhits[i - start_idx];
+            std::vector<RTCRayHit> rayhits(range.size());
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                RTCRayHit& rh = rayhits[i - range.begin()];
                 const float* r = &rays[i * 6];
                 rh.ray.org_x = r[0];
                 rh.ray.org_y = r[1];
@@ -251,53 +502,105 @@ struct RaycastingScene::Impl {
                     rh.ray.tfar = std::numeric_limits<float>::infinity();
                 }
                 rh.ray.mask = 0;
-                rh.ray.id = i - start_idx;
+                rh.ray.id = i - range.begin();
                 rh.ray.flags = 0;
                 rh.hit.geomID = RTC_INVALID_GEOMETRY_ID;
                 rh.hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
             }
 
-            rtcIntersect1M(scene_, &context, &rayhits[0], end_idx - start_idx,
+            rtcIntersect1M(scene_, &context, &rayhits[0], range.size(),
                            sizeof(RTCRayHit));
 
-            for (size_t i = start_idx; i < end_idx; ++i) {
-                RTCRayHit rh = rayhits[i - start_idx];
-                size_t idx = rh.ray.id + start_idx;
-                t_hit[idx] = rh.ray.tfar;
-                if (rh.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-                    geometry_ids[idx] = rh.hit.geomID;
-                    primitive_ids[idx] = rh.hit.primID;
-                    primitive_uvs[idx * 2 + 0] = rh.hit.u;
-                    primitive_uvs[idx * 2 + 1] = rh.hit.v;
-                    float inv_norm = 1.f / std::sqrt(rh.hit.Ng_x * rh.hit.Ng_x +
-                                                     rh.hit.Ng_y * rh.hit.Ng_y +
-                                                     rh.hit.Ng_z * rh.hit.Ng_z);
-                    primitive_normals[idx * 3 + 0] = rh.hit.Ng_x * inv_norm;
-                    primitive_normals[idx * 3 + 1] = rh.hit.Ng_y * inv_norm;
-                    primitive_normals[idx * 3 + 2] = rh.hit.Ng_z * inv_norm;
-                } else {
-                    geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
-                    primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
-                    primitive_uvs[idx * 2 + 0] = 0;
-                    primitive_uvs[idx * 2 + 1] = 0;
-                    primitive_normals[idx * 3 + 0] = 0;
-                    primitive_normals[idx * 3 + 1] = 0;
-                    primitive_normals[idx * 3 + 2] = 0;
+            for (const RTCRayHit& rh : rayhits) {
+                output.Set(rh.ray.id + range.begin(), rh.ray.tfar,
+                           rh.hit.geomID, rh.hit.primID, rh.hit.u, rh.hit.v,
+                           rh.hit.Ng_x, rh.hit.Ng_y, rh.hit.Ng_z);
+            }
+        };
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
+                          LoopFn);
+    }
+
+    // Casts the rays of a {height, width, 6} ray image. Neighbouring rays,
+    // e.g. of a pinhole camera, are traced together as coherent packets of
+    // PACKET_HEIGHT x PACKET_WIDTH rays.
+    void CastRaysCoherent(const float* const rays,
+                          const int64_t height,
+                          const int64_t width,
+                          const CastRaysOutput& output) {
+        CommitScene();
+
+        const int64_t num_tiles_x = (width + PACKET_WIDTH - 1) / PACKET_WIDTH;
+        const int64_t num_tiles_y =
+                (height + PACKET_HEIGHT - 1) / PACKET_HEIGHT;
+        const int64_t num_tiles = num_tiles_x * num_tiles_y;
+
+        auto LoopFn = [&](const tbb::blocked_range<int64_t>& range) {
+            struct RTCIntersectContext context;
+            rtcInitIntersectContext(&context);
+            context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+
+            alignas(32) int valid[PACKET_WIDTH * PACKET_HEIGHT];
+            int64_t pixel_indices[PACKET_WIDTH * PACKET_HEIGHT];
+            RTCRayHit8 rh;
+
+            for (int64_t tile = range.begin(); tile < range.end(); ++tile) {
+                const int64_t x0 = (tile % num_tiles_x) * PACKET_WIDTH;
+                const int64_t y0 = (tile / num_tiles_x) * PACKET_HEIGHT;
+                for (int k = 0; k < PACKET_WIDTH * PACKET_HEIGHT; ++k) {
+                    const int64_t x = x0 + k % PACKET_WIDTH;
+                    const int64_t y = y0 + k / PACKET_WIDTH;
+                    // Pad the packets at the image border with inactive rays.
+                    const bool inside = x < width && y < height;
+                    const int64_t idx = inside ? y * width + x : 0;
+                    const float* r = &rays[idx * 6];
+                    valid[k] = inside ? -1 : 0;
+                    pixel_indices[k] = idx;
+                    rh.ray.org_x[k] = r[0];
+                    rh.ray.org_y[k] = r[1];
+                    rh.ray.org_z[k] = r[2];
+                    rh.ray.dir_x[k] = r[3];
+                    rh.ray.dir_y[k] = r[4];
+                    rh.ray.dir_z[k] = r[5];
+                    rh.ray.tnear[k] = 0;
+                    rh.ray.tfar[k] = std::numeric_limits<float>::infinity();
+                    rh.ray.time[k] = 0;
+                    rh.ray.mask[k] = 0;
+                    rh.ray.id[k] = k;
+                    rh.ray.flags[k] = 0;
+                    rh.hit.geomID[k] = RTC_INVALID_GEOMETRY_ID;
+                    rh.hit.instID[0][k] = RTC_INVALID_GEOMETRY_ID;
+                }
+
+                rtcIntersect8(valid, scene_, &context, &rh);
+
+                for (int k = 0; k < PACKET_WIDTH * PACKET_HEIGHT; ++k) {
+                    if (!valid[k]) continue;
+                    output.Set(pixel_indices[k], rh.ray.tfar[k],
+                               rh.hit.geomID[k], rh.hit.primID[k], rh.hit.u[k],
+                               rh.hit.v[k], rh.hit.Ng_x[k], rh.hit.Ng_y[k],
+                               rh.hit.Ng_z[k]);
                 }
             }
-        }
+        };
+
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(
+                        0, num_tiles,
+                        BATCH_SIZE / (PACKET_WIDTH * PACKET_HEIGHT)),
+                LoopFn);
     }
 
     void CountIntersections(const float* const rays,
                             const size_t num_rays,
                             int* intersections) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         memset(intersections, 0, sizeof(int) * num_rays);
 
+        // The filter function only touches the entries of its own ray, which
+        // allows sharing these buffers between tasks.
         std::vector<std::tuple<uint32_t, uint32_t, float>>
                 previous_geom_prim_ID_tfar(
                         num_rays,
@@ -305,22 +608,16 @@ struct RaycastingScene::Impl {
                                         uint32_t(RTC_INVALID_GEOMETRY_ID),
                                         0.f));
 
-        CountIntersectionsContext context;
-        rtcInitIntersectContext(&context.context);
-        context.context.filter = CountIntersectionsFunc;
-        context.previous_geom_prim_ID_tfar = &previous_geom_prim_ID_tfar;
-        context.intersections = intersections;
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            CountIntersectionsContext context;
+            rtcInitIntersectContext(&context.context);
+            context.context.filter = CountIntersectionsFunc;
+            context.previous_geom_prim_ID_tfar = &previous_geom_prim_ID_tfar;
+            context.intersections = intersections;
 
-        std::vector<RTCRayHit> rayhits(std::min(num_rays, MAX_BATCH_SIZE));
-
-        const int num_batches = utility::DivUp(num_rays, rayhits.size());
-
-        for (int n = 0; n < num_batches; ++n) {
-            size_t start_idx = n * rayhits.size();
-            size_t end_idx = std::min(num_rays, (n + 1) * rayhits.size());
-
-            for (size_t i = start_idx; i < end_idx; ++i) {
-                RTCRayHit* rh = &rayhits[i - start_idx];
+            std::vector<RTCRayHit> rayhits(range.size());
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                RTCRayHit* rh = &rayhits[i - range.begin()];
                 const float* r = &rays[i * 6];
                 rh->ray.org_x = r[0];
                 rh->ray.org_y = r[1];
@@ -337,9 +634,12 @@ struct RaycastingScene::Impl {
                 rh->hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
             }
 
-            rtcIntersect1M(scene_, &context.context, &rayhits[0],
-                           end_idx - start_idx, sizeof(RTCRayHit));
-        }
+            rtcIntersect1M(scene_, &context.context, &rayhits[0], range.size(),
+                           sizeof(RTCRayHit));
+        };
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
+                          LoopFn);
     }
 
     void ComputeClosestPoints(const float* const query_points,
@@ -347,33 +647,57 @@ struct RaycastingScene::Impl {
                               float* closest_points,
                               unsigned int* geometry_ids,
                               unsigned int* primitive_ids) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
+
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                RTCPointQuery query;
+                query.x = query_points[i * 3 + 0];
+                query.y = query_points[i * 3 + 1];
+                query.z = query_points[i * 3 + 2];
+                query.radius = std::numeric_limits<float>::infinity();
+                query.time = 0.f;
+
+                ClosestPointResult result;
+                result.geometry_ptrs_ptr = &geometry_ptrs_;
+
+                RTCPointQueryContext instStack;
+                rtcInitPointQueryContext(&instStack);
+                rtcPointQuery(scene_, &query, &instStack, &ClosestPointFunc,
+                              (void*)&result);
+
+                closest_points[3 * i + 0] = result.p.x;
+                closest_points[3 * i + 1] = result.p.y;
+                closest_points[3 * i + 2] = result.p.z;
+                geometry_ids[i] = result.geomID;
+                primitive_ids[i] = result.primID;
+            }
+        };
+
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_query_points, BATCH_SIZE),
+                LoopFn);
+    }
 
-        for (size_t i = 0; i < num_query_points; ++i) {
-            RTCPointQuery query;
-            query.x = query_points[i * 3 + 0];
-            query.y = query_points[i * 3 + 1];
-            query.z = query_points[i * 3 + 2];
-            query.radius = std::numeric_limits<float>::infinity();
-            query.time = 0.f;
-
-            ClosestPointResult result;
-            result.geometry_ptrs_ptr = &geometry_ptrs_;
-
-            RTCPointQueryContext instStack;
-            rtcInitPointQueryContext(&instStack);
-            rtcPointQuery(scene_, &query, &instStack, &ClosestPointFunc,
-                          (void*)&result);
-
-            closest_points[3 * i + 0] = result.p.x;
-            closest_points[3 * i + 1] = result.p.y;
-            closest_points[3 * i + 2] = result.p.z;
-            geometry_ids[i] = result.geomID;
-            primitive_ids[i] = result.primID;
+    void ComputeWindingNumbers(const float* const query_points,
+                               const size_t num_query_points,
+                               float* winding_numbers) {
+        if (!winding_number_tree_) {
+            winding_number_tree_.reset(new WindingNumberTree(
+                    geometry_ptrs_, geometry_num_primitives_));
         }
+        const WindingNumberTree& tree = *winding_number_tree_;
+
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                Eigen::Map<const Eigen::Vector3f> query(&query_points[3 * i]);
+                winding_numbers[i] = tree.WindingNumber(query);
+            }
+        };
+
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_query_points, BATCH_SIZE),
+                LoopFn);
     }
 };
 
@@ -409,6 +733,7 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertices,
 
     // scene needs to be recommitted
     impl_->scene_committed_ = false;
+    impl_->winding_number_tree_.reset();
     RTCGeometry geom =
             rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_TRIANGLE);
 
@@ -433,12 +758,17 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertices,
     }
     rtcCommitGeometry(geom);
 
-    uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geom);
+    // Geometry IDs are not reused after removing a geometry, which allows
+    // indexing geometry_ptrs_ with the ID.
+    uint32_t geom_id = uint32_t(impl_->geometry_ptrs_.size());
+    rtcAttachGeometryByID(impl_->scene_, geom, geom_id);
     rtcReleaseGeometry(geom);
 
     impl_->geometry_ptrs_.push_back(std::make_tuple(RTC_GEOMETRY_TYPE_TRIANGLE,
                                                     (const void*)vertex_buffer,
                                                     (const void*)index_buffer));
+    impl_->geometry_num_vertices_.push_back(num_vertices);
+    impl_->geometry_num_primitives_.push_back(num_triangles);
     return geom_id;
 }
 
@@ -453,6 +783,74 @@ uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
                         mesh.GetTriangles().To(core::UInt32));
 }
 
+void RaycastingScene::SetGeometryTransform(uint32_t geom_id,
+                                           const core::Tensor& transformation) {
+    impl_->AssertValidGeometryID(geom_id);
+    transformation.AssertShape({4, 4});
+
+    const size_t num_vertices = impl_->geometry_num_vertices_[geom_id];
+    float* vertex_buffer =
+            (float*)std::get<1>(impl_->geometry_ptrs_[geom_id]);
+
+    auto it = impl_->original_vertices_.find(geom_id);
+    if (it == impl_->original_vertices_.end()) {
+        // Keep the vertices the geometry was added with, so that
+        // transformations do not accumulate rounding errors.
+        core::Tensor vertices({int64_t(num_vertices), 3}, core::Float32);
+        memcpy(vertices.GetDataPtr(), vertex_buffer,
+               sizeof(float) * 3 * num_vertices);
+        it = impl_->original_vertices_.emplace(geom_id, vertices).first;
+    }
+    const float* original_vertices = it->second.GetDataPtr<float>();
+
+    core::Tensor transformation_contig =
+            transformation.To(core::Device("CPU:0"), core::Float64)
+                    .Contiguous();
+    // Eigen is col major.
+    Eigen::Map<const Eigen::Matrix4d> TT(
+            transformation_contig.GetDataPtr<double>());
+    const Eigen::Matrix3f R = TT.block<3, 3>(0, 0).transpose().cast<float>();
+    const Eigen::Vector3f t = TT.block<1, 3>(3, 0).transpose().cast<float>();
+
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_vertices, BATCH_SIZE),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i < range.end(); ++i) {
+                    Eigen::Map<const Eigen::Vector3f> v(
+                            &original_vertices[3 * i]);
+                    Eigen::Map<Eigen::Vector3f> v_transformed(
+                            &vertex_buffer[3 * i]);
+                    v_transformed = R * v + t;
+                }
+            });
+
+    // Refit the BVH of this geometry instead of rebuilding it. The topology
+    // does not change, so the refitted BVH stays valid.
+    impl_->MakeDynamic();
+    RTCGeometry geom = rtcGetGeometry(impl_->scene_, geom_id);
+    rtcSetGeometryBuildQuality(geom, RTC_BUILD_QUALITY_REFIT);
+    rtcUpdateGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0);
+    rtcCommitGeometry(geom);
+
+    impl_->scene_committed_ = false;
+    impl_->winding_number_tree_.reset();
+}
+
+void RaycastingScene::RemoveGeometry(uint32_t geom_id) {
+    impl_->AssertValidGeometryID(geom_id);
+
+    impl_->MakeDynamic();
+    rtcDetachGeometry(impl_->scene_, geom_id);
+    impl_->geometry_ptrs_[geom_id] =
+            std::make_tuple(RTC_GEOMETRY_TYPE_TRIANGLE, nullptr, nullptr);
+    impl_->geometry_num_vertices_[geom_id] = 0;
+    impl_->geometry_num_primitives_[geom_id] = 0;
+    impl_->original_vertices_.erase(geom_id);
+
+    impl_->scene_committed_ = false;
+    impl_->winding_number_tree_.reset();
+}
+
 std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
         const core::Tensor& rays) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
@@ -471,13 +869,20 @@ std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
     shape.back() = 3;
     result["primitive_normals"] = core::Tensor(shape, core::Float32);
 
+    CastRaysOutput output;
+    output.t_hit = result["t_hit"].GetDataPtr<float>();
+    output.geometry_ids = result["geometry_ids"].GetDataPtr<uint32_t>();
+    output.primitive_ids = result["primitive_ids"].GetDataPtr<uint32_t>();
+    output.primitive_uvs = result["primitive_uvs"].GetDataPtr<float>();
+    output.primitive_normals = result["primitive_normals"].GetDataPtr<float>();
+
     auto data = rays.Contiguous();
-    impl_->CastRays<false>(data.GetDataPtr<float>(), num_rays,
-                           result["t_hit"].GetDataPtr<float>(),
-                           result["geometry_ids"].GetDataPtr<uint32_t>(),
-                           result["primitive_ids"].GetDataPtr<uint32_t>(),
-                           result["primitive_uvs"].GetDataPtr<float>(),
-                           result["primitive_normals"].GetDataPtr<float>());
+    if (rays.NumDims() == 3) {
+        impl_->CastRaysCoherent(data.GetDataPtr<float>(), rays.GetShape(0),
+                                rays.GetShape(1), output);
+    } else {
+        impl_->CastRays<false>(data.GetDataPtr<float>(), num_rays, output);
+    }
 
     return result;
 }
@@ -548,7 +953,7 @@ core::Tensor RaycastingScene::ComputeDistance(
 }
 
 core::Tensor RaycastingScene::ComputeSignedDistance(
-        const core::Tensor& query_points) {
+        const core::Tensor& query_points, bool use_winding_number) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
                                                  3, impl_->tensor_device_);
     auto shape = query_points.GetShape();
@@ -558,6 +963,21 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
 
     auto data = query_points.Contiguous();
     auto distance = ComputeDistance(data);
+    Eigen::Map<Eigen::VectorXf> distance_map(distance.GetDataPtr<float>(),
+                                             num_query_points);
+
+    if (use_winding_number) {
+        core::Tensor winding_numbers(shape, core::Float32);
+        impl_->ComputeWindingNumbers(data.GetDataPtr<float>(),
+                                     num_query_points,
+                                     winding_numbers.GetDataPtr<float>());
+        Eigen::Map<Eigen::VectorXf> winding_numbers_map(
+                winding_numbers.GetDataPtr<float>(), num_query_points);
+        distance_map.array() *= winding_numbers_map.array().unaryExpr(
+                [](const float x) { return x > 0.5f ? -1.f : 1.f; });
+        return distance;
+    }
+
     core::Tensor rays({int64_t(num_query_points), 6}, core::Float32);
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
                   core::TensorKey::Slice(0, 3, 1)},
@@ -568,8 +988,6 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
                          .Expand({int64_t(num_query_points), 3}));
     auto intersections = CountIntersections(rays);
 
-    Eigen::Map<Eigen::VectorXf> distance_map(distance.GetDataPtr<float>(),
-                                             num_query_points);
     Eigen::Map<Eigen::VectorXi> intersections_map(
             intersections.GetDataPtr<int>(), num_query_points);
     intersections_map = intersections_map.unaryExpr(
@@ -578,8 +996,8 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
     return distance;
 }
 
-core::Tensor RaycastingScene::ComputeOccupancy(
-        const core::Tensor& query_points) {
+core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
+                                               bool use_winding_number) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
                                                  3, impl_->tensor_device_);
     auto shape = query_points.GetShape();
@@ -587,6 +1005,19 @@ core::Tensor RaycastingScene::ComputeOccupancy(
                        // results.
     size_t num_query_points = shape.NumElements();
 
+    if (use_winding_number) {
+        auto data = query_points.Contiguous();
+        core::Tensor occupancy(shape, core::Float32);
+        impl_->ComputeWindingNumbers(data.GetDataPtr<float>(),
+                                     num_query_points,
+                                     occupancy.GetDataPtr<float>());
+        Eigen::Map<Eigen::VectorXf> occupancy_map(occupancy.GetDataPtr<float>(),
+                                                  num_query_points);
+        occupancy_map = occupancy_map.unaryExpr(
+                [](const float x) { return x > 0.5f ? 1.f : 0.f; });
+        return occupancy;
+    }
+
     core::Tensor rays({int64_t(num_query_points), 6}, core::Float32);
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
                   core::TensorKey::Slice(0, 3, 1)},
@@ -44,6 +44,7 @@ namespace geometry {
 /// or compute the closest point on the surface of a mesh with respect to one
 /// or more query points.
 /// It builds an internal acceleration structure to speed up those queries.
+/// All queries are processed in parallel.
 ///
 /// This class supports only the CPU device.
 class RaycastingScene {
@@ -65,6 +66,23 @@ public:
     /// \return The geometry ID of the added mesh.
     uint32_t AddTriangles(const TriangleMesh &mesh);
 
+    /// \brief Sets the transformation of a geometry.
+    ///
+    /// The transformation is applied to the vertices the geometry was added
+    /// with, i.e., consecutive transformations do not accumulate. Only the
+    /// acceleration structure of this geometry is refitted, which makes moving
+    /// a few geometries in a large static scene cheap.
+    /// \param geom_id The geometry ID returned by AddTriangles().
+    /// \param transformation The 4x4 transformation matrix.
+    void SetGeometryTransform(uint32_t geom_id,
+                              const core::Tensor &transformation);
+
+    /// \brief Removes a geometry from the scene.
+    ///
+    /// The IDs of removed geometries are not reused by AddTriangles().
+    /// \param geom_id The geometry ID returned by AddTriangles().
+    void RemoveGeometry(uint32_t geom_id);
+
     /// \brief Computes the first intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
     /// describing the rays.
@@ -74,6 +92,9 @@ public:
     /// with [ox,oy,oz] as the origin and [dx,dy,dz] as the direction. It is not
     /// necessary to normalize the direction but the returned hit distance uses
     /// the length of the direction vector as unit.
+    /// Rays with shape {height, width, 6}, e.g. created with
+    /// CreateRaysPinhole(), are traced in coherent packets of neighbouring
+    /// rays, which is faster if neighbouring rays have similar directions.
     /// \return The returned dictionary contains:
     ///         - \b t_hit A tensor with the distance to the first hit. The
     ///           shape is {..}. If there is no intersection the hit distance
@@ -131,16 +152,22 @@ public:
     /// The function assumes that all meshes are watertight and that there are
     /// no intersections between meshes, i.e., inside and outside must be well
     /// defined. The function determines the sign of the distance by counting
-    /// the intersections of a rays starting at the query points.
+    /// the intersections of a rays starting at the query points, or with the
+    /// generalized winding number if \p use_winding_number is true.
     ///
     /// \param query_points A tensor with >=2 dims, shape {.., 3} and Dtype
     /// Float32 describing the query points. {..} can be any number of
     /// dimensions, e.g., to organize the query_point to create a 3D grid the
     /// shape can be {depth, height, width, 3}. The last dimension must be 3 and
-    /// has the format [x, y, z]. \return A tensor with the signed distances to
-    /// the surface. The shape is
+    /// has the format [x, y, z].
+    /// \param use_winding_number If true, a point is inside if the winding
+    /// number of the surface at the point is larger than 0.5. This does not
+    /// cast rays and is more robust for meshes with small holes or
+    /// self-intersections.
+    /// \return A tensor with the signed distances to the surface. The shape is
     /// {..}. Negative distances mean a point is inside a closed surface.
-    core::Tensor ComputeSignedDistance(const core::Tensor &query_points);
+    core::Tensor ComputeSignedDistance(const core::Tensor &query_points,
+                                       bool use_winding_number = false);
 
     /// \brief Computes the occupancy at the query point positions.
     ///
@@ -148,7 +175,8 @@ public:
     /// The function assumes that all meshes are watertight and that there are
     /// no intersections between meshes, i.e., inside and outside must be well
     /// defined. The function determines if a point is inside by counting the
-    /// intersections of a rays starting at the query points.
+    /// intersections of a rays starting at the query points, or with the
+    /// generalized winding number if \p use_winding_number is true.
     ///
     /// \param query_points A tensor with >=2 dims, shape {.., 3} and Dtype
     /// Float32 describing the query_points.
@@ -156,9 +184,14 @@ public:
     /// organize the query_point to create a 3D grid the shape can be
     /// {depth, height, width, 3}.
     /// The last dimension must be 3 and has the format [x, y, z].
+    /// \param use_winding_number If true, a point is inside if the winding
+    /// number of the surface at the point is larger than 0.5. This does not
+    /// cast rays and is more robust for meshes with small holes or
+    /// self-intersections.
     /// \return A tensor with the occupancy values. The shape is {..}. Values
     /// are either 0 or 1. A point is occupied or inside if the value is 1.
-    core::Tensor ComputeOccupancy(const core::Tensor &query_points);
+    core::Tensor ComputeOccupancy(const core::Tensor &query_points,
+                                  bool use_winding_number = false);
 
     /// \brief Creates rays for the given camera parameters.
     ///
@@ -26,14 +26,193 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/hashmap/DeviceHashmap.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 
+namespace {
+
+// On-disk layout of a saved TSDFVoxelGrid:
+//   FileHeader
+//   AttrRecord x num_attrs_ (sorted by attribute name)
+//   Segment x N, each made of
+//     SegmentHeader
+//     Int32 block coordinates, (num_blocks_, 3)
+//     UInt8 block values, (num_blocks_, res, res, res, block_bytes_)
+// Every section is padded to kSectionAlignment bytes, so that the keys and
+// values can be used in place from a memory-mapped file.
+constexpr char kMagic[8] = {'O', '3', 'D', 'T', 'S', 'D', 'F', '\0'};
+constexpr uint32_t kVersion = 1;
+constexpr int64_t kSectionAlignment = 8;
+
+struct FileHeader {
+    char magic_[8];
+    uint32_t version_;
+    uint32_t num_attrs_;
+    float voxel_size_;
+    float sdf_trunc_;
+    int64_t block_resolution_;
+    int64_t block_count_;
+    int64_t block_bytes_;
+};
+
+struct AttrRecord {
+    char name_[48];
+    char dtype_[16];
+};
+
+struct SegmentHeader {
+    int64_t num_blocks_;
+    int64_t reserved_;
+};
+
+int64_t AlignSection(int64_t bytes) {
+    return (bytes + kSectionAlignment - 1) / kSectionAlignment *
+           kSectionAlignment;
+}
+
+core::Dtype DtypeFromString(const std::string &name) {
+    for (const core::Dtype &dtype :
+         {core::Float32, core::Float64, core::Int8, core::Int16, core::Int32,
+          core::Int64, core::UInt8, core::UInt16, core::UInt32, core::UInt64,
+          core::Bool}) {
+        if (dtype.ToString() == name) {
+            return dtype;
+        }
+    }
+    utility::LogError("[TSDFVoxelGrid] unsupported dtype {} in file.", name);
+}
+
+/// Attribute records of \p attr_dtype_map, sorted by attribute name.
+std::vector<AttrRecord> MakeAttrRecords(
+        const std::unordered_map<std::string, core::Dtype> &attr_dtype_map) {
+    std::vector<std::string> names;
+    for (const auto &kv : attr_dtype_map) {
+        names.push_back(kv.first);
+    }
+    std::sort(names.begin(), names.end());
+    std::vector<AttrRecord> attrs(names.size());
+    for (size_t i = 0; i < names.size(); ++i) {
+        std::memset(&attrs[i], 0, sizeof(AttrRecord));
+        if (names[i].size() >= sizeof(attrs[i].name_)) {
+            utility::LogError("[TSDFVoxelGrid] attribute name {} is too long.",
+                              names[i]);
+        }
+        std::strncpy(attrs[i].name_, names[i].c_str(),
+                     sizeof(attrs[i].name_) - 1);
+        std::strncpy(attrs[i].dtype_,
+                     attr_dtype_map.at(names[i]).ToString().c_str(),
+                     sizeof(attrs[i].dtype_) - 1);
+    }
+    return attrs;
+}
+
+void WritePadded(FILE *file, const void *data, int64_t bytes) {
+    static const char zeros[kSectionAlignment] = {0};
+    int64_t padding = AlignSection(bytes) - bytes;
+    if ((bytes > 0 && fwrite(data, 1, bytes, file) != size_t(bytes)) ||
+        (padding > 0 && fwrite(zeros, 1, padding, file) != size_t(padding))) {
+        utility::LogError("[TSDFVoxelGrid] failed to write to file.");
+    }
+}
+
+/// Write one segment of contiguous CPU Int32 keys and UInt8 values.
+void WriteSegment(FILE *file,
+                  const core::Tensor &keys,
+                  const core::Tensor &values) {
+    SegmentHeader header;
+    header.num_blocks_ = keys.GetLength();
+    header.reserved_ = 0;
+    WritePadded(file, &header, sizeof(SegmentHeader));
+    WritePadded(file, keys.GetDataPtr(),
+                keys.NumElements() * keys.GetDtype().ByteSize());
+    WritePadded(file, values.GetDataPtr(),
+                values.NumElements() * values.GetDtype().ByteSize());
+}
+
+/// Map a whole file read-only into a 1D CPU UInt8 tensor. On POSIX systems the
+/// file is memory-mapped and unmapped once the last view is released,
+/// elsewhere it is read into a regular buffer.
+core::Tensor MapFile(const std::string &file_name) {
+    core::Device host("CPU:0");
+#ifndef _WIN32
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        utility::LogError("[TSDFVoxelGrid] unable to open file {}.",
+                          file_name);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        utility::LogError("[TSDFVoxelGrid] unable to read file {}.",
+                          file_name);
+    }
+    int64_t byte_size = static_cast<int64_t>(st.st_size);
+    void *ptr = mmap(nullptr, byte_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        utility::LogError("[TSDFVoxelGrid] unable to map file {}.", file_name);
+    }
+    auto blob = std::make_shared<core::Blob>(
+            host, ptr, [byte_size](void *p) { munmap(p, byte_size); });
+    return core::Tensor({byte_size}, {1}, ptr, core::UInt8, blob);
+#else
+    FILE *file = utility::filesystem::FOpen(file_name, "rb");
+    if (file == nullptr) {
+        utility::LogError("[TSDFVoxelGrid] unable to open file {}.",
+                          file_name);
+    }
+    fseek(file, 0, SEEK_END);
+    int64_t byte_size = static_cast<int64_t>(ftell(file));
+    fseek(file, 0, SEEK_SET);
+    core::Tensor buffer({byte_size}, core::UInt8, host);
+    size_t read = fread(buffer.GetDataPtr(), 1, byte_size, file);
+    fclose(file);
+    if (byte_size == 0 || read != size_t(byte_size)) {
+        utility::LogError("[TSDFVoxelGrid] unable to read file {}.",
+                          file_name);
+    }
+    return buffer;
+#endif
+}
+
+/// View \p shape elements of \p dtype at \p offset into a mapped file.
+core::Tensor ViewMappedFile(const core::Tensor &file,
+                            int64_t offset,
+                            const core::SizeVector &shape,
+                            core::Dtype dtype) {
+    if (offset + shape.NumElements() * dtype.ByteSize() > file.GetLength()) {
+        utility::LogError("[TSDFVoxelGrid] file is truncated.");
+    }
+    return core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                        static_cast<uint8_t *>(file.GetBlob()->GetDataPtr()) +
+                                offset,
+                        dtype, file.GetBlob());
+}
+
+}  // namespace
+
 TSDFVoxelGrid::TSDFVoxelGrid(
         std::unordered_map<std::string, core::Dtype> attr_dtype_map,
         float voxel_size,
@@ -127,12 +306,10 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                 "[TSDFVoxelGrid] input depth is empty for integration.");
     }
 
-    // Create a point cloud from a low-resolution depth input to roughly
-    // estimate surfaces.
-    // TODO(wei): merge CreateFromDepth and Touch in one kernel.
+    // Touch the voxel blocks around the surface points unprojected from a
+    // low-resolution depth input. The candidate coordinate buffer and the
+    // local hashmap are kept across frames.
     int down_factor = 4;
-    PointCloud pcd = PointCloud::CreateFromDepthImage(
-            depth, intrinsics, extrinsics, depth_scale, depth_max, down_factor);
     int64_t capacity = (depth.GetCols() / down_factor) *
                        (depth.GetRows() / down_factor) * 8;
 
@@ -144,39 +321,69 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
         point_hashmap_->Clear();
     }
 
+    core::Tensor depth_tensor = depth.AsTensor().Contiguous();
     core::Tensor block_coords;
-    kernel::tsdf::Touch(point_hashmap_, pcd.GetPoints().Contiguous(),
-                        block_coords, block_resolution_, voxel_size_,
-                        sdf_trunc_);
+    kernel::tsdf::Touch(point_hashmap_, depth_tensor, intrinsics,
+                        extrinsics, touch_buffer_, block_coords,
+                        block_resolution_, voxel_size_, sdf_trunc_,
+                        depth_scale, depth_max, down_factor);
+
+    // Look up the touched blocks first and only activate the blocks observed
+    // for the first time, so that the global hashmap is only written for newly
+    // observed space. The lookup and activation outputs are written to
+    // buffers kept across frames; only the coordinates of newly observed
+    // blocks are gathered into a fresh tensor.
+    int64_t n = block_coords.GetLength();
+    if (addrs_buffer_.GetLength() < n || addrs_buffer_.GetDevice() != device_) {
+        addrs_buffer_ = core::Tensor({n}, core::Int32, device_);
+        masks_buffer_ = core::Tensor({n}, core::Bool, device_);
+        new_addrs_buffer_ = core::Tensor({n}, core::Int32, device_);
+        activated_masks_buffer_ = core::Tensor({n}, core::Bool, device_);
+    }
+    core::Tensor addrs = addrs_buffer_.Slice(0, 0, n);
+    core::Tensor new_masks = masks_buffer_.Slice(0, 0, n);
 
-    // Active voxel blocks in the block hashmap.
-    core::Tensor addrs, masks;
-    int64_t n = block_hashmap_->Size();
-    try {
-        block_hashmap_->Activate(block_coords, addrs, masks);
-    } catch (const std::runtime_error &) {
-        utility::LogError(
-                "[TSDFIntegrate] Unable to allocate volume during rehashing. "
-                "Consider using a "
-                "larger block_count at initialization to avoid rehashing "
-                "(currently {}), or choosing a larger voxel_size "
-                "(currently {})",
-                n, voxel_size_);
-    }
-
-    // Collect voxel blocks in the viewing frustum. Note we cannot directly
-    // reuse addrs from Activate, since some blocks might have been activated in
-    // previous launches and return false.
-    // TODO(wei): support one-pass operation ActivateAndFind.
-    // TODO(wei): set point_hashmap_[block_coords] = addrs and use the small
-    // hashmap for raycasting
-    block_hashmap_->Find(block_coords, addrs, masks);
+    auto device_hashmap = block_hashmap_->GetDeviceHashmap();
+    device_hashmap->Find(block_coords.GetDataPtr(),
+                         static_cast<core::addr_t *>(addrs.GetDataPtr()),
+                         new_masks.GetDataPtr<bool>(), n);
+    new_masks.LogicalNot_();
+    if (new_masks.Any()) {
+        core::Tensor new_block_coords = block_coords.IndexGet({new_masks});
+        int64_t m = new_block_coords.GetLength();
+        core::Tensor new_addrs = new_addrs_buffer_.Slice(0, 0, m);
+        core::Tensor activated_masks = activated_masks_buffer_.Slice(0, 0, m);
+
+        int64_t size_before = block_hashmap_->Size();
+        int64_t capacity_before = block_hashmap_->GetCapacity();
+        try {
+            device_hashmap->Activate(
+                    new_block_coords.GetDataPtr(),
+                    static_cast<core::addr_t *>(new_addrs.GetDataPtr()),
+                    activated_masks.GetDataPtr<bool>(), m);
+        } catch (const std::runtime_error &) {
+            utility::LogError(
+                    "[TSDFIntegrate] Unable to allocate volume during "
+                    "rehashing. Consider using a larger block_count at "
+                    "initialization to avoid rehashing (currently {}), or "
+                    "choosing a larger voxel_size (currently {})",
+                    size_before, voxel_size_);
+        }
+        if (block_hashmap_->GetCapacity() != capacity_before) {
+            // Rehashing moves the existing blocks.
+            device_hashmap->Find(
+                    block_coords.GetDataPtr(),
+                    static_cast<core::addr_t *>(addrs.GetDataPtr()),
+                    new_masks.GetDataPtr<bool>(), n);
+        } else {
+            addrs.IndexSet({new_masks}, new_addrs);
+        }
+    }
 
     // TODO(wei): directly reuse it without intermediate variables.
     // Reserved for raycasting
     active_block_coords_ = block_coords;
 
-    core::Tensor depth_tensor = depth.AsTensor().Contiguous();
     core::Tensor color_tensor;
     if (color.IsEmpty()) {
         utility::LogDebug(
@@ -376,6 +583,206 @@ TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     return device_tsdf_voxelgrid;
 }
 
+void TSDFVoxelGrid::Save(const std::string &file_name) const {
+    FileHeader header;
+    std::memcpy(header.magic_, kMagic, sizeof(kMagic));
+    header.version_ = kVersion;
+    header.num_attrs_ = static_cast<uint32_t>(attr_dtype_map_.size());
+    header.voxel_size_ = voxel_size_;
+    header.sdf_trunc_ = sdf_trunc_;
+    header.block_resolution_ = block_resolution_;
+    header.block_count_ = std::max(block_count_, block_hashmap_->Size());
+    header.block_bytes_ = block_hashmap_->GetValueTensor().GetShape().back();
+
+    const std::vector<AttrRecord> attrs = MakeAttrRecords(attr_dtype_map_);
+
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Int64);
+    core::Device host("CPU:0");
+    core::Tensor keys = block_hashmap_->GetKeyTensor()
+                                .IndexGet({active_addrs})
+                                .To(host)
+                                .Contiguous();
+    core::Tensor values = block_hashmap_->GetValueTensor()
+                                  .IndexGet({active_addrs})
+                                  .To(host)
+                                  .Contiguous();
+
+    FILE *file = utility::filesystem::FOpen(file_name, "wb");
+    if (file == nullptr) {
+        utility::LogError("[TSDFVoxelGrid] unable to open file {}.",
+                          file_name);
+    }
+    try {
+        WritePadded(file, &header, sizeof(FileHeader));
+        WritePadded(file, attrs.data(), sizeof(AttrRecord) * attrs.size());
+        WriteSegment(file, keys, values);
+    } catch (const std::runtime_error &) {
+        fclose(file);
+        throw;
+    }
+    fclose(file);
+}
+
+void TSDFVoxelGrid::Append(const std::string &file_name,
+                           const core::Tensor &block_coords) const {
+    if (block_coords.GetDtype() != core::Int32 ||
+        block_coords.NumDims() != 2 || block_coords.GetShape(1) != 3) {
+        utility::LogError(
+                "[TSDFVoxelGrid] block_coords must be an Int32 tensor of "
+                "shape (N, 3), but got {} {}.",
+                block_coords.GetDtype().ToString(),
+                block_coords.GetShape().ToString());
+    }
+    if (!utility::filesystem::FileExists(file_name)) {
+        Save(file_name);
+        return;
+    }
+
+    FILE *file = utility::filesystem::FOpen(file_name, "r+b");
+    if (file == nullptr) {
+        utility::LogError("[TSDFVoxelGrid] unable to open file {}.",
+                          file_name);
+    }
+    // Segments are only compatible if the grid parameters and the attributes
+    // match the file exactly.
+    const std::vector<AttrRecord> attrs = MakeAttrRecords(attr_dtype_map_);
+    std::vector<AttrRecord> file_attrs(attrs.size());
+    FileHeader header;
+    if (fread(&header, sizeof(FileHeader), 1, file) != 1 ||
+        std::memcmp(header.magic_, kMagic, sizeof(kMagic)) != 0 ||
+        header.version_ != kVersion || header.voxel_size_ != voxel_size_ ||
+        header.sdf_trunc_ != sdf_trunc_ ||
+        header.block_resolution_ != block_resolution_ ||
+        header.block_bytes_ !=
+                block_hashmap_->GetValueTensor().GetShape().back() ||
+        header.num_attrs_ != attrs.size() ||
+        fseek(file, AlignSection(sizeof(FileHeader)), SEEK_SET) != 0 ||
+        fread(file_attrs.data(), sizeof(AttrRecord), file_attrs.size(),
+              file) != file_attrs.size() ||
+        std::memcmp(file_attrs.data(), attrs.data(),
+                    sizeof(AttrRecord) * attrs.size()) != 0) {
+        fclose(file);
+        utility::LogError(
+                "[TSDFVoxelGrid] {} is not a TSDFVoxelGrid file with the "
+                "same voxel size, sdf_trunc, block resolution and "
+                "attributes.",
+                file_name);
+    }
+
+    core::Tensor addrs, masks;
+    block_hashmap_->Find(block_coords.To(device_).Contiguous(), addrs, masks);
+    addrs = addrs.IndexGet({masks}).To(core::Int64);
+    core::Device host("CPU:0");
+    core::Tensor keys = block_hashmap_->GetKeyTensor()
+                                .IndexGet({addrs})
+                                .To(host)
+                                .Contiguous();
+    core::Tensor values = block_hashmap_->GetValueTensor()
+                                  .IndexGet({addrs})
+                                  .To(host)
+                                  .Contiguous();
+
+    try {
+        if (fseek(file, 0, SEEK_END) != 0) {
+            utility::LogError("[TSDFVoxelGrid] failed to seek file {}.",
+                              file_name);
+        }
+        WriteSegment(file, keys, values);
+    } catch (const std::runtime_error &) {
+        fclose(file);
+        throw;
+    }
+    fclose(file);
+}
+
+TSDFVoxelGrid TSDFVoxelGrid::Load(const std::string &file_name,
+                                  const core::Device &device,
+                                  const core::HashmapBackend &backend) {
+    core::Tensor file = MapFile(file_name);
+    const uint8_t *base =
+            static_cast<const uint8_t *>(file.GetBlob()->GetDataPtr());
+    int64_t file_size = file.GetLength();
+
+    FileHeader header;
+    if (file_size < int64_t(sizeof(FileHeader))) {
+        utility::LogError("[TSDFVoxelGrid] file is truncated.");
+    }
+    std::memcpy(&header, base, sizeof(FileHeader));
+    if (std::memcmp(header.magic_, kMagic, sizeof(kMagic)) != 0) {
+        utility::LogError("[TSDFVoxelGrid] {} is not a TSDFVoxelGrid file.",
+                          file_name);
+    }
+    if (header.version_ != kVersion) {
+        utility::LogError("[TSDFVoxelGrid] unsupported file version {}.",
+                          header.version_);
+    }
+    int64_t offset = AlignSection(sizeof(FileHeader));
+
+    int64_t attrs_bytes = sizeof(AttrRecord) * header.num_attrs_;
+    if (offset + attrs_bytes > file_size) {
+        utility::LogError("[TSDFVoxelGrid] file is truncated.");
+    }
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map;
+    for (uint32_t i = 0; i < header.num_attrs_; ++i) {
+        AttrRecord attr;
+        std::memcpy(&attr, base + offset + i * sizeof(AttrRecord),
+                    sizeof(AttrRecord));
+        attr.name_[sizeof(attr.name_) - 1] = '\0';
+        attr.dtype_[sizeof(attr.dtype_) - 1] = '\0';
+        attr_dtype_map.emplace(attr.name_, DtypeFromString(attr.dtype_));
+    }
+    offset += AlignSection(attrs_bytes);
+
+    TSDFVoxelGrid voxel_grid(attr_dtype_map, header.voxel_size_,
+                             header.sdf_trunc_, header.block_resolution_,
+                             header.block_count_, device, backend);
+    if (voxel_grid.block_hashmap_->GetValueTensor().GetShape().back() !=
+        header.block_bytes_) {
+        utility::LogError(
+                "[TSDFVoxelGrid] block size in file does not match the "
+                "attribute dtype map.");
+    }
+
+    int64_t res = header.block_resolution_;
+    auto block_hashmap = voxel_grid.block_hashmap_;
+    while (offset < file_size) {
+        SegmentHeader segment;
+        if (offset + int64_t(sizeof(SegmentHeader)) > file_size) {
+            utility::LogError("[TSDFVoxelGrid] file is truncated.");
+        }
+        std::memcpy(&segment, base + offset, sizeof(SegmentHeader));
+        offset += AlignSection(sizeof(SegmentHeader));
+
+        int64_t n = segment.num_blocks_;
+        core::Tensor keys = ViewMappedFile(file, offset, {n, 3}, core::Int32);
+        offset += AlignSection(keys.NumElements() * sizeof(int32_t));
+        core::Tensor values =
+                ViewMappedFile(file, offset, {n, res, res, res,
+                                              header.block_bytes_},
+                               core::UInt8);
+        offset += AlignSection(values.NumElements());
+        if (n == 0) {
+            continue;
+        }
+
+        // Blocks in later segments override the ones loaded before.
+        core::Tensor keys_device = keys.To(device);
+        core::Tensor addrs, masks;
+        block_hashmap->Activate(keys_device, addrs, masks);
+        block_hashmap->Find(keys_device, addrs, masks);
+        core::Tensor value_buffer = block_hashmap->GetValueTensor();
+        value_buffer.IndexSet({addrs.To(core::Int64)}, values.To(device));
+    }
+
+    core::Tensor active_addrs;
+    block_hashmap->GetActiveIndices(active_addrs);
+    voxel_grid.active_block_coords_ = block_hashmap->GetKeyTensor().IndexGet(
+            {active_addrs.To(core::Int64)});
+    return voxel_grid;
+}
+
 std::pair<core::Tensor, core::Tensor> TSDFVoxelGrid::BufferRadiusNeighbors(
         const core::Tensor &active_addrs) {
     // Fixed radius search for spatially hashed voxel blocks.
@@ -156,6 +156,35 @@ public:
                   false);
     }
 
+    /// Write all active voxel blocks to a binary file.
+    /// The file stores the voxel size, sdf_trunc, block resolution and the
+    /// attribute dtype map, followed by one segment of block coordinates and
+    /// block values. Existing files are overwritten.
+    void Save(const std::string &file_name) const;
+
+    /// Append the voxel blocks at \p block_coords (Int32 tensor of shape
+    /// (N, 3)) as a new segment to a file previously written by Save, e.g.
+    /// the blocks touched since the last checkpoint. Coordinates that are not
+    /// allocated in the grid are skipped. When the file does not exist, the
+    /// whole grid is saved instead. The file must have been written by a grid
+    /// with the same voxel size, sdf_trunc, block resolution and attributes.
+    /// On Load, later segments override blocks stored in earlier ones.
+    void Append(const std::string &file_name,
+                const core::Tensor &block_coords) const;
+
+    /// Load a TSDFVoxelGrid written by Save / Append.
+    /// This is not a zero-copy load: the hashmap owns its buffers, so every
+    /// block segment is copied into the hashmap buffers on \p device. On
+    /// POSIX systems the copy is made straight from a memory mapping of the
+    /// file, without an intermediate read buffer; elsewhere the file is read
+    /// into memory first. All loaded blocks are
+    /// marked active, so RayCast can be called directly after loading.
+    static TSDFVoxelGrid Load(
+            const std::string &file_name,
+            const core::Device &device = core::Device("CPU:0"),
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
     core::Device GetDevice() const { return device_; }
 
     std::shared_ptr<core::Hashmap> GetBlockHashmap() { return block_hashmap_; }
@@ -184,8 +213,17 @@ protected:
     // Global hashmap
     std::shared_ptr<core::Hashmap> block_hashmap_;
 
-    // Local hashmap for the `unique` operation of input points
+    // Local hashmap for the `unique` operation of touched blocks
     std::shared_ptr<core::Hashmap> point_hashmap_;
+    // Candidate block coordinates of the touch operation, reused across
+    // Integrate calls
+    core::Tensor touch_buffer_;
+    // Outputs of the block lookup and activation, reused across Integrate
+    // calls
+    core::Tensor addrs_buffer_;
+    core::Tensor masks_buffer_;
+    core::Tensor new_addrs_buffer_;
+    core::Tensor activated_masks_buffer_;
     core::Tensor active_block_coords_;
 
     std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
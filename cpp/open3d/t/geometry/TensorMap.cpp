@@ -31,7 +31,9 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -72,6 +74,24 @@ void TensorMap::AssertSizeSynchronized() const {
     }
 }
 
+TensorMap TensorMap::SelectRows(const core::Tensor& indices) const {
+    AssertSizeSynchronized();
+    std::vector<std::string> keys;
+    std::vector<core::Tensor> srcs;
+    for (const auto& kv : *this) {
+        keys.push_back(kv.first);
+        srcs.push_back(kv.second);
+    }
+    std::vector<core::Tensor> dsts;
+    core::kernel::IndexGetRows(srcs, indices, dsts);
+
+    TensorMap tensor_map(primary_key_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        tensor_map[keys[i]] = dsts[i];
+    }
+    return tensor_map;
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
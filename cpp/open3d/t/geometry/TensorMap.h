@@ -124,6 +124,15 @@ public:
     /// Same as C++20's std::unordered_map::contains().
     bool Contains(const std::string& key) const { return count(key) != 0; }
 
+    /// \brief Returns a TensorMap with the rows \p indices of all tensors,
+    /// i.e. `result[key] = tensor[indices]` along the first dimension.
+    ///
+    /// All tensors are gathered in a single pass over \p indices with
+    /// core::kernel::IndexGetRows(), thus the map must be size-synchronized.
+    ///
+    /// \param indices Int64 tensor of shape {N} on the device of the tensors.
+    TensorMap SelectRows(const core::Tensor& indices) const;
+
 private:
     /// Asserts that the map indeed contains the primary_key. This is typically
     /// called in constructors.
@@ -33,8 +33,11 @@
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
 
 namespace open3d {
 namespace t {
@@ -109,6 +112,280 @@ TriangleMesh &TriangleMesh::Rotate(const core::Tensor &R,
     return *this;
 }
 
+TriangleMesh TriangleMesh::SelectFacesByMask(const core::Tensor &mask) const {
+    const core::Tensor &triangles = GetTriangles();
+    const int64_t num_vertices = GetVertices().GetLength();
+    mask.AssertDtype(core::Bool);
+    mask.AssertDevice(device_);
+    mask.AssertShape({triangles.GetLength()});
+
+    TensorMap triangle_attr =
+            triangle_attr_.SelectRows(mask.NonZero().Reshape({-1}));
+    const int64_t num_triangles = triangle_attr["triangles"].GetLength();
+    const core::Tensor triangle_vertices =
+            triangle_attr["triangles"].Reshape({num_triangles * 3}).To(
+                    core::Int64);
+
+    // Keep the vertices referenced by the selected triangles and map them to
+    // consecutive indices.
+    core::Tensor vertex_mask =
+            core::Tensor::Zeros({num_vertices}, core::Int64, device_);
+    vertex_mask.IndexSet({triangle_vertices},
+                         core::Tensor::Ones({num_triangles * 3}, core::Int64,
+                                            device_));
+    const core::Tensor vertex_indices = vertex_mask.NonZero().Reshape({-1});
+    core::Tensor vertex_map =
+            core::Tensor::Empty({num_vertices}, core::Int64, device_);
+    vertex_map.IndexSet({vertex_indices},
+                        core::Tensor::Arange(0, vertex_indices.GetLength(), 1,
+                                             core::Int64, device_));
+    triangle_attr["triangles"] = vertex_map.IndexGet({triangle_vertices})
+                                         .Reshape({num_triangles, 3})
+                                         .To(triangles.GetDtype());
+
+    TriangleMesh mesh(device_);
+    mesh.vertex_attr_ = vertex_attr_.SelectRows(vertex_indices);
+    mesh.triangle_attr_ = triangle_attr;
+    return mesh;
+}
+
+/// Returns the triangles with every vertex index i replaced by vertex_map[i].
+static core::Tensor RemapTriangles(const core::Tensor &triangles,
+                                   const core::Tensor &vertex_map) {
+    const int64_t num_triangles = triangles.GetLength();
+    return vertex_map
+            .IndexGet({triangles.Reshape({num_triangles * 3}).To(core::Int64)})
+            .Reshape({num_triangles, 3})
+            .To(triangles.GetDtype());
+}
+
+/// Returns the map from the vertex indices {N} to the positions of the
+/// \p kept vertices (Int64) among them, -1 for the other vertices.
+static core::Tensor ComputeVertexMap(int64_t num_vertices,
+                                     const core::Tensor &kept) {
+    core::Device device = kept.GetDevice();
+    core::Tensor vertex_map =
+            core::Tensor::Full({num_vertices}, -1, core::Int64, device);
+    vertex_map.IndexSet({kept}, core::Tensor::Arange(0, kept.GetLength(), 1,
+                                                     core::Int64, device));
+    return vertex_map;
+}
+
+TriangleMesh &TriangleMesh::ComputeTriangleNormals(bool normalized) {
+    if (!HasTriangles()) {
+        utility::LogWarning("The mesh has no triangles.");
+        return *this;
+    }
+    core::Tensor normals;
+    kernel::trianglemesh::ComputeTriangleNormals(
+            GetVertices(), GetTriangles().To(core::Int64), normals);
+    if (normalized) {
+        kernel::trianglemesh::NormalizeNormals(normals);
+    }
+    SetTriangleNormals(normals);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized) {
+    if (!HasTriangles()) {
+        utility::LogWarning("The mesh has no triangles.");
+        return *this;
+    }
+    if (!HasTriangleNormals()) {
+        ComputeTriangleNormals(false);
+    }
+    const core::Tensor &triangle_normals = GetTriangleNormals();
+    core::Tensor vertex_normals =
+            core::Tensor::Zeros({GetVertices().GetLength(), 3},
+                                triangle_normals.GetDtype(), device_);
+    kernel::trianglemesh::ComputeVertexNormals(GetTriangles().To(core::Int64),
+                                               triangle_normals,
+                                               vertex_normals);
+    SetVertexNormals(vertex_normals);
+    if (normalized) {
+        NormalizeNormals();
+    }
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::NormalizeNormals() {
+    if (HasVertexNormals()) {
+        core::Tensor normals = GetVertexNormals().Contiguous();
+        kernel::trianglemesh::NormalizeNormals(normals);
+        SetVertexNormals(normals);
+    }
+    if (HasTriangleNormals()) {
+        core::Tensor normals = GetTriangleNormals().Contiguous();
+        kernel::trianglemesh::NormalizeNormals(normals);
+        SetTriangleNormals(normals);
+    }
+    return *this;
+}
+
+core::Tensor TriangleMesh::GetTriangleAreas() const {
+    if (!HasTriangles()) {
+        return core::Tensor({0}, GetVertices().GetDtype(), device_);
+    }
+    core::Tensor areas;
+    kernel::trianglemesh::ComputeTriangleAreas(
+            GetVertices(), GetTriangles().To(core::Int64), areas);
+    return areas;
+}
+
+double TriangleMesh::GetSurfaceArea() const {
+    if (!HasTriangles()) {
+        return 0;
+    }
+    return GetTriangleAreas().To(core::Float64).Sum({0}).Item<double>();
+}
+
+TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
+    if (!HasVertices()) {
+        return *this;
+    }
+    // Adding 0 turns -0 into 0, so that the bit patterns of equal coordinates
+    // are equal, and the vertices can be hashed as integers of the same size.
+    core::Tensor vertices = GetVertices().Add(0).Contiguous();
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t byte_size = vertices.GetDtype().ByteSize();
+    if (byte_size != 4 && byte_size != 8) {
+        utility::LogError("Unsupported vertex dtype {}.",
+                          vertices.GetDtype().ToString());
+    }
+    const core::Dtype key_dtype = byte_size == 4 ? core::Int32 : core::Int64;
+    const core::Tensor keys(vertices.GetShape(), vertices.GetStrides(),
+                            vertices.GetDataPtr(), key_dtype,
+                            vertices.GetBlob());
+
+    core::Hashmap hashmap(num_vertices, key_dtype, core::Int32, {3}, {1},
+                          device_);
+    core::Tensor addrs, masks;
+    hashmap.Activate(keys, addrs, masks);
+    hashmap.Find(keys, addrs, masks);
+
+    // Map every vertex to the first vertex with the same coordinates.
+    core::Tensor first_indices;
+    kernel::trianglemesh::ComputeFirstIndices(
+            addrs.To(core::Int64), hashmap.GetCapacity(), first_indices);
+    const core::Tensor first_vertices =
+            first_indices.IndexGet({addrs.To(core::Int64)});
+    const core::Tensor kept =
+            first_vertices
+                    .Eq(core::Tensor::Arange(0, num_vertices, 1, core::Int64,
+                                             device_))
+                    .NonZero()
+                    .Reshape({-1});
+    utility::LogDebug(
+            "[RemoveDuplicatedVertices] {:d} vertices have been removed.",
+            num_vertices - kept.GetLength());
+    if (kept.GetLength() == num_vertices) {
+        return *this;
+    }
+
+    const core::Tensor vertex_map =
+            ComputeVertexMap(num_vertices, kept).IndexGet({first_vertices});
+    vertex_attr_ = vertex_attr_.SelectRows(kept);
+    if (HasTriangles()) {
+        SetTriangles(RemapTriangles(GetTriangles(), vertex_map));
+    }
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
+    if (!HasVertices()) {
+        return *this;
+    }
+    const int64_t num_vertices = GetVertices().GetLength();
+    core::Tensor referenced =
+            core::Tensor::Zeros({num_vertices}, core::Int64, device_);
+    if (HasTriangles()) {
+        const core::Tensor triangle_vertices =
+                GetTriangles().Reshape({-1}).To(core::Int64);
+        referenced.IndexSet({triangle_vertices},
+                            core::Tensor::Ones({triangle_vertices.GetLength()},
+                                               core::Int64, device_));
+    }
+    const core::Tensor kept = referenced.NonZero().Reshape({-1});
+    utility::LogDebug(
+            "[RemoveUnreferencedVertices] {:d} vertices have been removed.",
+            num_vertices - kept.GetLength());
+    if (kept.GetLength() == num_vertices) {
+        return *this;
+    }
+
+    vertex_attr_ = vertex_attr_.SelectRows(kept);
+    if (HasTriangles()) {
+        SetTriangles(RemapTriangles(GetTriangles(),
+                                    ComputeVertexMap(num_vertices, kept)));
+    }
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
+    if (eps <= 0) {
+        utility::LogError("eps must be positive.");
+    }
+    if (!HasVertices()) {
+        return *this;
+    }
+    const core::Tensor vertices = GetVertices().Contiguous();
+    const int64_t num_vertices = vertices.GetLength();
+    core::nns::NearestNeighborSearch nns(vertices);
+    nns.FixedRadiusIndex(eps);
+    core::Tensor indices, distances, splits;
+    std::tie(indices, distances, splits) =
+            nns.FixedRadiusSearch(vertices, eps, /*sort=*/false);
+
+    core::Tensor merge_targets;
+    kernel::trianglemesh::ComputeMergeTargets(indices, splits, merge_targets);
+
+    // Order the merged vertices by the first vertex of each group, so that
+    // the vertex order does not depend on the order the groups were formed.
+    core::Tensor first_indices;
+    kernel::trianglemesh::ComputeFirstIndices(merge_targets, num_vertices,
+                                              first_indices);
+    const core::Tensor first_vertices =
+            first_indices.IndexGet({merge_targets});
+    const core::Tensor firsts =
+            first_vertices
+                    .Eq(core::Tensor::Arange(0, num_vertices, 1, core::Int64,
+                                             device_))
+                    .NonZero()
+                    .Reshape({-1});
+    const core::Tensor kept = merge_targets.IndexGet({firsts});
+    const int64_t num_kept = kept.GetLength();
+    utility::LogDebug("[MergeCloseVertices] {:d} vertices have been merged.",
+                      num_vertices - num_kept);
+    const core::Tensor vertex_map =
+            ComputeVertexMap(num_vertices, firsts).IndexGet({first_vertices});
+
+    // Average the floating point attributes over the merged vertices.
+    TensorMap vertex_attr(vertex_attr_.GetPrimaryKey());
+    for (const auto &kv : vertex_attr_) {
+        const core::Tensor &value = kv.second;
+        const core::Dtype dtype = value.GetDtype();
+        if (dtype != core::Float32 && dtype != core::Float64) {
+            vertex_attr[kv.first] = value.IndexGet({kept});
+            continue;
+        }
+        core::SizeVector shape = value.GetShape();
+        core::Tensor averages;
+        kernel::trianglemesh::AverageByGroup(
+                value.Reshape({num_vertices, -1}).To(core::Float64),
+                vertex_map, num_kept, averages);
+        shape[0] = num_kept;
+        vertex_attr[kv.first] = averages.Reshape(shape).To(dtype);
+    }
+    vertex_attr_ = vertex_attr;
+    if (HasTriangles()) {
+        SetTriangles(RemapTriangles(GetTriangles(), vertex_map));
+    }
+    if (HasTriangleNormals()) {
+        ComputeTriangleNormals();
+    }
+    return *this;
+}
+
 geometry::TriangleMesh TriangleMesh::FromLegacyTriangleMesh(
         const open3d::geometry::TriangleMesh &mesh_legacy,
         core::Dtype float_dtype,
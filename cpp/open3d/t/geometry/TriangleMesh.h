@@ -405,6 +405,66 @@ public:
 
     TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Returns a new mesh with the triangles selected by a boolean
+    /// mask.
+    ///
+    /// Vertices that are not referenced by the selected triangles are removed
+    /// and the triangles are re-indexed accordingly. The vertex and triangle
+    /// attributes are each gathered in a single pass.
+    ///
+    /// \param mask Boolean tensor of shape {num_triangles}.
+    TriangleMesh SelectFacesByMask(const core::Tensor &mask) const;
+
+    /// \brief Computes the triangle normals from the vertices.
+    ///
+    /// \param normalized If false, the length of a normal is twice the area
+    /// of its triangle.
+    TriangleMesh &ComputeTriangleNormals(bool normalized = true);
+
+    /// \brief Computes the vertex normals as the sum of the normals of the
+    /// adjacent triangles.
+    ///
+    /// If the mesh has no triangle normals, the unnormalized triangle normals
+    /// are computed first, so that the triangles are weighted by their area.
+    /// \param normalized If true, the vertex and triangle normals are
+    /// normalized.
+    TriangleMesh &ComputeVertexNormals(bool normalized = true);
+
+    /// Normalizes the vertex and triangle normals to length 1. As in the
+    /// legacy TriangleMesh, normals of length 0 stay 0 and NaN normals are set
+    /// to (0, 0, 1).
+    TriangleMesh &NormalizeNormals();
+
+    /// Returns the areas of the triangles, a tensor of shape {num_triangles}
+    /// with the dtype of the vertices.
+    core::Tensor GetTriangleAreas() const;
+
+    /// Returns the sum of the areas of the triangles.
+    double GetSurfaceArea() const;
+
+    /// \brief Removes vertices with identical coordinates.
+    ///
+    /// The vertices are deduplicated with a core::Hashmap on the device of
+    /// the mesh. The first occurrence of every vertex is kept together with
+    /// its attributes and the triangles are re-indexed accordingly.
+    TriangleMesh &RemoveDuplicatedVertices();
+
+    /// Removes the vertices that are not referenced by any triangle.
+    TriangleMesh &RemoveUnreferencedVertices();
+
+    /// \brief Merges vertices closer than \p eps to a single one.
+    ///
+    /// As in the legacy TriangleMesh, every vertex that is not merged yet
+    /// absorbs its unmerged neighbors. The vertices are visited in a fixed
+    /// pseudo-random order instead of by index, so that the merge runs in few
+    /// parallel passes even on long chains of close vertices. The merged
+    /// vertices keep the order of their first vertices. The position and the
+    /// floating point attributes of a merged vertex are the averages of its
+    /// vertices, other attributes are taken from the absorbing vertex.
+    ///
+    /// \param eps The maximum distance of merged vertices.
+    TriangleMesh &MergeCloseVertices(double eps);
+
     core::Device GetDevice() const { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
@@ -0,0 +1,382 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const core::Device host("CPU:0");
+
+// Checks that the voxel indices of a grid covering [min_bound - voxel_size / 2,
+// max_bound + voxel_size / 2] fit in Int32.
+static void AssertVoxelSizeFitsExtent(const core::Tensor &min_bound,
+                                      const core::Tensor &max_bound,
+                                      double voxel_size) {
+    const double extent =
+            (max_bound - min_bound).Max({0}).Item<double>() + voxel_size;
+    if (voxel_size * std::numeric_limits<int>::max() < extent) {
+        utility::LogError("voxel_size is too small.");
+    }
+}
+
+VoxelGrid::VoxelGrid(double voxel_size,
+                     const core::Tensor &origin,
+                     int64_t init_capacity,
+                     const core::Device &device,
+                     const core::HashmapBackend &backend)
+    : Geometry(Geometry::GeometryType::VoxelGrid, 3),
+      voxel_size_(voxel_size),
+      device_(device),
+      backend_(backend) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    origin.AssertShape({3});
+    origin_ = origin.To(host, core::Float64, /*copy=*/true);
+    voxel_hashmap_ = std::make_shared<core::Hashmap>(
+            std::max<int64_t>(init_capacity, 1), core::Int32, core::Float32,
+            core::SizeVector{3}, core::SizeVector{3}, device, backend);
+}
+
+VoxelGrid &VoxelGrid::Clear() {
+    voxel_hashmap_->Clear();
+    return *this;
+}
+
+core::Tensor VoxelGrid::GetActiveIndices() const {
+    core::Tensor active_addrs;
+    voxel_hashmap_->GetActiveIndices(active_addrs);
+    return active_addrs.To(core::Int64);
+}
+
+core::Tensor VoxelGrid::GetVoxelIndices() const {
+    return voxel_hashmap_->GetKeyTensor().IndexGet({GetActiveIndices()});
+}
+
+core::Tensor VoxelGrid::GetVoxelColors() const {
+    return voxel_hashmap_->GetValueTensor().IndexGet({GetActiveIndices()});
+}
+
+void VoxelGrid::AddVoxels(const core::Tensor &voxel_indices,
+                          const core::Tensor &colors) {
+    const int64_t n = voxel_indices.GetLength();
+    voxel_indices.AssertShape({n, 3});
+    voxel_indices.AssertDevice(device_);
+    if (n == 0) {
+        return;
+    }
+
+    core::Tensor values;
+    if (colors.NumElements() == 0) {
+        values = core::Tensor::Zeros({n, 3}, core::Float32, device_);
+    } else {
+        colors.AssertShape({n, 3});
+        colors.AssertDevice(device_);
+        values = colors.To(core::Float32);
+    }
+
+    // Activate, then look the voxels up again: the addresses of voxels that
+    // already exist are not returned by Activate, and activating may rehash.
+    const core::Tensor keys = voxel_indices.To(core::Int32).Contiguous();
+    core::Tensor addrs, masks;
+    voxel_hashmap_->Activate(keys, addrs, masks);
+    voxel_hashmap_->Find(keys, addrs, masks);
+    voxel_hashmap_->GetValueTensor().IndexSet({addrs.To(core::Int64)}, values);
+}
+
+void VoxelGrid::RemoveVoxels(const core::Tensor &voxel_indices) {
+    const int64_t n = voxel_indices.GetLength();
+    voxel_indices.AssertShape({n, 3});
+    voxel_indices.AssertDevice(device_);
+    if (n == 0) {
+        return;
+    }
+    core::Tensor masks;
+    voxel_hashmap_->Erase(voxel_indices.To(core::Int32).Contiguous(), masks);
+}
+
+core::Tensor VoxelGrid::GetVoxel(const core::Tensor &points) const {
+    points.AssertShape({points.GetLength(), 3});
+    points.AssertDevice(device_);
+    const core::Tensor origin = origin_.To(device_).Reshape({1, 3});
+    return ((points.To(core::Float64) - origin) / voxel_size_)
+            .Floor()
+            .To(core::Int32);
+}
+
+core::Tensor VoxelGrid::CheckIfIncluded(const core::Tensor &points) const {
+    const core::Tensor keys = GetVoxel(points);
+    if (keys.GetLength() == 0) {
+        return core::Tensor({0}, core::Bool, device_);
+    }
+    core::Tensor addrs, masks;
+    voxel_hashmap_->Find(keys.Contiguous(), addrs, masks);
+    return masks;
+}
+
+VoxelGrid &VoxelGrid::CarveDepthMap(const Image &depth,
+                                    const core::Tensor &intrinsics,
+                                    const core::Tensor &extrinsics,
+                                    float depth_scale,
+                                    bool keep_voxels_outside_image) {
+    if (depth.GetChannels() != 1) {
+        utility::LogError("depth must have 1 channel, but got {}.",
+                          depth.GetChannels());
+    }
+    if (depth_scale <= 0) {
+        utility::LogError("depth_scale must be positive.");
+    }
+    if (IsEmpty()) {
+        return *this;
+    }
+    const core::Tensor voxel_indices = GetVoxelIndices();
+    core::Tensor carve_mask;
+    kernel::voxel_grid::Carve(voxel_indices, depth.AsTensor(), intrinsics,
+                              extrinsics, origin_, voxel_size_, depth_scale,
+                              /*silhouette=*/false, keep_voxels_outside_image,
+                              carve_mask);
+    RemoveVoxels(voxel_indices.IndexGet({carve_mask}));
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveSilhouette(const Image &silhouette_mask,
+                                      const core::Tensor &intrinsics,
+                                      const core::Tensor &extrinsics,
+                                      bool keep_voxels_outside_image) {
+    if (silhouette_mask.GetChannels() != 1) {
+        utility::LogError("silhouette_mask must have 1 channel, but got {}.",
+                          silhouette_mask.GetChannels());
+    }
+    if (IsEmpty()) {
+        return *this;
+    }
+    const core::Tensor voxel_indices = GetVoxelIndices();
+    core::Tensor carve_mask;
+    kernel::voxel_grid::Carve(voxel_indices, silhouette_mask.AsTensor(),
+                              intrinsics, extrinsics, origin_, voxel_size_,
+                              1.0f, /*silhouette=*/true,
+                              keep_voxels_outside_image, carve_mask);
+    RemoveVoxels(voxel_indices.IndexGet({carve_mask}));
+    return *this;
+}
+
+VoxelGrid VoxelGrid::To(const core::Device &device, bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return *this;
+    }
+
+    // Backends are specific to a device type, so only a backend requested for
+    // the same type carries over.
+    const core::HashmapBackend backend =
+            device.GetType() == GetDevice().GetType()
+                    ? backend_
+                    : core::HashmapBackend::Default;
+    VoxelGrid voxel_grid(voxel_size_, origin_,
+                         voxel_hashmap_->GetCapacity(), device, backend);
+    if (!IsEmpty()) {
+        core::Tensor addrs, masks;
+        voxel_grid.voxel_hashmap_->Insert(GetVoxelIndices().To(device),
+                                          GetVoxelColors().To(device), addrs,
+                                          masks);
+    }
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::CreateDense(const core::Tensor &origin,
+                                 const core::Tensor &color,
+                                 double voxel_size,
+                                 double width,
+                                 double height,
+                                 double depth,
+                                 const core::Device &device,
+                                 const core::HashmapBackend &backend) {
+    const int64_t num_w = int64_t(std::round(width / voxel_size));
+    const int64_t num_h = int64_t(std::round(height / voxel_size));
+    const int64_t num_d = int64_t(std::round(depth / voxel_size));
+    if (std::max({num_w, num_h, num_d}) > std::numeric_limits<int>::max()) {
+        utility::LogError("voxel_size is too small.");
+    }
+    const int64_t n = num_w * num_h * num_d;
+    VoxelGrid voxel_grid(voxel_size, origin, n, device, backend);
+    if (n == 0) {
+        return voxel_grid;
+    }
+
+    // Voxel (w, h, d) is stored at w * num_h * num_d + h * num_d + d.
+    const core::Tensor idx = core::Tensor::Arange(0, n, 1, core::Int64, device);
+    const core::Tensor w = idx / (num_h * num_d);
+    const core::Tensor hd = idx - w * (num_h * num_d);
+    const core::Tensor h = hd / num_d;
+    core::Tensor voxel_indices({n, 3}, core::Int32, device);
+    voxel_indices.Slice(1, 0, 1) = w.To(core::Int32).Reshape({n, 1});
+    voxel_indices.Slice(1, 1, 2) = h.To(core::Int32).Reshape({n, 1});
+    voxel_indices.Slice(1, 2, 3) = (hd - h * num_d).To(core::Int32).Reshape(
+            {n, 1});
+
+    color.AssertShape({3});
+    const core::Tensor colors =
+            color.To(device, core::Float32).Reshape({1, 3}).Expand({n, 3});
+    voxel_grid.AddVoxels(voxel_indices, colors);
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::CreateFromPointCloud(const PointCloud &pcd,
+                                          double voxel_size,
+                                          const core::HashmapBackend &backend) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    const core::Device device = pcd.GetDevice();
+    if (!pcd.HasPoints() || pcd.GetPoints().GetLength() == 0) {
+        return VoxelGrid(voxel_size, core::Tensor::Zeros({3}, core::Float64),
+                         1, device, backend);
+    }
+
+    const core::Tensor points = pcd.GetPoints().To(core::Float64);
+    const core::Tensor min_bound = points.Min({0});
+    AssertVoxelSizeFitsExtent(min_bound, points.Max({0}), voxel_size);
+    const int64_t n = points.GetLength();
+    VoxelGrid voxel_grid(voxel_size, min_bound - voxel_size / 2, n, device,
+                         backend);
+
+    std::shared_ptr<core::Hashmap> hashmap = voxel_grid.voxel_hashmap_;
+    const core::Tensor keys = voxel_grid.GetVoxel(points).Contiguous();
+    core::Tensor voxel_addrs, voxel_masks;
+    hashmap->Activate(keys, voxel_addrs, voxel_masks);
+
+    core::Tensor voxel_colors = hashmap->GetValueTensor();
+    if (pcd.HasPointColors()) {
+        // Activate only returns the address of the first point of every voxel;
+        // look up the addresses of all points.
+        core::Tensor point_addrs, point_masks;
+        hashmap->Find(keys, point_addrs, point_masks);
+        kernel::voxel_grid::AverageColors(point_addrs, pcd.GetPointColors(),
+                                          voxel_masks, voxel_colors);
+    } else {
+        voxel_colors.Fill(0);
+    }
+    utility::LogDebug("Pointcloud is voxelized from {} points to {} voxels.",
+                      n, voxel_grid.GetNumVoxels());
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::CreateFromTriangleMesh(
+        const TriangleMesh &mesh,
+        double voxel_size,
+        const core::HashmapBackend &backend) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    const core::Device device = mesh.GetDevice();
+    if (!mesh.HasTriangles() || mesh.GetTriangles().GetLength() == 0) {
+        return VoxelGrid(voxel_size, core::Tensor::Zeros({3}, core::Float64),
+                         1, device, backend);
+    }
+
+    const core::Tensor vertices = mesh.GetVertices().To(core::Float64);
+    const core::Tensor min_bound = vertices.Min({0});
+    AssertVoxelSizeFitsExtent(min_bound, vertices.Max({0}), voxel_size);
+    const core::Tensor origin = min_bound - voxel_size / 2;
+
+    core::Tensor voxel_indices;
+    kernel::voxel_grid::VoxelizeTriangles(vertices, mesh.GetTriangles(),
+                                          origin, voxel_size, voxel_indices);
+    VoxelGrid voxel_grid(voxel_size, origin, voxel_indices.GetLength(), device,
+                         backend);
+    voxel_grid.AddVoxels(voxel_indices);
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::FromLegacyVoxelGrid(
+        const open3d::geometry::VoxelGrid &voxel_grid_legacy,
+        const core::Device &device,
+        const core::HashmapBackend &backend) {
+    const int64_t n = static_cast<int64_t>(voxel_grid_legacy.voxels_.size());
+    const Eigen::Vector3d &origin = voxel_grid_legacy.origin_;
+    VoxelGrid voxel_grid(
+            voxel_grid_legacy.voxel_size_,
+            core::Tensor(std::vector<double>{origin(0), origin(1), origin(2)},
+                         {3}, core::Float64),
+            n, device, backend);
+    if (n == 0) {
+        return voxel_grid;
+    }
+
+    std::vector<int> indices;
+    std::vector<float> colors;
+    indices.reserve(3 * n);
+    colors.reserve(3 * n);
+    for (const auto &it : voxel_grid_legacy.voxels_) {
+        const open3d::geometry::Voxel &voxel = it.second;
+        for (int i = 0; i < 3; ++i) {
+            indices.push_back(voxel.grid_index_(i));
+            colors.push_back(static_cast<float>(voxel.color_(i)));
+        }
+    }
+    voxel_grid.AddVoxels(core::Tensor(indices, {n, 3}, core::Int32, device),
+                         core::Tensor(colors, {n, 3}, core::Float32, device));
+    return voxel_grid;
+}
+
+open3d::geometry::VoxelGrid VoxelGrid::ToLegacyVoxelGrid() const {
+    open3d::geometry::VoxelGrid voxel_grid_legacy;
+    voxel_grid_legacy.voxel_size_ = voxel_size_;
+    const double *origin_ptr = origin_.GetDataPtr<double>();
+    voxel_grid_legacy.origin_ =
+            Eigen::Vector3d(origin_ptr[0], origin_ptr[1], origin_ptr[2]);
+
+    const core::Tensor active_indices = GetActiveIndices();
+    const core::Tensor indices = voxel_hashmap_->GetKeyTensor()
+                                         .IndexGet({active_indices})
+                                         .To(host)
+                                         .Contiguous();
+    const core::Tensor colors = voxel_hashmap_->GetValueTensor()
+                                        .IndexGet({active_indices})
+                                        .To(host)
+                                        .Contiguous();
+    const int *indices_ptr = indices.GetDataPtr<int>();
+    const float *colors_ptr = colors.GetDataPtr<float>();
+    for (int64_t i = 0; i < indices.GetLength(); ++i) {
+        voxel_grid_legacy.AddVoxel(open3d::geometry::Voxel(
+                Eigen::Vector3i(indices_ptr + 3 * i),
+                Eigen::Vector3f(colors_ptr + 3 * i).cast<double>()));
+    }
+    return voxel_grid_legacy;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,238 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/Geometry.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class VoxelGrid
+///
+/// \brief A sparse voxel grid stored in a core::Hashmap.
+///
+/// The keys of the hashmap are the Int32 voxel indices of shape {3}, the
+/// values the Float32 voxel colors of shape {3}. The voxel with index
+/// (i, j, k) covers the cube [origin + (i, j, k) * voxel_size,
+/// origin + (i + 1, j + 1, k + 1) * voxel_size). Construction, queries and
+/// carving are batched over all points or voxels and run in parallel on the
+/// device of the grid.
+class VoxelGrid : public Geometry {
+public:
+    /// \brief Construct an empty voxel grid.
+    ///
+    /// \param voxel_size Edge length of the voxels.
+    /// \param origin Float64 tensor of shape {3}, the corner of voxel
+    /// (0, 0, 0).
+    /// \param init_capacity Initial capacity of the hashmap. The hashmap grows
+    /// when more voxels are added.
+    /// \param device The device of the grid.
+    /// \param backend The hashmap backend.
+    VoxelGrid(double voxel_size = 1.0,
+              const core::Tensor &origin = core::Tensor::Zeros({3},
+                                                               core::Float64),
+              int64_t init_capacity = 1000,
+              const core::Device &device = core::Device("CPU:0"),
+              const core::HashmapBackend &backend =
+                      core::HashmapBackend::Default);
+
+    virtual ~VoxelGrid() override {}
+
+    /// Remove all voxels.
+    VoxelGrid &Clear() override;
+
+    /// Returns true iff the grid has no voxels.
+    bool IsEmpty() const override { return GetNumVoxels() == 0; }
+
+    /// Returns the number of voxels.
+    int64_t GetNumVoxels() const { return voxel_hashmap_->Size(); }
+
+    double GetVoxelSize() const { return voxel_size_; }
+
+    /// Returns the origin as a Float64 tensor of shape {3} on the CPU.
+    core::Tensor GetOrigin() const { return origin_; }
+
+    core::Device GetDevice() const { return device_; }
+
+    /// Returns the hashmap backend the grid was created with.
+    core::HashmapBackend GetHashmapBackend() const { return backend_; }
+
+    std::shared_ptr<core::Hashmap> GetVoxelHashmap() { return voxel_hashmap_; }
+
+    /// Returns the indices of all voxels as an Int32 tensor of shape {N, 3}.
+    core::Tensor GetVoxelIndices() const;
+
+    /// Returns the colors of all voxels as a Float32 tensor of shape {N, 3},
+    /// in the same order as GetVoxelIndices().
+    core::Tensor GetVoxelColors() const;
+
+    /// \brief Add voxels, overwriting the colors of existing ones.
+    ///
+    /// \param voxel_indices Int32 tensor of shape {N, 3}.
+    /// \param colors Float tensor of shape {N, 3}. If empty, the voxels are
+    /// black.
+    void AddVoxels(const core::Tensor &voxel_indices,
+                   const core::Tensor &colors = core::Tensor());
+
+    /// \brief Remove voxels. Indices that are not in the grid are ignored.
+    ///
+    /// \param voxel_indices Int32 tensor of shape {N, 3}.
+    void RemoveVoxels(const core::Tensor &voxel_indices);
+
+    /// \brief Returns the indices of the voxels containing the points, whether
+    /// the voxels are in the grid or not.
+    ///
+    /// \param points Float tensor of shape {N, 3}.
+    /// \return Int32 tensor of shape {N, 3}.
+    core::Tensor GetVoxel(const core::Tensor &points) const;
+
+    /// \brief Element-wise check if the points fall into a voxel of the grid.
+    ///
+    /// \param points Float tensor of shape {N, 3}.
+    /// \return Bool tensor of shape {N}.
+    core::Tensor CheckIfIncluded(const core::Tensor &points) const;
+
+    /// \brief Remove all voxels where none of the corners projects to a depth
+    /// value that is smaller than or equal to the depth of the corner.
+    ///
+    /// \param depth Depth image of shape {H, W, 1}.
+    /// \param intrinsics Pinhole camera matrix of shape {3, 3}.
+    /// \param extrinsics World to camera transformation of shape {4, 4}.
+    /// \param depth_scale Scale dividing the depth values, e.g. 1000 for
+    /// depth images in millimeters.
+    /// \param keep_voxels_outside_image If true, voxels are only carved if all
+    /// their corners project inside of the image.
+    VoxelGrid &CarveDepthMap(const Image &depth,
+                             const core::Tensor &intrinsics,
+                             const core::Tensor &extrinsics,
+                             float depth_scale = 1000.0f,
+                             bool keep_voxels_outside_image = false);
+
+    /// \brief Remove all voxels where none of the corners projects to a mask
+    /// pixel with a value larger than 0.
+    ///
+    /// \param silhouette_mask Mask image of shape {H, W, 1}.
+    /// \param intrinsics Pinhole camera matrix of shape {3, 3}.
+    /// \param extrinsics World to camera transformation of shape {4, 4}.
+    /// \param keep_voxels_outside_image If true, voxels are only carved if all
+    /// their corners project inside of the image.
+    VoxelGrid &CarveSilhouette(const Image &silhouette_mask,
+                               const core::Tensor &intrinsics,
+                               const core::Tensor &extrinsics,
+                               bool keep_voxels_outside_image = false);
+
+    /// Convert the VoxelGrid to the target device.
+    /// \param device The targeted device to convert to.
+    /// \param copy If true, a new VoxelGrid is always created; if false, the
+    /// copy is avoided when the original VoxelGrid is already on the targeted
+    /// device.
+    VoxelGrid To(const core::Device &device, bool copy = false) const;
+
+    /// Clone the VoxelGrid on the same device.
+    VoxelGrid Clone() const { return To(GetDevice(), true); }
+
+    /// \brief Create a grid where every voxel of the given extent is set. This
+    /// is a useful starting point for voxel carving.
+    ///
+    /// \param origin Float64 tensor of shape {3}.
+    /// \param color Float tensor of shape {3}, the color of all voxels.
+    /// \param voxel_size Edge length of the voxels.
+    /// \param width Extent of the grid along x.
+    /// \param height Extent of the grid along y.
+    /// \param depth Extent of the grid along z.
+    /// \param device The device of the grid.
+    /// \param backend The hashmap backend.
+    static VoxelGrid CreateDense(
+            const core::Tensor &origin,
+            const core::Tensor &color,
+            double voxel_size,
+            double width,
+            double height,
+            double depth,
+            const core::Device &device = core::Device("CPU:0"),
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// \brief Create a grid from the voxels occupied by the points. The color
+    /// of a voxel is the average color of its points, if the point cloud has
+    /// colors. The origin is half a voxel below the minimum bound of the
+    /// points.
+    ///
+    /// \param pcd The input point cloud.
+    /// \param voxel_size Edge length of the voxels.
+    /// \param backend The hashmap backend.
+    static VoxelGrid CreateFromPointCloud(
+            const PointCloud &pcd,
+            double voxel_size,
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// \brief Create a grid from the voxels intersected by the triangles. The
+    /// origin is half a voxel below the minimum bound of the vertices.
+    ///
+    /// \param mesh The input triangle mesh.
+    /// \param voxel_size Edge length of the voxels.
+    /// \param backend The hashmap backend.
+    static VoxelGrid CreateFromTriangleMesh(
+            const TriangleMesh &mesh,
+            double voxel_size,
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// Create a VoxelGrid from a legacy Open3D VoxelGrid.
+    static VoxelGrid FromLegacyVoxelGrid(
+            const open3d::geometry::VoxelGrid &voxel_grid_legacy,
+            const core::Device &device = core::Device("CPU:0"),
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// Convert to a legacy Open3D VoxelGrid.
+    open3d::geometry::VoxelGrid ToLegacyVoxelGrid() const;
+
+protected:
+    /// Returns the buffer indices (Int64) of all voxels in the hashmap.
+    core::Tensor GetActiveIndices() const;
+
+    double voxel_size_;
+    core::Tensor origin_;
+    core::Device device_;
+    core::HashmapBackend backend_;
+    std::shared_ptr<core::Hashmap> voxel_hashmap_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
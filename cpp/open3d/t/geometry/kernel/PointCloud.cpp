@@ -102,6 +102,95 @@ void Project(
     }
 }
 
+void EstimateCovariances(const core::Tensor& points,
+                         const core::Tensor& indices,
+                         const core::Tensor& counts,
+                         core::Tensor& covariances) {
+    core::Device device = points.GetDevice();
+    indices.AssertDevice(device);
+    counts.AssertDevice(device);
+    indices.AssertDtype(core::Int64);
+    counts.AssertDtype(core::Int64);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateCovariancesCPU(points.Contiguous(), indices.Contiguous(),
+                               counts.Contiguous(), covariances);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EstimateCovariancesCUDA, points.Contiguous(),
+                  indices.Contiguous(), counts.Contiguous(), covariances);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EstimateNormalsFromCovariances(const core::Tensor& covariances,
+                                    core::Tensor& normals,
+                                    bool has_normals) {
+    core::Device device = covariances.GetDevice();
+    if (has_normals) {
+        normals.AssertDevice(device);
+        normals.AssertDtype(covariances.GetDtype());
+        normals.AssertShape({covariances.GetLength(), 3});
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateNormalsFromCovariancesCPU(covariances.Contiguous(), normals,
+                                          has_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EstimateNormalsFromCovariancesCUDA, covariances.Contiguous(),
+                  normals, has_normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SortPointsByCell(const core::Tensor& point_cells,
+                      int64_t num_cells,
+                      core::Tensor& cell_offsets,
+                      core::Tensor& sorted_indices) {
+    point_cells.AssertDtype(core::Int32);
+
+    core::Device::DeviceType device_type = point_cells.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SortPointsByCellCPU(point_cells, num_cells, cell_offsets,
+                            sorted_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SortPointsByCellCUDA, point_cells, num_cells, cell_offsets,
+                  sorted_indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ClusterDBSCAN(const core::Tensor& points,
+                   const core::Tensor& sorted_indices,
+                   const core::Tensor& cell_offsets,
+                   const core::Tensor& neighbor_offsets,
+                   const core::Tensor& neighbor_cells,
+                   double eps,
+                   int64_t min_points,
+                   core::Tensor& labels) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    sorted_indices.AssertDtype(core::Int32);
+    cell_offsets.AssertDtype(core::Int32);
+    neighbor_offsets.AssertDtype(core::Int64);
+    neighbor_cells.AssertDtype(core::Int32);
+
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ClusterDBSCANCPU(points, sorted_indices, cell_offsets,
+                         neighbor_offsets, neighbor_cells, eps, min_points,
+                         labels);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ClusterDBSCANCUDA, points, sorted_indices, cell_offsets,
+                  neighbor_offsets, neighbor_cells, eps, min_points, labels);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
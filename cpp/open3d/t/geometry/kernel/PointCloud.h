@@ -57,6 +57,50 @@ void Project(
         float depth_scale,
         float depth_max);
 
+/// Computes the covariance of the neighborhood of each point. \p indices has
+/// shape {N, max_nn}; only the first \p counts[i] entries of row i are used.
+/// Points with fewer than 3 neighbors get an identity covariance.
+void EstimateCovariances(const core::Tensor& points,
+                         const core::Tensor& indices,
+                         const core::Tensor& counts,
+                         core::Tensor& covariances);
+
+/// Computes normals as the eigenvectors of the smallest eigenvalue of the
+/// covariances. If \p has_normals, \p normals holds the previous normals,
+/// which are used to orient the new ones.
+void EstimateNormalsFromCovariances(const core::Tensor& covariances,
+                                    core::Tensor& normals,
+                                    bool has_normals);
+
+/// Sorts the points by the cells they fall into. \p point_cells (Int32,
+/// {N}) holds the cell index in [0, \p num_cells) of each point. Outputs the
+/// point indices (Int32, {N}) grouped by cell in \p sorted_indices, with the
+/// points of cell i at [cell_offsets[i], cell_offsets[i + 1]) of
+/// \p cell_offsets (Int32, {num_cells + 1}).
+void SortPointsByCell(const core::Tensor& point_cells,
+                      int64_t num_cells,
+                      core::Tensor& cell_offsets,
+                      core::Tensor& sorted_indices);
+
+/// DBSCAN clustering of points bucketed into cells of size eps / sqrt(3), so
+/// that all points of a cell are neighbors of each other. \p points ({N, 3})
+/// are sorted by cell as described by \p cell_offsets, and \p sorted_indices
+/// are their original indices (see SortPointsByCell). The cells that may hold
+/// neighbors of cell i, including itself, are listed at
+/// [neighbor_offsets[i], neighbor_offsets[i + 1]) (Int64, {M + 1}) of
+/// \p neighbor_cells (Int32). The cluster labels (Int32, {N}) are written in
+/// the original order of the points and numbered as in
+/// geometry::PointCloud::ClusterDBSCAN: by the smallest index of their core
+/// points, and -1 for noise.
+void ClusterDBSCAN(const core::Tensor& points,
+                   const core::Tensor& sorted_indices,
+                   const core::Tensor& cell_offsets,
+                   const core::Tensor& neighbor_offsets,
+                   const core::Tensor& neighbor_cells,
+                   double eps,
+                   int64_t min_points,
+                   core::Tensor& labels);
+
 void UnprojectCPU(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -79,6 +123,29 @@ void ProjectCPU(
         float depth_scale,
         float depth_max);
 
+void EstimateCovariancesCPU(const core::Tensor& points,
+                            const core::Tensor& indices,
+                            const core::Tensor& counts,
+                            core::Tensor& covariances);
+
+void EstimateNormalsFromCovariancesCPU(const core::Tensor& covariances,
+                                       core::Tensor& normals,
+                                       bool has_normals);
+
+void SortPointsByCellCPU(const core::Tensor& point_cells,
+                         int64_t num_cells,
+                         core::Tensor& cell_offsets,
+                         core::Tensor& sorted_indices);
+
+void ClusterDBSCANCPU(const core::Tensor& points,
+                      const core::Tensor& sorted_indices,
+                      const core::Tensor& cell_offsets,
+                      const core::Tensor& neighbor_offsets,
+                      const core::Tensor& neighbor_cells,
+                      double eps,
+                      int64_t min_points,
+                      core::Tensor& labels);
+
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(
         const core::Tensor& depth,
@@ -101,6 +168,28 @@ void ProjectCUDA(
         const core::Tensor& extrinsics,
         float depth_scale,
         float depth_max);
+
+void EstimateCovariancesCUDA(const core::Tensor& points,
+                             const core::Tensor& indices,
+                             const core::Tensor& counts,
+                             core::Tensor& covariances);
+
+void EstimateNormalsFromCovariancesCUDA(const core::Tensor& covariances,
+                                        core::Tensor& normals,
+                                        bool has_normals);
+void SortPointsByCellCUDA(const core::Tensor& point_cells,
+                          int64_t num_cells,
+                          core::Tensor& cell_offsets,
+                          core::Tensor& sorted_indices);
+
+void ClusterDBSCANCUDA(const core::Tensor& points,
+                       const core::Tensor& sorted_indices,
+                       const core::Tensor& cell_offsets,
+                       const core::Tensor& neighbor_offsets,
+                       const core::Tensor& neighbor_cells,
+                       double eps,
+                       int64_t min_points,
+                       core::Tensor& labels);
 #endif
 
 }  // namespace pointcloud
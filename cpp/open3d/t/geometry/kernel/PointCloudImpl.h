@@ -24,7 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <numeric>
 #include <vector>
 
 #include "open3d/core/CUDAUtils.h"
@@ -144,6 +147,638 @@ void UnprojectCPU
     }
 }
 
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void Cross3(const scalar_t* a,
+                                                   const scalar_t* b,
+                                                   scalar_t* c) {
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE scalar_t Dot3(const scalar_t* a,
+                                                     const scalar_t* b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/// Eigenvector of the symmetric 3x3 matrix \p A (row major) for the
+/// eigenvalue \p eval0 of multiplicity one.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE void ComputeEigenvector0(const scalar_t* A,
+                                            scalar_t eval0,
+                                            scalar_t* evec0) {
+    const scalar_t row0[3] = {A[0] - eval0, A[1], A[2]};
+    const scalar_t row1[3] = {A[1], A[4] - eval0, A[5]};
+    const scalar_t row2[3] = {A[2], A[5], A[8] - eval0};
+    scalar_t r0xr1[3], r0xr2[3], r1xr2[3];
+    Cross3(row0, row1, r0xr1);
+    Cross3(row0, row2, r0xr2);
+    Cross3(row1, row2, r1xr2);
+    const scalar_t d0 = Dot3(r0xr1, r0xr1);
+    const scalar_t d1 = Dot3(r0xr2, r0xr2);
+    const scalar_t d2 = Dot3(r1xr2, r1xr2);
+
+    const scalar_t* r = r0xr1;
+    scalar_t dmax = d0;
+    if (d1 > dmax) {
+        r = r0xr2;
+        dmax = d1;
+    }
+    if (d2 > dmax) {
+        r = r1xr2;
+        dmax = d2;
+    }
+    const scalar_t inv_length = 1 / sqrt(dmax);
+    evec0[0] = r[0] * inv_length;
+    evec0[1] = r[1] * inv_length;
+    evec0[2] = r[2] * inv_length;
+}
+
+/// Eigenvector of the symmetric 3x3 matrix \p A (row major) for the
+/// eigenvalue \p eval1, orthogonal to the eigenvector \p evec0.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE void ComputeEigenvector1(const scalar_t* A,
+                                            const scalar_t* evec0,
+                                            scalar_t eval1,
+                                            scalar_t* evec1) {
+    scalar_t U[3], V[3];
+    if (abs(evec0[0]) > abs(evec0[1])) {
+        const scalar_t inv_length =
+                1 / sqrt(evec0[0] * evec0[0] + evec0[2] * evec0[2]);
+        U[0] = -evec0[2] * inv_length;
+        U[1] = 0;
+        U[2] = evec0[0] * inv_length;
+    } else {
+        const scalar_t inv_length =
+                1 / sqrt(evec0[1] * evec0[1] + evec0[2] * evec0[2]);
+        U[0] = 0;
+        U[1] = evec0[2] * inv_length;
+        U[2] = -evec0[1] * inv_length;
+    }
+    Cross3(evec0, U, V);
+
+    const scalar_t AU[3] = {A[0] * U[0] + A[1] * U[1] + A[2] * U[2],
+                            A[1] * U[0] + A[4] * U[1] + A[5] * U[2],
+                            A[2] * U[0] + A[5] * U[1] + A[8] * U[2]};
+    const scalar_t AV[3] = {A[0] * V[0] + A[1] * V[1] + A[2] * V[2],
+                            A[1] * V[0] + A[4] * V[1] + A[5] * V[2],
+                            A[2] * V[0] + A[5] * V[1] + A[8] * V[2]};
+
+    scalar_t m00 = Dot3(U, AU) - eval1;
+    scalar_t m01 = Dot3(U, AV);
+    scalar_t m11 = Dot3(V, AV) - eval1;
+
+    const scalar_t abs_m00 = abs(m00);
+    const scalar_t abs_m01 = abs(m01);
+    const scalar_t abs_m11 = abs(m11);
+    scalar_t u_coeff = 1, v_coeff = 0;
+    if (abs_m00 >= abs_m11) {
+        if (abs_m00 > 0 || abs_m01 > 0) {
+            if (abs_m00 >= abs_m01) {
+                m01 /= m00;
+                m00 = 1 / sqrt(1 + m01 * m01);
+                m01 *= m00;
+            } else {
+                m00 /= m01;
+                m01 = 1 / sqrt(1 + m00 * m00);
+                m00 *= m01;
+            }
+            u_coeff = m01;
+            v_coeff = -m00;
+        }
+    } else {
+        if (abs_m11 > 0 || abs_m01 > 0) {
+            if (abs_m11 >= abs_m01) {
+                m01 /= m11;
+                m11 = 1 / sqrt(1 + m01 * m01);
+                m01 *= m11;
+            } else {
+                m11 /= m01;
+                m01 = 1 / sqrt(1 + m11 * m11);
+                m11 *= m01;
+            }
+            u_coeff = m11;
+            v_coeff = -m01;
+        }
+    }
+    evec1[0] = u_coeff * U[0] + v_coeff * V[0];
+    evec1[1] = u_coeff * U[1] + v_coeff * V[1];
+    evec1[2] = u_coeff * U[2] + v_coeff * V[2];
+}
+
+/// Eigenvector of the smallest eigenvalue of the symmetric 3x3 matrix
+/// \p covariance (row major). Same algorithm as the legacy FastEigen3x3:
+/// https://www.geometrictools.com/Documentation/RobustEigenSymmetric3x3.pdf
+/// Returns a zero vector for a zero matrix.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE void FastEigen3x3(const scalar_t* covariance,
+                                     scalar_t* normal) {
+    scalar_t max_coeff = covariance[0];
+    for (int i = 1; i < 9; ++i) {
+        max_coeff = max_coeff > covariance[i] ? max_coeff : covariance[i];
+    }
+    if (max_coeff == 0) {
+        normal[0] = normal[1] = normal[2] = 0;
+        return;
+    }
+    scalar_t A[9];
+    for (int i = 0; i < 9; ++i) {
+        A[i] = covariance[i] / max_coeff;
+    }
+
+    const scalar_t norm = A[1] * A[1] + A[2] * A[2] + A[5] * A[5];
+    if (norm == 0) {
+        // A is diagonal.
+        normal[0] = normal[1] = normal[2] = 0;
+        if (A[0] < A[4] && A[0] < A[8]) {
+            normal[0] = 1;
+        } else if (A[4] < A[0] && A[4] < A[8]) {
+            normal[1] = 1;
+        } else {
+            normal[2] = 1;
+        }
+        return;
+    }
+
+    const scalar_t q = (A[0] + A[4] + A[8]) / 3;
+    const scalar_t b00 = A[0] - q;
+    const scalar_t b11 = A[4] - q;
+    const scalar_t b22 = A[8] - q;
+    const scalar_t p =
+            sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2) / 6);
+    const scalar_t c00 = b11 * b22 - A[5] * A[5];
+    const scalar_t c01 = A[1] * b22 - A[5] * A[2];
+    const scalar_t c02 = A[1] * A[5] - b11 * A[2];
+    const scalar_t det = (b00 * c00 - A[1] * c01 + A[2] * c02) / (p * p * p);
+
+    scalar_t half_det = det * static_cast<scalar_t>(0.5);
+    half_det = half_det < -1 ? -1 : (half_det > 1 ? 1 : half_det);
+
+    const scalar_t angle = acos(half_det) / 3;
+    const scalar_t two_thirds_pi = static_cast<scalar_t>(2.09439510239319549);
+    const scalar_t beta2 = cos(angle) * 2;
+    const scalar_t beta0 = cos(angle + two_thirds_pi) * 2;
+    const scalar_t beta1 = -(beta0 + beta2);
+    const scalar_t eval[3] = {q + p * beta0, q + p * beta1, q + p * beta2};
+
+    // Compute the eigenvector of the well-separated eigenvalue first, then
+    // the middle one, and the last one as their cross product.
+    const int first = half_det >= 0 ? 2 : 0;
+    const int last = 2 - first;
+    scalar_t evec_first[3], evec1[3];
+    ComputeEigenvector0(A, eval[first], evec_first);
+    if (eval[first] < eval[1] && eval[first] < eval[last]) {
+        normal[0] = evec_first[0];
+        normal[1] = evec_first[1];
+        normal[2] = evec_first[2];
+        return;
+    }
+    ComputeEigenvector1(A, evec_first, eval[1], evec1);
+    if (eval[1] < eval[0] && eval[1] < eval[2]) {
+        normal[0] = evec1[0];
+        normal[1] = evec1[1];
+        normal[2] = evec1[2];
+        return;
+    }
+    if (first == 2) {
+        Cross3(evec1, evec_first, normal);
+    } else {
+        Cross3(evec_first, evec1, normal);
+    }
+}
+
+#if defined(__CUDACC__)
+void EstimateCovariancesCUDA
+#else
+void EstimateCovariancesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& indices,
+         const core::Tensor& counts,
+         core::Tensor& covariances) {
+    const core::Dtype dtype = points.GetDtype();
+    const int64_t n = points.GetLength();
+    const int64_t max_nn = indices.GetShape(1);
+    covariances = core::Tensor::Empty({n, 3, 3}, dtype, points.GetDevice());
+
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    const int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
+
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t* neighbors = indices_ptr + workload_idx * max_nn;
+            const int64_t count = counts_ptr[workload_idx];
+            scalar_t* covariance = covariances_ptr + 9 * workload_idx;
+            if (count < 3) {
+                for (int i = 0; i < 9; ++i) {
+                    covariance[i] = i % 4 == 0 ? 1 : 0;
+                }
+                return;
+            }
+
+            // Center the neighbors before accumulating the second moments,
+            // so that Float32 covariances stay accurate far from the origin.
+            scalar_t mean[3] = {0, 0, 0};
+            for (int64_t k = 0; k < count; ++k) {
+                const scalar_t* point = points_ptr + 3 * neighbors[k];
+                mean[0] += point[0];
+                mean[1] += point[1];
+                mean[2] += point[2];
+            }
+            const scalar_t inv_count = static_cast<scalar_t>(1) / count;
+            mean[0] *= inv_count;
+            mean[1] *= inv_count;
+            mean[2] *= inv_count;
+
+            scalar_t xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
+            for (int64_t k = 0; k < count; ++k) {
+                const scalar_t* point = points_ptr + 3 * neighbors[k];
+                const scalar_t dx = point[0] - mean[0];
+                const scalar_t dy = point[1] - mean[1];
+                const scalar_t dz = point[2] - mean[2];
+                xx += dx * dx;
+                xy += dx * dy;
+                xz += dx * dz;
+                yy += dy * dy;
+                yz += dy * dz;
+                zz += dz * dz;
+            }
+            covariance[0] = xx * inv_count;
+            covariance[1] = covariance[3] = xy * inv_count;
+            covariance[2] = covariance[6] = xz * inv_count;
+            covariance[4] = yy * inv_count;
+            covariance[5] = covariance[7] = yz * inv_count;
+            covariance[8] = zz * inv_count;
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void EstimateNormalsFromCovariancesCUDA
+#else
+void EstimateNormalsFromCovariancesCPU
+#endif
+        (const core::Tensor& covariances,
+         core::Tensor& normals,
+         bool has_normals) {
+    const core::Dtype dtype = covariances.GetDtype();
+    const int64_t n = covariances.GetLength();
+    if (!has_normals) {
+        normals = core::Tensor::Empty({n, 3}, dtype, covariances.GetDevice());
+    }
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            scalar_t* normal = normals_ptr + 3 * workload_idx;
+            scalar_t estimate[3];
+            FastEigen3x3(covariances_ptr + 9 * workload_idx, estimate);
+            if (estimate[0] == 0 && estimate[1] == 0 && estimate[2] == 0) {
+                // Keep the previous normal, or fall back to +z.
+                if (!has_normals) {
+                    normal[0] = 0;
+                    normal[1] = 0;
+                    normal[2] = 1;
+                }
+                return;
+            }
+            const scalar_t sign =
+                    has_normals && Dot3(estimate, normal) < 0 ? -1 : 1;
+            normal[0] = sign * estimate[0];
+            normal[1] = sign * estimate[1];
+            normal[2] = sign * estimate[2];
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void SortPointsByCellCUDA
+#else
+void SortPointsByCellCPU
+#endif
+        (const core::Tensor& point_cells,
+         int64_t num_cells,
+         core::Tensor& cell_offsets,
+         core::Tensor& sorted_indices) {
+    const core::Device device = point_cells.GetDevice();
+    const int64_t n = point_cells.GetLength();
+    const int* point_cells_ptr = point_cells.GetDataPtr<int>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    core::Tensor cell_counts =
+            core::Tensor::Zeros({num_cells}, core::Int32, device);
+    int* cell_counts_ptr = cell_counts.GetDataPtr<int>();
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#if defined(__CUDACC__)
+        atomicAdd(cell_counts_ptr + point_cells_ptr[workload_idx], 1);
+#else
+#pragma omp atomic
+        cell_counts_ptr[point_cells_ptr[workload_idx]]++;
+#endif
+    });
+
+    // The number of cells is at most the number of points, and the prefix sum
+    // is cheap compared to the clustering.
+    const std::vector<int> counts = cell_counts.ToFlatVector<int>();
+    std::vector<int> offsets(num_cells + 1, 0);
+    std::partial_sum(counts.begin(), counts.end(), offsets.begin() + 1);
+    cell_offsets = core::Tensor(offsets, {num_cells + 1}, core::Int32, device);
+
+    core::Tensor cursors = cell_offsets.Slice(0, 0, num_cells).Clone();
+    int* cursors_ptr = cursors.GetDataPtr<int>();
+    sorted_indices = core::Tensor::Empty({n}, core::Int32, device);
+    int* sorted_indices_ptr = sorted_indices.GetDataPtr<int>();
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int pos;
+#if defined(__CUDACC__)
+        pos = atomicAdd(cursors_ptr + point_cells_ptr[workload_idx], 1);
+#else
+#pragma omp atomic capture
+        pos = cursors_ptr[point_cells_ptr[workload_idx]]++;
+#endif
+        sorted_indices_ptr[pos] = static_cast<int>(workload_idx);
+    });
+}
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t SquaredDistance3(const scalar_t* a,
+                                                    const scalar_t* b) {
+    const scalar_t dx = a[0] - b[0];
+    const scalar_t dy = a[1] - b[1];
+    const scalar_t dz = a[2] - b[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+#if defined(__CUDACC__)
+void ClusterDBSCANCUDA
+#else
+void ClusterDBSCANCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& sorted_indices,
+         const core::Tensor& cell_offsets,
+         const core::Tensor& neighbor_offsets,
+         const core::Tensor& neighbor_cells,
+         double eps,
+         int64_t min_points,
+         core::Tensor& labels) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t num_cells = cell_offsets.GetLength() - 1;
+
+    const int* sorted_indices_ptr = sorted_indices.GetDataPtr<int>();
+    const int* cell_offsets_ptr = cell_offsets.GetDataPtr<int>();
+    const int64_t* neighbor_offsets_ptr =
+            neighbor_offsets.GetDataPtr<int64_t>();
+    const int* neighbor_cells_ptr = neighbor_cells.GetDataPtr<int>();
+
+    // Cell of each sorted point.
+    core::Tensor point_cells = core::Tensor::Empty({n}, core::Int32, device);
+    int* point_cells_ptr = point_cells.GetDataPtr<int>();
+    // Whether each sorted point, and each cell, is a core point or contains
+    // one.
+    core::Tensor is_core = core::Tensor::Empty({n}, core::Bool, device);
+    bool* is_core_ptr = is_core.GetDataPtr<bool>();
+    core::Tensor cell_is_core =
+            core::Tensor::Empty({num_cells}, core::Bool, device);
+    bool* cell_is_core_ptr = cell_is_core.GetDataPtr<bool>();
+    // Whether the core points of two neighboring cells are connected.
+    core::Tensor is_edge = core::Tensor::Empty(
+            {neighbor_cells.GetLength()}, core::Bool, device);
+    bool* is_edge_ptr = is_edge.GetDataPtr<bool>();
+
+    labels = core::Tensor::Empty({n}, core::Int32, device);
+    int* labels_ptr = labels.GetDataPtr<int>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(num_cells, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        for (int k = cell_offsets_ptr[workload_idx];
+             k < cell_offsets_ptr[workload_idx + 1]; ++k) {
+            point_cells_ptr[k] = static_cast<int>(workload_idx);
+        }
+    });
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t eps2 = static_cast<scalar_t>(eps * eps);
+
+        // A point is a core point if it has at least min_points neighbors,
+        // itself included. All points of a cell are neighbors of each other.
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int cell = point_cells_ptr[workload_idx];
+            if (cell_offsets_ptr[cell + 1] - cell_offsets_ptr[cell] >=
+                min_points) {
+                is_core_ptr[workload_idx] = true;
+                return;
+            }
+            const scalar_t* point = points_ptr + 3 * workload_idx;
+            int64_t count = 0;
+            for (int64_t e = neighbor_offsets_ptr[cell];
+                 e < neighbor_offsets_ptr[cell + 1]; ++e) {
+                const int other = neighbor_cells_ptr[e];
+                for (int k = cell_offsets_ptr[other];
+                     k < cell_offsets_ptr[other + 1]; ++k) {
+                    if (SquaredDistance3(point, points_ptr + 3 * k) < eps2 &&
+                        ++count >= min_points) {
+                        is_core_ptr[workload_idx] = true;
+                        return;
+                    }
+                }
+            }
+            is_core_ptr[workload_idx] = false;
+        });
+
+        launcher::ParallelFor(num_cells, [=] OPEN3D_DEVICE(
+                                                 int64_t workload_idx) {
+            bool has_core = false;
+            for (int k = cell_offsets_ptr[workload_idx];
+                 k < cell_offsets_ptr[workload_idx + 1] && !has_core; ++k) {
+                has_core = is_core_ptr[k];
+            }
+            cell_is_core_ptr[workload_idx] = has_core;
+        });
+
+        // Two core cells are connected if any of their core points are
+        // neighbors. The test is symmetric, so both directions agree.
+        launcher::ParallelFor(num_cells, [=] OPEN3D_DEVICE(
+                                                 int64_t workload_idx) {
+            const int cell = static_cast<int>(workload_idx);
+            for (int64_t e = neighbor_offsets_ptr[cell];
+                 e < neighbor_offsets_ptr[cell + 1]; ++e) {
+                const int other = neighbor_cells_ptr[e];
+                bool connected = false;
+                if (other != cell && cell_is_core_ptr[cell] &&
+                    cell_is_core_ptr[other]) {
+                    for (int i = cell_offsets_ptr[cell];
+                         i < cell_offsets_ptr[cell + 1] && !connected; ++i) {
+                        if (!is_core_ptr[i]) continue;
+                        for (int j = cell_offsets_ptr[other];
+                             j < cell_offsets_ptr[other + 1]; ++j) {
+                            if (is_core_ptr[j] &&
+                                SquaredDistance3(points_ptr + 3 * i,
+                                                 points_ptr + 3 * j) < eps2) {
+                                connected = true;
+                                break;
+                            }
+                        }
+                    }
+                }
+                is_edge_ptr[e] = connected;
+            }
+        });
+    });
+
+    // Connected components of the core cells by min-label propagation with
+    // pointer jumping. Each cell converges to the smallest cell index of its
+    // component; -1 for cells without core points.
+    core::Tensor cell_roots =
+            core::Tensor::Empty({num_cells}, core::Int32, device);
+    int* cell_roots_ptr = cell_roots.GetDataPtr<int>();
+    launcher::ParallelFor(num_cells, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        cell_roots_ptr[workload_idx] = cell_is_core_ptr[workload_idx]
+                                               ? static_cast<int>(workload_idx)
+                                               : -1;
+    });
+    core::Tensor next_cell_roots = cell_roots.Clone();
+    while (true) {
+        const int* roots_ptr = cell_roots.GetDataPtr<int>();
+        int* next_roots_ptr = next_cell_roots.GetDataPtr<int>();
+        launcher::ParallelFor(num_cells, [=] OPEN3D_DEVICE(
+                                                 int64_t workload_idx) {
+            int root = roots_ptr[workload_idx];
+            if (root < 0) {
+                next_roots_ptr[workload_idx] = -1;
+                return;
+            }
+            for (int64_t e = neighbor_offsets_ptr[workload_idx];
+                 e < neighbor_offsets_ptr[workload_idx + 1]; ++e) {
+                if (is_edge_ptr[e]) {
+                    const int other_root = roots_ptr[neighbor_cells_ptr[e]];
+                    root = other_root < root ? other_root : root;
+                }
+            }
+            next_roots_ptr[workload_idx] = roots_ptr[root];
+        });
+        std::swap(cell_roots, next_cell_roots);
+        if (!cell_roots.Ne(next_cell_roots).Any()) {
+            break;
+        }
+    }
+
+    // Clusters are numbered by the smallest index of their core points, as in
+    // the legacy implementation. The number of cells is small enough to do
+    // this on the host.
+    core::Tensor cell_min_indices =
+            core::Tensor::Empty({num_cells}, core::Int32, device);
+    int* cell_min_indices_ptr = cell_min_indices.GetDataPtr<int>();
+    launcher::ParallelFor(num_cells, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int min_index = -1;
+        for (int k = cell_offsets_ptr[workload_idx];
+             k < cell_offsets_ptr[workload_idx + 1]; ++k) {
+            if (is_core_ptr[k] &&
+                (min_index < 0 || sorted_indices_ptr[k] < min_index)) {
+                min_index = sorted_indices_ptr[k];
+            }
+        }
+        cell_min_indices_ptr[workload_idx] = min_index;
+    });
+    const std::vector<int> roots = cell_roots.ToFlatVector<int>();
+    const std::vector<int> min_indices = cell_min_indices.ToFlatVector<int>();
+    std::vector<int> root_min_indices(num_cells, -1);
+    for (int64_t c = 0; c < num_cells; ++c) {
+        if (roots[c] < 0) continue;
+        int& root_min_index = root_min_indices[roots[c]];
+        if (root_min_index < 0 || min_indices[c] < root_min_index) {
+            root_min_index = min_indices[c];
+        }
+    }
+    std::vector<std::pair<int, int>> clusters;
+    for (int64_t c = 0; c < num_cells; ++c) {
+        if (roots[c] == c) {
+            clusters.emplace_back(root_min_indices[c], static_cast<int>(c));
+        }
+    }
+    std::sort(clusters.begin(), clusters.end());
+    std::vector<int> root_labels(num_cells, -1);
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        root_labels[clusters[i].second] = static_cast<int>(i);
+    }
+    std::vector<int> cell_labels(num_cells, -1);
+    for (int64_t c = 0; c < num_cells; ++c) {
+        if (roots[c] >= 0) {
+            cell_labels[c] = root_labels[roots[c]];
+        }
+    }
+    const core::Tensor cell_labels_t =
+            core::Tensor(cell_labels, {num_cells}, core::Int32, device);
+    const int* cell_labels_ptr = cell_labels_t.GetDataPtr<int>();
+
+    // Core points take the label of their cell. A border point takes the
+    // smallest label of the core points it neighbors, as it is reached first
+    // by that cluster in the legacy implementation.
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t eps2 = static_cast<scalar_t>(eps * eps);
+
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int cell = point_cells_ptr[workload_idx];
+            int label = -1;
+            if (is_core_ptr[workload_idx]) {
+                label = cell_labels_ptr[cell];
+            } else {
+                const scalar_t* point = points_ptr + 3 * workload_idx;
+                for (int64_t e = neighbor_offsets_ptr[cell];
+                     e < neighbor_offsets_ptr[cell + 1]; ++e) {
+                    const int other = neighbor_cells_ptr[e];
+                    const int other_label = cell_labels_ptr[other];
+                    if (other_label < 0 ||
+                        (label >= 0 && other_label >= label)) {
+                        continue;
+                    }
+                    for (int k = cell_offsets_ptr[other];
+                         k < cell_offsets_ptr[other + 1]; ++k) {
+                        if (is_core_ptr[k] &&
+                            SquaredDistance3(point, points_ptr + 3 * k) <
+                                    eps2) {
+                            label = other_label;
+                            break;
+                        }
+                    }
+                }
+            }
+            labels_ptr[sorted_indices_ptr[workload_idx]] = label;
+        });
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -39,21 +39,33 @@ namespace geometry {
 namespace kernel {
 namespace tsdf {
 void Touch(std::shared_ptr<core::Hashmap>& hashmap,
-           const core::Tensor& points,
+           const core::Tensor& depth,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           core::Tensor& block_coords_buffer,
            core::Tensor& voxel_block_coords,
-           int64_t voxel_grid_resolution,
+           int64_t block_resolution,
            float voxel_size,
-           float sdf_trunc) {
-    core::Device device = points.GetDevice();
+           float sdf_trunc,
+           float depth_scale,
+           float depth_max,
+           int64_t stride) {
+    core::Device device = depth.GetDevice();
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor extrinsics_d = extrinsics.To(host, core::Float64).Contiguous();
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        TouchCPU(hashmap, points, voxel_block_coords, voxel_grid_resolution,
-                 voxel_size, sdf_trunc);
+        TouchCPU(hashmap, depth, intrinsics_d, extrinsics_d,
+                 block_coords_buffer, voxel_block_coords, block_resolution,
+                 voxel_size, sdf_trunc, depth_scale, depth_max, stride);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        TouchCUDA(hashmap, points, voxel_block_coords, voxel_grid_resolution,
-                  voxel_size, sdf_trunc);
+        TouchCUDA(hashmap, depth, intrinsics_d, extrinsics_d,
+                  block_coords_buffer, voxel_block_coords, block_resolution,
+                  voxel_size, sdf_trunc, depth_scale, depth_max, stride);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -38,11 +38,17 @@ namespace kernel {
 namespace tsdf {
 
 void Touch(std::shared_ptr<core::Hashmap>& hashmap,
-           const core::Tensor& points,
+           const core::Tensor& depth,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           core::Tensor& block_coords_buffer,
            core::Tensor& voxel_block_coords,
-           int64_t voxel_grid_resolution,
+           int64_t block_resolution,
            float voxel_size,
-           float sdf_trunc);
+           float sdf_trunc,
+           float depth_scale,
+           float depth_max,
+           int64_t stride);
 
 void Integrate(const core::Tensor& depth,
                const core::Tensor& color,
@@ -119,11 +125,17 @@ void ExtractSurfaceMesh(
         int& vertex_count);
 
 void TouchCPU(std::shared_ptr<core::Hashmap>& hashmap,
-              const core::Tensor& points,
+              const core::Tensor& depth,
+              const core::Tensor& intrinsics,
+              const core::Tensor& extrinsics,
+              core::Tensor& block_coords_buffer,
               core::Tensor& voxel_block_coords,
-              int64_t voxel_grid_resolution,
+              int64_t block_resolution,
               float voxel_size,
-              float sdf_trunc);
+              float sdf_trunc,
+              float depth_scale,
+              float depth_max,
+              int64_t stride);
 
 void IntegrateCPU(const core::Tensor& depth,
                   const core::Tensor& color,
@@ -201,11 +213,17 @@ void ExtractSurfaceMeshCPU(
 
 #ifdef BUILD_CUDA_MODULE
 void TouchCUDA(std::shared_ptr<core::Hashmap>& hashmap,
-               const core::Tensor& points,
+               const core::Tensor& depth,
+               const core::Tensor& intrinsics,
+               const core::Tensor& extrinsics,
+               core::Tensor& block_coords_buffer,
                core::Tensor& voxel_block_coords,
-               int64_t voxel_grid_resolution,
+               int64_t block_resolution,
                float voxel_size,
-               float sdf_trunc);
+               float sdf_trunc,
+               float depth_scale,
+               float depth_max,
+               int64_t stride);
 
 void IntegrateCUDA(const core::Tensor& depth,
                    const core::Tensor& color,
@@ -39,82 +39,3 @@
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGridImpl.h"
 #include "open3d/utility/Logging.h"
-
-namespace open3d {
-namespace t {
-namespace geometry {
-namespace kernel {
-namespace tsdf {
-struct Coord3i {
-    OPEN3D_HOST_DEVICE Coord3i(int x, int y, int z) : x_(x), y_(y), z_(z) {}
-    OPEN3D_HOST_DEVICE bool operator==(const Coord3i& other) const {
-        return x_ == other.x_ && y_ == other.y_ && z_ == other.z_;
-    }
-
-    int64_t x_;
-    int64_t y_;
-    int64_t z_;
-};
-
-void TouchCUDA(std::shared_ptr<core::Hashmap>& hashmap,
-               const core::Tensor& points,
-               core::Tensor& voxel_block_coords,
-               int64_t voxel_grid_resolution,
-               float voxel_size,
-               float sdf_trunc) {
-    int64_t resolution = voxel_grid_resolution;
-    float block_size = voxel_size * resolution;
-
-    int64_t n = points.GetLength();
-    const float* pcd_ptr = static_cast<const float*>(points.GetDataPtr());
-
-    core::Device device = points.GetDevice();
-    core::Tensor block_coordi({8 * n, 3}, core::Int32, device);
-    int* block_coordi_ptr = static_cast<int*>(block_coordi.GetDataPtr());
-    core::Tensor count(std::vector<int>{0}, {}, core::Int32, device);
-    int* count_ptr = static_cast<int*>(count.GetDataPtr());
-
-    core::kernel::cuda_launcher::ParallelFor(n, [=] OPEN3D_DEVICE(
-                                                        int64_t workload_idx) {
-        float x = pcd_ptr[3 * workload_idx + 0];
-        float y = pcd_ptr[3 * workload_idx + 1];
-        float z = pcd_ptr[3 * workload_idx + 2];
-
-        int xb_lo = static_cast<int>(floorf((x - sdf_trunc) / block_size));
-        int xb_hi = static_cast<int>(floorf((x + sdf_trunc) / block_size));
-        int yb_lo = static_cast<int>(floorf((y - sdf_trunc) / block_size));
-        int yb_hi = static_cast<int>(floorf((y + sdf_trunc) / block_size));
-        int zb_lo = static_cast<int>(floorf((z - sdf_trunc) / block_size));
-        int zb_hi = static_cast<int>(floorf((z + sdf_trunc) / block_size));
-
-        for (int xb = xb_lo; xb <= xb_hi; ++xb) {
-            for (int yb = yb_lo; yb <= yb_hi; ++yb) {
-                for (int zb = zb_lo; zb <= zb_hi; ++zb) {
-                    int idx = atomicAdd(count_ptr, 1);
-                    block_coordi_ptr[3 * idx + 0] = xb;
-                    block_coordi_ptr[3 * idx + 1] = yb;
-                    block_coordi_ptr[3 * idx + 2] = zb;
-                }
-            }
-        }
-    });
-
-    int total_block_count = count.Item<int>();
-    if (total_block_count == 0) {
-        utility::LogError(
-                "[CUDATSDFTouchKernel] No block is touched in TSDF volume, "
-                "abort integration. Please check specified parameters, "
-                "especially depth_scale and voxel_size");
-    }
-    block_coordi = block_coordi.Slice(0, 0, total_block_count);
-    core::Tensor block_addrs, block_masks;
-    hashmap->Activate(block_coordi.Slice(0, 0, count.Item<int>()), block_addrs,
-                      block_masks);
-    voxel_block_coords = block_coordi.IndexGet({block_masks});
-}
-
-}  // namespace tsdf
-}  // namespace kernel
-}  // namespace geometry
-}  // namespace t
-}  // namespace open3d
@@ -46,6 +46,144 @@ namespace geometry {
 namespace kernel {
 namespace tsdf {
 
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE bool InBlockRange(
+        const int* lo, const int* hi, int xb, int yb, int zb) {
+    return xb >= lo[0] && xb <= hi[0] && yb >= lo[1] && yb <= hi[1] &&
+           zb >= lo[2] && zb <= hi[2];
+}
+
+#if defined(__CUDACC__)
+void TouchCUDA
+#else
+void TouchCPU
+#endif
+        (std::shared_ptr<core::Hashmap>& hashmap,
+         const core::Tensor& depth,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         core::Tensor& block_coords_buffer,
+         core::Tensor& voxel_block_coords,
+         int64_t block_resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_max,
+         int64_t stride) {
+    core::Device device = depth.GetDevice();
+    float block_size = voxel_size * block_resolution;
+
+    NDArrayIndexer depth_indexer(depth, 2);
+    core::Tensor pose = t::geometry::InverseTransformation(extrinsics);
+    TransformIndexer transform_indexer(intrinsics, pose, 1.0f);
+
+    int64_t rows_strided = depth_indexer.GetShape(0) / stride;
+    int64_t cols_strided = depth_indexer.GetShape(1) / stride;
+    int64_t n = rows_strided * cols_strided;
+
+    // The buffer holds the block range [lo, hi] of each pixel in its first
+    // 2n rows, followed by the candidate block coordinates. sdf_trunc is less
+    // than half a block, so a pixel touches at most 2^3 blocks. The buffer is
+    // reused across frames of the same size.
+    if (block_coords_buffer.GetLength() < 10 * n ||
+        block_coords_buffer.GetDevice() != device) {
+        block_coords_buffer = core::Tensor({10 * n, 3}, core::Int32, device);
+    }
+    int* range_ptr = block_coords_buffer.GetDataPtr<int>();
+    int* block_coords_ptr = range_ptr + 6 * n;
+
+#if defined(__CUDACC__)
+    core::Tensor count(std::vector<int>{0}, {}, core::Int32, device);
+    int* count_ptr = count.GetDataPtr<int>();
+#else
+    std::atomic<int> count_atomic(0);
+    std::atomic<int>* count_ptr = &count_atomic;
+#endif
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    // Block range of each pixel within sdf_trunc of its surface point. Pixels
+    // with invalid depth get an empty range.
+    DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int64_t y = (workload_idx / cols_strided) * stride;
+            int64_t x = (workload_idx % cols_strided) * stride;
+            int* lo = range_ptr + 6 * workload_idx;
+            int* hi = lo + 3;
+
+            float d = *depth_indexer.GetDataPtr<scalar_t>(x, y) / depth_scale;
+            if (!(d > 0 && d < depth_max)) {
+                lo[0] = 1;
+                hi[0] = 0;
+                return;
+            }
+
+            float xc, yc, zc, p[3];
+            transform_indexer.Unproject(static_cast<float>(x),
+                                        static_cast<float>(y), d, &xc, &yc,
+                                        &zc);
+            transform_indexer.RigidTransform(xc, yc, zc, &p[0], &p[1], &p[2]);
+            for (int i = 0; i < 3; ++i) {
+                lo[i] = static_cast<int>(
+                        floorf((p[i] - sdf_trunc) / block_size));
+                hi[i] = static_cast<int>(
+                        floorf((p[i] + sdf_trunc) / block_size));
+            }
+        });
+    });
+
+    // Blocks also touched by the left or the upper pixel are left to that
+    // pixel, which emits them unless its own left or upper pixel does.
+    // Neighboring pixels on a surface mostly touch the same blocks, so this
+    // removes most of the duplicates before they reach the hashmap.
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const int* lo = range_ptr + 6 * workload_idx;
+        const int* hi = lo + 3;
+        const int* lo_left = workload_idx % cols_strided > 0 ? lo - 6 : nullptr;
+        const int* lo_up =
+                workload_idx >= cols_strided ? lo - 6 * cols_strided : nullptr;
+
+        for (int xb = lo[0]; xb <= hi[0]; ++xb) {
+            for (int yb = lo[1]; yb <= hi[1]; ++yb) {
+                for (int zb = lo[2]; zb <= hi[2]; ++zb) {
+                    if ((lo_left != nullptr &&
+                         InBlockRange(lo_left, lo_left + 3, xb, yb, zb)) ||
+                        (lo_up != nullptr &&
+                         InBlockRange(lo_up, lo_up + 3, xb, yb, zb))) {
+                        continue;
+                    }
+                    int idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+                    block_coords_ptr[3 * idx + 0] = xb;
+                    block_coords_ptr[3 * idx + 1] = yb;
+                    block_coords_ptr[3 * idx + 2] = zb;
+                }
+            }
+        }
+    });
+
+#if defined(__CUDACC__)
+    int total_block_count = count.Item<int>();
+#else
+    int total_block_count = (*count_ptr).load();
+#endif
+    if (total_block_count == 0) {
+        utility::LogError(
+                "No block is touched in TSDF volume, abort integration. Please "
+                "check specified parameters, especially depth_scale and "
+                "voxel_size");
+    }
+
+    // The hashmap removes the remaining duplicates.
+    core::Tensor block_coords =
+            block_coords_buffer.Slice(0, 2 * n, 2 * n + total_block_count);
+    core::Tensor block_addrs, block_masks;
+    hashmap->Activate(block_coords, block_addrs, block_masks);
+    voxel_block_coords = block_coords.IndexGet({block_masks});
+}
+
 #if defined(__CUDACC__)
 void IntegrateCUDA
 #else
@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+void ComputeTriangleNormals(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            core::Tensor& normals) {
+    core::Device device = vertices.GetDevice();
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    triangles.AssertDevice(device);
+    triangles.AssertDtype(core::Int64);
+    triangles.AssertShapeCompatible({utility::nullopt, 3});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleNormalsCPU(vertices.Contiguous(), triangles.Contiguous(),
+                                  normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeTriangleNormalsCUDA, vertices.Contiguous(),
+                  triangles.Contiguous(), normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeVertexNormals(const core::Tensor& triangles,
+                          const core::Tensor& triangle_normals,
+                          core::Tensor& vertex_normals) {
+    core::Device device = triangles.GetDevice();
+    triangles.AssertDtype(core::Int64);
+    triangle_normals.AssertDevice(device);
+    triangle_normals.AssertShape({triangles.GetLength(), 3});
+    vertex_normals.AssertDevice(device);
+    vertex_normals.AssertDtype(triangle_normals.GetDtype());
+    vertex_normals.AssertShapeCompatible({utility::nullopt, 3});
+    if (!vertex_normals.IsContiguous()) {
+        utility::LogError("vertex_normals is not contiguous.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexNormalsCPU(triangles.Contiguous(),
+                                triangle_normals.Contiguous(), vertex_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVertexNormalsCUDA, triangles.Contiguous(),
+                  triangle_normals.Contiguous(), vertex_normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void NormalizeNormals(core::Tensor& normals) {
+    normals.AssertShapeCompatible({utility::nullopt, 3});
+    if (!normals.IsContiguous()) {
+        utility::LogError("normals is not contiguous.");
+    }
+
+    core::Device::DeviceType device_type = normals.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        NormalizeNormalsCPU(normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(NormalizeNormalsCUDA, normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeTriangleAreas(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          core::Tensor& areas) {
+    core::Device device = vertices.GetDevice();
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    triangles.AssertDevice(device);
+    triangles.AssertDtype(core::Int64);
+    triangles.AssertShapeCompatible({utility::nullopt, 3});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleAreasCPU(vertices.Contiguous(), triangles.Contiguous(),
+                                areas);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeTriangleAreasCUDA, vertices.Contiguous(),
+                  triangles.Contiguous(), areas);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeFirstIndices(const core::Tensor& groups,
+                         int64_t num_groups,
+                         core::Tensor& first_indices) {
+    groups.AssertDtype(core::Int64);
+    groups.AssertShape({groups.GetLength()});
+
+    core::Device::DeviceType device_type = groups.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeFirstIndicesCPU(groups.Contiguous(), num_groups, first_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeFirstIndicesCUDA, groups.Contiguous(), num_groups,
+                  first_indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeMergeTargets(const core::Tensor& neighbor_indices,
+                         const core::Tensor& neighbor_splits,
+                         core::Tensor& merge_targets) {
+    core::Device device = neighbor_indices.GetDevice();
+    neighbor_indices.AssertDtype(core::Int64);
+    neighbor_splits.AssertDevice(device);
+    neighbor_splits.AssertDtype(core::Int64);
+    if (neighbor_splits.GetLength() == 0) {
+        utility::LogError("neighbor_splits must not be empty.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeMergeTargetsCPU(neighbor_indices.Contiguous(),
+                               neighbor_splits.Contiguous(), merge_targets);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeMergeTargetsCUDA, neighbor_indices.Contiguous(),
+                  neighbor_splits.Contiguous(), merge_targets);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void AverageByGroup(const core::Tensor& values,
+                    const core::Tensor& groups,
+                    int64_t num_groups,
+                    core::Tensor& averages) {
+    core::Device device = values.GetDevice();
+    values.AssertDtype(core::Float64);
+    groups.AssertDevice(device);
+    groups.AssertDtype(core::Int64);
+    groups.AssertShape({values.GetLength()});
+    if (values.NumDims() != 2) {
+        utility::LogError("values must have shape {N, C}, but got {}.",
+                          values.GetShape().ToString());
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AverageByGroupCPU(values.Contiguous(), groups.Contiguous(), num_groups,
+                          averages);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(AverageByGroupCUDA, values.Contiguous(), groups.Contiguous(),
+                  num_groups, averages);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Computes the normals (same dtype as \p vertices, {M, 3}) of the
+/// \p triangles (Int64, {M, 3}). The normals are not normalized, their length
+/// is twice the area of the triangle.
+void ComputeTriangleNormals(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            core::Tensor& normals);
+
+/// Adds the normals of the triangles to the normals of their vertices.
+/// \p vertex_normals has shape {N, 3} and the dtype of \p triangle_normals.
+void ComputeVertexNormals(const core::Tensor& triangles,
+                          const core::Tensor& triangle_normals,
+                          core::Tensor& vertex_normals);
+
+/// Normalizes \p normals ({N, 3}) in place. As in the legacy TriangleMesh,
+/// zero normals stay zero and NaN normals are set to (0, 0, 1).
+void NormalizeNormals(core::Tensor& normals);
+
+/// Computes the areas (same dtype as \p vertices, {M}) of the \p triangles
+/// (Int64, {M, 3}).
+void ComputeTriangleAreas(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          core::Tensor& areas);
+
+/// Computes the smallest index (Int64, {num_groups}) of the elements of each
+/// group, where \p groups (Int64, {N}) holds the group in [0, num_groups) of
+/// every element. Groups without elements get index N.
+void ComputeFirstIndices(const core::Tensor& groups,
+                         int64_t num_groups,
+                         core::Tensor& first_indices);
+
+/// Selects the vertices that other vertices are merged into. The vertices are
+/// visited in a fixed pseudo-random order given by a hash of their index, and
+/// every vertex not merged yet absorbs its unmerged neighbors. Since the order
+/// is not the index order of the legacy TriangleMesh::MergeCloseVertices, the
+/// groups can differ from the legacy ones. The neighbors of vertex i are
+/// neighbor_indices[neighbor_splits[i] : neighbor_splits[i + 1]] (both
+/// Int64). Outputs for every vertex the index (Int64, {N}) of the vertex it is
+/// merged into, which is the vertex itself for the vertices that are kept.
+void ComputeMergeTargets(const core::Tensor& neighbor_indices,
+                         const core::Tensor& neighbor_splits,
+                         core::Tensor& merge_targets);
+
+/// Averages the rows of \p values (Float64, {N, C}) by group, where
+/// \p groups (Int64, {N}) holds the group in [0, num_groups) of every row.
+/// Outputs \p averages (Float64, {num_groups, C}).
+void AverageByGroup(const core::Tensor& values,
+                    const core::Tensor& groups,
+                    int64_t num_groups,
+                    core::Tensor& averages);
+
+void ComputeTriangleNormalsCPU(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               core::Tensor& normals);
+
+void ComputeVertexNormalsCPU(const core::Tensor& triangles,
+                             const core::Tensor& triangle_normals,
+                             core::Tensor& vertex_normals);
+
+void NormalizeNormalsCPU(core::Tensor& normals);
+
+void ComputeTriangleAreasCPU(const core::Tensor& vertices,
+                             const core::Tensor& triangles,
+                             core::Tensor& areas);
+
+void ComputeFirstIndicesCPU(const core::Tensor& groups,
+                            int64_t num_groups,
+                            core::Tensor& first_indices);
+
+void ComputeMergeTargetsCPU(const core::Tensor& neighbor_indices,
+                            const core::Tensor& neighbor_splits,
+                            core::Tensor& merge_targets);
+
+void AverageByGroupCPU(const core::Tensor& values,
+                       const core::Tensor& groups,
+                       int64_t num_groups,
+                       core::Tensor& averages);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeTriangleNormalsCUDA(const core::Tensor& vertices,
+                                const core::Tensor& triangles,
+                                core::Tensor& normals);
+
+void ComputeVertexNormalsCUDA(const core::Tensor& triangles,
+                              const core::Tensor& triangle_normals,
+                              core::Tensor& vertex_normals);
+
+void NormalizeNormalsCUDA(core::Tensor& normals);
+
+void ComputeTriangleAreasCUDA(const core::Tensor& vertices,
+                              const core::Tensor& triangles,
+                              core::Tensor& areas);
+
+void ComputeFirstIndicesCUDA(const core::Tensor& groups,
+                             int64_t num_groups,
+                             core::Tensor& first_indices);
+
+void ComputeMergeTargetsCUDA(const core::Tensor& neighbor_indices,
+                             const core::Tensor& neighbor_splits,
+                             core::Tensor& merge_targets);
+
+void AverageByGroupCUDA(const core::Tensor& values,
+                        const core::Tensor& groups,
+                        int64_t num_groups,
+                        core::Tensor& averages);
+#endif
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,383 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Position of a vertex in the order in which the vertices are merged. The
+/// mixing function of SplitMix64 is a bijection, so no two vertices share a
+/// position, and it shuffles chains of close vertices with consecutive indices.
+OPEN3D_HOST_DEVICE inline uint64_t MergeOrder(int64_t idx) {
+    uint64_t z = static_cast<uint64_t>(idx) + UINT64_C(0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+    return z ^ (z >> 31);
+}
+
+/// Adds \p value to \p *ptr atomically. Preprocessor directives cannot be
+/// used inside the lambdas passed to the dispatch macros, hence the helper.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AtomicAdd(scalar_t* ptr, scalar_t value) {
+#if defined(__CUDACC__)
+    atomicAdd(ptr, value);
+#else
+#pragma omp atomic
+    *ptr += value;
+#endif
+}
+
+#if defined(__CUDACC__)
+void ComputeTriangleNormalsCUDA
+#else
+void ComputeTriangleNormalsCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         core::Tensor& normals) {
+    const int64_t n = triangles.GetLength();
+    normals = core::Tensor::Empty({n, 3}, vertices.GetDtype(),
+                                  vertices.GetDevice());
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t* tri_ptr = triangles_ptr + 3 * workload_idx;
+            const scalar_t* v0 = vertices_ptr + 3 * tri_ptr[0];
+            const scalar_t* v1 = vertices_ptr + 3 * tri_ptr[1];
+            const scalar_t* v2 = vertices_ptr + 3 * tri_ptr[2];
+            scalar_t v01[3], v02[3];
+            for (int i = 0; i < 3; ++i) {
+                v01[i] = v1[i] - v0[i];
+                v02[i] = v2[i] - v0[i];
+            }
+            scalar_t* normal_ptr = normals_ptr + 3 * workload_idx;
+            normal_ptr[0] = v01[1] * v02[2] - v01[2] * v02[1];
+            normal_ptr[1] = v01[2] * v02[0] - v01[0] * v02[2];
+            normal_ptr[2] = v01[0] * v02[1] - v01[1] * v02[0];
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexNormalsCUDA
+#else
+void ComputeVertexNormalsCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& triangle_normals,
+         core::Tensor& vertex_normals) {
+    const int64_t n = triangles.GetLength();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(triangle_normals.GetDtype(), [&]() {
+        const scalar_t* triangle_normals_ptr =
+                triangle_normals.GetDataPtr<scalar_t>();
+        scalar_t* vertex_normals_ptr = vertex_normals.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(3 * n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const scalar_t* normal_ptr =
+                    triangle_normals_ptr + 3 * (workload_idx / 3);
+            scalar_t* sum_ptr =
+                    vertex_normals_ptr + 3 * triangles_ptr[workload_idx];
+            for (int i = 0; i < 3; ++i) {
+                AtomicAdd(sum_ptr + i, normal_ptr[i]);
+            }
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void NormalizeNormalsCUDA
+#else
+void NormalizeNormalsCPU
+#endif
+        (core::Tensor& normals) {
+    const int64_t n = normals.GetLength();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(normals.GetDtype(), [&]() {
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            scalar_t* normal_ptr = normals_ptr + 3 * workload_idx;
+            const scalar_t norm = sqrt(normal_ptr[0] * normal_ptr[0] +
+                                       normal_ptr[1] * normal_ptr[1] +
+                                       normal_ptr[2] * normal_ptr[2]);
+            // Same as Eigen's normalize() followed by the NaN check of the
+            // legacy TriangleMesh.
+            if (norm > 0) {
+                normal_ptr[0] /= norm;
+                normal_ptr[1] /= norm;
+                normal_ptr[2] /= norm;
+            }
+            if (normal_ptr[0] != normal_ptr[0]) {
+                normal_ptr[0] = 0;
+                normal_ptr[1] = 0;
+                normal_ptr[2] = 1;
+            }
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeTriangleAreasCUDA
+#else
+void ComputeTriangleAreasCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         core::Tensor& areas) {
+    core::Tensor normals;
+#if defined(__CUDACC__)
+    ComputeTriangleNormalsCUDA(vertices, triangles, normals);
+#else
+    ComputeTriangleNormalsCPU(vertices, triangles, normals);
+#endif
+    const int64_t n = triangles.GetLength();
+    areas = core::Tensor::Empty({n}, vertices.GetDtype(), vertices.GetDevice());
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        scalar_t* areas_ptr = areas.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const scalar_t* normal_ptr = normals_ptr + 3 * workload_idx;
+            areas_ptr[workload_idx] =
+                    0.5 * sqrt(normal_ptr[0] * normal_ptr[0] +
+                               normal_ptr[1] * normal_ptr[1] +
+                               normal_ptr[2] * normal_ptr[2]);
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeFirstIndicesCUDA
+#else
+void ComputeFirstIndicesCPU
+#endif
+        (const core::Tensor& groups,
+         int64_t num_groups,
+         core::Tensor& first_indices) {
+    const int64_t n = groups.GetLength();
+    const int64_t* groups_ptr = groups.GetDataPtr<int64_t>();
+    first_indices = core::Tensor::Full({num_groups}, n, core::Int64,
+                                       groups.GetDevice());
+    int64_t* first_ptr = first_indices.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        unsigned long long* first = reinterpret_cast<unsigned long long*>(
+                first_ptr + groups_ptr[workload_idx]);
+        atomicMin(first, static_cast<unsigned long long>(workload_idx));
+    });
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    std::vector<std::atomic<int64_t>> first_atomic(num_groups);
+    std::atomic<int64_t>* first_atomic_ptr = first_atomic.data();
+    launcher::ParallelFor(num_groups, [=](int64_t workload_idx) {
+        first_atomic_ptr[workload_idx].store(n, std::memory_order_relaxed);
+    });
+    launcher::ParallelFor(n, [=](int64_t workload_idx) {
+        std::atomic<int64_t>& first =
+                first_atomic_ptr[groups_ptr[workload_idx]];
+        int64_t current = first.load(std::memory_order_relaxed);
+        while (workload_idx < current &&
+               !first.compare_exchange_weak(current, workload_idx,
+                                            std::memory_order_relaxed)) {
+        }
+    });
+    launcher::ParallelFor(num_groups, [=](int64_t workload_idx) {
+        first_ptr[workload_idx] =
+                first_atomic_ptr[workload_idx].load(std::memory_order_relaxed);
+    });
+#endif
+}
+
+#if defined(__CUDACC__)
+void ComputeMergeTargetsCUDA
+#else
+void ComputeMergeTargetsCPU
+#endif
+        (const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_splits,
+         core::Tensor& merge_targets) {
+    const int64_t n = neighbor_splits.GetLength() - 1;
+    core::Device device = neighbor_indices.GetDevice();
+    const int64_t* indices_ptr = neighbor_indices.GetDataPtr<int64_t>();
+    const int64_t* splits_ptr = neighbor_splits.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    // State of every vertex: 0 while undecided, 1 if it is kept, 2 if it is
+    // merged into a kept vertex. A vertex is decided as soon as all of its
+    // neighbors that come before it in the merge order are decided.
+    core::Tensor states = core::Tensor::Zeros({n}, core::Int8, device);
+    core::Tensor next_states = core::Tensor::Empty({n}, core::Int8, device);
+    bool has_undecided = n > 0;
+    while (has_undecided) {
+        const int8_t* states_ptr = states.GetDataPtr<int8_t>();
+        int8_t* next_ptr = next_states.GetDataPtr<int8_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int8_t state = states_ptr[workload_idx];
+            if (state == 0) {
+                const uint64_t order = MergeOrder(workload_idx);
+                state = 1;
+                for (int64_t k = splits_ptr[workload_idx];
+                     k < splits_ptr[workload_idx + 1]; ++k) {
+                    const int64_t nb = indices_ptr[k];
+                    if (MergeOrder(nb) >= order) {
+                        continue;
+                    }
+                    if (states_ptr[nb] == 1) {
+                        state = 2;
+                        break;
+                    }
+                    if (states_ptr[nb] == 0) {
+                        state = 0;
+                    }
+                }
+            }
+            next_ptr[workload_idx] = state;
+        });
+        std::swap(states, next_states);
+        has_undecided = states.Eq(0).Any();
+    }
+
+    // Merge every vertex into the first kept vertex among its neighbors.
+    merge_targets = core::Tensor::Empty({n}, core::Int64, device);
+    const int8_t* states_ptr = states.GetDataPtr<int8_t>();
+    int64_t* targets_ptr = merge_targets.GetDataPtr<int64_t>();
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t target = workload_idx;
+        if (states_ptr[workload_idx] == 2) {
+            uint64_t target_order = MergeOrder(workload_idx);
+            for (int64_t k = splits_ptr[workload_idx];
+                 k < splits_ptr[workload_idx + 1]; ++k) {
+                const int64_t nb = indices_ptr[k];
+                const uint64_t order = MergeOrder(nb);
+                if (states_ptr[nb] == 1 && order < target_order) {
+                    target = nb;
+                    target_order = order;
+                }
+            }
+        }
+        targets_ptr[workload_idx] = target;
+    });
+}
+
+#if defined(__CUDACC__)
+void AverageByGroupCUDA
+#else
+void AverageByGroupCPU
+#endif
+        (const core::Tensor& values,
+         const core::Tensor& groups,
+         int64_t num_groups,
+         core::Tensor& averages) {
+    const int64_t n = values.GetLength();
+    const int64_t num_channels = values.GetShape(1);
+    core::Device device = values.GetDevice();
+    const double* values_ptr = values.GetDataPtr<double>();
+    const int64_t* groups_ptr = groups.GetDataPtr<int64_t>();
+
+    averages = core::Tensor::Zeros({num_groups, num_channels}, core::Float64,
+                                   device);
+    core::Tensor counts = core::Tensor::Zeros({num_groups}, core::Float64,
+                                              device);
+    double* averages_ptr = averages.GetDataPtr<double>();
+    double* counts_ptr = counts.GetDataPtr<double>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const int64_t group = groups_ptr[workload_idx];
+        double* sum_ptr = averages_ptr + num_channels * group;
+        const double* value_ptr = values_ptr + num_channels * workload_idx;
+        for (int64_t i = 0; i < num_channels; ++i) {
+            AtomicAdd(sum_ptr + i, value_ptr[i]);
+        }
+        AtomicAdd(counts_ptr + group, 1.0);
+    });
+
+    launcher::ParallelFor(
+            num_groups * num_channels, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const double count = counts_ptr[workload_idx / num_channels];
+                if (count > 0) {
+                    averages_ptr[workload_idx] /= count;
+                }
+            });
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
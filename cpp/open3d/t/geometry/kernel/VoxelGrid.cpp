@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+void AverageColors(const core::Tensor& point_addrs,
+                   const core::Tensor& point_colors,
+                   const core::Tensor& voxel_masks,
+                   core::Tensor& voxel_colors) {
+    core::Device device = point_addrs.GetDevice();
+    const int64_t n = point_addrs.GetLength();
+    point_addrs.AssertDtype(core::Int32);
+    point_colors.AssertDevice(device);
+    point_colors.AssertShape({n, 3});
+    voxel_masks.AssertDevice(device);
+    voxel_masks.AssertDtype(core::Bool);
+    voxel_masks.AssertShape({n});
+    voxel_colors.AssertDevice(device);
+    voxel_colors.AssertDtype(core::Float32);
+    if (!voxel_colors.IsContiguous()) {
+        utility::LogError("voxel_colors is not contiguous.");
+    }
+    const core::Tensor colors_d = point_colors.To(core::Float64).Contiguous();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AverageColorsCPU(point_addrs.Contiguous(), colors_d,
+                         voxel_masks.Contiguous(), voxel_colors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(AverageColorsCUDA, point_addrs.Contiguous(), colors_d,
+                  voxel_masks.Contiguous(), voxel_colors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void VoxelizeTriangles(const core::Tensor& vertices,
+                       const core::Tensor& triangles,
+                       const core::Tensor& origin,
+                       double voxel_size,
+                       core::Tensor& voxel_indices) {
+    core::Device device = vertices.GetDevice();
+    triangles.AssertDevice(device);
+
+    // The triangle-box intersection test runs on the host; meshes on other
+    // devices are voxelized on the CPU and the result is moved back.
+    static const core::Device host("CPU:0");
+    VoxelizeTrianglesCPU(vertices.To(host, core::Float64).Contiguous(),
+                         triangles.To(host, core::Int64).Contiguous(),
+                         origin.To(host, core::Float64).Contiguous(),
+                         voxel_size, voxel_indices);
+    voxel_indices = voxel_indices.To(device);
+}
+
+void Carve(const core::Tensor& voxel_indices,
+           const core::Tensor& image,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           const core::Tensor& origin,
+           double voxel_size,
+           float depth_scale,
+           bool silhouette,
+           bool keep_voxels_outside_image,
+           core::Tensor& carve_mask) {
+    core::Device device = voxel_indices.GetDevice();
+    voxel_indices.AssertDtype(core::Int32);
+    image.AssertDevice(device);
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor extrinsics_d = extrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor origin_d = origin.To(host, core::Float64).Contiguous();
+    intrinsics_d.AssertShape({3, 3});
+    extrinsics_d.AssertShape({4, 4});
+    origin_d.AssertShape({3});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CarveCPU(voxel_indices.Contiguous(), image.Contiguous(), intrinsics_d,
+                 extrinsics_d, origin_d, voxel_size, depth_scale, silhouette,
+                 keep_voxels_outside_image, carve_mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(CarveCUDA, voxel_indices.Contiguous(), image.Contiguous(),
+                  intrinsics_d, extrinsics_d, origin_d, voxel_size,
+                  depth_scale, silhouette, keep_voxels_outside_image,
+                  carve_mask);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+/// Computes the average colors of the voxels. \p point_addrs (Int32, {N})
+/// are the hashmap buffer addresses of the voxels the points fall into and
+/// \p point_colors (Float64, {N, 3}) their colors. \p voxel_masks (Bool, {N})
+/// must be true for exactly one point of every voxel, e.g. the masks returned
+/// by core::Hashmap::Activate. The average color of a voxel is written to row
+/// point_addrs[i] of \p voxel_colors (Float32, {capacity, 3}) for these
+/// points.
+void AverageColors(const core::Tensor& point_addrs,
+                   const core::Tensor& point_colors,
+                   const core::Tensor& voxel_masks,
+                   core::Tensor& voxel_colors);
+
+/// Computes the indices (Int32, {M, 3}) of the voxels intersected by the
+/// triangles. A voxel intersected by several triangles is listed once per
+/// triangle. Only the triangle bounding boxes are scanned, so the cost is
+/// proportional to the surface area of the mesh instead of the volume of its
+/// bounding box.
+void VoxelizeTriangles(const core::Tensor& vertices,
+                       const core::Tensor& triangles,
+                       const core::Tensor& origin,
+                       double voxel_size,
+                       core::Tensor& voxel_indices);
+
+/// Computes the carving mask (Bool, {N}) of the voxels \p voxel_indices
+/// (Int32, {N, 3}). A voxel is carved if none of its 8 corners projects to a
+/// pixel of \p image where the voxel may be occupied: for depth carving, a
+/// pixel with a valid depth not larger than the depth of the corner; for
+/// silhouette carving, a pixel with a value larger than 0. If
+/// \p keep_voxels_outside_image is true, a corner projecting outside of the
+/// image also keeps the voxel. Pixel values are bilinearly interpolated.
+void Carve(const core::Tensor& voxel_indices,
+           const core::Tensor& image,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           const core::Tensor& origin,
+           double voxel_size,
+           float depth_scale,
+           bool silhouette,
+           bool keep_voxels_outside_image,
+           core::Tensor& carve_mask);
+
+void AverageColorsCPU(const core::Tensor& point_addrs,
+                      const core::Tensor& point_colors,
+                      const core::Tensor& voxel_masks,
+                      core::Tensor& voxel_colors);
+
+void VoxelizeTrianglesCPU(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          const core::Tensor& origin,
+                          double voxel_size,
+                          core::Tensor& voxel_indices);
+
+void CarveCPU(const core::Tensor& voxel_indices,
+              const core::Tensor& image,
+              const core::Tensor& intrinsics,
+              const core::Tensor& extrinsics,
+              const core::Tensor& origin,
+              double voxel_size,
+              float depth_scale,
+              bool silhouette,
+              bool keep_voxels_outside_image,
+              core::Tensor& carve_mask);
+
+#ifdef BUILD_CUDA_MODULE
+void AverageColorsCUDA(const core::Tensor& point_addrs,
+                       const core::Tensor& point_colors,
+                       const core::Tensor& voxel_masks,
+                       core::Tensor& voxel_colors);
+
+void CarveCUDA(const core::Tensor& voxel_indices,
+               const core::Tensor& image,
+               const core::Tensor& intrinsics,
+               const core::Tensor& extrinsics,
+               const core::Tensor& origin,
+               double voxel_size,
+               float depth_scale,
+               bool silhouette,
+               bool keep_voxels_outside_image,
+               core::Tensor& carve_mask);
+#endif
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Core>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/t/geometry/kernel/VoxelGridImpl.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+void VoxelizeTrianglesCPU(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          const core::Tensor& origin,
+                          double voxel_size,
+                          core::Tensor& voxel_indices) {
+    const double* vertices_ptr = vertices.GetDataPtr<double>();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const Eigen::Vector3d origin_e(origin.GetDataPtr<double>());
+    const Eigen::Vector3d box_half_size =
+            Eigen::Vector3d::Constant(voxel_size / 2.0);
+    const int64_t num_triangles = triangles.GetLength();
+
+    // Visits the voxels intersected by a triangle, writing their indices to
+    // voxels_ptr if it is not null, and returns their number. Voxels touching
+    // the bounding box of the triangle are tested as well.
+    auto visit_voxels = [&](int64_t tri, int* voxels_ptr) {
+        const int64_t* tri_ptr = triangles_ptr + 3 * tri;
+        const Eigen::Vector3d v0(vertices_ptr + 3 * tri_ptr[0]);
+        const Eigen::Vector3d v1(vertices_ptr + 3 * tri_ptr[1]);
+        const Eigen::Vector3d v2(vertices_ptr + 3 * tri_ptr[2]);
+        const Eigen::Vector3d min_bound = v0.cwiseMin(v1).cwiseMin(v2);
+        const Eigen::Vector3d max_bound = v0.cwiseMax(v1).cwiseMax(v2);
+        Eigen::Vector3i lo, hi;
+        for (int i = 0; i < 3; ++i) {
+            lo(i) = int(std::ceil((min_bound(i) - origin_e(i)) / voxel_size)) -
+                    1;
+            hi(i) = int(std::floor((max_bound(i) - origin_e(i)) / voxel_size));
+        }
+
+        int64_t count = 0;
+        for (int x = lo(0); x <= hi(0); ++x) {
+            for (int y = lo(1); y <= hi(1); ++y) {
+                for (int z = lo(2); z <= hi(2); ++z) {
+                    const Eigen::Vector3d box_center =
+                            origin_e + (Eigen::Vector3d(x, y, z).array() + 0.5)
+                                                       .matrix() *
+                                               voxel_size;
+                    if (open3d::geometry::IntersectionTest::TriangleAABB(
+                                box_center, box_half_size, v0, v1, v2)) {
+                        if (voxels_ptr != nullptr) {
+                            voxels_ptr[3 * count + 0] = x;
+                            voxels_ptr[3 * count + 1] = y;
+                            voxels_ptr[3 * count + 2] = z;
+                        }
+                        ++count;
+                    }
+                }
+            }
+        }
+        return count;
+    };
+
+    // Count the voxels of every triangle first, so that the second pass can
+    // write them without synchronization.
+    std::vector<int64_t> offsets(num_triangles + 1, 0);
+    core::kernel::cpu_launcher::ParallelFor(num_triangles, [&](int64_t tri) {
+        offsets[tri + 1] = visit_voxels(tri, nullptr);
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    voxel_indices = core::Tensor({offsets.back(), 3}, core::Int32,
+                                 vertices.GetDevice());
+    int* voxel_indices_ptr = voxel_indices.GetDataPtr<int>();
+    core::kernel::cpu_launcher::ParallelFor(num_triangles, [&](int64_t tri) {
+        visit_voxels(tri, voxel_indices_ptr + 3 * offsets[tri]);
+    });
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,231 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryIndexer.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+/// Pinhole camera and voxel grid geometry in double precision, so that the
+/// corners of the voxels project exactly as in the legacy VoxelGrid.
+struct CarveCamera {
+    double intrinsics_[9];
+    double extrinsics_[12];
+    double origin_[3];
+    double voxel_size_;
+};
+
+#if defined(__CUDACC__)
+void AverageColorsCUDA
+#else
+void AverageColorsCPU
+#endif
+        (const core::Tensor& point_addrs,
+         const core::Tensor& point_colors,
+         const core::Tensor& voxel_masks,
+         core::Tensor& voxel_colors) {
+    const int64_t n = point_addrs.GetLength();
+    const int* addrs_ptr = point_addrs.GetDataPtr<int>();
+    const double* colors_ptr = point_colors.GetDataPtr<double>();
+    const bool* masks_ptr = voxel_masks.GetDataPtr<bool>();
+    float* voxel_colors_ptr = voxel_colors.GetDataPtr<float>();
+
+    // Color sums and point counts, indexed by the voxel addresses.
+    core::Tensor color_sums =
+            core::Tensor::Zeros({voxel_colors.GetLength(), 4}, core::Float64,
+                                point_addrs.GetDevice());
+    double* sums_ptr = color_sums.GetDataPtr<double>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        double* sum_ptr = sums_ptr + 4 * addrs_ptr[workload_idx];
+        const double* color_ptr = colors_ptr + 3 * workload_idx;
+#if defined(__CUDACC__)
+        atomicAdd(sum_ptr + 0, color_ptr[0]);
+        atomicAdd(sum_ptr + 1, color_ptr[1]);
+        atomicAdd(sum_ptr + 2, color_ptr[2]);
+        atomicAdd(sum_ptr + 3, 1.0);
+#else
+        for (int i = 0; i < 3; ++i) {
+#pragma omp atomic
+            sum_ptr[i] += color_ptr[i];
+        }
+#pragma omp atomic
+        sum_ptr[3] += 1.0;
+#endif
+    });
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        if (!masks_ptr[workload_idx]) {
+            return;
+        }
+        const int addr = addrs_ptr[workload_idx];
+        const double* sum_ptr = sums_ptr + 4 * addr;
+        for (int i = 0; i < 3; ++i) {
+            voxel_colors_ptr[3 * addr + i] =
+                    static_cast<float>(sum_ptr[i] / sum_ptr[3]);
+        }
+    });
+}
+
+#if defined(__CUDACC__)
+void CarveCUDA
+#else
+void CarveCPU
+#endif
+        (const core::Tensor& voxel_indices,
+         const core::Tensor& image,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         const core::Tensor& origin,
+         double voxel_size,
+         float depth_scale,
+         bool silhouette,
+         bool keep_voxels_outside_image,
+         core::Tensor& carve_mask) {
+    CarveCamera camera;
+    const double* intrinsics_ptr = intrinsics.GetDataPtr<double>();
+    const double* extrinsics_ptr = extrinsics.GetDataPtr<double>();
+    const double* origin_ptr = origin.GetDataPtr<double>();
+    for (int i = 0; i < 9; ++i) {
+        camera.intrinsics_[i] = intrinsics_ptr[i];
+    }
+    for (int i = 0; i < 12; ++i) {
+        camera.extrinsics_[i] = extrinsics_ptr[i];
+    }
+    for (int i = 0; i < 3; ++i) {
+        camera.origin_[i] = origin_ptr[i];
+    }
+    camera.voxel_size_ = voxel_size;
+
+    const int64_t n = voxel_indices.GetLength();
+    carve_mask = core::Tensor({n}, core::Bool, voxel_indices.GetDevice());
+    if (n == 0) {
+        return;
+    }
+
+    const int* indices_ptr = voxel_indices.GetDataPtr<int>();
+    bool* mask_ptr = carve_mask.GetDataPtr<bool>();
+    NDArrayIndexer image_indexer(image, 2);
+    const double width = static_cast<double>(image_indexer.GetShape(1));
+    const double height = static_cast<double>(image_indexer.GetShape(0));
+    const double scale = silhouette ? 1.0 : 1.0 / depth_scale;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(image.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const double* K = camera.intrinsics_;
+            const double* T = camera.extrinsics_;
+            const double r = camera.voxel_size_ / 2.0;
+            double center[3];
+            for (int i = 0; i < 3; ++i) {
+                center[i] = (indices_ptr[3 * workload_idx + i] + 0.5) *
+                                    camera.voxel_size_ +
+                            camera.origin_[i];
+            }
+
+            bool carve = true;
+            for (int corner = 0; corner < 8 && carve; ++corner) {
+                double x[3];
+                for (int i = 0; i < 3; ++i) {
+                    x[i] = center[i] + (((corner >> i) & 1) ? r : -r);
+                }
+                double xc[3];
+                for (int i = 0; i < 3; ++i) {
+                    xc[i] = T[4 * i + 0] * x[0] + T[4 * i + 1] * x[1] +
+                            T[4 * i + 2] * x[2] + T[4 * i + 3];
+                }
+                double uvz[3];
+                for (int i = 0; i < 3; ++i) {
+                    uvz[i] = K[3 * i + 0] * xc[0] + K[3 * i + 1] * xc[1] +
+                             K[3 * i + 2] * xc[2];
+                }
+                const double z = uvz[2];
+                const double u = uvz[0] / z;
+                const double v = uvz[1] / z;
+
+                const bool within_boundary =
+                        u >= 0.0 && u <= width - 1 && v >= 0.0 &&
+                        v <= height - 1;
+                if (!within_boundary) {
+                    carve = !keep_voxels_outside_image;
+                    continue;
+                }
+
+                // Bilinear interpolation of the pixel values.
+                int64_t ui = static_cast<int64_t>(u);
+                int64_t vi = static_cast<int64_t>(v);
+                ui = ui > width - 2 ? static_cast<int64_t>(width) - 2 : ui;
+                vi = vi > height - 2 ? static_cast<int64_t>(height) - 2 : vi;
+                ui = ui < 0 ? 0 : ui;
+                vi = vi < 0 ? 0 : vi;
+                const double pu = u - ui;
+                const double pv = v - vi;
+                const double v00 = static_cast<double>(
+                        *image_indexer.GetDataPtr<scalar_t>(ui, vi));
+                const double v01 = static_cast<double>(
+                        *image_indexer.GetDataPtr<scalar_t>(ui, vi + 1));
+                const double v10 = static_cast<double>(
+                        *image_indexer.GetDataPtr<scalar_t>(ui + 1, vi));
+                const double v11 = static_cast<double>(
+                        *image_indexer.GetDataPtr<scalar_t>(ui + 1, vi + 1));
+                const double d = ((v00 * (1 - pv) + v01 * pv) * (1 - pu) +
+                                  (v10 * (1 - pv) + v11 * pv) * pu) *
+                                 scale;
+
+                if (d > 0 && (silhouette || z >= d)) {
+                    carve = false;
+                }
+            }
+            mask_ptr[workload_idx] = carve;
+        });
+    });
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
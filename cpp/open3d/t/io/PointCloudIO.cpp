@@ -91,6 +91,7 @@ bool ReadPointCloud(const std::string &filename,
                 legacy_pointcloud, core::Float64);
     } else {
         success = map_itr->second(filename, pointcloud, params);
+        if (!success) return false;
         utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
                           (int)pointcloud.GetPoints().GetLength());
         if (params.remove_nan_points || params.remove_infinite_points) {
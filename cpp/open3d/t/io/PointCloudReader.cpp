@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudReader.h"
+
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+std::unique_ptr<PointCloudChunkReader> CreateChunkReader(
+        const std::string &format) {
+    if (format == "ply") {
+        return CreatePLYChunkReader();
+    } else if (format == "pcd") {
+        return CreatePCDChunkReader();
+    } else if (format == "pts") {
+        return CreatePTSChunkReader();
+    } else if (format == "xyz" || format == "xyzn" || format == "xyzrgb" ||
+               format == "xyzi") {
+        return CreateXYZChunkReader(format);
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+PointCloudReader::~PointCloudReader() { Close(); }
+
+bool PointCloudReader::Open(const std::string &filename,
+                            int64_t chunk_size,
+                            const std::string &format,
+                            size_t read_ahead) {
+    Close();
+    if (chunk_size <= 0 || read_ahead == 0) {
+        utility::LogWarning(
+                "Open point cloud reader failed: chunk_size and read_ahead "
+                "must be positive.");
+        return false;
+    }
+    std::string file_format = format;
+    if (file_format == "auto") {
+        file_format =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+
+    std::unique_ptr<PointCloudChunkReader> chunk_reader =
+            CreateChunkReader(file_format);
+    if (chunk_reader == nullptr) {
+        utility::LogWarning(
+                "Open point cloud reader failed: unknown file extension for "
+                "{} (format: {}).",
+                filename, format);
+        return false;
+    }
+    if (!chunk_reader->Open(filename)) {
+        utility::LogWarning(
+                "Open point cloud reader failed: unable to read {} in chunks. "
+                "Use ReadPointCloud() for the variants of the format that "
+                "cannot be streamed.",
+                filename);
+        return false;
+    }
+
+    chunk_reader_ = std::move(chunk_reader);
+    chunk_size_ = chunk_size;
+    read_ahead_ = read_ahead;
+    num_points_ = chunk_reader_->GetNumPoints();
+    chunks_.clear();
+    is_eof_ = false;
+    has_failed_ = false;
+    stop_ = false;
+    chunk_reader_thread_ = std::thread(&PointCloudReader::ReadChunks, this);
+    return true;
+}
+
+void PointCloudReader::Close() {
+    if (chunk_reader_thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(chunks_mutex_);
+            stop_ = true;
+        }
+        chunks_changed_.notify_all();
+        chunk_reader_thread_.join();
+    }
+    chunk_reader_.reset();
+    chunks_.clear();
+    num_points_ = -1;
+}
+
+bool PointCloudReader::IsEOF() const {
+    std::lock_guard<std::mutex> lock(chunks_mutex_);
+    return is_eof_ && chunks_.empty();
+}
+
+bool PointCloudReader::HasFailed() const {
+    std::lock_guard<std::mutex> lock(chunks_mutex_);
+    return has_failed_;
+}
+
+bool PointCloudReader::ReadNext(geometry::PointCloud &chunk) {
+    if (!IsOpened()) {
+        utility::LogWarning("Point cloud reader is not opened.");
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(chunks_mutex_);
+    chunks_changed_.wait(lock, [this] { return !chunks_.empty() || is_eof_; });
+    if (chunks_.empty()) {
+        chunk.Clear();
+        return false;
+    }
+    chunk = std::move(chunks_.front());
+    chunks_.pop_front();
+    lock.unlock();
+    chunks_changed_.notify_all();
+    return true;
+}
+
+void PointCloudReader::ReadChunks() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(chunks_mutex_);
+            chunks_changed_.wait(lock, [this] {
+                return stop_ || chunks_.size() < read_ahead_;
+            });
+            if (stop_) {
+                return;
+            }
+        }
+
+        geometry::PointCloud chunk;
+        bool success = false;
+        try {
+            success = chunk_reader_->ReadChunk(chunk_size_, chunk);
+        } catch (const std::exception &e) {
+            utility::LogWarning("Read point cloud chunk failed: {}", e.what());
+        }
+
+        const bool done = !success || chunk.IsEmpty();
+        {
+            std::lock_guard<std::mutex> lock(chunks_mutex_);
+            if (done) {
+                is_eof_ = true;
+                has_failed_ = !success;
+            } else {
+                chunks_.push_back(std::move(chunk));
+            }
+        }
+        chunks_changed_.notify_all();
+        if (done) {
+            return;
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
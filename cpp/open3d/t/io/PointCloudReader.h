@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudChunkReader
+///
+/// Format specific reader used by PointCloudReader. It reads consecutive
+/// chunks of points from a file and is only accessed by one thread at a time.
+class PointCloudChunkReader {
+public:
+    virtual ~PointCloudChunkReader() {}
+
+    /// Open the file and parse its header. Returns false if the file cannot
+    /// be read in chunks.
+    virtual bool Open(const std::string &filename) = 0;
+
+    /// Read at most \p max_points points into \p chunk. An empty chunk marks
+    /// the end of the file. Returns false if the file could not be read.
+    virtual bool ReadChunk(int64_t max_points,
+                           geometry::PointCloud &chunk) = 0;
+
+    /// Number of points in the file if known from its header, -1 otherwise.
+    virtual int64_t GetNumPoints() const { return -1; }
+};
+
+/// PLY files in ASCII or binary little endian format whose vertex element has
+/// no list properties.
+std::unique_ptr<PointCloudChunkReader> CreatePLYChunkReader();
+
+/// PCD files in ASCII or binary format.
+std::unique_ptr<PointCloudChunkReader> CreatePCDChunkReader();
+
+/// PTS files.
+std::unique_ptr<PointCloudChunkReader> CreatePTSChunkReader();
+
+/// Whitespace separated text files with one point per line. \p format is one
+/// of "xyz", "xyzn", "xyzrgb" or "xyzi".
+std::unique_ptr<PointCloudChunkReader> CreateXYZChunkReader(
+        const std::string &format);
+
+/// \class PointCloudReader
+///
+/// Streaming point cloud reader for files that do not fit in memory.
+///
+/// The file is read in chunks of at most \p chunk_size points, which are
+/// returned one by one by ReadNext(). The next chunks are read on a
+/// background thread while the caller processes the current one; at most
+/// \p read_ahead chunks are buffered. The chunks have the same attributes and
+/// dtypes as the point cloud returned by ReadPointCloud().
+///
+/// Supported formats are PLY, PCD, XYZ, XYZN, XYZRGB, XYZI and PTS. Variants
+/// that cannot be read in chunks (binary compressed PCD, big endian PLY and
+/// PLY files with list properties in the vertex element) are rejected by
+/// Open(); read them with ReadPointCloud() instead.
+///
+/// Example:
+/// \code
+/// t::io::PointCloudReader reader;
+/// reader.Open("tile.ply", 1 << 20);
+/// t::geometry::PointCloud chunk;
+/// while (reader.ReadNext(chunk)) {
+///     Process(chunk.VoxelDownSample(0.05));
+/// }
+/// \endcode
+class PointCloudReader {
+public:
+    static const int64_t DEFAULT_CHUNK_SIZE = 1 << 20;
+    static const size_t DEFAULT_READ_AHEAD = 2;
+
+    PointCloudReader() {}
+    PointCloudReader(const PointCloudReader &) = delete;
+    PointCloudReader &operator=(const PointCloudReader &) = delete;
+    ~PointCloudReader();
+
+    /// Open a point cloud file and start reading it in the background.
+    ///
+    /// \param filename Path to the point cloud file.
+    /// \param chunk_size Maximum number of points per chunk.
+    /// \param format File format, "auto" deduces it from the file extension.
+    /// \param read_ahead Maximum number of chunks buffered ahead of the
+    /// caller.
+    bool Open(const std::string &filename,
+              int64_t chunk_size = DEFAULT_CHUNK_SIZE,
+              const std::string &format = "auto",
+              size_t read_ahead = DEFAULT_READ_AHEAD);
+
+    /// Stop the background reading and close the file.
+    void Close();
+
+    /// Check if a file is opened.
+    bool IsOpened() const { return chunk_reader_ != nullptr; }
+
+    /// Check if all chunks have been returned by ReadNext().
+    bool IsEOF() const;
+
+    /// Number of points in the file if known from its header, -1 otherwise.
+    int64_t GetNumPoints() const { return num_points_; }
+
+    /// Get the next chunk of points. Blocks until the chunk is read.
+    /// \return false at the end of the file or if reading failed.
+    bool ReadNext(geometry::PointCloud &chunk);
+
+    /// Check if reading the file failed.
+    bool HasFailed() const;
+
+private:
+    void ReadChunks();
+
+    std::unique_ptr<PointCloudChunkReader> chunk_reader_;
+    int64_t chunk_size_ = DEFAULT_CHUNK_SIZE;
+    size_t read_ahead_ = DEFAULT_READ_AHEAD;
+    int64_t num_points_ = -1;
+
+    /// Chunks read by chunk_reader_thread_, protected by chunks_mutex_.
+    std::deque<geometry::PointCloud> chunks_;
+    bool is_eof_ = false;
+    bool has_failed_ = false;
+    bool stop_ = false;
+    mutable std::mutex chunks_mutex_;
+    std::condition_variable chunks_changed_;
+    std::thread chunk_reader_thread_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/io/file_format/FilePCD.h"
+#include "open3d/t/io/PointCloudReader.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+using open3d::io::PCDHeader;
+using open3d::io::PCLPointField;
+
+/// Chunked reader for ASCII and binary PCD files. The output matches
+/// ReadPointCloud(): Float64 points, normals and colors in [0, 1].
+class PCDChunkReader : public PointCloudChunkReader {
+public:
+    ~PCDChunkReader() override {
+        if (file_ != nullptr) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename) override {
+        file_ = utility::filesystem::FOpen(filename, "rb");
+        // Binary compressed data is a single LZF block of all the points.
+        return file_ != nullptr && open3d::io::ReadPCDHeader(file_, header_) &&
+               header_.datatype != open3d::io::PCD_DATA_BINARY_COMPRESSED;
+    }
+
+    bool ReadChunk(int64_t max_points,
+                   geometry::PointCloud &chunk) override {
+        chunk.Clear();
+        int64_t n = std::min(max_points, header_.points - num_points_read_);
+        if (n <= 0) {
+            return true;
+        }
+        core::Tensor points({n, 3}, core::Float64);
+        core::Tensor normals, colors;
+        double *points_ptr = points.GetDataPtr<double>();
+        double *normals_ptr = nullptr;
+        double *colors_ptr = nullptr;
+        if (header_.has_normals) {
+            normals = core::Tensor({n, 3}, core::Float64);
+            normals_ptr = normals.GetDataPtr<double>();
+        }
+        if (header_.has_colors) {
+            colors = core::Tensor({n, 3}, core::Float64);
+            colors_ptr = colors.GetDataPtr<double>();
+        }
+
+        const bool is_ascii = header_.datatype == open3d::io::PCD_DATA_ASCII;
+        std::vector<char> record(header_.pointsize);
+        char line[DEFAULT_IO_BUFFER_SIZE];
+        int64_t idx = 0;
+        while (idx < n) {
+            std::vector<std::string> strs;
+            if (is_ascii) {
+                if (!fgets(line, sizeof(line), file_)) {
+                    break;
+                }
+                strs = utility::SplitString(line, "\t\r\n ");
+                if (int(strs.size()) < header_.elementnum) {
+                    continue;
+                }
+            } else if (fread(record.data(), header_.pointsize, 1, file_) !=
+                       1) {
+                break;
+            }
+            for (const PCLPointField &field : header_.fields) {
+                const char *data_ptr =
+                        is_ascii ? strs[field.count_offset].c_str()
+                                 : record.data() + field.offset;
+                if (field.name == "rgb" || field.name == "rgba") {
+                    Eigen::Map<Eigen::Vector3d>(colors_ptr + 3 * idx) =
+                            is_ascii ? open3d::io::UnpackASCIIPCDColor(
+                                               data_ptr, field.type, field.size)
+                                     : open3d::io::UnpackBinaryPCDColor(
+                                               data_ptr, field.type,
+                                               field.size);
+                    continue;
+                }
+                const double value =
+                        is_ascii ? open3d::io::UnpackASCIIPCDElement(
+                                           data_ptr, field.type, field.size)
+                                 : open3d::io::UnpackBinaryPCDElement(
+                                           data_ptr, field.type, field.size);
+                if (field.name == "x") {
+                    points_ptr[3 * idx + 0] = value;
+                } else if (field.name == "y") {
+                    points_ptr[3 * idx + 1] = value;
+                } else if (field.name == "z") {
+                    points_ptr[3 * idx + 2] = value;
+                } else if (header_.has_normals && field.name == "normal_x") {
+                    normals_ptr[3 * idx + 0] = value;
+                } else if (header_.has_normals && field.name == "normal_y") {
+                    normals_ptr[3 * idx + 1] = value;
+                } else if (header_.has_normals && field.name == "normal_z") {
+                    normals_ptr[3 * idx + 2] = value;
+                }
+            }
+            ++idx;
+        }
+        if (idx < n) {
+            utility::LogWarning("Read PCD failed: unexpected end of file.");
+            return false;
+        }
+
+        chunk.SetPoints(points);
+        if (header_.has_normals) {
+            chunk.SetPointNormals(normals);
+        }
+        if (header_.has_colors) {
+            chunk.SetPointColors(colors);
+        }
+        num_points_read_ += n;
+        return true;
+    }
+
+    int64_t GetNumPoints() const override { return header_.points; }
+
+private:
+    FILE *file_ = nullptr;
+    PCDHeader header_;
+    int64_t num_points_read_ = 0;
+};
+
+}  // namespace
+
+std::unique_ptr<PointCloudChunkReader> CreatePCDChunkReader() {
+    return std::unique_ptr<PointCloudChunkReader>(new PCDChunkReader());
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
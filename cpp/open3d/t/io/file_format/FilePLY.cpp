@@ -26,13 +26,22 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudReader.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -171,9 +180,516 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+static e_ply_type GetPlyTypeFromString(const std::string &type) {
+    static const std::unordered_map<std::string, e_ply_type> type_map = {
+            {"int8", PLY_INT8},       {"uint8", PLY_UINT8},
+            {"int16", PLY_INT16},     {"uint16", PLY_UINT16},
+            {"int32", PLY_INT32},     {"uint32", PLY_UIN32},
+            {"float32", PLY_FLOAT32}, {"float64", PLY_FLOAT64},
+            {"char", PLY_CHAR},       {"uchar", PLY_UCHAR},
+            {"short", PLY_SHORT},     {"ushort", PLY_USHORT},
+            {"int", PLY_INT},         {"uint", PLY_UINT},
+            {"float", PLY_FLOAT},     {"double", PLY_DOUBLE},
+            {"list", PLY_LIST}};
+    auto it = type_map.find(type);
+    return it == type_map.end() ? PLY_LIST : it->second;
+}
+
+static int64_t GetPlyTypeByteSize(e_ply_type type) {
+    switch (type) {
+        case PLY_INT8:
+        case PLY_UINT8:
+        case PLY_CHAR:
+        case PLY_UCHAR:
+            return 1;
+        case PLY_INT16:
+        case PLY_UINT16:
+        case PLY_SHORT:
+        case PLY_USHORT:
+            return 2;
+        case PLY_INT32:
+        case PLY_UIN32:
+        case PLY_INT:
+        case PLY_UINT:
+        case PLY_FLOAT32:
+        case PLY_FLOAT:
+            return 4;
+        case PLY_FLOAT64:
+        case PLY_DOUBLE:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+struct PLYHeaderElement {
+    struct Property {
+        std::string name_;
+        e_ply_type type_;
+        // 0 for list properties.
+        int64_t byte_size_;
+    };
+    std::string name_;
+    int64_t size_;
+    std::vector<Property> properties_;
+
+    /// Bytes per element, or 0 if any property is a list.
+    int64_t GetStride() const {
+        int64_t stride = 0;
+        for (const Property &property : properties_) {
+            if (property.byte_size_ == 0) {
+                return 0;
+            }
+            stride += property.byte_size_;
+        }
+        return stride;
+    }
+};
+
+enum class PLYFormat { ASCII, BinaryLittleEndian, Other };
+
+/// Parse the header of a PLY file, leaving \p file at the start of the data.
+/// Returns false if the header cannot be parsed.
+static bool ReadPLYHeader(FILE *file,
+                          PLYFormat &format,
+                          std::vector<PLYHeaderElement> &elements) {
+    char line[4096];
+    if (fgets(line, sizeof(line), file) == nullptr ||
+        std::string(line).compare(0, 3, "ply") != 0) {
+        return false;
+    }
+    format = PLYFormat::Other;
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        std::vector<std::string> tokens =
+                utility::SplitString(line, " \t\r\n");
+        if (tokens.empty() || tokens[0] == "comment" ||
+            tokens[0] == "obj_info") {
+            continue;
+        } else if (tokens[0] == "format" && tokens.size() >= 2) {
+            if (tokens[1] == "ascii") {
+                format = PLYFormat::ASCII;
+            } else if (tokens[1] == "binary_little_endian") {
+                format = PLYFormat::BinaryLittleEndian;
+            }
+        } else if (tokens[0] == "element" && tokens.size() == 3) {
+            PLYHeaderElement element;
+            element.name_ = tokens[1];
+            element.size_ = std::stoll(tokens[2]);
+            elements.push_back(element);
+        } else if (tokens[0] == "property" && tokens.size() >= 3 &&
+                   !elements.empty()) {
+            PLYHeaderElement::Property property;
+            property.name_ = tokens.back();
+            property.type_ = GetPlyTypeFromString(tokens[1]);
+            property.byte_size_ = GetPlyTypeByteSize(property.type_);
+            elements.back().properties_.push_back(property);
+        } else if (tokens[0] == "end_header") {
+            return true;
+        } else {
+            return false;
+        }
+    }
+    return false;
+}
+
+/// fseek with a 64-bit offset. long is only 32 bits wide on Windows.
+static int FSeek64(FILE *file, int64_t offset, int origin) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, origin);
+#else
+    return fseeko(file, static_cast<off_t>(offset), origin);
+#endif
+}
+
+/// Find the vertex element and move \p file to the start of its data by
+/// skipping the elements stored before it. Binary files can only skip
+/// fixed-size elements. Returns nullptr if this is not possible.
+static const PLYHeaderElement *SeekPLYVertexElement(
+        FILE *file,
+        PLYFormat format,
+        const std::vector<PLYHeaderElement> &elements) {
+    int64_t offset = 0;
+    int64_t lines = 0;
+    for (const PLYHeaderElement &element : elements) {
+        if (element.name_ == "vertex") {
+            if (format == PLYFormat::BinaryLittleEndian && offset > 0 &&
+                FSeek64(file, offset, SEEK_CUR) != 0) {
+                return nullptr;
+            }
+            char line[4096];
+            for (int64_t i = 0; i < lines; ++i) {
+                if (fgets(line, sizeof(line), file) == nullptr) {
+                    return nullptr;
+                }
+            }
+            return &element;
+        }
+        if (format == PLYFormat::BinaryLittleEndian) {
+            if (element.GetStride() == 0) {
+                return nullptr;
+            }
+            offset += element.size_ * element.GetStride();
+        } else {
+            lines += element.size_;
+        }
+    }
+    return nullptr;
+}
+
+/// Maps the properties of a vertex element without list properties to the
+/// point cloud attributes. x/y/z, nx/ny/nz and red/green/blue are stored in
+/// the columns of (N, 3) tensors, the remaining supported properties in (N, 1)
+/// tensors.
+struct PLYVertexLayout {
+    struct Column {
+        std::string attr_;
+        int64_t channel_;
+        // Index of the property in the element and byte offset in a binary
+        // row.
+        int64_t property_index_;
+        int64_t src_offset_;
+    };
+    std::vector<Column> columns_;
+    std::unordered_map<std::string, std::pair<core::Dtype, int64_t>> attrs_;
+    int64_t stride_;
+
+    /// Returns false if the vertex element has list properties or base
+    /// attributes with mixed dtypes, which are left to rply.
+    bool Init(const PLYHeaderElement &vertex) {
+        stride_ = vertex.GetStride();
+        if (stride_ == 0) {
+            return false;
+        }
+        std::unordered_map<std::string, int64_t> name_to_index;
+        for (size_t i = 0; i < vertex.properties_.size(); ++i) {
+            name_to_index[vertex.properties_[i].name_] = int64_t(i);
+        }
+        std::vector<int64_t> src_offsets(vertex.properties_.size(), 0);
+        for (size_t i = 1; i < vertex.properties_.size(); ++i) {
+            src_offsets[i] =
+                    src_offsets[i - 1] + vertex.properties_[i - 1].byte_size_;
+        }
+
+        const std::vector<std::pair<std::string, std::vector<std::string>>>
+                base_attr_names = {{"points", {"x", "y", "z"}},
+                                   {"normals", {"nx", "ny", "nz"}},
+                                   {"colors", {"red", "green", "blue"}}};
+        for (const auto &base_attr : base_attr_names) {
+            const std::vector<std::string> &names = base_attr.second;
+            if (name_to_index.count(names[0]) == 0 ||
+                name_to_index.count(names[1]) == 0 ||
+                name_to_index.count(names[2]) == 0) {
+                continue;
+            }
+            std::vector<int64_t> indices = {name_to_index.at(names[0]),
+                                            name_to_index.at(names[1]),
+                                            name_to_index.at(names[2])};
+            core::Dtype dtype = GetDtype(vertex.properties_[indices[0]].type_);
+            if (dtype == core::Undefined ||
+                GetDtype(vertex.properties_[indices[1]].type_) != dtype ||
+                GetDtype(vertex.properties_[indices[2]].type_) != dtype) {
+                return false;
+            }
+            for (int64_t i = 0; i < 3; ++i) {
+                columns_.push_back({base_attr.first, i, indices[i],
+                                    src_offsets[indices[i]]});
+                name_to_index.erase(names[i]);
+            }
+            attrs_[base_attr.first] = std::make_pair(dtype, 3);
+        }
+        for (size_t i = 0; i < vertex.properties_.size(); ++i) {
+            const PLYHeaderElement::Property &property = vertex.properties_[i];
+            if (name_to_index.count(property.name_) == 0) {
+                continue;
+            }
+            core::Dtype dtype = GetDtype(property.type_);
+            if (dtype == core::Undefined) {
+                utility::LogWarning(
+                        "Read PLY warning: skipping property \"{}\", "
+                        "unsupported datatype \"{}\".",
+                        property.name_, GetDtypeString(property.type_));
+                continue;
+            }
+            columns_.push_back(
+                    {property.name_, 0, int64_t(i), src_offsets[i]});
+            attrs_[property.name_] = std::make_pair(dtype, 1);
+        }
+        return true;
+    }
+
+    std::unordered_map<std::string, core::Tensor> AllocateAttrs(
+            int64_t num_vertices) const {
+        std::unordered_map<std::string, core::Tensor> attrs;
+        for (const auto &it : attrs_) {
+            attrs[it.first] = core::Tensor({num_vertices, it.second.second},
+                                           it.second.first);
+        }
+        return attrs;
+    }
+};
+
+template <int64_t byte_size>
+static void CopyStridedColumn(const uint8_t *src,
+                              int64_t src_stride,
+                              uint8_t *dst,
+                              int64_t dst_stride,
+                              int64_t count) {
+    for (int64_t i = 0; i < count; ++i) {
+        std::memcpy(dst + i * dst_stride, src + i * src_stride, byte_size);
+    }
+}
+
+/// Read \p num_rows binary vertex rows into rows [row_begin, row_begin +
+/// num_rows) of \p attrs. Rows are read in chunks of ~64MB, and each chunk is
+/// scattered into the attribute columns in parallel over (column, row range)
+/// pairs.
+static bool ReadBinaryPLYVertexRows(
+        FILE *file,
+        const PLYVertexLayout &layout,
+        std::unordered_map<std::string, core::Tensor> &attrs,
+        int64_t row_begin,
+        int64_t num_rows,
+        utility::CountingProgressReporter *reporter = nullptr) {
+    struct Column {
+        int64_t src_offset_;
+        int64_t byte_size_;
+        uint8_t *dst_;
+        int64_t dst_stride_;
+    };
+    std::vector<Column> columns;
+    for (const auto &column : layout.columns_) {
+        core::Tensor &data = attrs.at(column.attr_);
+        int64_t byte_size = data.GetDtype().ByteSize();
+        int64_t dst_stride = byte_size * data.GetShape(1);
+        columns.push_back({column.src_offset_, byte_size,
+                           static_cast<uint8_t *>(data.GetDataPtr()) +
+                                   row_begin * dst_stride +
+                                   column.channel_ * byte_size,
+                           dst_stride});
+    }
+
+    const int64_t stride = layout.stride_;
+    const int64_t chunk_rows =
+            std::max<int64_t>(1, (int64_t(1) << 26) / stride);
+    const int64_t rows_per_task = 1 << 14;
+    std::vector<uint8_t> buffer(
+            static_cast<size_t>(std::min(chunk_rows, num_rows) * stride));
+    for (int64_t row = 0; row < num_rows; row += chunk_rows) {
+        const int64_t rows = std::min(chunk_rows, num_rows - row);
+        if (fread(buffer.data(), stride, rows, file) != size_t(rows)) {
+            return false;
+        }
+        const int64_t num_row_tasks =
+                (rows + rows_per_task - 1) / rows_per_task;
+        const int64_t num_tasks =
+                static_cast<int64_t>(columns.size()) * num_row_tasks;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t task = 0; task < num_tasks; ++task) {
+            const Column &column = columns[task / num_row_tasks];
+            const int64_t begin = (task % num_row_tasks) * rows_per_task;
+            const int64_t count = std::min(rows_per_task, rows - begin);
+            const uint8_t *src =
+                    buffer.data() + begin * stride + column.src_offset_;
+            uint8_t *dst = column.dst_ + (row + begin) * column.dst_stride_;
+            switch (column.byte_size_) {
+                case 1:
+                    CopyStridedColumn<1>(src, stride, dst, column.dst_stride_,
+                                         count);
+                    break;
+                case 2:
+                    CopyStridedColumn<2>(src, stride, dst, column.dst_stride_,
+                                         count);
+                    break;
+                case 4:
+                    CopyStridedColumn<4>(src, stride, dst, column.dst_stride_,
+                                         count);
+                    break;
+                default:
+                    CopyStridedColumn<8>(src, stride, dst, column.dst_stride_,
+                                         count);
+                    break;
+            }
+        }
+        if (reporter != nullptr) {
+            reporter->Update(row + rows);
+        }
+    }
+    return true;
+}
+
+/// Read \p num_rows ASCII vertex lines into rows [row_begin, row_begin +
+/// num_rows) of \p attrs.
+static bool ReadASCIIPLYVertexRows(
+        FILE *file,
+        const PLYVertexLayout &layout,
+        std::unordered_map<std::string, core::Tensor> &attrs,
+        int64_t row_begin,
+        int64_t num_rows) {
+    char line[4096];
+    std::vector<double> values;
+    for (int64_t row = row_begin; row < row_begin + num_rows; ++row) {
+        if (fgets(line, sizeof(line), file) == nullptr) {
+            return false;
+        }
+        values.clear();
+        char *begin = line;
+        char *end = nullptr;
+        for (double value = std::strtod(begin, &end); end != begin;
+             value = std::strtod(begin, &end)) {
+            values.push_back(value);
+            begin = end;
+        }
+        for (const auto &column : layout.columns_) {
+            if (column.property_index_ >= int64_t(values.size())) {
+                return false;
+            }
+            core::Tensor &data = attrs.at(column.attr_);
+            DISPATCH_DTYPE_TO_TEMPLATE(data.GetDtype(), [&]() {
+                data.GetDataPtr<scalar_t>()[row * data.GetShape(1) +
+                                            column.channel_] =
+                        static_cast<scalar_t>(values[column.property_index_]);
+            });
+        }
+    }
+    return true;
+}
+
+static void SetPLYVertexAttrs(
+        const std::unordered_map<std::string, core::Tensor> &attrs,
+        geometry::PointCloud &pointcloud) {
+    pointcloud.Clear();
+    for (const auto &it : attrs) {
+        if (it.first == "points") {
+            pointcloud.SetPoints(it.second);
+        } else if (it.first == "normals") {
+            pointcloud.SetPointNormals(it.second);
+        } else if (it.first == "colors") {
+            pointcloud.SetPointColors(it.second);
+        } else {
+            pointcloud.SetPointAttr(it.first, it.second);
+        }
+    }
+}
+
+/// Bulk reader for binary little endian PLY files whose vertex element only has
+/// fixed-size properties. The vertex block is read with large sequential reads
+/// and scattered into the attribute tensors in parallel, without going through
+/// the per-value rply callbacks. Returns false if the file cannot be handled,
+/// in which case rply is used instead. Otherwise \p success holds the status of
+/// the read.
+static bool ReadPointCloudFromBinaryPLY(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const open3d::io::ReadPointCloudOption &params,
+        bool &success) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    PLYFormat format;
+    std::vector<PLYHeaderElement> elements;
+    const PLYHeaderElement *vertex = nullptr;
+    PLYVertexLayout layout;
+    if (!ReadPLYHeader(file, format, elements) ||
+        format != PLYFormat::BinaryLittleEndian ||
+        (vertex = SeekPLYVertexElement(file, format, elements)) == nullptr ||
+        !layout.Init(*vertex)) {
+        fclose(file);
+        return false;
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(vertex->size_);
+    std::unordered_map<std::string, core::Tensor> attrs =
+            layout.AllocateAttrs(vertex->size_);
+    success = ReadBinaryPLYVertexRows(file, layout, attrs, 0, vertex->size_,
+                                      &reporter);
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read PLY failed: unable to read file: {}.",
+                            filename);
+        return true;
+    }
+    SetPLYVertexAttrs(attrs, pointcloud);
+    reporter.Finish();
+    return true;
+}
+
+/// Chunked reader for ASCII and binary little endian PLY files whose vertex
+/// element has no list properties.
+class PLYChunkReader : public PointCloudChunkReader {
+public:
+    ~PLYChunkReader() override {
+        if (file_ != nullptr) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename) override {
+        file_ = utility::filesystem::FOpen(filename, "rb");
+        if (file_ == nullptr) {
+            return false;
+        }
+        std::vector<PLYHeaderElement> elements;
+        const PLYHeaderElement *vertex = nullptr;
+        if (!ReadPLYHeader(file_, format_, elements) ||
+            format_ == PLYFormat::Other ||
+            (vertex = SeekPLYVertexElement(file_, format_, elements)) ==
+                    nullptr ||
+            !layout_.Init(*vertex)) {
+            return false;
+        }
+        num_points_ = vertex->size_;
+        return true;
+    }
+
+    bool ReadChunk(int64_t max_points,
+                   geometry::PointCloud &chunk) override {
+        int64_t rows = std::min(max_points, num_points_ - num_points_read_);
+        if (rows <= 0) {
+            chunk.Clear();
+            return true;
+        }
+        std::unordered_map<std::string, core::Tensor> attrs =
+                layout_.AllocateAttrs(rows);
+        bool success =
+                format_ == PLYFormat::BinaryLittleEndian
+                        ? ReadBinaryPLYVertexRows(file_, layout_, attrs, 0,
+                                                  rows)
+                        : ReadASCIIPLYVertexRows(file_, layout_, attrs, 0,
+                                                 rows);
+        if (!success) {
+            utility::LogWarning("Read PLY failed: unexpected end of file.");
+            return false;
+        }
+        SetPLYVertexAttrs(attrs, chunk);
+        num_points_read_ += rows;
+        return true;
+    }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+private:
+    FILE *file_ = nullptr;
+    PLYFormat format_ = PLYFormat::Other;
+    PLYVertexLayout layout_;
+    int64_t num_points_ = 0;
+    int64_t num_points_read_ = 0;
+};
+
+std::unique_ptr<PointCloudChunkReader> CreatePLYChunkReader() {
+    return std::unique_ptr<PointCloudChunkReader>(new PLYChunkReader());
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    bool success = false;
+    if (ReadPointCloudFromBinaryPLY(filename, pointcloud, params, success)) {
+        return success;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
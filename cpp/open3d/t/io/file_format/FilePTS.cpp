@@ -24,10 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudReader.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
@@ -37,6 +39,129 @@ namespace open3d {
 namespace t {
 namespace io {
 
+/// Allocate the attributes of \p num_points points for a PTS file with
+/// \p num_fields fields per line. Returns false for unknown layouts.
+static bool AllocatePTSAttrs(size_t num_fields,
+                             int64_t num_points,
+                             geometry::PointCloud &pointcloud) {
+    pointcloud.Clear();
+    if (num_fields != 3 && num_fields != 4 && num_fields != 6 &&
+        num_fields != 7) {
+        return false;
+    }
+    pointcloud.SetPoints(core::Tensor({num_points, 3}, core::Float64));
+    // X Y Z I [R G B].
+    if (num_fields == 4 || num_fields == 7) {
+        pointcloud.SetPointAttr("intensities",
+                                core::Tensor({num_points, 1}, core::Float64));
+    }
+    // X Y Z [I] R G B.
+    if (num_fields == 6 || num_fields == 7) {
+        pointcloud.SetPointColors(core::Tensor({num_points, 3}, core::UInt8));
+    }
+    return true;
+}
+
+/// Parse one PTS line into point \p idx of attributes allocated by
+/// AllocatePTSAttrs.
+static bool ReadPTSLine(const char *line_buffer,
+                        size_t num_fields,
+                        int64_t idx,
+                        geometry::PointCloud &pointcloud) {
+    double *points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
+    double x, y, z, i;
+    int r, g, b;
+    // X Y Z I R G B.
+    if (num_fields == 7 && (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x,
+                                   &y, &z, &i, &r, &g, &b) == 7)) {
+        double *intensities_ptr =
+                pointcloud.GetPointAttr("intensities").GetDataPtr<double>();
+        uint8_t *colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
+        points_ptr[3 * idx + 0] = x;
+        points_ptr[3 * idx + 1] = y;
+        points_ptr[3 * idx + 2] = z;
+        intensities_ptr[idx] = i;
+        colors_ptr[3 * idx + 0] = r;
+        colors_ptr[3 * idx + 1] = g;
+        colors_ptr[3 * idx + 2] = b;
+    }
+    // X Y Z R G B.
+    else if (num_fields == 6 &&
+             (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z, &r, &g,
+                     &b) == 6)) {
+        uint8_t *colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
+        points_ptr[3 * idx + 0] = x;
+        points_ptr[3 * idx + 1] = y;
+        points_ptr[3 * idx + 2] = z;
+        colors_ptr[3 * idx + 0] = r;
+        colors_ptr[3 * idx + 1] = g;
+        colors_ptr[3 * idx + 2] = b;
+    }
+    // X Y Z I.
+    else if (num_fields == 4 &&
+             (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &i) == 4)) {
+        double *intensities_ptr =
+                pointcloud.GetPointAttr("intensities").GetDataPtr<double>();
+        points_ptr[3 * idx + 0] = x;
+        points_ptr[3 * idx + 1] = y;
+        points_ptr[3 * idx + 2] = z;
+        intensities_ptr[idx] = i;
+    }
+    // X Y Z.
+    else if (num_fields == 3 &&
+             sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
+        points_ptr[3 * idx + 0] = x;
+        points_ptr[3 * idx + 1] = y;
+        points_ptr[3 * idx + 2] = z;
+    } else {
+        utility::LogWarning("Read PTS failed at line: {}", line_buffer);
+        return false;
+    }
+    return true;
+}
+
+/// Read the number of points from the first line of a PTS file and the
+/// number of fields per point from the second one. The file is left at the
+/// start of the point data.
+static bool ReadPTSHeader(utility::filesystem::CFile &file,
+                          int64_t &num_points,
+                          size_t &num_fields) {
+    num_points = 0;
+    num_fields = 0;
+    const char *line_buffer;
+    if ((line_buffer = file.ReadLine())) {
+        const char *format;
+        if (std::is_same<int64_t, long>::value) {
+            format = "%ld";
+        } else {
+            format = "%lld";
+        }
+        sscanf(line_buffer, format, &num_points);
+    }
+    if (num_points < 0) {
+        utility::LogWarning("Read PTS failed: number of points must be >= 0.");
+        return false;
+    } else if (num_points == 0) {
+        return true;
+    }
+
+    // Store data start position.
+    int64_t start_pos = ftell(file.GetFILE());
+    if ((line_buffer = file.ReadLine())) {
+        num_fields = utility::SplitString(line_buffer, " ").size();
+        if (num_fields != 3 && num_fields != 4 && num_fields != 6 &&
+            num_fields != 7) {
+            utility::LogWarning("Read PTS failed: unknown pts format: {}",
+                                line_buffer);
+            return false;
+        }
+    }
+
+    // Go to data start position.
+    fseek(file.GetFILE(), start_pos, 0);
+    return true;
+}
+
 bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
@@ -53,19 +178,8 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         }
 
         int64_t num_points = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            const char *format;
-            if (std::is_same<int64_t, long>::value) {
-                format = "%ld";
-            } else {
-                format = "%lld";
-            }
-            sscanf(line_buffer, format, &num_points);
-        }
-        if (num_points < 0) {
-            utility::LogWarning(
-                    "Read PTS failed: number of points must be >= 0.");
+        size_t num_fields = 0;
+        if (!ReadPTSHeader(file, num_points, num_fields)) {
             return false;
         } else if (num_points == 0) {
             pointcloud.SetPoints(core::Tensor({0, 3}, core::Float64));
@@ -73,110 +187,12 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         }
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(num_points);
-
-        // Store data start position.
-        int64_t start_pos = ftell(file.GetFILE());
-
-        double *points_ptr = nullptr;
-        double *intensities_ptr = nullptr;
-        uint8_t *colors_ptr = nullptr;
-        size_t num_fields = 0;
-
-        if ((line_buffer = file.ReadLine())) {
-            num_fields = utility::SplitString(line_buffer, " ").size();
-
-            // X Y Z I R G B.
-            if (num_fields == 7) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z I.
-            else if (num_fields == 4) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-            }
-            // X Y Z.
-            else if (num_fields == 3) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-            } else {
-                utility::LogWarning("Read PTS failed: unknown pts format: {}",
-                                    line_buffer);
-                return false;
-            }
-        }
-
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
+        AllocatePTSAttrs(num_fields, num_points, pointcloud);
 
         int64_t idx = 0;
+        const char *line_buffer;
         while (idx < num_points && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B.
-            if (num_fields == 7 &&
-                (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                        &r, &g, &b) == 7)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6 &&
-                     (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z,
-                             &r, &g, &b) == 6)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z I.
-            else if (num_fields == 4 && (sscanf(line_buffer, "%lf %lf %lf %lf",
-                                                &x, &y, &z, &i) == 4)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-            }
-            // X Y Z.
-            else if (num_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}", line_buffer);
+            if (!ReadPTSLine(line_buffer, num_fields, idx, pointcloud)) {
                 return false;
             }
             idx++;
@@ -193,6 +209,49 @@ bool ReadPointCloudFromPTS(const std::string &filename,
     }
 }
 
+/// Chunked reader for PTS files.
+class PTSChunkReader : public PointCloudChunkReader {
+public:
+    bool Open(const std::string &filename) override {
+        return file_.Open(filename, "rb") &&
+               ReadPTSHeader(file_, num_points_, num_fields_);
+    }
+
+    bool ReadChunk(int64_t max_points,
+                   geometry::PointCloud &chunk) override {
+        int64_t n = std::min(max_points, num_points_ - num_points_read_);
+        if (n <= 0) {
+            chunk.Clear();
+            return true;
+        }
+        AllocatePTSAttrs(num_fields_, n, chunk);
+        for (int64_t idx = 0; idx < n; ++idx) {
+            const char *line_buffer = file_.ReadLine();
+            if (line_buffer == nullptr) {
+                utility::LogWarning("Read PTS failed: unexpected end of file.");
+                return false;
+            }
+            if (!ReadPTSLine(line_buffer, num_fields_, idx, chunk)) {
+                return false;
+            }
+        }
+        num_points_read_ += n;
+        return true;
+    }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+private:
+    utility::filesystem::CFile file_;
+    int64_t num_points_ = 0;
+    size_t num_fields_ = 0;
+    int64_t num_points_read_ = 0;
+};
+
+std::unique_ptr<PointCloudChunkReader> CreatePTSChunkReader() {
+    return std::unique_ptr<PointCloudChunkReader>(new PTSChunkReader());
+}
+
 core::Tensor ConvertColorTensorToUint8(const core::Tensor &color_in) {
     core::Tensor color_values;
     if (color_in.GetDtype() == core::Float32 ||
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/PointCloudReader.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Chunked reader for text files with one point per line: "x y z" followed
+/// by a normal (xyzn), a color in [0, 1] (xyzrgb) or an intensity (xyzi).
+/// Like the non-streaming readers, lines that cannot be parsed are skipped.
+class XYZChunkReader : public PointCloudChunkReader {
+public:
+    explicit XYZChunkReader(const std::string &format) {
+        if (format == "xyzn") {
+            extra_attr_ = "normals";
+            num_extra_fields_ = 3;
+        } else if (format == "xyzrgb") {
+            extra_attr_ = "colors";
+            num_extra_fields_ = 3;
+        } else if (format == "xyzi") {
+            extra_attr_ = "intensities";
+            num_extra_fields_ = 1;
+        }
+    }
+
+    bool Open(const std::string &filename) override {
+        return file_.Open(filename, "r");
+    }
+
+    bool ReadChunk(int64_t max_points,
+                   geometry::PointCloud &chunk) override {
+        chunk.Clear();
+        core::Tensor points({max_points, 3}, core::Float64);
+        core::Tensor extra;
+        double *points_ptr = points.GetDataPtr<double>();
+        double *extra_ptr = nullptr;
+        if (num_extra_fields_ > 0) {
+            extra = core::Tensor({max_points, num_extra_fields_},
+                                 core::Float64);
+            extra_ptr = extra.GetDataPtr<double>();
+        }
+
+        int64_t n = 0;
+        const int num_fields = 3 + static_cast<int>(num_extra_fields_);
+        double values[6];
+        const char *line_buffer;
+        while (n < max_points && (line_buffer = file_.ReadLine())) {
+            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &values[0],
+                       &values[1], &values[2], &values[3], &values[4],
+                       &values[5]) < num_fields) {
+                continue;
+            }
+            for (int i = 0; i < 3; ++i) {
+                points_ptr[3 * n + i] = values[i];
+            }
+            for (int64_t i = 0; i < num_extra_fields_; ++i) {
+                extra_ptr[num_extra_fields_ * n + i] = values[3 + i];
+            }
+            ++n;
+        }
+        if (n == 0) {
+            return true;
+        }
+        chunk.SetPoints(points.Slice(0, 0, n));
+        if (num_extra_fields_ > 0) {
+            chunk.SetPointAttr(extra_attr_, extra.Slice(0, 0, n));
+        }
+        return true;
+    }
+
+private:
+    utility::filesystem::CFile file_;
+    std::string extra_attr_;
+    int64_t num_extra_fields_ = 0;
+};
+
+std::unique_ptr<PointCloudChunkReader> CreateXYZChunkReader(
+        const std::string &format) {
+    return std::unique_ptr<PointCloudChunkReader>(new XYZChunkReader(format));
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
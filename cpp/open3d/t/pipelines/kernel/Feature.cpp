@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void ComputeFPFHFeature(const core::Tensor &points,
+                        const core::Tensor &normals,
+                        const core::Tensor &indices,
+                        const core::Tensor &distance2,
+                        const core::Tensor &counts,
+                        core::Tensor &fpfhs) {
+    const core::Device device = points.GetDevice();
+    const core::Dtype dtype = points.GetDtype();
+    const int64_t n = points.GetLength();
+
+    if (dtype != core::Float64 && dtype != core::Float32) {
+        utility::LogError("Only Float32 and Float64 dtypes are supported.");
+    }
+    normals.AssertShape({n, 3});
+    normals.AssertDtype(dtype);
+    normals.AssertDevice(device);
+    indices.AssertShapeCompatible({n, utility::nullopt});
+    indices.AssertDtype(core::Int64);
+    indices.AssertDevice(device);
+    distance2.AssertShape(indices.GetShape());
+    distance2.AssertDtype(dtype);
+    distance2.AssertDevice(device);
+    counts.AssertShape({n});
+    counts.AssertDtype(core::Int64);
+    counts.AssertDevice(device);
+
+    fpfhs = core::Tensor::Zeros({n, 33}, core::Float32, device);
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeFPFHFeatureCPU(points.Contiguous(), normals.Contiguous(),
+                              indices.Contiguous(), distance2.Contiguous(),
+                              counts.Contiguous(), fpfhs);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeFPFHFeatureCUDA, points.Contiguous(),
+                  normals.Contiguous(), indices.Contiguous(),
+                  distance2.Contiguous(), counts.Contiguous(), fpfhs);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,214 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Computes the angular features (theta, alpha, phi) of a pair of oriented
+/// points. The features are zero for degenerated pairs.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void ComputePairFeature(const scalar_t *p1,
+                                                  const scalar_t *n1,
+                                                  const scalar_t *p2,
+                                                  const scalar_t *n2,
+                                                  scalar_t *feature) {
+    feature[0] = 0;
+    feature[1] = 0;
+    feature[2] = 0;
+
+    scalar_t dp2p1[3] = {p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+    const scalar_t dist = sqrt(dp2p1[0] * dp2p1[0] + dp2p1[1] * dp2p1[1] +
+                               dp2p1[2] * dp2p1[2]);
+    if (dist == 0) {
+        return;
+    }
+
+    const scalar_t angle1 =
+            (n1[0] * dp2p1[0] + n1[1] * dp2p1[1] + n1[2] * dp2p1[2]) / dist;
+    const scalar_t angle2 =
+            (n2[0] * dp2p1[0] + n2[1] * dp2p1[1] + n2[2] * dp2p1[2]) / dist;
+
+    // The source of the Darboux frame is the point whose normal is closer to
+    // the line connecting the points. acos is decreasing, so comparing the
+    // absolute cosines is enough.
+    const scalar_t *n1_copy = n1;
+    const scalar_t *n2_copy = n2;
+    scalar_t phi = angle1;
+    if (fabs(angle1) < fabs(angle2)) {
+        n1_copy = n2;
+        n2_copy = n1;
+        dp2p1[0] = -dp2p1[0];
+        dp2p1[1] = -dp2p1[1];
+        dp2p1[2] = -dp2p1[2];
+        phi = -angle2;
+    }
+
+    // v = dp2p1 x n1, w = n1 x v.
+    scalar_t v[3] = {dp2p1[1] * n1_copy[2] - dp2p1[2] * n1_copy[1],
+                     dp2p1[2] * n1_copy[0] - dp2p1[0] * n1_copy[2],
+                     dp2p1[0] * n1_copy[1] - dp2p1[1] * n1_copy[0]};
+    const scalar_t v_norm = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (v_norm == 0) {
+        return;
+    }
+    v[0] /= v_norm;
+    v[1] /= v_norm;
+    v[2] /= v_norm;
+    const scalar_t w[3] = {n1_copy[1] * v[2] - n1_copy[2] * v[1],
+                           n1_copy[2] * v[0] - n1_copy[0] * v[2],
+                           n1_copy[0] * v[1] - n1_copy[1] * v[0]};
+
+    feature[0] = atan2(w[0] * n2_copy[0] + w[1] * n2_copy[1] +
+                               w[2] * n2_copy[2],
+                       n1_copy[0] * n2_copy[0] + n1_copy[1] * n2_copy[1] +
+                               n1_copy[2] * n2_copy[2]);
+    feature[1] = v[0] * n2_copy[0] + v[1] * n2_copy[1] + v[2] * n2_copy[2];
+    feature[2] = phi;
+}
+
+/// Returns the bin of a value in [min_value, max_value] in a histogram with
+/// 11 bins.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline int GetFPFHBin(scalar_t value,
+                                         scalar_t min_value,
+                                         scalar_t max_value) {
+    int bin = static_cast<int>(
+            floor(11 * (value - min_value) / (max_value - min_value)));
+    return bin < 0 ? 0 : (bin > 10 ? 10 : bin);
+}
+
+#if defined(__CUDACC__)
+void ComputeFPFHFeatureCUDA
+#else
+void ComputeFPFHFeatureCPU
+#endif
+        (const core::Tensor &points,
+         const core::Tensor &normals,
+         const core::Tensor &indices,
+         const core::Tensor &distance2,
+         const core::Tensor &counts,
+         core::Tensor &fpfhs) {
+    const int64_t n = points.GetLength();
+    const int64_t max_nn = indices.GetShape(1);
+
+    // Simplified point feature histograms of all points. They are only
+    // accumulated once and then reused by all neighbors in the second pass.
+    core::Tensor spfhs = core::Tensor::Zeros({n, 33}, core::Float32,
+                                             points.GetDevice());
+    float *spfhs_ptr = spfhs.GetDataPtr<float>();
+    float *fpfhs_ptr = fpfhs.GetDataPtr<float>();
+    const int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+    const int64_t *counts_ptr = counts.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t *points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t *normals_ptr = normals.GetDataPtr<scalar_t>();
+        const scalar_t *distance2_ptr = distance2.GetDataPtr<scalar_t>();
+
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t count = counts_ptr[workload_idx];
+            // Only compute the SPFH when the point has neighbors.
+            if (count <= 1) {
+                return;
+            }
+
+            const scalar_t *point = points_ptr + 3 * workload_idx;
+            const scalar_t *normal = normals_ptr + 3 * workload_idx;
+            const int64_t *neighbors = indices_ptr + max_nn * workload_idx;
+            float *spfh = spfhs_ptr + 33 * workload_idx;
+            const float hist_incr = 100.0f / static_cast<float>(count - 1);
+
+            for (int64_t k = 0; k < count; ++k) {
+                const int64_t idx = neighbors[k];
+                if (idx == workload_idx) {
+                    continue;
+                }
+                scalar_t pf[3];
+                ComputePairFeature(point, normal, points_ptr + 3 * idx,
+                                   normals_ptr + 3 * idx, pf);
+                spfh[GetFPFHBin<scalar_t>(pf[0], -M_PI, M_PI)] += hist_incr;
+                spfh[11 + GetFPFHBin<scalar_t>(pf[1], -1, 1)] += hist_incr;
+                spfh[22 + GetFPFHBin<scalar_t>(pf[2], -1, 1)] += hist_incr;
+            }
+        });
+
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t count = counts_ptr[workload_idx];
+            if (count <= 1) {
+                return;
+            }
+
+            const int64_t *neighbors = indices_ptr + max_nn * workload_idx;
+            const scalar_t *neighbor_distance2 =
+                    distance2_ptr + max_nn * workload_idx;
+            float *fpfh = fpfhs_ptr + 33 * workload_idx;
+
+            float sum[3] = {0, 0, 0};
+            for (int64_t k = 0; k < count; ++k) {
+                // Skips the point itself and duplicated points.
+                const float dist = static_cast<float>(neighbor_distance2[k]);
+                if (dist == 0) {
+                    continue;
+                }
+                const float *spfh = spfhs_ptr + 33 * neighbors[k];
+                for (int j = 0; j < 33; ++j) {
+                    const float val = spfh[j] / dist;
+                    sum[j / 11] += val;
+                    fpfh[j] += val;
+                }
+            }
+            for (int j = 0; j < 3; ++j) {
+                if (sum[j] != 0) sum[j] = 100.0f / sum[j];
+            }
+            const float *spfh = spfhs_ptr + 33 * workload_idx;
+            for (int j = 0; j < 33; ++j) {
+                fpfh[j] = fpfh[j] * sum[j / 11] + spfh[j];
+            }
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
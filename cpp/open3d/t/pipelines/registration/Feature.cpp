@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <tuple>
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
+                                double radius,
+                                int max_nn /* = 100 */) {
+    if (!input.HasPointNormals()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    if (radius <= 0 || max_nn <= 0) {
+        utility::LogError(
+                "[ComputeFPFHFeature] radius and max_nn must be positive, but "
+                "got {} and {}.",
+                radius, max_nn);
+    }
+
+    const core::Tensor &points = input.GetPoints();
+    if (points.GetLength() == 0) {
+        return core::Tensor::Zeros({0, 33}, core::Float32, points.GetDevice());
+    }
+
+    core::nns::NearestNeighborSearch tree(points);
+    if (!tree.HybridIndex(radius)) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Building HybridIndex failed. Please "
+                "check if the input point cloud is valid.");
+    }
+    core::Tensor indices, distance2, counts;
+    std::tie(indices, distance2, counts) =
+            tree.HybridSearch(points, radius, max_nn);
+
+    core::Tensor fpfhs;
+    kernel::ComputeFPFHFeature(points, input.GetPointNormals(), indices,
+                               distance2, counts, fpfhs);
+    return fpfhs;
+}
+
+core::Tensor CorrespondencesFromFeatures(const core::Tensor &source_features,
+                                         const core::Tensor &target_features,
+                                         bool mutual_filter /* = false */) {
+    const core::Dtype dtype = source_features.GetDtype();
+    if (dtype != core::Float64 && dtype != core::Float32) {
+        utility::LogError("Only Float32 and Float64 dtypes are supported.");
+    }
+    if (source_features.NumDims() != 2) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Features must be of shape "
+                "{{N, D}}, but got {}.",
+                source_features.GetShape().ToString());
+    }
+    target_features.AssertDtype(dtype);
+    target_features.AssertShapeCompatible(
+            {utility::nullopt, source_features.GetShape(1)});
+
+    const core::Device device = source_features.GetDevice();
+    const int64_t num_source = source_features.GetLength();
+    const int64_t num_target = target_features.GetLength();
+    if (num_source == 0 || num_target == 0) {
+        return core::Tensor::Empty({0, 2}, core::Int64, device);
+    }
+
+    // The features are matched with the CPU KD-tree, which also supports
+    // high dimensional features.
+    const core::Device host("CPU:0");
+    const core::Tensor source_features_host =
+            source_features.To(host).Contiguous();
+    const core::Tensor target_features_host =
+            target_features.To(host).Contiguous();
+
+    core::nns::NearestNeighborSearch target_tree(target_features_host);
+    target_tree.KnnIndex();
+    const core::Tensor source_to_target =
+            target_tree.KnnSearch(source_features_host, 1).first.Contiguous();
+    const int64_t *source_to_target_ptr =
+            source_to_target.GetDataPtr<int64_t>();
+
+    core::Tensor corres = core::Tensor::Empty({num_source, 2}, core::Int64);
+    int64_t *corres_ptr = corres.GetDataPtr<int64_t>();
+    int64_t num_corres = 0;
+
+    if (!mutual_filter) {
+        for (int64_t i = 0; i < num_source; ++i) {
+            corres_ptr[2 * i + 0] = i;
+            corres_ptr[2 * i + 1] = source_to_target_ptr[i];
+        }
+        num_corres = num_source;
+    } else {
+        core::nns::NearestNeighborSearch source_tree(source_features_host);
+        source_tree.KnnIndex();
+        const core::Tensor target_to_source =
+                source_tree.KnnSearch(target_features_host, 1)
+                        .first.Contiguous();
+        const int64_t *target_to_source_ptr =
+                target_to_source.GetDataPtr<int64_t>();
+
+        for (int64_t i = 0; i < num_source; ++i) {
+            const int64_t j = source_to_target_ptr[i];
+            if (target_to_source_ptr[j] == i) {
+                corres_ptr[2 * num_corres + 0] = i;
+                corres_ptr[2 * num_corres + 1] = j;
+                ++num_corres;
+            }
+        }
+    }
+
+    return corres.Slice(0, 0, num_corres).Contiguous().To(device);
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
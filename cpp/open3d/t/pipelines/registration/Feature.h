@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace pipelines {
+namespace registration {
+
+/// \brief Function to compute FPFH feature for a point cloud.
+///
+/// The neighbors of all points are found with one batched hybrid search, and
+/// the histograms are accumulated on the device of the point cloud.
+///
+/// \param input The input point cloud with normals, of dtype Float32 or
+/// Float64.
+/// \param radius Radius of the neighborhood of a point.
+/// \param max_nn Maximum number of neighbors of a point.
+/// \return FPFH features of shape {N, 33} and dtype Float32, on the device of
+/// the input point cloud.
+core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
+                                double radius,
+                                int max_nn = 100);
+
+/// \brief Function to find correspondences between two point clouds by
+/// nearest neighbor matching of their features.
+///
+/// \param source_features Features of the source point cloud, shape {N, D}.
+/// \param target_features Features of the target point cloud, shape {M, D},
+/// same dtype as the source features.
+/// \param mutual_filter Keeps only the correspondences where the source point
+/// is also the nearest neighbor of its corresponding target point.
+/// \return Correspondences of shape {K, 2} and dtype Int64, where each row
+/// holds a source index and the corresponding target index, on the device of
+/// the source features.
+core::Tensor CorrespondencesFromFeatures(const core::Tensor &source_features,
+                                         const core::Tensor &target_features,
+                                         bool mutual_filter = false);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,11 +26,21 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <tbb/parallel_for.h>
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Feature.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace t {
@@ -107,19 +117,55 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
                                      init_source_to_target, estimation);
 }
 
-static void AssertInputMultiScaleICP(
-        const geometry::PointCloud &source,
+static void AssertInputMultiScaleICPTarget(
         const geometry::PointCloud &target,
         const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances) {
+    const int64_t num_scales = int64_t(voxel_sizes.size());
+    if (num_scales == 0 ||
+        int64_t(max_correspondence_distances.size()) != num_scales) {
+        utility::LogError(
+                " [RegistrationMultiScaleICP]: Size of criterias, voxel_size,"
+                " max_correspondence_distances vectors must be same.");
+    }
+    if (target.GetPoints().GetDtype() == core::Float64 &&
+        target.GetDevice().GetType() == core::Device::DeviceType::CUDA) {
+        utility::LogDebug(
+                "Use Float32 pointcloud for best performance on CUDA device.");
+    }
+
+    for (int64_t i = 0; i < num_scales; i++) {
+        if (i > 0 && voxel_sizes[i] >= voxel_sizes[i - 1]) {
+            utility::LogError(
+                    " [MultiScaleICP] Voxel sizes must be in strictly "
+                    "decreasing order.");
+        }
+        if (voxel_sizes[i] <= 0 &&
+            !(i == num_scales - 1 && voxel_sizes[i] == -1)) {
+            utility::LogError(
+                    " [MultiScaleICP] Voxel sizes must be positive, only the "
+                    "last voxel size can be -1.");
+        }
+        if (max_correspondence_distances[i] <= 0.0) {
+            utility::LogError(
+                    " Max correspondence distance must be greater than 0, but"
+                    " got {} in scale: {}.",
+                    max_correspondence_distances[i], i);
+        }
+    }
+}
+
+static void AssertInputMultiScaleICPSource(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
         const std::vector<ICPConvergenceCriteria> &criterias,
-        const std::vector<double> &max_correspondence_distances,
+        const int64_t num_scales,
         const core::Tensor &init_source_to_target,
-        const TransformationEstimation &estimation,
-        const int64_t &num_iterations,
-        const core::Device &device,
-        const core::Dtype &dtype) {
+        const TransformationEstimation &estimation) {
     init_source_to_target.AssertShape({4, 4});
 
+    const core::Device device = source.GetDevice();
+    const core::Dtype dtype = source.GetPoints().GetDtype();
     if (target.GetPoints().GetDtype() != dtype) {
         utility::LogError(
                 "Target Pointcloud dtype {} != Source Pointcloud's dtype {}.",
@@ -130,13 +176,7 @@ static void AssertInputMultiScaleICP(
                 "Target Pointcloud device {} != Source Pointcloud's device {}.",
                 target.GetDevice().ToString(), device.ToString());
     }
-    if (dtype == core::Float64 &&
-        device.GetType() == core::Device::DeviceType::CUDA) {
-        utility::LogDebug(
-                "Use Float32 pointcloud for best performance on CUDA device.");
-    }
-    if (!(criterias.size() == voxel_sizes.size() &&
-          criterias.size() == max_correspondence_distances.size())) {
+    if (int64_t(criterias.size()) != num_scales) {
         utility::LogError(
                 " [RegistrationMultiScaleICP]: Size of criterias, voxel_size,"
                 " max_correspondence_distances vectors must be same.");
@@ -153,64 +193,27 @@ static void AssertInputMultiScaleICP(
         TransformationEstimationType::ColoredICP) {
         utility::LogError("Tensor PointCloud ColoredICP is not implemented.");
     }
-
-    if (max_correspondence_distances[0] <= 0.0) {
-        utility::LogError(
-                " Max correspondence distance must be greater than 0, but"
-                " got {} in scale: {}.",
-                max_correspondence_distances[0], 0);
-    }
-
-    for (int64_t i = 1; i < num_iterations; i++) {
-        if (voxel_sizes[i] >= voxel_sizes[i - 1]) {
-            utility::LogError(
-                    " [MultiScaleICP] Voxel sizes must be in strictly "
-                    "decreasing order.");
-        }
-        if (max_correspondence_distances[i] <= 0.0) {
-            utility::LogError(
-                    " Max correspondence distance must be greater than 0, but"
-                    " got {} in scale: {}.",
-                    max_correspondence_distances[i], i);
-        }
-    }
 }
 
-static std::tuple<std::vector<t::geometry::PointCloud>,
-                  std::vector<t::geometry::PointCloud>>
-InitializePointCloudPyramidForMultiScaleICP(
+static std::vector<t::geometry::PointCloud> InitializeSourcePyramid(
         const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
         const std::vector<double> &voxel_sizes,
-        const TransformationEstimation &estimation,
         const int64_t &num_iterations) {
     std::vector<t::geometry::PointCloud> source_down_pyramid(num_iterations);
-    std::vector<t::geometry::PointCloud> target_down_pyramid(num_iterations);
 
     if (voxel_sizes[num_iterations - 1] == -1) {
         source_down_pyramid[num_iterations - 1] = source.Clone();
-        target_down_pyramid[num_iterations - 1] = target;
     } else {
         source_down_pyramid[num_iterations - 1] =
                 source.VoxelDownSample(voxel_sizes[num_iterations - 1]);
-        target_down_pyramid[num_iterations - 1] =
-                target.VoxelDownSample(voxel_sizes[num_iterations - 1]);
-    }
-
-    // TODO(@rishabh): Estimate Color-Gradient here, for ColoredICP.
-    if (estimation.GetTransformationEstimationType() ==
-        TransformationEstimationType::ColoredICP) {
-        utility::LogError(" ColoredICP requires pre-computed color-gradients.");
     }
 
     for (int k = num_iterations - 2; k >= 0; k--) {
         source_down_pyramid[k] =
                 source_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
-        target_down_pyramid[k] =
-                target_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
     }
 
-    return std::make_tuple(source_down_pyramid, target_down_pyramid);
+    return source_down_pyramid;
 }
 
 static RegistrationResult DoSingleScaleIterationsICP(
@@ -225,13 +228,23 @@ static RegistrationResult DoSingleScaleIterationsICP(
         double &prev_fitness,
         double &prev_inlier_rmse,
         const core::Device &device,
-        const core::Dtype &dtype) {
+        const core::Dtype &dtype,
+        std::vector<ICPIterationInfo> &iteration_info) {
     RegistrationResult result;
     for (int j = 0; j < criteria.max_iteration_; j++) {
+        ICPIterationInfo info;
+        info.scale_index_ = iteration_idx;
+        info.iteration_index_ = j;
+
+        utility::Timer timer;
+        timer.Start();
         result = GetRegistrationResultAndCorrespondences(
                 source.GetPoints(), target_nns, max_correspondence_distance,
                 transformation);
+        timer.Stop();
+        info.correspondence_time_ms_ = timer.GetDuration();
 
+        timer.Start();
         // Computing Transform between source and target, given
         // correspondences. ComputeTransformation returns {4,4} shaped
         // Float64 transformation tensor on CPU device.
@@ -246,6 +259,12 @@ static RegistrationResult DoSingleScaleIterationsICP(
 
         // Apply the transform on source pointcloud.
         source.Transform(update.To(device, dtype));
+        timer.Stop();
+        info.estimation_time_ms_ = timer.GetDuration();
+
+        info.fitness_ = result.fitness_;
+        info.inlier_rmse_ = result.inlier_rmse_;
+        iteration_info.push_back(info);
 
         utility::LogDebug(
                 " ICP Scale #{:d} Iteration #{:d}: Fitness {:.4f}, RMSE "
@@ -268,28 +287,104 @@ static RegistrationResult DoSingleScaleIterationsICP(
     return result;
 }
 
-RegistrationResult RegistrationMultiScaleICP(
-        const geometry::PointCloud &source,
+MultiScaleICPContext::MultiScaleICPContext(
         const geometry::PointCloud &target,
         const std::vector<double> &voxel_sizes,
-        const std::vector<ICPConvergenceCriteria> &criterias,
-        const std::vector<double> &max_correspondence_distances,
+        const std::vector<double> &max_correspondence_distances)
+    : voxel_sizes_(voxel_sizes),
+      max_correspondence_distances_(max_correspondence_distances) {
+    AssertInputMultiScaleICPTarget(target, voxel_sizes,
+                                   max_correspondence_distances);
+    if (target.GetPoints().GetLength() == 0) {
+        utility::LogError(
+                "[MultiScaleICPContext] Target point cloud is empty.");
+    }
+
+    const int64_t num_scales = GetNumScales();
+    target_pyramid_.resize(num_scales);
+    voxel_hashmaps_.resize(num_scales);
+    target_nns_.resize(num_scales);
+    AddTargetPoints(target);
+}
+
+geometry::PointCloud MultiScaleICPContext::AddTargetPointsToScale(
+        int64_t scale, const geometry::PointCloud &points) {
+    geometry::PointCloud &target = target_pyramid_[scale];
+    geometry::PointCloud points_down;
+    if (voxel_sizes_[scale] == -1) {
+        points_down = points;
+    } else {
+        // Same as PointCloud::VoxelDownSample, but the occupied voxels are
+        // kept for later insertions.
+        const double voxel_size = voxel_sizes_[scale];
+        core::Tensor points_voxeli =
+                (points.GetPoints() / voxel_size).Floor().To(core::Int64);
+
+        std::shared_ptr<core::Hashmap> &hashmap = voxel_hashmaps_[scale];
+        if (hashmap == nullptr) {
+            hashmap = std::make_shared<core::Hashmap>(
+                    std::max<int64_t>(points_voxeli.GetLength(), 1),
+                    core::Int64, core::Int32, core::SizeVector{3},
+                    core::SizeVector{1}, points.GetDevice());
+        }
+        core::Tensor addrs, masks;
+        hashmap->Activate(points_voxeli, addrs, masks);
+
+        // Gather the voxel coordinates in place of the points, together
+        // with the other attributes.
+        geometry::TensorMap point_attr(points.GetPointAttr());
+        point_attr["points"] = points_voxeli;
+        geometry::TensorMap point_attr_down =
+                point_attr.SelectRows(masks.NonZero().Reshape({-1}));
+
+        points_down = geometry::PointCloud(points.GetDevice());
+        for (auto &kv : point_attr_down) {
+            if (kv.first == "points") {
+                points_down.SetPointAttr(
+                        kv.first,
+                        kv.second.To(points.GetPoints().GetDtype()) *
+                                voxel_size);
+            } else {
+                points_down.SetPointAttr(kv.first, kv.second);
+            }
+        }
+    }
+
+    if (points_down.GetPoints().GetLength() > 0) {
+        if (target.IsEmpty()) {
+            target = points_down;
+        } else {
+            target = target.Append(points_down);
+        }
+        target_nns_[scale] = nullptr;
+    }
+    return points_down;
+}
+
+void MultiScaleICPContext::AddTargetPoints(const geometry::PointCloud &points) {
+    // Coarser scales are downsampled from the points added to the next finer
+    // scale.
+    geometry::PointCloud points_down = points;
+    for (int64_t k = GetNumScales() - 1; k >= 0; k--) {
+        points_down = AddTargetPointsToScale(k, points_down);
+    }
+}
+
+RegistrationResult MultiScaleICPContext::RegisterICP(
+        const geometry::PointCloud &source,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
         const core::Tensor &init_source_to_target,
         const TransformationEstimation &estimation) {
     core::Device device = source.GetDevice();
     core::Dtype dtype = source.GetPoints().GetDtype();
-    int64_t num_iterations = int64_t(criterias.size());
+    int64_t num_iterations = GetNumScales();
 
-    AssertInputMultiScaleICP(source, target, voxel_sizes, criterias,
-                             max_correspondence_distances,
-                             init_source_to_target, estimation, num_iterations,
-                             device, dtype);
+    AssertInputMultiScaleICPSource(source, target_pyramid_.back(),
+                                   criteria_list, num_iterations,
+                                   init_source_to_target, estimation);
 
-    std::vector<t::geometry::PointCloud> source_down_pyramid(num_iterations);
-    std::vector<t::geometry::PointCloud> target_down_pyramid(num_iterations);
-    std::tie(source_down_pyramid, target_down_pyramid) =
-            InitializePointCloudPyramidForMultiScaleICP(
-                    source, target, voxel_sizes, estimation, num_iterations);
+    std::vector<t::geometry::PointCloud> source_down_pyramid =
+            InitializeSourcePyramid(source, voxel_sizes_, num_iterations);
 
     // Transformation tensor is always of shape {4,4}, type Float64 on CPU:0.
     core::Tensor transformation =
@@ -298,32 +393,39 @@ RegistrationResult RegistrationMultiScaleICP(
 
     double prev_fitness = 0;
     double prev_inlier_rmse = 0;
+    iteration_info_.clear();
 
     // ---- Iterating over different resolution scale START -------------------
     for (int64_t i = 0; i < num_iterations; i++) {
         source_down_pyramid[i].Transform(transformation.To(device, dtype));
 
-        // Initialize Neighbor Search.
-        core::nns::NearestNeighborSearch target_nns(
-                target_down_pyramid[i].GetPoints());
-        bool check = target_nns.HybridIndex(max_correspondence_distances[i]);
-        if (!check) {
-            utility::LogError(
-                    "NearestNeighborSearch::HybridSearch: Index is not set.");
+        // Initialize Neighbor Search, if the target of this scale changed.
+        if (target_nns_[i] == nullptr) {
+            target_nns_[i] = std::make_shared<core::nns::NearestNeighborSearch>(
+                    target_pyramid_[i].GetPoints());
+            bool check = target_nns_[i]->HybridIndex(
+                    max_correspondence_distances_[i]);
+            if (!check) {
+                target_nns_[i] = nullptr;
+                utility::LogError(
+                        "NearestNeighborSearch::HybridSearch: Index is not "
+                        "set.");
+            }
         }
 
         // ICP iterations result for single scale.
         result = DoSingleScaleIterationsICP(
-                source_down_pyramid[i], target_down_pyramid[i], target_nns,
-                criterias[i], max_correspondence_distances[i], transformation,
-                estimation, i, prev_fitness, prev_inlier_rmse, device, dtype);
+                source_down_pyramid[i], target_pyramid_[i], *target_nns_[i],
+                criteria_list[i], max_correspondence_distances_[i],
+                transformation, estimation, i, prev_fitness, prev_inlier_rmse,
+                device, dtype, iteration_info_);
 
         // To calculate final `fitness` and `inlier_rmse` for the current
         // `transformation` stored in `result`.
         if (i == num_iterations - 1) {
             result = GetRegistrationResultAndCorrespondences(
-                    source_down_pyramid[i], target_nns,
-                    max_correspondence_distances[i], transformation);
+                    source_down_pyramid[i], *target_nns_[i],
+                    max_correspondence_distances_[i], transformation);
         }
     }
     // ---- Iterating over different resolution scale END ---------------------
@@ -331,6 +433,283 @@ RegistrationResult RegistrationMultiScaleICP(
     return result;
 }
 
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init_source_to_target,
+        const TransformationEstimation &estimation) {
+    MultiScaleICPContext context(target, voxel_sizes,
+                                 max_correspondence_distances);
+    return context.RegisterICP(source, criterias, init_source_to_target,
+                               estimation);
+}
+
+/// Number of RANSAC hypotheses that are generated and evaluated in parallel
+/// before the convergence criteria are checked again.
+static constexpr int64_t kRANSACBatchSize = 1024;
+
+/// SplitMix64 step, used to draw the samples of a RANSAC hypothesis from the
+/// seed of the call and the index of the hypothesis.
+static inline uint64_t SplitMix64(uint64_t &state) {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/// Checks that the edges between the sampled source points and between the
+/// sampled target points have similar lengths.
+static bool CheckEdgeLength(const Eigen::Matrix3Xd &source_samples,
+                            const Eigen::Matrix3Xd &target_samples,
+                            double similarity_threshold) {
+    for (int i = 0; i < source_samples.cols(); ++i) {
+        for (int j = i + 1; j < source_samples.cols(); ++j) {
+            const double dist_source =
+                    (source_samples.col(i) - source_samples.col(j)).norm();
+            const double dist_target =
+                    (target_samples.col(i) - target_samples.col(j)).norm();
+            if (dist_source <= similarity_threshold * dist_target ||
+                dist_target <= similarity_threshold * dist_source) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+RegistrationResult RegistrationRANSACBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences,
+        double max_correspondence_distance,
+        int ransac_n /* = 3 */,
+        double similarity_threshold /* = 0.9 */,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria() */) {
+    correspondences.AssertShapeCompatible({utility::nullopt, 2});
+    correspondences.AssertDtype(core::Int64);
+    if (similarity_threshold < 0 || similarity_threshold > 1) {
+        utility::LogError(
+                "similarity_threshold must be in [0, 1], but got {}.",
+                similarity_threshold);
+    }
+    const int64_t num_corres = correspondences.GetLength();
+    if (ransac_n < 3 || num_corres < ransac_n ||
+        max_correspondence_distance <= 0.0) {
+        return RegistrationResult();
+    }
+
+    // RANSAC only works on the corresponding points, which are gathered on
+    // their device and copied to the host.
+    const core::Device host("CPU:0");
+    const core::Tensor corres_t = correspondences.T();
+    const core::Tensor source_points =
+            source.GetPoints()
+                    .IndexGet({corres_t[0].To(source.GetDevice())})
+                    .To(host, core::Float64)
+                    .Contiguous();
+    const core::Tensor target_points =
+            target.GetPoints()
+                    .IndexGet({corres_t[1].To(target.GetDevice())})
+                    .To(host, core::Float64)
+                    .Contiguous();
+    const double *source_ptr = source_points.GetDataPtr<double>();
+    const double *target_ptr = target_points.GetDataPtr<double>();
+    const double max_distance2 =
+            max_correspondence_distance * max_correspondence_distance;
+
+    struct Hypothesis {
+        int64_t inlier_count = 0;
+        double inlier_error = 0.0;
+        Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    };
+    // Returns true if a has more inliers, or the same number of inliers with
+    // a smaller RMSE.
+    auto is_better = [](const Hypothesis &a, const Hypothesis &b) {
+        return a.inlier_count > b.inlier_count ||
+               (a.inlier_count == b.inlier_count && a.inlier_count > 0 &&
+                a.inlier_error < b.inlier_error);
+    };
+
+    // Every call draws different samples, but for a given seed they do not
+    // depend on how the hypotheses are scheduled.
+    const uint64_t seed =
+            static_cast<uint64_t>(utility::UniformRandDistinctInts(
+                    1, std::numeric_limits<int64_t>::max())[0]);
+
+    Hypothesis best;
+    std::vector<Hypothesis> batch(kRANSACBatchSize);
+    int64_t exit_itr = criteria.max_iteration_;
+    int64_t itr = 0;
+    while (itr < exit_itr) {
+        const int64_t batch_size = std::min(kRANSACBatchSize, exit_itr - itr);
+        // Hypotheses that cannot reach the best inlier count of the previous
+        // batches are abandoned early.
+        const int64_t min_inlier_count = best.inlier_count;
+
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, batch_size),
+                [&](const tbb::blocked_range<int64_t> &range) {
+                    Eigen::Matrix3Xd source_samples(3, ransac_n);
+                    Eigen::Matrix3Xd target_samples(3, ransac_n);
+                    std::vector<int64_t> sampled(ransac_n);
+                    for (int64_t b = range.begin(); b < range.end(); ++b) {
+                        Hypothesis &hypothesis = batch[b];
+                        hypothesis = Hypothesis();
+
+                        // Floyd's algorithm draws ransac_n distinct
+                        // correspondences.
+                        uint64_t index_state = static_cast<uint64_t>(itr + b);
+                        uint64_t state = seed ^ SplitMix64(index_state);
+                        for (int j = 0; j < ransac_n; ++j) {
+                            const int64_t max_k = num_corres - ransac_n + j;
+                            int64_t k = static_cast<int64_t>(
+                                    SplitMix64(state) %
+                                    static_cast<uint64_t>(max_k + 1));
+                            if (std::find(sampled.begin(),
+                                          sampled.begin() + j,
+                                          k) != sampled.begin() + j) {
+                                k = max_k;
+                            }
+                            sampled[j] = k;
+                            source_samples.col(j) =
+                                    Eigen::Map<const Eigen::Vector3d>(
+                                            source_ptr + 3 * k);
+                            target_samples.col(j) =
+                                    Eigen::Map<const Eigen::Vector3d>(
+                                            target_ptr + 3 * k);
+                        }
+                        if (!CheckEdgeLength(source_samples, target_samples,
+                                             similarity_threshold)) {
+                            continue;
+                        }
+
+                        const Eigen::Matrix4d transformation = Eigen::umeyama(
+                                source_samples, target_samples, false);
+                        const Eigen::Matrix3d R =
+                                transformation.block<3, 3>(0, 0);
+                        const Eigen::Vector3d t =
+                                transformation.block<3, 1>(0, 3);
+
+                        int64_t inlier_count = 0;
+                        double inlier_error = 0.0;
+                        for (int64_t k = 0; k < num_corres; ++k) {
+                            const Eigen::Vector3d diff =
+                                    R * Eigen::Map<const Eigen::Vector3d>(
+                                                source_ptr + 3 * k) +
+                                    t -
+                                    Eigen::Map<const Eigen::Vector3d>(
+                                            target_ptr + 3 * k);
+                            const double distance2 = diff.squaredNorm();
+                            if (distance2 < max_distance2) {
+                                ++inlier_count;
+                                inlier_error += distance2;
+                            } else if (inlier_count + num_corres - k - 1 <
+                                       min_inlier_count) {
+                                break;
+                            }
+                        }
+                        hypothesis.inlier_count = inlier_count;
+                        hypothesis.inlier_error = inlier_error;
+                        hypothesis.transformation = transformation;
+                    }
+                });
+
+        for (int64_t b = 0; b < batch_size; ++b) {
+            if (is_better(batch[b], best)) {
+                best = batch[b];
+            }
+        }
+        itr += batch_size;
+
+        // Update exit condition if necessary.
+        if (best.inlier_count > 0) {
+            const double fitness = double(best.inlier_count) / num_corres;
+            const double exit_itr_d = std::log(1.0 - criteria.confidence_) /
+                                      std::log(1.0 - std::pow(fitness,
+                                                              ransac_n));
+            if (exit_itr_d < double(exit_itr)) {
+                exit_itr = static_cast<int64_t>(std::ceil(exit_itr_d));
+            }
+        }
+    }
+
+    if (best.inlier_count == 0) {
+        utility::LogDebug("RANSAC found no valid hypothesis.");
+        return RegistrationResult();
+    }
+
+    RegistrationResult result(
+            core::eigen_converter::EigenMatrixToTensor(best.transformation));
+    result.fitness_ = double(best.inlier_count) / num_corres;
+    result.inlier_rmse_ = std::sqrt(best.inlier_error / best.inlier_count);
+
+    // Correspondences of the inliers, in the format of ICP.
+    const core::Tensor corres_host = correspondences.To(host).Contiguous();
+    const int64_t *corres_ptr = corres_host.GetDataPtr<int64_t>();
+    const Eigen::Matrix3d R = best.transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = best.transformation.block<3, 1>(0, 3);
+    core::Tensor inlier_correspondences = core::Tensor::Full(
+            {source.GetPoints().GetLength(), 1}, -1, core::Int64, host);
+    int64_t *inlier_correspondences_ptr =
+            inlier_correspondences.GetDataPtr<int64_t>();
+    for (int64_t k = 0; k < num_corres; ++k) {
+        const Eigen::Vector3d diff =
+                R * Eigen::Map<const Eigen::Vector3d>(source_ptr + 3 * k) + t -
+                Eigen::Map<const Eigen::Vector3d>(target_ptr + 3 * k);
+        if (diff.squaredNorm() < max_distance2) {
+            inlier_correspondences_ptr[corres_ptr[2 * k]] =
+                    corres_ptr[2 * k + 1];
+        }
+    }
+    result.correspondences_ = inlier_correspondences.To(source.GetDevice());
+
+    utility::LogDebug(
+            "RANSAC exits at {:d}-th iteration: inlier ratio {:e}, "
+            "RMSE {:e}",
+            itr, result.fitness_, result.inlier_rmse_);
+    return result;
+}
+
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        bool mutual_filter,
+        double max_correspondence_distance,
+        int ransac_n /* = 3 */,
+        double similarity_threshold /* = 0.9 */,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria() */) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+        return RegistrationResult();
+    }
+    if (source_features.GetLength() != source.GetPoints().GetLength() ||
+        target_features.GetLength() != target.GetPoints().GetLength()) {
+        utility::LogError(
+                "The number of features must match the number of points.");
+    }
+
+    core::Tensor corres = CorrespondencesFromFeatures(
+            source_features, target_features, mutual_filter);
+    // Empirically mutual correspondence set should not be too small.
+    if (mutual_filter && corres.GetLength() < ransac_n * 3) {
+        utility::LogDebug(
+                "Too few correspondences after mutual filter, fall back to "
+                "original correspondences.");
+        corres = CorrespondencesFromFeatures(source_features, target_features,
+                                             false);
+    }
+
+    return RegistrationRANSACBasedOnCorrespondence(
+            source, target, corres, max_correspondence_distance, ransac_n,
+            similarity_threshold, criteria);
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -26,19 +26,18 @@
 
 #pragma once
 
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
 namespace t {
-
-namespace geometry {
-class PointCloud;
-}
-
 namespace pipelines {
 namespace registration {
 class Feature;
@@ -77,6 +76,34 @@ public:
     int max_iteration_;
 };
 
+/// \class RANSACConvergenceCriteria
+///
+/// \brief Class that defines the convergence criteria of RANSAC.
+///
+/// RANSAC algorithm stops if the iteration number hits max_iteration_, or the
+/// number of iterations estimated from the confidence and the best inlier
+/// ratio so far has been reached.
+class RANSACConvergenceCriteria {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_iteration Maximum iteration before iteration stops.
+    /// \param confidence Desired probability of success. Used for estimating
+    /// early termination by k = log(1 - confidence)/log(1 -
+    /// inlier_ratio^{ransac_n}).
+    RANSACConvergenceCriteria(int max_iteration = 100000,
+                              double confidence = 0.999)
+        : max_iteration_(max_iteration), confidence_(confidence) {}
+
+    ~RANSACConvergenceCriteria() {}
+
+public:
+    /// Maximum iteration before iteration stops.
+    int max_iteration_;
+    /// Desired probability of success.
+    double confidence_;
+};
+
 /// \class RegistrationResult
 ///
 /// Class that contains the registration results.
@@ -108,9 +135,116 @@ public:
     double inlier_rmse_;
     /// For ICP: the overlapping area (# of inlier correspondences / # of points
     /// in target). Higher is better.
+    /// For RANSAC: inlier ratio (# of inlier correspondences / # of
+    /// all correspondences)
     double fitness_;
 };
 
+/// \class ICPIterationInfo
+///
+/// Class that contains the statistics of a single ICP iteration.
+class ICPIterationInfo {
+public:
+    /// Index of the scale in multi-scale ICP.
+    int64_t scale_index_ = 0;
+    /// Index of the iteration within the scale.
+    int iteration_index_ = 0;
+    /// Fitness of the correspondences of this iteration.
+    double fitness_ = 0.0;
+    /// Inlier RMSE of the correspondences of this iteration.
+    double inlier_rmse_ = 0.0;
+    /// Time for the correspondence search in milliseconds.
+    double correspondence_time_ms_ = 0.0;
+    /// Time for estimating and applying the transformation in milliseconds.
+    double estimation_time_ms_ = 0.0;
+};
+
+/// \class MultiScaleICPContext
+///
+/// \brief Multi-scale ICP with a cached target.
+///
+/// Keeps the voxel downsampled target of every scale together with its nearest
+/// neighbor search index, so that many sources can be registered to the same
+/// target without downsampling the target and rebuilding the indices on every
+/// call, e.g., for frame-to-map odometry. Attributes of the target, such as
+/// normals for point-to-plane ICP, are kept with the downsampled points.
+///
+/// The target can grow with AddTargetPoints(). The indices of the changed
+/// scales are rebuilt on the next call to RegisterICP().
+class MultiScaleICPContext {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud.
+    /// \param voxel_sizes Voxel sizes of the scales in strictly decreasing
+    /// order. Only the last value can be -1, which uses the target without
+    /// downsampling.
+    /// \param max_correspondence_distances Maximum correspondence points-pair
+    /// distance of each scale.
+    MultiScaleICPContext(
+            const geometry::PointCloud &target,
+            const std::vector<double> &voxel_sizes,
+            const std::vector<double> &max_correspondence_distances);
+
+    /// \brief Adds points to the target.
+    ///
+    /// Like in PointCloud::VoxelDownSample(), a scale keeps one point per
+    /// voxel, so only points in voxels that are not yet occupied are added.
+    /// The points must have the same attributes, dtype and device as the
+    /// target.
+    void AddTargetPoints(const geometry::PointCloud &points);
+
+    /// \brief Registers the source to the cached target with multi-scale ICP.
+    ///
+    /// \param source The source point cloud.
+    /// \param criteria_list Vector of ICPConvergenceCriteria objects for each
+    /// scale.
+    /// \param init_source_to_target Initial transformation estimation of type
+    /// Float64 on CPU.
+    /// \param estimation Estimation method.
+    RegistrationResult RegisterICP(
+            const geometry::PointCloud &source,
+            const std::vector<ICPConvergenceCriteria> &criteria_list,
+            const core::Tensor &init_source_to_target =
+                    core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+            const TransformationEstimation &estimation =
+                    TransformationEstimationPointToPoint());
+
+    /// Returns the number of scales.
+    int64_t GetNumScales() const { return int64_t(voxel_sizes_.size()); }
+
+    /// Returns the downsampled target of a scale.
+    const geometry::PointCloud &GetTarget(int64_t scale) const {
+        return target_pyramid_.at(scale);
+    }
+
+    /// Returns the statistics of all iterations of the last call to
+    /// RegisterICP().
+    const std::vector<ICPIterationInfo> &GetIterationInfo() const {
+        return iteration_info_;
+    }
+
+private:
+    /// Adds the points to a scale and returns the points that were added.
+    geometry::PointCloud AddTargetPointsToScale(
+            int64_t scale, const geometry::PointCloud &points);
+
+private:
+    std::vector<double> voxel_sizes_;
+    std::vector<double> max_correspondence_distances_;
+
+    std::vector<geometry::PointCloud> target_pyramid_;
+    /// Occupied voxels of each scale, nullptr for scales without
+    /// downsampling.
+    std::vector<std::shared_ptr<core::Hashmap>> voxel_hashmaps_;
+    /// Nearest neighbor search index of each scale, nullptr if the index has
+    /// to be rebuilt.
+    std::vector<std::shared_ptr<core::nns::NearestNeighborSearch>>
+            target_nns_;
+
+    std::vector<ICPIterationInfo> iteration_info_;
+};
+
 /// \brief Function for evaluating registration between point clouds.
 ///
 /// \param source The source point cloud.
@@ -178,6 +312,67 @@ RegistrationResult RegistrationMultiScaleICP(
         const TransformationEstimation &estimation =
                 TransformationEstimationPointToPoint());
 
+/// \brief Function for global RANSAC registration based on a given set of
+/// correspondences.
+///
+/// Hypotheses are generated and evaluated in parallel batches. The evaluation
+/// of a hypothesis stops as soon as it cannot beat the best hypothesis of the
+/// previous batches, and no more batches are run once the number of
+/// iterations required by the convergence criteria has been reached. Each
+/// sample holds distinct correspondences and is drawn from a random seed of
+/// the call and the iteration index, so the samples do not depend on the
+/// number of threads.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param correspondences Tensor of shape {K, 2} and dtype Int64, where each
+/// row holds a source index and the corresponding target index.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param ransac_n Fit ransac with `ransac_n` correspondences.
+/// \param similarity_threshold Rejects a sample before estimating its
+/// transformation if the lengths of the edges between the sampled source
+/// points and between the sampled target points are not similar, i.e., if
+/// ||edge_source|| <= similarity_threshold * ||edge_target|| or vice versa.
+/// Must be in [0, 1].
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationRANSACBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences,
+        double max_correspondence_distance,
+        int ransac_n = 3,
+        double similarity_threshold = 0.9,
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria());
+
+/// \brief Function for global RANSAC registration based on feature matching.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param source_features Source point cloud features of shape {N, D}, e.g.,
+/// from ComputeFPFHFeature().
+/// \param target_features Target point cloud features of shape {M, D}.
+/// \param mutual_filter Enables mutual filter such that the correspondence of
+/// the source point's correspondence is itself.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param ransac_n Fit ransac with `ransac_n` correspondences.
+/// \param similarity_threshold Edge length similarity threshold, see
+/// RegistrationRANSACBasedOnCorrespondence().
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        bool mutual_filter,
+        double max_correspondence_distance,
+        int ransac_n = 3,
+        double similarity_threshold = 0.9,
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria());
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
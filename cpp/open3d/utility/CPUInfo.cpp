@@ -51,6 +51,8 @@ namespace utility {
 struct CPUInfo::Impl {
     int num_cores_;
     int num_threads_;
+    bool supports_avx2_ = false;
+    bool supports_avx512_ = false;
 };
 
 /// Returns the number of physical CPU cores.
@@ -135,6 +137,16 @@ static int PhysicalConcurrency() {
 CPUInfo::CPUInfo() : impl_(new CPUInfo::Impl()) {
     impl_->num_cores_ = PhysicalConcurrency();
     impl_->num_threads_ = std::thread::hardware_concurrency();
+#if (defined(__GNUC__) || defined(__clang__)) && \
+        (defined(__x86_64__) || defined(__i386__))
+    // Also checks that the OS saves the AVX registers.
+    __builtin_cpu_init();
+    impl_->supports_avx2_ = __builtin_cpu_supports("avx2");
+    impl_->supports_avx512_ = __builtin_cpu_supports("avx512f") &&
+                              __builtin_cpu_supports("avx512bw") &&
+                              __builtin_cpu_supports("avx512dq") &&
+                              __builtin_cpu_supports("avx512vl");
+#endif
 }
 
 CPUInfo& CPUInfo::GetInstance() {
@@ -146,9 +158,14 @@ int CPUInfo::NumCores() const { return impl_->num_cores_; }
 
 int CPUInfo::NumThreads() const { return impl_->num_threads_; }
 
+bool CPUInfo::SupportsAVX2() const { return impl_->supports_avx2_; }
+
+bool CPUInfo::SupportsAVX512() const { return impl_->supports_avx512_; }
+
 void CPUInfo::Print() const {
-    utility::LogInfo("CPUInfo: {} cores, {} threads.", NumCores(),
-                     NumThreads());
+    utility::LogInfo("CPUInfo: {} cores, {} threads, AVX2: {}, AVX-512: {}.",
+                     NumCores(), NumThreads(), SupportsAVX2(),
+                     SupportsAVX512());
 }
 
 }  // namespace utility
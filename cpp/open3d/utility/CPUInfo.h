@@ -48,6 +48,13 @@ public:
     /// boost::thread::hardware_concurrency().
     int NumThreads() const;
 
+    /// Returns true if the CPU and the OS support AVX2 instructions.
+    bool SupportsAVX2() const;
+
+    /// Returns true if the CPU and the OS support the AVX-512 F, BW, DQ and VL
+    /// instructions.
+    bool SupportsAVX512() const;
+
     /// Prints CPUInfo in the console.
     void Print() const;
 
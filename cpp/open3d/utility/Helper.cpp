@@ -39,6 +39,8 @@
 #include <unistd.h>
 #endif  // _WIN32
 
+#include "open3d/utility/Logging.h"
+
 namespace open3d {
 namespace utility {
 
@@ -122,6 +124,28 @@ int UniformRandInt(const int min, const int max) {
     return distribution(generator);
 }
 
+std::vector<int64_t> UniformRandDistinctInts(int64_t n, int64_t population) {
+    if (n < 0 || n > population) {
+        LogError("Cannot draw {} distinct integers out of {}.", n,
+                 population);
+    }
+    static thread_local std::mt19937_64 generator(std::random_device{}());
+    std::vector<int64_t> sampled;
+    sampled.reserve(n);
+    std::unordered_set<int64_t> seen;
+    seen.reserve(n);
+    for (int64_t j = population - n; j < population; ++j) {
+        std::uniform_int_distribution<int64_t> distribution(0, j);
+        int64_t value = distribution(generator);
+        if (!seen.insert(value).second) {
+            value = j;
+            seen.insert(value);
+        }
+        sampled.push_back(value);
+    }
+    return sampled;
+}
+
 std::string GetCurrentTimeStamp() {
     std::time_t t = std::time(nullptr);
     return fmt::format("{:%Y-%m-%d-%H-%M-%S}", *std::localtime(&t));
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <string>
@@ -147,6 +148,12 @@ inline int DivUp(int x, int y) {
 /// (inclusive)
 int UniformRandInt(const int min, const int max);
 
+/// Thread-safe function returning \p n distinct pseudo-random integers in
+/// [0, \p population). Every subset of size \p n is equally likely. The
+/// integers are drawn with Floyd's algorithm, which needs exactly \p n draws
+/// and supports populations beyond the range of int.
+std::vector<int64_t> UniformRandDistinctInts(int64_t n, int64_t population);
+
 /// Uniformly distributed binary-friendly floating point number in [0, 1).
 ///
 /// Binary-friendly means that the random number can be represented by floating
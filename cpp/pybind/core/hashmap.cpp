@@ -40,6 +40,14 @@
 namespace open3d {
 namespace core {
 void pybind_core_hashmap(py::module& m) {
+    py::enum_<HashmapBackend>(m, "HashmapBackend",
+                              "Backend of the hashmap implementation.")
+            .value("Slab", HashmapBackend::Slab)
+            .value("StdGPU", HashmapBackend::StdGPU)
+            .value("TBB", HashmapBackend::TBB)
+            .value("Default", HashmapBackend::Default)
+            .export_values();
+
     py::class_<Hashmap> hashmap(
             m, "Hashmap",
             "A Hashmap is a map from key to data wrapped by Tensors.");
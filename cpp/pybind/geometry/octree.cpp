@@ -29,6 +29,7 @@
 #include <sstream>
 #include <unordered_map>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "pybind/docstring.h"
@@ -361,6 +362,112 @@ void pybind_octree(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "Octree", "create_from_voxel_grid",
             {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
+
+    // LinearOctreeNode
+    py::class_<LinearOctreeNode> linear_octree_node(
+            m, "LinearOctreeNode",
+            "A node of a LinearOctree, referring to the contiguous range of "
+            "leaves inside of it.");
+    py::detail::bind_default_constructor<LinearOctreeNode>(linear_octree_node);
+    linear_octree_node
+            .def(py::init<size_t, size_t>(), "leaf_begin"_a, "leaf_end"_a)
+            .def("__repr__",
+                 [](const LinearOctreeNode &node) {
+                     std::ostringstream repr;
+                     repr << "LinearOctreeNode with leaves ["
+                          << node.leaf_begin_ << ", " << node.leaf_end_ << ")";
+                     return repr.str();
+                 })
+            .def_readwrite("leaf_begin", &LinearOctreeNode::leaf_begin_,
+                           "int: Index of the first leaf inside the node.")
+            .def_readwrite("leaf_end", &LinearOctreeNode::leaf_end_,
+                           "int: One past the index of the last leaf inside "
+                           "the node.");
+    docstring::ClassMethodDocInject(m, "LinearOctreeNode", "__init__");
+
+    // LinearOctree
+    py::class_<LinearOctree, std::shared_ptr<LinearOctree>> linear_octree(
+            m, "LinearOctree",
+            "Pointer-free octree storing its occupied leaves in arrays sorted "
+            "by Morton code.");
+    py::detail::bind_default_constructor<LinearOctree>(linear_octree);
+    py::detail::bind_copy_functions<LinearOctree>(linear_octree);
+    linear_octree
+            .def(py::init([](size_t max_depth) {
+                     return new LinearOctree(max_depth);
+                 }),
+                 "max_depth"_a)
+            .def(py::init([](size_t max_depth, const Eigen::Vector3d &origin,
+                             double size) {
+                     return new LinearOctree(max_depth, origin, size);
+                 }),
+                 "max_depth"_a, "origin"_a, "size"_a)
+            .def("__repr__",
+                 [](const LinearOctree &octree) {
+                     std::ostringstream repr;
+                     repr << "LinearOctree with ";
+                     repr << "origin: [" << octree.origin_(0) << ", "
+                          << octree.origin_(1) << ", " << octree.origin_(2)
+                          << "]";
+                     repr << ", size: " << octree.size_;
+                     repr << ", max_depth: " << octree.max_depth_;
+                     repr << ", leaves: " << octree.leaf_codes_.size();
+                     return repr.str();
+                 })
+            .def("clear", &LinearOctree::Clear,
+                 "Clear all leaves, keeping the bounds and max depth.")
+            .def("is_empty", &LinearOctree::IsEmpty,
+                 "Returns True if the LinearOctree has no leaves.")
+            .def("traverse", &LinearOctree::Traverse, "f"_a,
+                 "DFS traversal of the octree from the root, with a "
+                 "callback function f being called for each node.")
+            .def("locate_leaf_node", &LinearOctree::LocateLeafNode, "point"_a,
+                 "Returns the index of the leaf where the query point should "
+                 "reside (-1 if not occupied) and its OctreeNodeInfo.")
+            .def("get_point_indices", &LinearOctree::GetPointIndices, "node"_a,
+                 "Returns the indices of the points inside the node.")
+            .def("convert_from_point_cloud",
+                 &LinearOctree::ConvertFromPointCloud, "point_cloud"_a,
+                 "size_expand"_a = 0.01, "Convert octree from point cloud.")
+            .def("to_voxel_grid", &LinearOctree::ToVoxelGrid,
+                 "Convert to VoxelGrid.")
+            .def("create_from_voxel_grid", &LinearOctree::CreateFromVoxelGrid,
+                 "voxel_grid"_a, "Convert from VoxelGrid.")
+            .def("to_octree", &LinearOctree::ToOctree,
+                 "Convert to the pointer-based Octree.")
+            .def_readwrite("origin", &LinearOctree::origin_,
+                           "(3, 1) float numpy array: Global min bound "
+                           "(include). A point is within bound iff origin <= "
+                           "point < origin + size.")
+            .def_readwrite("size", &LinearOctree::size_,
+                           "float: Outer bounding box edge size for the whole "
+                           "octree. A point is within bound iff origin <= "
+                           "point < origin + size.")
+            .def_readwrite("max_depth", &LinearOctree::max_depth_,
+                           "int: Maximum depth of the octree. All leaves are "
+                           "at this depth.")
+            .def_readonly("leaf_codes", &LinearOctree::leaf_codes_,
+                          "List of int: Morton codes of the occupied leaves, "
+                          "in increasing order.")
+            .def_readonly("leaf_colors", &LinearOctree::leaf_colors_,
+                          "``Vector3dVector``: Color of each leaf.")
+            .def_readonly("leaf_point_offsets",
+                          &LinearOctree::leaf_point_offsets_,
+                          "List of int: Points of leaf i are "
+                          "point_indices[leaf_point_offsets[i]: "
+                          "leaf_point_offsets[i + 1]].")
+            .def_readonly("point_indices", &LinearOctree::point_indices_,
+                          "List of int: Point indices grouped by leaf.");
+
+    docstring::ClassMethodDocInject(m, "LinearOctree", "__init__");
+    docstring::ClassMethodDocInject(m, "LinearOctree", "locate_leaf_node",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "convert_from_point_cloud",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(
+            m, "LinearOctree", "create_from_voxel_grid",
+            {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
 }
 
 void pybind_octree_methods(py::module &m) {}
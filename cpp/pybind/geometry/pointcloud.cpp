@@ -190,7 +190,15 @@ void pybind_pointcloud(py::module &m) {
             .def("segment_plane", &PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999, "preverification_n"_a = 0)
+            .def("segment_planes", &PointCloud::SegmentPlanes,
+                 "Segments multiple planes in the point cloud by running the "
+                 "RANSAC algorithm repeatedly on the remaining points.",
+                 "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                 "num_iterations"_a = 100, "max_num_planes"_a = 10,
+                 "min_num_inliers"_a = 100, "probability"_a = 0.99999999,
+                 "preverification_n"_a = 0)
             .def_static(
                     "create_from_depth_image",
                     &PointCloud::CreateFromDepthImage,
@@ -340,7 +348,30 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane. The "
+              "iterations stop early once it is reached."},
+             {"preverification_n",
+              "If positive, each hypothesis is first evaluated on a random "
+              "subset of this many points and discarded if it fits the subset "
+              "clearly worse than the best hypothesis so far."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations per plane."},
+             {"max_num_planes", "Maximum number of planes."},
+             {"min_num_inliers",
+              "The extraction stops when the next plane has less inliers."},
+             {"probability", "Expected probability of finding each plane."},
+             {"preverification_n",
+              "Size of the random subset hypotheses are first evaluated on. 0 "
+              "disables the preverification."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
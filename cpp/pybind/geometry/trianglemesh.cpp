@@ -272,6 +272,14 @@ void pybind_trianglemesh(py::module &m) {
                  "target_number_of_triangles"_a,
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
+            .def("simplify_quadric_decimation_parallel",
+                 &TriangleMesh::SimplifyQuadricDecimationParallel,
+                 "Function to simplify mesh using Quadric Error Metric "
+                 "Decimation by Garland and Heckbert, collapsing batches of "
+                 "independent edges in parallel",
+                 "target_number_of_triangles"_a,
+                 "maximum_error"_a = std::numeric_limits<double>::infinity(),
+                 "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
@@ -346,6 +354,14 @@ void pybind_trianglemesh(py::module &m) {
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
                     "pcd"_a, "radii"_a)
+            .def_static(
+                    "create_from_point_cloud_ball_pivoting_parallel",
+                    &TriangleMesh::CreateFromPointCloudBallPivotingParallel,
+                    "Parallel variant of "
+                    "create_from_point_cloud_ball_pivoting. The fronts are "
+                    "grown independently on the cells of a regular grid and "
+                    "stitched along the cell boundaries afterwards.",
+                    "pcd"_a, "radii"_a)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
                         "Function that computes a triangle mesh from a "
@@ -617,6 +633,16 @@ void pybind_trianglemesh(py::module &m) {
              {"boundary_weight",
               "A weight applied to edge vertices used to preserve "
               "boundaries"}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "simplify_quadric_decimation_parallel",
+            {{"target_number_of_triangles",
+              "The number of triangles that the simplified mesh should have. "
+              "It is not guaranteed that this number will be reached."},
+             {"maximum_error",
+              "The maximum error where a vertex is allowed to be merged"},
+             {"boundary_weight",
+              "A weight applied to edge vertices used to preserve "
+              "boundaries"}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -676,6 +702,14 @@ void pybind_trianglemesh(py::module &m) {
              {"radii",
               "The radii of the ball that are used for the surface "
               "reconstruction."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_ball_pivoting_parallel",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed. Has to contain normals."},
+             {"radii",
+              "The radii of the ball that are used for the surface "
+              "reconstruction."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
             {{"pcd",
@@ -27,6 +27,7 @@
 #include "open3d/pipelines/registration/Feature.h"
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/FeatureMatching.h"
 #include "pybind/docstring.h"
 #include "pybind/pipelines/registration/registration.h"
 
@@ -62,6 +63,46 @@ void pybind_feature(py::module &m) {
     docstring::ClassMethodDocInject(m, "Feature", "resize",
                                     {{"dim", "Feature dimension per point."},
                                      {"n", "Number of points."}});
+
+    // open3d.registration.FeatureMatchingMethod
+    py::enum_<FeatureMatchingMethod> feature_matching_method(
+            m, "FeatureMatchingMethod", py::arithmetic());
+    feature_matching_method.value("KDTree", FeatureMatchingMethod::KDTree)
+            .value("BruteForce", FeatureMatchingMethod::BruteForce)
+            .value("InvertedFile", FeatureMatchingMethod::InvertedFile)
+            .export_values();
+    feature_matching_method.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Nearest neighbor search method for feature matching.";
+            }),
+            py::none(), py::none(), "");
+
+    // open3d.registration.FeatureMatchingOption
+    py::class_<FeatureMatchingOption> matching_option(
+            m, "FeatureMatchingOption",
+            "Options of the nearest neighbor search used to match features.");
+    py::detail::bind_copy_functions<FeatureMatchingOption>(matching_option);
+    matching_option
+            .def(py::init<FeatureMatchingMethod, int, int>(),
+                 "method"_a = FeatureMatchingMethod::KDTree,
+                 "num_lists"_a = 0, "num_probes"_a = 16)
+            .def_readwrite("method", &FeatureMatchingOption::method_,
+                           "FeatureMatchingMethod: Nearest neighbor search "
+                           "method.")
+            .def_readwrite("num_lists", &FeatureMatchingOption::num_lists_,
+                           "int: Number of inverted lists of the "
+                           "``InvertedFile`` method. If 0, the square root "
+                           "of the number of features is used.")
+            .def_readwrite("num_probes", &FeatureMatchingOption::num_probes_,
+                           "int: Number of inverted lists scanned per query "
+                           "by the ``InvertedFile`` method.")
+            .def("__repr__", [](const FeatureMatchingOption &o) {
+                return fmt::format(
+                        "FeatureMatchingOption with method={}, "
+                        "num_lists={}, num_probes={}",
+                        static_cast<int>(o.method_), o.num_lists_,
+                        o.num_probes_);
+            });
 }
 
 void pybind_feature_methods(py::module &m) {
@@ -72,6 +113,20 @@ void pybind_feature_methods(py::module &m) {
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+
+    m.def("correspondences_from_features", &CorrespondencesFromFeatures,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to find nearest neighbor correspondences from features",
+          "source_features"_a, "target_features"_a, "mutual_filter"_a = false,
+          "option"_a = FeatureMatchingOption());
+    docstring::FunctionDocInject(
+            m, "correspondences_from_features",
+            {{"source_features", "The source features."},
+             {"target_features", "The target features."},
+             {"mutual_filter",
+              "Only keep the correspondences that are nearest neighbors in "
+              "both directions."},
+             {"option", "Options of the nearest neighbor search."}});
 }
 
 }  // namespace registration
@@ -505,6 +505,11 @@ must hold true for all edges.)");
             .def_readwrite("maximum_tuple_count",
                            &FastGlobalRegistrationOption::maximum_tuple_count_,
                            "float: Maximum tuple numbers.")
+            .def_readwrite(
+                    "feature_matching_option",
+                    &FastGlobalRegistrationOption::feature_matching_option_,
+                    "FeatureMatchingOption: Options of the nearest neighbor "
+                    "search used to match the features.")
             .def("__repr__", [](const FastGlobalRegistrationOption &c) {
                 return fmt::format(
                         ""
@@ -590,6 +595,9 @@ static const std::unordered_map<std::string, std::string>
                  "TransformationEstimationForColoredICP``)"},
                 {"init", "Initial transformation estimation"},
                 {"lambda_geometric", "lambda_geometric value"},
+                {"matching_option",
+                 "Options of the nearest neighbor search used to match the "
+                 "features."},
                 {"epsilon", "epsilon value"},
                 {"kernel", "Robust Kernel used in the Optimization"},
                 {"max_correspondence_distance",
@@ -670,7 +678,8 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 3,
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
-          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999));
+          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
+          "matching_option"_a = FeatureMatchingOption());
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
@@ -698,11 +707,13 @@ void pybind_registration_methods(py::module &m) {
 void pybind_registration(py::module &m) {
     py::module m_submodule =
             m.def_submodule("registration", "Registration pipeline.");
+    // Feature classes are bound first since the registration functions use
+    // FeatureMatchingOption as a default argument.
+    pybind_feature(m_submodule);
+    pybind_feature_methods(m_submodule);
     pybind_registration_classes(m_submodule);
     pybind_registration_methods(m_submodule);
 
-    pybind_feature(m_submodule);
-    pybind_feature_methods(m_submodule);
     pybind_global_optimization(m_submodule);
     pybind_global_optimization_methods(m_submodule);
     pybind_robust_kernels(m_submodule);
@@ -57,6 +57,7 @@ void pybind_geometry(py::module& m) {
     pybind_image(m_submodule);
     pybind_tsdf_voxelgrid(m_submodule);
     pybind_raycasting_scene(m_submodule);
+    pybind_voxelgrid(m_submodule);
 }
 
 }  // namespace geometry
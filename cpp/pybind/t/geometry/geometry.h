@@ -57,6 +57,7 @@ void pybind_trianglemesh(py::module& m);
 void pybind_image(py::module& m);
 void pybind_tsdf_voxelgrid(py::module& m);
 void pybind_raycasting_scene(py::module& m);
+void pybind_voxelgrid(py::module& m);
 
 }  // namespace geometry
 }  // namespace t
@@ -127,6 +127,56 @@ void pybind_pointcloud(py::module& m) {
             },
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
+    pointcloud.def("select_by_mask", &PointCloud::SelectByMask,
+                   "Select points by a boolean mask.", "boolean_mask"_a,
+                   "invert"_a = false);
+    pointcloud.def("estimate_covariances", &PointCloud::EstimateCovariances,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Computes the covariance matrix of the neighborhood of "
+                   "each point. A hybrid search is used if radius is set, "
+                   "otherwise a KNN search.",
+                   "max_nn"_a = 30, "radius"_a = py::none());
+    pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Computes the normals of the point cloud, oriented with "
+                   "respect to the existing normals, if any. A hybrid search "
+                   "is used if radius is set, otherwise a KNN search.",
+                   "max_nn"_a = 30, "radius"_a = py::none());
+    pointcloud.def("remove_statistical_outliers",
+                   &PointCloud::RemoveStatisticalOutliers,
+                   "Removes points that are further away from their "
+                   "neighbors in average. Returns the filtered point cloud "
+                   "and the boolean mask of the points that were kept.",
+                   "nb_neighbors"_a, "std_ratio"_a);
+    pointcloud.def("remove_radius_outliers", &PointCloud::RemoveRadiusOutliers,
+                   "Removes points that have less than nb_points neighbors "
+                   "in a sphere of a given radius. Returns the filtered point "
+                   "cloud and the boolean mask of the points that were kept.",
+                   "nb_points"_a, "search_radius"_a);
+    pointcloud.def("segment_plane", &PointCloud::SegmentPlane,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Segments a plane in the point cloud using the RANSAC "
+                   "algorithm. Returns the plane model ax + by + cz + d = 0 "
+                   "and the indices of the plane inliers.",
+                   "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                   "num_iterations"_a = 100, "probability"_a = 0.99999999,
+                   "preverification_n"_a = 0);
+    pointcloud.def("segment_planes", &PointCloud::SegmentPlanes,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Segments multiple planes in the point cloud by running "
+                   "the RANSAC algorithm repeatedly on the remaining points. "
+                   "Returns the plane models of shape (P, 4) and the plane "
+                   "label of each point, -1 for the points not on any plane.",
+                   "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                   "num_iterations"_a = 100, "max_num_planes"_a = 10,
+                   "min_num_inliers"_a = 100, "probability"_a = 0.99999999,
+                   "preverification_n"_a = 0);
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Clusters the point cloud using DBSCAN [Ester1996]. "
+                   "Returns an Int32 tensor with the cluster label of each "
+                   "point, -1 for noise.",
+                   "eps"_a, "min_points"_a);
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
             py::call_guard<py::gil_scoped_release>(), "depth"_a, "intrinsics"_a,
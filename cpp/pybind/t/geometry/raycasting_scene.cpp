@@ -105,6 +105,31 @@ Returns:
     The geometry ID of the added mesh.
 )doc");
 
+    raycasting_scene.def("set_geometry_transform",
+                         &RaycastingScene::SetGeometryTransform, "geom_id"_a,
+                         "transformation"_a, R"doc(
+Sets the transformation of a geometry.
+
+The transformation is applied to the vertices the geometry was added with,
+i.e., consecutive transformations do not accumulate. Only the acceleration
+structure of this geometry is refitted, which makes moving a few geometries in
+a large static scene cheap.
+
+Args:
+    geom_id (int): The geometry ID returned by add_triangles.
+    transformation (open3d.core.Tensor): The 4x4 transformation matrix.
+)doc");
+
+    raycasting_scene.def("remove_geometry", &RaycastingScene::RemoveGeometry,
+                         "geom_id"_a, R"doc(
+Removes a geometry from the scene.
+
+The IDs of removed geometries are not reused by add_triangles.
+
+Args:
+    geom_id (int): The geometry ID returned by add_triangles.
+)doc");
+
     raycasting_scene.def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
                          R"doc(
 Computes the first intersection of the rays with the scene.
@@ -118,6 +143,9 @@ Args:
         with [ox,oy,oz] as the origin and [dx,dy,dz] as the direction. It is
         not necessary to normalize the direction but the returned hit distance
         uses the length of the direction vector as unit.
+        Rays with shape {height, width, 6}, e.g. created with
+        create_rays_pinhole, are traced in coherent packets of neighbouring
+        rays.
 
 Returns:
     A dictionary which contains the following keys
@@ -205,14 +233,16 @@ Returns:
 
     raycasting_scene.def("compute_signed_distance",
                          &RaycastingScene::ComputeSignedDistance,
-                         "query_points"_a, R"doc(
+                         "query_points"_a, "use_winding_number"_a = false,
+                         R"doc(
 Computes the signed distance to the surface of the scene.
 
 This function computes the signed distance to the meshes in the scene.
 The function assumes that all meshes are watertight and that there are
 no intersections between meshes, i.e., inside and outside must be well
 defined. The function determines the sign of the distance by counting
-the intersections of a rays starting at the query points.
+the intersections of a rays starting at the query points, or with the
+generalized winding number if use_winding_number is True.
 
 Args:
     query_points (open3d.core.Tensor): A tensor with >=2 dims, shape {.., 3},
@@ -222,6 +252,11 @@ Args:
         {depth, height, width, 3}.
         The last dimension must be 3 and has the format [x, y, z].
 
+    use_winding_number (bool): If True, a point is inside if the winding
+        number of the surface at the point is larger than 0.5. This does not
+        cast rays and is more robust for meshes with small holes or
+        self-intersections.
+
 Returns:
     A tensor with the signed distances to the surface. The shape is {..}. 
     Negative distances mean a point is inside a closed surface.
@@ -229,14 +264,15 @@ Returns:
 
     raycasting_scene.def("compute_occupancy",
                          &RaycastingScene::ComputeOccupancy, "query_points"_a,
-                         R"doc(
+                         "use_winding_number"_a = false, R"doc(
 Computes the occupancy at the query point positions.
 
 This function computes whether the query points are inside or outside.
 The function assumes that all meshes are watertight and that there are
 no intersections between meshes, i.e., inside and outside must be well
 defined. The function determines if a point is inside by counting the
-intersections of a rays starting at the query points.
+intersections of a rays starting at the query points, or with the
+generalized winding number if use_winding_number is True.
 
 Args:
     query_points (open3d.core.Tensor): A tensor with >=2 dims, shape {.., 3},
@@ -246,6 +282,11 @@ Args:
         {depth, height, width, 3}.
         The last dimension must be 3 and has the format [x, y, z].
 
+    use_winding_number (bool): If True, a point is inside if the winding
+        number of the surface at the point is larger than 0.5. This does not
+        cast rays and is more robust for meshes with small holes or
+        self-intersections.
+
 Returns:
     A tensor with the occupancy values. The shape is {..}. Values are either 0
     or 1. A point is occupied or inside if the value is 1.
@@ -89,6 +89,38 @@ void pybind_trianglemesh(py::module& m) {
                       "Scale points.");
     triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
                       "Rotate points and normals (if exist).");
+    triangle_mesh.def("select_faces_by_mask",
+                      &TriangleMesh::SelectFacesByMask, "mask"_a,
+                      "Returns a new mesh with the triangles selected by a "
+                      "boolean mask, without the unreferenced vertices.");
+    triangle_mesh.def("compute_triangle_normals",
+                      &TriangleMesh::ComputeTriangleNormals,
+                      "Computes the triangle normals from the vertices.",
+                      "normalized"_a = true);
+    triangle_mesh.def("compute_vertex_normals",
+                      &TriangleMesh::ComputeVertexNormals,
+                      "Computes the vertex normals as the sum of the normals "
+                      "of the adjacent triangles, weighted by their areas.",
+                      "normalized"_a = true);
+    triangle_mesh.def("normalize_normals", &TriangleMesh::NormalizeNormals,
+                      "Normalizes the vertex and triangle normals to unit "
+                      "length.");
+    triangle_mesh.def("get_triangle_areas", &TriangleMesh::GetTriangleAreas,
+                      "Returns the area of each triangle.");
+    triangle_mesh.def("get_surface_area", &TriangleMesh::GetSurfaceArea,
+                      "Returns the surface area of the mesh.");
+    triangle_mesh.def("remove_duplicated_vertices",
+                      &TriangleMesh::RemoveDuplicatedVertices,
+                      "Removes the vertices with the same coordinates as an "
+                      "earlier vertex.");
+    triangle_mesh.def("remove_unreferenced_vertices",
+                      &TriangleMesh::RemoveUnreferencedVertices,
+                      "Removes the vertices not referenced by any triangle.");
+    triangle_mesh.def("merge_close_vertices",
+                      &TriangleMesh::MergeCloseVertices,
+                      "Merges the vertices closer than eps. The attributes of "
+                      "the merged vertices are averaged.",
+                      "eps"_a);
     triangle_mesh.def_static(
             "from_legacy_triangle_mesh", &TriangleMesh::FromLegacyTriangleMesh,
             "mesh_legacy"_a, "vertex_dtype"_a = core::Float32,
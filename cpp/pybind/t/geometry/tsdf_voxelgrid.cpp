@@ -103,6 +103,13 @@ void pybind_tsdf_voxelgrid(py::module& m) {
     tsdf_voxelgrid.def("cpu", &TSDFVoxelGrid::CPU);
     tsdf_voxelgrid.def("cuda", &TSDFVoxelGrid::CUDA, "device_id"_a);
 
+    tsdf_voxelgrid.def("save", &TSDFVoxelGrid::Save, "file_name"_a);
+    tsdf_voxelgrid.def("append", &TSDFVoxelGrid::Append, "file_name"_a,
+                       "block_coords"_a);
+    tsdf_voxelgrid.def_static("load", &TSDFVoxelGrid::Load, "file_name"_a,
+                              "device"_a = core::Device("CPU:0"),
+                              "backend"_a = core::HashmapBackend::Default);
+
     tsdf_voxelgrid.def("get_block_hashmap", &TSDFVoxelGrid::GetBlockHashmap);
     tsdf_voxelgrid.def("get_device", &TSDFVoxelGrid::GetDevice);
 }
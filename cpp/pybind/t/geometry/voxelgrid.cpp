@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include "pybind/docstring.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_voxelgrid(py::module& m) {
+    py::class_<VoxelGrid, PyGeometry<VoxelGrid>, std::shared_ptr<VoxelGrid>,
+               Geometry>
+            voxelgrid(m, "VoxelGrid",
+                      "A sparse voxel grid stored in a hash map from voxel "
+                      "indices to voxel colors.");
+
+    // Constructors.
+    voxelgrid.def(
+            py::init([](double voxel_size, const core::Tensor& origin,
+                        int64_t init_capacity, const core::Device& device) {
+                return VoxelGrid(voxel_size, origin, init_capacity, device);
+            }),
+            "voxel_size"_a = 1.0,
+            "origin"_a = core::Tensor::Zeros({3}, core::Float64),
+            "init_capacity"_a = 1000, "device"_a = core::Device("CPU:0"));
+
+    voxelgrid.def_property_readonly("voxel_size", &VoxelGrid::GetVoxelSize);
+    voxelgrid.def_property_readonly("origin", &VoxelGrid::GetOrigin);
+    voxelgrid.def_property_readonly("device", &VoxelGrid::GetDevice);
+    voxelgrid.def("__len__", &VoxelGrid::GetNumVoxels);
+
+    voxelgrid.def("get_voxel_indices", &VoxelGrid::GetVoxelIndices,
+                  "Returns the indices of all voxels as an Int32 tensor of "
+                  "shape (N, 3).");
+    voxelgrid.def("get_voxel_colors", &VoxelGrid::GetVoxelColors,
+                  "Returns the colors of all voxels as a Float32 tensor of "
+                  "shape (N, 3), in the order of get_voxel_indices.");
+    voxelgrid.def("add_voxels", &VoxelGrid::AddVoxels, "voxel_indices"_a,
+                  "colors"_a = core::Tensor(),
+                  "Add voxels, overwriting the colors of existing ones.");
+    voxelgrid.def("remove_voxels", &VoxelGrid::RemoveVoxels,
+                  "voxel_indices"_a, "Remove voxels.");
+    voxelgrid.def("get_voxel", &VoxelGrid::GetVoxel, "points"_a,
+                  "Returns the indices of the voxels containing the points.");
+    voxelgrid.def("check_if_included", &VoxelGrid::CheckIfIncluded,
+                  "points"_a,
+                  "Element-wise check if the points fall into a voxel of the "
+                  "grid.");
+    voxelgrid.def("carve_depth_map", &VoxelGrid::CarveDepthMap, "depth"_a,
+                  "intrinsics"_a, "extrinsics"_a, "depth_scale"_a = 1000.0f,
+                  "keep_voxels_outside_image"_a = false,
+                  "Remove all voxels where none of the corners projects to a "
+                  "depth value that is smaller than or equal to the depth of "
+                  "the corner.");
+    voxelgrid.def("carve_silhouette", &VoxelGrid::CarveSilhouette,
+                  "silhouette_mask"_a, "intrinsics"_a, "extrinsics"_a,
+                  "keep_voxels_outside_image"_a = false,
+                  "Remove all voxels where none of the corners projects to a "
+                  "mask pixel with a value larger than 0.");
+
+    voxelgrid.def("to", &VoxelGrid::To, "device"_a, "copy"_a = false);
+    voxelgrid.def("clone", &VoxelGrid::Clone);
+
+    voxelgrid.def_static(
+            "create_dense",
+            [](const core::Tensor& origin, const core::Tensor& color,
+               double voxel_size, double width, double height, double depth,
+               const core::Device& device) {
+                return VoxelGrid::CreateDense(origin, color, voxel_size, width,
+                                              height, depth, device);
+            },
+            "origin"_a, "color"_a, "voxel_size"_a, "width"_a, "height"_a,
+            "depth"_a, "device"_a = core::Device("CPU:0"),
+            "Create a grid where every voxel of the given extent is set.");
+    voxelgrid.def_static(
+            "create_from_point_cloud",
+            [](const PointCloud& pcd, double voxel_size) {
+                return VoxelGrid::CreateFromPointCloud(pcd, voxel_size);
+            },
+            py::call_guard<py::gil_scoped_release>(), "pcd"_a, "voxel_size"_a,
+            "Create a grid from the voxels occupied by the points, colored "
+            "with the average color of their points.");
+    voxelgrid.def_static(
+            "create_from_triangle_mesh",
+            [](const TriangleMesh& mesh, double voxel_size) {
+                return VoxelGrid::CreateFromTriangleMesh(mesh, voxel_size);
+            },
+            py::call_guard<py::gil_scoped_release>(), "mesh"_a, "voxel_size"_a,
+            "Create a grid from the voxels intersected by the triangles.");
+    voxelgrid.def_static(
+            "from_legacy_voxel_grid",
+            [](const open3d::geometry::VoxelGrid& voxel_grid_legacy,
+               const core::Device& device) {
+                return VoxelGrid::FromLegacyVoxelGrid(voxel_grid_legacy,
+                                                      device);
+            },
+            "voxel_grid_legacy"_a, "device"_a = core::Device("CPU:0"),
+            "Create a VoxelGrid from a legacy Open3D VoxelGrid.");
+    voxelgrid.def("to_legacy_voxel_grid", &VoxelGrid::ToLegacyVoxelGrid,
+                  "Convert to a legacy Open3D VoxelGrid.");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
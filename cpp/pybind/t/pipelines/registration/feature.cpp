@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "open3d/t/geometry/PointCloud.h"
+#include "pybind/docstring.h"
+#include "pybind/t/pipelines/registration/registration.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+void pybind_feature(py::module &m) {
+    m.def("compute_fpfh_feature", &ComputeFPFHFeature,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to compute FPFH feature for a point cloud. Returns a "
+          "Float32 tensor of shape {N, 33}.",
+          "input"_a, "radius"_a, "max_nn"_a = 100);
+    docstring::FunctionDocInject(
+            m, "compute_fpfh_feature",
+            {{"input",
+              "The input point cloud with normals, of dtype Float32 or "
+              "Float64."},
+             {"radius", "Radius of the neighborhood of a point."},
+             {"max_nn", "Maximum number of neighbors of a point."}});
+
+    m.def("correspondences_from_features", &CorrespondencesFromFeatures,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to find correspondences between two point clouds by "
+          "nearest neighbor matching of their features. Returns an Int64 "
+          "tensor of shape {K, 2}, where each row holds a source index and "
+          "the corresponding target index.",
+          "source_features"_a, "target_features"_a, "mutual_filter"_a = false);
+    docstring::FunctionDocInject(
+            m, "correspondences_from_features",
+            {{"source_features",
+              "Features of the source point cloud, shape {N, D}."},
+             {"target_features",
+              "Features of the target point cloud, shape {M, D}."},
+             {"mutual_filter",
+              "Keeps only the correspondences where the source point is also "
+              "the nearest neighbor of its corresponding target point."}});
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -63,6 +63,49 @@ public:
     }
 };
 
+// Registration functions have similar arguments, sharing arg
+// docstrings.
+static const std::unordered_map<std::string, std::string>
+        map_shared_argument_docstrings = {
+                {"correspondences",
+                 "Tensor of type Int64 containing indices of corresponding "
+                 "target points, where the value is the target index and the "
+                 "index of the value itself is the source index. It contains "
+                 "-1 as value at index with no correspondence."},
+                {"criteria", "Convergence criteria"},
+                {"criteria_list",
+                 "List of Convergence criteria for each scale of multi-scale "
+                 "icp."},
+                {"estimation_method",
+                 "Estimation method. One of "
+                 "(``TransformationEstimationPointToPoint``, "
+                 "``TransformationEstimationPointToPlane``)"},
+                {"init_source_to_target", "Initial transformation estimation"},
+                {"max_correspondence_distance",
+                 "Maximum correspondence points-pair distance."},
+                {"max_correspondence_distances",
+                 "o3d.utility.DoubleVector of maximum correspondence "
+                 "points-pair distances for multi-scale icp."},
+                {"mutual_filter",
+                 "Enables mutual filter such that the correspondence of the "
+                 "source point's correspondence is itself."},
+                {"option", "Registration option"},
+                {"ransac_n", "Fit ransac with ``ransac_n`` correspondences."},
+                {"similarity_threshold",
+                 "Rejects a sample if the lengths of the edges between the "
+                 "sampled source points and between the sampled target points "
+                 "are not similar. Must be in [0, 1]."},
+                {"source_features", "Source point cloud features."},
+                {"source", "The source point cloud."},
+                {"target", "The target point cloud."},
+                {"target_features", "Target point cloud features."},
+                {"transformation",
+                 "The 4x4 transformation matrix of type Float64 "
+                 "to transform ``source`` to ``target``"},
+                {"voxel_sizes",
+                 "o3d.utility.DoubleVector of voxel sizes in strictly "
+                 "decreasing order, for multi-scale icp."}};
+
 void pybind_registration_classes(py::module &m) {
     // open3d.t.pipelines.registration.ICPConvergenceCriteria
     py::class_<ICPConvergenceCriteria> convergence_criteria(
@@ -96,6 +139,30 @@ void pybind_registration_classes(py::module &m) {
                         c.max_iteration_);
             });
 
+    // open3d.t.pipelines.registration.RANSACConvergenceCriteria
+    py::class_<RANSACConvergenceCriteria> ransac_criteria(
+            m, "RANSACConvergenceCriteria",
+            "Convergence criteria of RANSAC. RANSAC algorithm stops if the "
+            "iteration number hits ``max_iteration``, or the number of "
+            "iterations estimated from ``confidence`` and the best inlier "
+            "ratio so far has been reached.");
+    py::detail::bind_copy_functions<RANSACConvergenceCriteria>(ransac_criteria);
+    ransac_criteria
+            .def(py::init<int, double>(), "max_iteration"_a = 100000,
+                 "confidence"_a = 0.999)
+            .def_readwrite("max_iteration",
+                           &RANSACConvergenceCriteria::max_iteration_,
+                           "Maximum iteration before iteration stops.")
+            .def_readwrite("confidence",
+                           &RANSACConvergenceCriteria::confidence_,
+                           "Desired probability of success.")
+            .def("__repr__", [](const RANSACConvergenceCriteria &c) {
+                return fmt::format(
+                        "RANSACConvergenceCriteria[max_iteration={:d}, "
+                        "confidence={:e}].",
+                        c.max_iteration_, c.confidence_);
+            });
+
     // open3d.t.pipelines.registration.RegistrationResult
     py::class_<RegistrationResult> registration_result(m, "RegistrationResult",
                                                        "Registration results.");
@@ -207,40 +274,81 @@ void pybind_registration_classes(py::module &m) {
                  [](const TransformationEstimationPointToPlane &te) {
                      return std::string("TransformationEstimationPointToPlane");
                  });
-}
 
-// Registration functions have similar arguments, sharing arg
-// docstrings.
-static const std::unordered_map<std::string, std::string>
-        map_shared_argument_docstrings = {
-                {"correspondences",
-                 "Tensor of type Int64 containing indices of corresponding "
-                 "target points, where the value is the target index and the "
-                 "index of the value itself is the source index. It contains "
-                 "-1 as value at index with no correspondence."},
-                {"criteria", "Convergence criteria"},
-                {"criteria_list",
-                 "List of Convergence criteria for each scale of multi-scale "
-                 "icp."},
-                {"estimation_method",
-                 "Estimation method. One of "
-                 "(``TransformationEstimationPointToPoint``, "
-                 "``TransformationEstimationPointToPlane``)"},
-                {"init_source_to_target", "Initial transformation estimation"},
-                {"max_correspondence_distance",
-                 "Maximum correspondence points-pair distance."},
-                {"max_correspondence_distances",
-                 "o3d.utility.DoubleVector of maximum correspondence "
-                 "points-pair distances for multi-scale icp."},
-                {"option", "Registration option"},
-                {"source", "The source point cloud."},
-                {"target", "The target point cloud."},
-                {"transformation",
-                 "The 4x4 transformation matrix of type Float64 "
-                 "to transform ``source`` to ``target``"},
-                {"voxel_sizes",
-                 "o3d.utility.DoubleVector of voxel sizes in strictly "
-                 "decreasing order, for multi-scale icp."}};
+    // open3d.t.pipelines.registration.ICPIterationInfo
+    py::class_<ICPIterationInfo> iteration_info(
+            m, "ICPIterationInfo", "Statistics of a single ICP iteration.");
+    py::detail::bind_default_constructor<ICPIterationInfo>(iteration_info);
+    py::detail::bind_copy_functions<ICPIterationInfo>(iteration_info);
+    iteration_info
+            .def_readwrite("scale_index", &ICPIterationInfo::scale_index_,
+                           "int: Index of the scale in multi-scale ICP.")
+            .def_readwrite("iteration_index",
+                           &ICPIterationInfo::iteration_index_,
+                           "int: Index of the iteration within the scale.")
+            .def_readwrite("fitness", &ICPIterationInfo::fitness_,
+                           "float: Fitness of the correspondences of this "
+                           "iteration.")
+            .def_readwrite("inlier_rmse", &ICPIterationInfo::inlier_rmse_,
+                           "float: Inlier RMSE of the correspondences of this "
+                           "iteration.")
+            .def_readwrite("correspondence_time_ms",
+                           &ICPIterationInfo::correspondence_time_ms_,
+                           "float: Time for the correspondence search in "
+                           "milliseconds.")
+            .def_readwrite("estimation_time_ms",
+                           &ICPIterationInfo::estimation_time_ms_,
+                           "float: Time for estimating and applying the "
+                           "transformation in milliseconds.")
+            .def("__repr__", [](const ICPIterationInfo &info) {
+                return fmt::format(
+                        "ICPIterationInfo[scale_index={:d}, "
+                        "iteration_index={:d}, fitness={:e}, "
+                        "inlier_rmse={:e}].",
+                        info.scale_index_, info.iteration_index_,
+                        info.fitness_, info.inlier_rmse_);
+            });
+
+    // open3d.t.pipelines.registration.MultiScaleICPContext
+    py::class_<MultiScaleICPContext> context(
+            m, "MultiScaleICPContext",
+            "Multi-scale ICP with a cached target. Keeps the downsampled "
+            "target of every scale together with its nearest neighbor search "
+            "index, so that many sources can be registered to the same "
+            "target, e.g., for frame-to-map odometry.");
+    py::detail::bind_copy_functions<MultiScaleICPContext>(context);
+    context.def(py::init<const geometry::PointCloud &,
+                         const std::vector<double> &,
+                         const std::vector<double> &>(),
+                "target"_a, "voxel_sizes"_a, "max_correspondence_distances"_a)
+            .def("add_target_points", &MultiScaleICPContext::AddTargetPoints,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Adds points to the target. A scale keeps one point per "
+                 "voxel, so only points in voxels that are not yet occupied "
+                 "are added.",
+                 "points"_a)
+            .def("register_icp", &MultiScaleICPContext::RegisterICP,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Registers the source to the cached target with multi-scale "
+                 "ICP.",
+                 "source"_a, "criteria_list"_a,
+                 "init_source_to_target"_a = core::Tensor::Eye(
+                         4, core::Float64, core::Device("CPU:0")),
+                 "estimation_method"_a =
+                         TransformationEstimationPointToPoint())
+            .def("get_num_scales", &MultiScaleICPContext::GetNumScales,
+                 "Returns the number of scales.")
+            .def("get_target", &MultiScaleICPContext::GetTarget,
+                 "Returns the downsampled target of a scale.", "scale"_a)
+            .def("get_iteration_info", &MultiScaleICPContext::GetIterationInfo,
+                 "Returns the statistics of all iterations of the last call "
+                 "to register_icp.");
+    docstring::ClassMethodDocInject(m, "MultiScaleICPContext", "__init__",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "MultiScaleICPContext",
+                                    "register_icp",
+                                    map_shared_argument_docstrings);
+}
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &EvaluateRegistration,
@@ -272,6 +380,35 @@ void pybind_registration_methods(py::module &m) {
           "estimation_method"_a = TransformationEstimationPointToPoint());
     docstring::FunctionDocInject(m, "registration_multi_scale_icp",
                                  map_shared_argument_docstrings);
+
+    m.def("registration_ransac_based_on_correspondence",
+          &RegistrationRANSACBasedOnCorrespondence,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for global RANSAC registration based on a set of "
+          "correspondences",
+          "source"_a, "target"_a, "correspondences"_a,
+          "max_correspondence_distance"_a, "ransac_n"_a = 3,
+          "similarity_threshold"_a = 0.9,
+          "criteria"_a = RANSACConvergenceCriteria());
+    auto ransac_docstrings = map_shared_argument_docstrings;
+    ransac_docstrings["correspondences"] =
+            "Tensor of type Int64 and shape {K, 2}, where each row holds a "
+            "source index and the corresponding target index.";
+    docstring::FunctionDocInject(m,
+                                 "registration_ransac_based_on_correspondence",
+                                 ransac_docstrings);
+
+    m.def("registration_ransac_based_on_feature_matching",
+          &RegistrationRANSACBasedOnFeatureMatching,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for global RANSAC registration based on feature matching",
+          "source"_a, "target"_a, "source_features"_a, "target_features"_a,
+          "mutual_filter"_a, "max_correspondence_distance"_a,
+          "ransac_n"_a = 3, "similarity_threshold"_a = 0.9,
+          "criteria"_a = RANSACConvergenceCriteria());
+    docstring::FunctionDocInject(
+            m, "registration_ransac_based_on_feature_matching",
+            map_shared_argument_docstrings);
 }
 
 void pybind_registration(py::module &m) {
@@ -279,6 +416,7 @@ void pybind_registration(py::module &m) {
             "registration", "Tensor-based registration pipeline.");
     pybind_registration_classes(m_submodule);
     pybind_registration_methods(m_submodule);
+    pybind_feature(m_submodule);
 
     pybind_robust_kernels(m_submodule);
 }
@@ -34,6 +34,7 @@ namespace pipelines {
 namespace registration {
 
 void pybind_registration(py::module &m);
+void pybind_feature(py::module &m);
 void pybind_robust_kernels(py::module &m);
 
 }  // namespace registration
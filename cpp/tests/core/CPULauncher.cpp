@@ -0,0 +1,218 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPULauncher.h"
+
+#include <atomic>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace launcher = core::kernel::cpu_launcher;
+
+class CPULauncherBackends
+    : public testing::TestWithParam<launcher::CPUBackend> {
+protected:
+    void SetUp() override {
+        prev_backend_ = launcher::GetCPUBackend();
+        launcher::SetCPUBackend(GetParam());
+    }
+    void TearDown() override { launcher::SetCPUBackend(prev_backend_); }
+
+private:
+    launcher::CPUBackend prev_backend_;
+};
+INSTANTIATE_TEST_SUITE_P(CPULauncher,
+                         CPULauncherBackends,
+                         testing::Values(launcher::CPUBackend::OpenMP,
+                                         launcher::CPUBackend::TBB));
+
+TEST_P(CPULauncherBackends, ParallelFor) {
+    EXPECT_EQ(launcher::GetCPUBackend(), GetParam());
+
+    const int64_t n = 100000;
+    std::vector<int> visits(n, 0);
+    launcher::ParallelFor(n, [&visits](int64_t idx) { visits[idx]++; });
+    EXPECT_EQ(visits, std::vector<int>(n, 1));
+
+    // Serial and parallel execution depending on the grain size.
+    for (int64_t grain_size : {int64_t(1), n, 2 * n}) {
+        std::vector<int> visits(n, 0);
+        launcher::ParallelFor(n, grain_size,
+                              [&visits](int64_t idx) { visits[idx]++; });
+        EXPECT_EQ(visits, std::vector<int>(n, 1));
+    }
+
+    // Empty ranges.
+    launcher::ParallelFor(0, [](int64_t) { FAIL(); });
+    launcher::ParallelFor(0, 10, [](int64_t) { FAIL(); });
+}
+
+TEST_P(CPULauncherBackends, ParallelForNested) {
+    const int64_t num_outer = 16;
+    const int64_t num_inner = 5000;
+    std::vector<int> visits(num_outer * num_inner, 0);
+    std::atomic<int64_t> num_visits(0);
+    launcher::ParallelFor(num_outer, [&](int64_t outer) {
+        launcher::ParallelFor(num_inner, [&](int64_t inner) {
+            visits[outer * num_inner + inner]++;
+            num_visits++;
+        });
+    });
+    EXPECT_EQ(num_visits.load(), num_outer * num_inner);
+    EXPECT_EQ(visits, std::vector<int>(num_outer * num_inner, 1));
+}
+
+class CPULauncherISAs : public testing::TestWithParam<launcher::CPUISA> {
+protected:
+    void SetUp() override { prev_isa_ = launcher::GetCPUISA(); }
+    void TearDown() override { launcher::SetCPUISA(prev_isa_); }
+
+    /// Returns the results of \p func with the instruction set of the test
+    /// and with the build ISA.
+    std::pair<core::Tensor, core::Tensor> Run(
+            const std::function<core::Tensor()>& func) {
+        launcher::SetCPUISA(GetParam());
+        core::Tensor result = func();
+        launcher::SetCPUISA(launcher::CPUISA::Default);
+        return std::make_pair(result, func());
+    }
+
+private:
+    launcher::CPUISA prev_isa_;
+};
+INSTANTIATE_TEST_SUITE_P(CPULauncher,
+                         CPULauncherISAs,
+                         testing::Values(launcher::CPUISA::Default,
+                                         launcher::CPUISA::AVX2,
+                                         launcher::CPUISA::AVX512));
+
+static std::vector<core::Dtype> ElementWiseDtypes() {
+    return {core::Bool,  core::UInt8, core::UInt16, core::UInt32,
+            core::UInt64, core::Int8, core::Int16,  core::Int32,
+            core::Int64, core::Float32, core::Float64};
+}
+
+// Odd length above the grain size, so that the workloads are split into
+// ranges with remainders.
+static const int64_t kElementWiseLength =
+        3 * launcher::SMALL_OP_GRAIN_SIZE + 5;
+
+/// Returns values in [1, 7] (1 for Bool), which keeps divisions and products
+/// well defined for every dtype. With \p step > 1, returns a strided slice.
+static core::Tensor MakeElementWiseValues(int64_t n,
+                                          core::Dtype dtype,
+                                          int64_t offset,
+                                          int64_t step = 1) {
+    std::vector<double> values(n * step);
+    for (int64_t i = 0; i < n * step; ++i) {
+        values[i] = dtype == core::Bool ? 1 : (i + offset) % 7 + 1;
+    }
+    core::Tensor t(values, {n * step}, core::Float64);
+    return t.To(dtype).Slice(0, 0, n * step, step);
+}
+
+TEST_P(CPULauncherISAs, BinaryEW) {
+    const int64_t n = kElementWiseLength;
+    for (const core::Dtype& dtype : ElementWiseDtypes()) {
+        const core::Tensor a = MakeElementWiseValues(n, dtype, 0);
+        const core::Tensor b = MakeElementWiseValues(n, dtype, 3);
+        const core::Tensor scalar =
+                MakeElementWiseValues(1, dtype, 5).Expand({n});
+        const core::Tensor strided = MakeElementWiseValues(n, dtype, 1, 2);
+        EXPECT_FALSE(strided.IsContiguous());
+
+        // Contiguous, broadcasted scalar on either side, strided.
+        const std::vector<std::pair<core::Tensor, core::Tensor>> operands{
+                {a, b}, {scalar, b}, {a, scalar}, {strided, b}, {a, strided}};
+        for (const auto& lr : operands) {
+            const core::Tensor& lhs = lr.first;
+            const core::Tensor& rhs = lr.second;
+            std::vector<std::function<core::Tensor()>> ops{
+                    [&]() { return lhs.Gt(rhs); },
+                    [&]() { return lhs.Eq(rhs); },
+                    [&]() { return lhs.LogicalAnd(rhs); },
+            };
+            if (dtype != core::Bool) {
+                ops.push_back([&]() { return lhs.Add(rhs); });
+                ops.push_back([&]() { return lhs.Sub(rhs); });
+                ops.push_back([&]() { return lhs.Mul(rhs); });
+                ops.push_back([&]() { return lhs.Div(rhs); });
+            }
+            for (const auto& op : ops) {
+                const auto results = Run(op);
+                EXPECT_EQ(results.first.GetDtype(), results.second.GetDtype());
+                EXPECT_TRUE(results.first.Eq(results.second).All());
+            }
+        }
+    }
+}
+
+TEST_P(CPULauncherISAs, UnaryEW) {
+    const int64_t n = kElementWiseLength;
+    for (const core::Dtype& dtype : ElementWiseDtypes()) {
+        // Contiguous, broadcasted scalar, strided.
+        const std::vector<core::Tensor> inputs{
+                MakeElementWiseValues(n, dtype, 0),
+                MakeElementWiseValues(1, dtype, 5).Expand({n}),
+                MakeElementWiseValues(n, dtype, 1, 2)};
+        for (const core::Tensor& src : inputs) {
+            std::vector<std::function<core::Tensor()>> ops{
+                    [&]() { return src.LogicalNot(); },
+                    [&]() { return src.To(core::Float64); },
+            };
+            if (dtype != core::Bool) {
+                ops.push_back([&]() { return src.Neg(); });
+                ops.push_back([&]() { return src.Abs(); });
+            }
+            if (dtype == core::Float32 || dtype == core::Float64) {
+                ops.push_back([&]() { return src.Sqrt(); });
+            }
+            for (const auto& op : ops) {
+                const auto results = Run(op);
+                EXPECT_EQ(results.first.GetDtype(), results.second.GetDtype());
+                EXPECT_TRUE(results.first.Eq(results.second).All());
+            }
+        }
+
+        // The broadcasted scalar fills the output with a single value.
+        const double value = dtype == core::Bool ? 1 : 6;
+        EXPECT_TRUE(inputs[1]
+                            .To(core::Float64)
+                            .Eq(core::Tensor::Full({n}, value, core::Float64))
+                            .All());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,7 +26,13 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "open3d/core/Device.h"
 #include "tests/UnitTest.h"
@@ -558,5 +564,119 @@ TEST(MemoryManagerPermuteDevices, CachedFreeOnProgramEnd) {
     // No cache release to test free on program end.
 }
 
+TEST(MemoryManagerPermuteDevices, CPUCachedAlignmentAndReuse) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager cached_mm;
+    core::CPUCachedMemoryManager::ReleaseCache();
+
+    for (size_t byte_size : {size_t(1), size_t(64), size_t(100), size_t(4097),
+                             size_t(3) << 20, size_t(100) << 20}) {
+        uint8_t* ptr =
+                static_cast<uint8_t*>(cached_mm.Malloc(byte_size, device));
+        EXPECT_NE(ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+        // The full requested range must be writable.
+        ptr[0] = 1;
+        ptr[byte_size - 1] = 1;
+        cached_mm.Free(ptr, device);
+
+        // Freed blocks are reused for allocations of the same size class.
+        void* reused_ptr = cached_mm.Malloc(byte_size, device);
+        if (byte_size < (size_t(16) << 20)) {
+            EXPECT_EQ(reused_ptr, ptr);
+        }
+        cached_mm.Free(reused_ptr, device);
+    }
+
+    EXPECT_EQ(cached_mm.Malloc(0, device), nullptr);
+    cached_mm.Free(nullptr, device);
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+}
+
+TEST(MemoryManagerPermuteDevices, CPUCachedMultiThreaded) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager cached_mm;
+
+    // Blocks allocated by one thread are freed by another one.
+    const int num_threads = 4;
+    const int num_blocks = 1000;
+    std::vector<std::vector<void*>> ptrs(num_threads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < num_blocks; ++i) {
+                const size_t byte_size = 8 + 37 * ((t * num_blocks + i) % 97);
+                uint8_t* ptr = static_cast<uint8_t*>(
+                        cached_mm.Malloc(byte_size, device));
+                std::fill(ptr, ptr + byte_size, uint8_t(t));
+                ptrs[t].push_back(ptr);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+
+    for (int t = 0; t < num_threads; ++t) {
+        for (int i = 0; i < num_blocks; ++i) {
+            EXPECT_EQ(static_cast<uint8_t*>(ptrs[t][i])[0], uint8_t(t));
+        }
+        threads.emplace_back([&, t]() {
+            for (void* ptr : ptrs[(t + 1) % num_threads]) {
+                cached_mm.Free(ptr, device);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+}
+
+TEST(MemoryManagerPermuteDevices, CPUCachedReleaseFromOtherThread) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager cached_mm;
+
+    // The worker fills its cache, the main thread releases all caches while
+    // the worker still holds live blocks and then the worker continues.
+    std::mutex mutex;
+    std::condition_variable cv;
+    int step = 0;
+    std::thread worker([&]() {
+        std::vector<void*> cached;
+        for (int i = 0; i < 100; ++i) {
+            cached.push_back(cached_mm.Malloc(1000, device));
+        }
+        uint8_t* live = static_cast<uint8_t*>(cached_mm.Malloc(1000, device));
+        std::fill(live, live + 1000, uint8_t(7));
+        for (void* ptr : cached) {
+            cached_mm.Free(ptr, device);
+        }
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            step = 1;
+            cv.notify_all();
+            cv.wait(lock, [&]() { return step == 2; });
+        }
+        void* ptr = cached_mm.Malloc(1000, device);
+        EXPECT_EQ(live[999], uint8_t(7));
+        cached_mm.Free(ptr, device);
+        cached_mm.Free(live, device);
+    });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return step == 1; });
+        core::CPUCachedMemoryManager::ReleaseCache();
+        step = 2;
+        cv.notify_all();
+    }
+    worker.join();
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+}
+
 }  // namespace tests
 }  // namespace open3d
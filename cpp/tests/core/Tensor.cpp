@@ -33,6 +33,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -1310,6 +1311,64 @@ TEST_P(TensorPermuteDevices, AdvancedIndexing_IsIndexSplittedBySlice) {
             {idx, slice, slice, idx}));
 }
 
+TEST_P(TensorPermuteDevices, IndexGetRows) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, device);
+    core::Tensor labels = core::Tensor::Init<int32_t>({0, 1, 2, 3}, device);
+    // Non-contiguous source.
+    core::Tensor colors =
+            core::Tensor::Init<uint8_t>({{0, 1, 2, 3}, {4, 5, 6, 7}}, device)
+                    .T();
+    core::Tensor indices = core::Tensor::Init<int64_t>({3, 0, 0}, device);
+
+    std::vector<core::Tensor> srcs = {points, labels, colors};
+    std::vector<core::Tensor> dsts;
+    core::kernel::IndexGetRows(srcs, indices, dsts);
+    ASSERT_EQ(dsts.size(), srcs.size());
+    for (size_t i = 0; i < srcs.size(); ++i) {
+        EXPECT_TRUE(dsts[i].AllClose(srcs[i].IndexGet({indices})));
+    }
+
+    // Empty indices.
+    core::kernel::IndexGetRows({points, labels},
+                               core::Tensor::Empty({0}, core::Int64, device),
+                               dsts);
+    EXPECT_EQ(dsts[0].GetShape(), core::SizeVector({0, 3}));
+    EXPECT_EQ(dsts[1].GetShape(), core::SizeVector({0}));
+
+    // Length mismatch and out-of-range indices.
+    EXPECT_ANY_THROW(core::kernel::IndexGetRows({points, labels[0]}, indices,
+                                                dsts));
+    EXPECT_ANY_THROW(core::kernel::IndexGetRows(
+            {points}, core::Tensor::Init<int64_t>({4}, device), dsts));
+    EXPECT_ANY_THROW(core::kernel::IndexGetRows(
+            {points}, core::Tensor::Init<int64_t>({-1}, device), dsts));
+}
+
+TEST_P(TensorPermuteDevices, IndexSetRows) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}},
+                                                    device);
+    core::Tensor labels = core::Tensor::Init<int32_t>({7, 8}, device);
+    core::Tensor indices = core::Tensor::Init<int64_t>({2, 0}, device);
+    std::vector<core::Tensor> dsts = {
+            core::Tensor::Zeros({3, 3}, core::Float32, device),
+            core::Tensor::Zeros({3}, core::Int32, device)};
+
+    core::kernel::IndexSetRows({points, labels}, indices, dsts);
+    EXPECT_EQ(dsts[0].ToFlatVector<float>(),
+              std::vector<float>({3, 4, 5, 0, 0, 0, 0, 1, 2}));
+    EXPECT_EQ(dsts[1].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({8, 0, 7}));
+
+    // Row shape mismatch.
+    EXPECT_ANY_THROW(core::kernel::IndexSetRows({points, points}, indices,
+                                                dsts));
+}
+
 TEST_P(TensorPermuteDevices, Add) {
     core::Device device = GetParam();
     core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
@@ -1767,6 +1826,90 @@ TEST_P(TensorPermuteDevices, ReduceSumLargeArray) {
     }
 }
 
+TEST_P(TensorPermuteDevices, ReduceSumFloatAccuracy) {
+    core::Device device = GetParam();
+
+    // Adding 0.1f sequentially to a float accumulator stalls at 2^21.
+    int64_t num_elements = (1LL << 24) + 3;
+    core::Tensor src =
+            core::Tensor::Full({num_elements}, 0.1f, core::Float32, device);
+    double ref_sum = 0.1 * num_elements;
+    EXPECT_NEAR(src.Sum({0}).Item<float>(), ref_sum, ref_sum * 1e-4);
+
+    // Reduction over the slow axis.
+    src = core::Tensor::Full({num_elements / 4, 3}, 0.1f, core::Float32,
+                             device);
+    ref_sum = 0.1 * (num_elements / 4);
+    for (float sum : src.Sum({0}).ToFlatVector<float>()) {
+        EXPECT_NEAR(sum, ref_sum, ref_sum * 1e-4);
+    }
+}
+
+TEST_P(TensorPermuteDevices, ReduceStridedLayouts) {
+    core::Device device = GetParam();
+
+    core::SizeVector shape{4, 5, 6};
+    std::vector<int64_t> vals(shape.NumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = (i * 7919) % 97;
+    }
+    core::Tensor base(vals, shape, core::Int64, device);
+
+    std::vector<core::Tensor> srcs = {base, base.Permute({2, 0, 1}),
+                                      base.Slice(2, 1, 6, 2),
+                                      base.Slice(0, 0, 4, 3).Transpose(0, 2)};
+    std::vector<core::SizeVector> dims_list = {{0},    {1},    {2},
+                                               {0, 1}, {0, 2}, {1, 2},
+                                               {0, 1, 2}};
+    for (const core::Tensor& src : srcs) {
+        // Reference computed on the contiguous values in row-major order.
+        core::SizeVector src_shape = src.GetShape();
+        std::vector<int64_t> src_vals = src.ToFlatVector<int64_t>();
+        for (const core::SizeVector& dims : dims_list) {
+            core::SizeVector dst_shape = src_shape;
+            for (int64_t dim : dims) {
+                dst_shape[dim] = 1;
+            }
+            std::vector<int64_t> ref_sum(dst_shape.NumElements(), 0);
+            std::vector<int64_t> ref_max(dst_shape.NumElements(),
+                                         std::numeric_limits<int64_t>::min());
+            std::vector<int64_t> ref_argmin(dst_shape.NumElements(), 0);
+            std::vector<int64_t> ref_min(dst_shape.NumElements(),
+                                         std::numeric_limits<int64_t>::max());
+            for (int64_t i = 0; i < src_shape[0]; ++i) {
+                for (int64_t j = 0; j < src_shape[1]; ++j) {
+                    for (int64_t k = 0; k < src_shape[2]; ++k) {
+                        int64_t idx[3] = {i, j, k};
+                        for (int64_t dim : dims) {
+                            idx[dim] = 0;
+                        }
+                        int64_t dst_idx =
+                                (idx[0] * dst_shape[1] + idx[1]) *
+                                        dst_shape[2] +
+                                idx[2];
+                        int64_t val = src_vals[(i * src_shape[1] + j) *
+                                                       src_shape[2] +
+                                               k];
+                        ref_sum[dst_idx] += val;
+                        ref_max[dst_idx] = std::max(ref_max[dst_idx], val);
+                        if (dims.size() == 1 && val < ref_min[dst_idx]) {
+                            ref_min[dst_idx] = val;
+                            ref_argmin[dst_idx] = (i + j + k) -
+                                                  (idx[0] + idx[1] + idx[2]);
+                        }
+                    }
+                }
+            }
+            EXPECT_EQ(src.Sum(dims, true).ToFlatVector<int64_t>(), ref_sum);
+            EXPECT_EQ(src.Max(dims, true).ToFlatVector<int64_t>(), ref_max);
+            if (dims.size() == 1) {
+                EXPECT_EQ(src.ArgMin(dims).ToFlatVector<int64_t>(),
+                          ref_argmin);
+            }
+        }
+    }
+}
+
 TEST_P(TensorPermuteDevices, ReduceProd) {
     core::Device device = GetParam();
     core::Tensor src = core::Tensor::Init<float>({{{22.f, 23.f, 20.f, 9.f},
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <memory>
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static geometry::PointCloud CreateRandomPointCloud(size_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -2, -3), Eigen::Vector3d(3, 2, 1), 0);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    return pcd;
+}
+
+TEST(LinearOctree, ConstructorWithSize) {
+    geometry::LinearOctree octree(3, Eigen::Vector3d(-1, -1, -1), 2);
+    ExpectEQ(octree.origin_, Eigen::Vector3d(-1, -1, -1));
+    EXPECT_EQ(octree.size_, 2);
+    EXPECT_EQ(octree.max_depth_, 3);
+    EXPECT_TRUE(octree.IsEmpty());
+}
+
+TEST(LinearOctree, EightCubes) {
+    geometry::PointCloud pcd;
+    for (size_t i = 0; i < 8; ++i) {
+        Eigen::Vector3d offset(double(i % 2), double((i / 2) % 2),
+                               double(i / 4));
+        pcd.points_.push_back(Eigen::Vector3d(0.5, 0.5, 0.5) + offset);
+        pcd.colors_.push_back(offset * 0.1);
+    }
+    geometry::LinearOctree octree(1);
+    octree.ConvertFromPointCloud(pcd, 0.5);
+    ExpectEQ(octree.origin_, Eigen::Vector3d(0.5, 0.5, 0.5));
+    EXPECT_EQ(octree.size_, 1.5);
+    ASSERT_EQ(octree.leaf_codes_.size(), 8);
+    for (size_t i = 0; i < 8; ++i) {
+        // The leaf code of a depth 1 octree is the child index.
+        EXPECT_EQ(octree.leaf_codes_[i], i);
+        ExpectEQ(octree.leaf_colors_[i], pcd.colors_[i]);
+        EXPECT_EQ(octree.GetPointIndices(geometry::LinearOctreeNode(i, i + 1)),
+                  std::vector<size_t>({i}));
+    }
+}
+
+TEST(LinearOctree, ConvertFromPointCloudMatchesOctree) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(2000);
+    for (size_t max_depth : {0, 1, 4, 7}) {
+        geometry::LinearOctree linear_octree(max_depth);
+        linear_octree.ConvertFromPointCloud(pcd, 0.01);
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(pcd, 0.01);
+
+        EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+        EXPECT_EQ(linear_octree.point_indices_.size(), pcd.points_.size());
+        EXPECT_EQ(linear_octree.leaf_point_offsets_.size(),
+                  linear_octree.leaf_codes_.size() + 1);
+        EXPECT_TRUE(std::is_sorted(linear_octree.leaf_codes_.begin(),
+                                   linear_octree.leaf_codes_.end()));
+    }
+}
+
+TEST(LinearOctree, Traverse) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(500);
+    geometry::LinearOctree linear_octree(5);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::Octree octree(5);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+
+    std::vector<geometry::OctreeNodeInfo> node_infos;
+    std::vector<size_t> num_node_points;
+    octree.Traverse(
+            [&](const std::shared_ptr<geometry::OctreeNode>& node,
+                const std::shared_ptr<geometry::OctreeNodeInfo>& node_info) {
+                node_infos.push_back(*node_info);
+                if (auto internal_node = std::dynamic_pointer_cast<
+                            geometry::OctreeInternalPointNode>(node)) {
+                    num_node_points.push_back(internal_node->indices_.size());
+                } else if (auto leaf_node = std::dynamic_pointer_cast<
+                                   geometry::OctreePointColorLeafNode>(node)) {
+                    num_node_points.push_back(leaf_node->indices_.size());
+                }
+                return false;
+            });
+
+    size_t num_nodes = 0;
+    linear_octree.Traverse([&](const geometry::LinearOctreeNode& node,
+                               const geometry::OctreeNodeInfo& node_info) {
+        EXPECT_LT(num_nodes, node_infos.size());
+        if (num_nodes < node_infos.size()) {
+            const geometry::OctreeNodeInfo& expected = node_infos[num_nodes];
+            ExpectEQ(node_info.origin_, expected.origin_);
+            EXPECT_EQ(node_info.size_, expected.size_);
+            EXPECT_EQ(node_info.depth_, expected.depth_);
+            EXPECT_EQ(node_info.child_index_, expected.child_index_);
+            EXPECT_EQ(linear_octree.GetPointIndices(node).size(),
+                      num_node_points[num_nodes]);
+        }
+        num_nodes++;
+        return false;
+    });
+    EXPECT_EQ(num_nodes, node_infos.size());
+
+    // Early stopping at depth 2.
+    num_nodes = 0;
+    linear_octree.Traverse([&](const geometry::LinearOctreeNode& node,
+                               const geometry::OctreeNodeInfo& node_info) {
+        EXPECT_LE(node_info.depth_, 2);
+        num_nodes++;
+        return node_info.depth_ == 2;
+    });
+    EXPECT_LT(num_nodes, node_infos.size());
+}
+
+TEST(LinearOctree, LocateLeafNode) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(500);
+    geometry::LinearOctree linear_octree(6);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::Octree octree(6);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+
+    for (size_t idx = 0; idx < pcd.points_.size(); ++idx) {
+        int64_t leaf;
+        geometry::OctreeNodeInfo leaf_info;
+        std::tie(leaf, leaf_info) =
+                linear_octree.LocateLeafNode(pcd.points_[idx]);
+        ASSERT_GE(leaf, 0);
+        std::vector<size_t> indices = linear_octree.GetPointIndices(
+                geometry::LinearOctreeNode(leaf, leaf + 1));
+        EXPECT_NE(std::find(indices.begin(), indices.end(), idx),
+                  indices.end());
+
+        auto expected = octree.LocateLeafNode(pcd.points_[idx]);
+        ExpectEQ(leaf_info.origin_, expected.second->origin_);
+        EXPECT_EQ(leaf_info.size_, expected.second->size_);
+        EXPECT_EQ(leaf_info.depth_, expected.second->depth_);
+        EXPECT_EQ(leaf_info.child_index_, expected.second->child_index_);
+    }
+
+    // Out of bound.
+    EXPECT_EQ(linear_octree.LocateLeafNode(Eigen::Vector3d(10, 10, 10)).first,
+              -1);
+}
+
+TEST(LinearOctree, VoxelGrid) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(500);
+    geometry::LinearOctree linear_octree(4);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    std::shared_ptr<geometry::VoxelGrid> voxel_grid =
+            linear_octree.ToVoxelGrid();
+    ExpectEQ(voxel_grid->origin_, linear_octree.origin_);
+    EXPECT_DOUBLE_EQ(voxel_grid->voxel_size_, linear_octree.size_ / 16);
+    EXPECT_EQ(voxel_grid->voxels_.size(), linear_octree.leaf_codes_.size());
+    for (const Eigen::Vector3d& point : pcd.points_) {
+        EXPECT_EQ(voxel_grid->voxels_.count(voxel_grid->GetVoxel(point)), 1);
+    }
+
+    geometry::LinearOctree linear_octree_from_voxels(4);
+    linear_octree_from_voxels.CreateFromVoxelGrid(*voxel_grid);
+    geometry::Octree octree_from_voxels(4);
+    octree_from_voxels.CreateFromVoxelGrid(*voxel_grid);
+    EXPECT_TRUE(*linear_octree_from_voxels.ToOctree() == octree_from_voxels);
+    EXPECT_TRUE(linear_octree_from_voxels.point_indices_.empty());
+}
+
+TEST(LinearOctree, MaxDepthTooLarge) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(10);
+    geometry::LinearOctree octree(
+            geometry::LinearOctree::MAX_SUPPORTED_DEPTH + 1);
+    EXPECT_ANY_THROW(octree.ConvertFromPointCloud(pcd));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -38,6 +38,7 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
+#include "tests/geometry/PointCloudTools.h"
 
 namespace open3d {
 namespace tests {
@@ -1229,6 +1230,41 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+TEST(PointCloud, SegmentPlaneAdaptive) {
+    geometry::PointCloud pcd(pointcloud_tools::MakeThreePlanes());
+
+    for (int preverification_n : {0, 200}) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) =
+                pcd.SegmentPlane(0.01, 3, 10000, 0.9999, preverification_n);
+        EXPECT_EQ(inliers.size(), 1200u);
+        ExpectEQ(Eigen::Vector4d(plane_model.cwiseAbs()),
+                 Eigen::Vector4d(0, 0, 1, 0));
+    }
+}
+
+TEST(PointCloud, SegmentPlanes) {
+    geometry::PointCloud pcd(pointcloud_tools::MakeThreePlanes());
+
+    std::vector<Eigen::Vector4d> plane_models;
+    std::vector<std::vector<size_t>> inliers;
+    std::tie(plane_models, inliers) = pcd.SegmentPlanes(0.01, 3, 1000, 10, 50);
+    ASSERT_EQ(plane_models.size(), 3u);
+    ExpectEQ(Eigen::Vector4d(plane_models[0].cwiseAbs()),
+             Eigen::Vector4d(0, 0, 1, 0));
+    ExpectEQ(Eigen::Vector4d(plane_models[1].cwiseAbs()),
+             Eigen::Vector4d(1, 0, 0, 0));
+    ExpectEQ(Eigen::Vector4d(plane_models[2].cwiseAbs()),
+             Eigen::Vector4d(0, 1, 0, 2));
+    EXPECT_EQ(inliers[0].size(), 1200u);
+    EXPECT_EQ(inliers[1].size(), 900u);
+    EXPECT_EQ(inliers[2].size(), 400u);
+    EXPECT_EQ(inliers[0].front(), 0u);
+    EXPECT_EQ(inliers[1].front(), 1200u);
+    EXPECT_EQ(inliers[2].back(), 2499u);
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     const std::string trajectory_path =
             std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log";
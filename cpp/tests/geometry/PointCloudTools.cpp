@@ -0,0 +1,57 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "tests/geometry/PointCloudTools.h"
+
+namespace open3d {
+namespace tests {
+
+std::vector<Eigen::Vector3d> pointcloud_tools::MakeThreePlanes() {
+    std::vector<Eigen::Vector3d> points;
+    for (int i = 0; i < 40; i++) {
+        for (int j = 0; j < 30; j++) {
+            points.emplace_back(0.5 + 0.04 * i, 0.05 * j, 0.0);
+        }
+    }
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            points.emplace_back(0.0, 0.05 * i, 0.5 + 0.05 * j);
+        }
+    }
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            points.emplace_back(0.5 + 0.05 * i, 2.0, 0.5 + 0.05 * j);
+        }
+    }
+    for (int i = 0; i < 100; i++) {
+        points.emplace_back(0.33 + 0.11 * (i % 5), 0.37 + 0.13 * (i / 5 % 5),
+                            0.31 + 0.17 * (i / 25));
+    }
+    return points;
+}
+
+}  // namespace tests
+}  // namespace open3d
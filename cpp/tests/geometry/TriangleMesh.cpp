@@ -839,6 +839,49 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2, 1e-4);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimationParallel) {
+    auto MaxDistanceToSphere = [](const geometry::TriangleMesh& mesh) {
+        double max_dist = 0;
+        for (const Eigen::Vector3d& vertex : mesh.vertices_) {
+            max_dist = std::max(max_dist, std::abs(vertex.norm() - 1));
+        }
+        return max_dist;
+    };
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    auto serial = sphere->SimplifyQuadricDecimation(
+            500, std::numeric_limits<double>::infinity(), 1.0);
+    auto parallel = sphere->SimplifyQuadricDecimationParallel(
+            500, std::numeric_limits<double>::infinity(), 1.0);
+    EXPECT_LE(parallel->triangles_.size(), 500u);
+    EXPECT_GE(parallel->triangles_.size(), 490u);
+    EXPECT_TRUE(parallel->IsEdgeManifold());
+    EXPECT_TRUE(parallel->IsWatertight());
+    EXPECT_LT(MaxDistanceToSphere(*parallel),
+              1.5 * MaxDistanceToSphere(*serial));
+
+    // A planar grid collapses without error while keeping its boundary.
+    geometry::TriangleMesh grid;
+    const int size = 20;
+    for (int y = 0; y <= size; ++y) {
+        for (int x = 0; x <= size; ++x) {
+            grid.vertices_.push_back(Eigen::Vector3d(x, y, 0));
+        }
+    }
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            int v = y * (size + 1) + x;
+            grid.triangles_.push_back(Eigen::Vector3i(v, v + 1, v + size + 2));
+            grid.triangles_.push_back(
+                    Eigen::Vector3i(v, v + size + 2, v + size + 1));
+        }
+    }
+    auto simplified = grid.SimplifyQuadricDecimationParallel(2, 1e-8, 1.0);
+    EXPECT_EQ(simplified->triangles_.size(), 2u);
+    ExpectEQ(simplified->GetMinBound(), Eigen::Vector3d(0, 0, 0));
+    ExpectEQ(simplified->GetMaxBound(), Eigen::Vector3d(size, size, 0));
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1915,6 +1958,51 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivotingParallel) {
+    // Evenly spread points on the unit sphere, spanning 8 cells of the grid.
+    geometry::PointCloud pcd;
+    const int n = 2000;
+    for (int i = 0; i < n; ++i) {
+        double z = 1 - (2 * i + 1) / double(n);
+        double r = std::sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - std::sqrt(5));
+        pcd.points_.emplace_back(r * std::cos(phi), r * std::sin(phi), z);
+    }
+    pcd.normals_ = pcd.points_;
+    const std::vector<double> radii = {0.05, 0.1};
+
+    auto mesh_serial =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(pcd,
+                                                                     radii);
+    auto mesh =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivotingParallel(
+                    pcd, radii);
+    EXPECT_EQ(mesh->vertices_.size(), pcd.points_.size());
+    EXPECT_EQ(mesh->triangle_normals_.size(), mesh->triangles_.size());
+    EXPECT_EQ(mesh->triangles_.size(), mesh_serial->triangles_.size());
+    EXPECT_TRUE(mesh->IsWatertight());
+    EXPECT_TRUE(mesh->IsOrientable());
+    EXPECT_NEAR(mesh->GetSurfaceArea(), 4 * M_PI, 0.05);
+
+    // The triangles across the cells, i.e. octants, are stitched.
+    int num_seam_triangles = 0;
+    for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+        const Eigen::Vector3d& p0 = mesh->vertices_[triangle(0)];
+        for (int i = 1; i < 3; ++i) {
+            const Eigen::Vector3d& p = mesh->vertices_[triangle(i)];
+            if (((p0.array() < 0) != (p.array() < 0)).any()) {
+                ++num_seam_triangles;
+                break;
+            }
+        }
+    }
+    EXPECT_GT(num_seam_triangles, 0);
+
+    EXPECT_ANY_THROW(
+            geometry::TriangleMesh::CreateFromPointCloudBallPivotingParallel(
+                    pcd, {0.1, -1}));
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
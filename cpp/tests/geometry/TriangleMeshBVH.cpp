@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <algorithm>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TriangleMeshBVH, QueryAABB) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::TriangleMeshBVH bvh(*mesh, 2);
+    EXPECT_FALSE(bvh.IsEmpty());
+    EXPECT_EQ(bvh.GetTriangleIndices().size(), mesh->triangles_.size());
+
+    // Root node bounds the whole mesh.
+    const auto &root = bvh.GetNodes()[0];
+    ExpectEQ(root.min_bound_, mesh->GetMinBound());
+    ExpectEQ(root.max_bound_, mesh->GetMaxBound());
+
+    const Eigen::Vector3d min_bound(0.2, -0.3, 0.5);
+    const Eigen::Vector3d max_bound(0.9, 0.4, 1.0);
+    std::vector<int> result = bvh.QueryAABB(min_bound, max_bound);
+    std::sort(result.begin(), result.end());
+
+    std::vector<int> expected;
+    for (int tidx = 0; tidx < int(mesh->triangles_.size()); ++tidx) {
+        if (geometry::IntersectionTest::AABBAABB(
+                    bvh.GetTriangleMinBound(tidx),
+                    bvh.GetTriangleMaxBound(tidx), min_bound, max_bound)) {
+            expected.push_back(tidx);
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(result, expected);
+}
+
+TEST(TriangleMeshBVH, Empty) {
+    geometry::TriangleMesh mesh;
+    geometry::TriangleMeshBVH bvh(mesh);
+    EXPECT_TRUE(bvh.IsEmpty());
+    EXPECT_TRUE(bvh.QueryAABB(Eigen::Vector3d(-1, -1, -1),
+                              Eigen::Vector3d(1, 1, 1))
+                        .empty());
+    EXPECT_TRUE(bvh.GetSelfIntersectingTriangles().empty());
+    EXPECT_FALSE(mesh.IsSelfIntersecting());
+}
+
+TEST(TriangleMeshBVH, GetSelfIntersectingTriangles) {
+    // Two overlapping spheres, each without self-intersections.
+    auto mesh0 = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    auto mesh1 = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    mesh1->Translate(Eigen::Vector3d(0.5, 0.1, 0.2));
+    geometry::TriangleMesh mesh = *mesh0 + *mesh1;
+
+    std::vector<Eigen::Vector2i> expected;
+    for (size_t tidx0 = 0; tidx0 < mesh.triangles_.size(); ++tidx0) {
+        const Eigen::Vector3i &p = mesh.triangles_[tidx0];
+        for (size_t tidx1 = tidx0 + 1; tidx1 < mesh.triangles_.size();
+             ++tidx1) {
+            const Eigen::Vector3i &q = mesh.triangles_[tidx1];
+            bool share_vertex = false;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    share_vertex |= p(i) == q(j);
+                }
+            }
+            if (!share_vertex &&
+                geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh.vertices_[p(0)], mesh.vertices_[p(1)],
+                        mesh.vertices_[p(2)], mesh.vertices_[q(0)],
+                        mesh.vertices_[q(1)], mesh.vertices_[q(2)])) {
+                expected.push_back(Eigen::Vector2i(tidx0, tidx1));
+            }
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    ExpectEQ(mesh.GetSelfIntersectingTriangles(), expected);
+    EXPECT_TRUE(mesh.IsSelfIntersecting());
+    EXPECT_TRUE(mesh0->IsIntersecting(*mesh1));
+
+    mesh1->Translate(Eigen::Vector3d(3, 0, 0));
+    EXPECT_FALSE(mesh0->IsIntersecting(*mesh1));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <unordered_set>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -33,6 +42,86 @@ TEST(ScalableTSDFVolume, DISABLED_VolumeUnit) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Constructor) { NotImplemented(); }
 
+TEST(ScalableTSDFVolume, SyntheticData) {
+    const int width = 160;
+    const int height = 120;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 130.0, 130.0,
+                                             79.5, 59.5);
+    pipelines::integration::ScalableTSDFVolume tsdf_volume(
+            4.0 / 128, 0.1, pipelines::integration::TSDFVolumeColorType::RGB8);
+
+    // A wavy surface with a depth discontinuity, seen from three poses.
+    for (int i = 0; i < 3; ++i) {
+        geometry::RGBDImage rgbd;
+        rgbd.depth_.Prepare(width, height, 1, 4);
+        rgbd.color_.Prepare(width, height, 3, 1);
+        for (int v = 0; v < height; ++v) {
+            for (int u = 0; u < width; ++u) {
+                *rgbd.depth_.PointerAt<float>(u, v) = float(
+                        1.2 + 0.3 * std::sin(u / 15.0 + i * 0.1) *
+                                        std::cos(v / 11.0) +
+                        (u > 120 ? 0.8 : 0.0));
+                uint8_t* color = rgbd.color_.PointerAt<uint8_t>(u, v, 0);
+                color[0] = uint8_t(u);
+                color[1] = uint8_t(v);
+                color[2] = uint8_t(u + v + i * 30);
+            }
+        }
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        extrinsic(0, 3) = 0.01 * i;
+        extrinsic(1, 3) = -0.005 * i;
+        tsdf_volume.Integrate(rgbd, intrinsic, extrinsic);
+    }
+    EXPECT_EQ(tsdf_volume.volume_units_.size(), 61u);
+
+    // Vertices on the faces of the volume units are shared between units, so
+    // every vertex must be unique after extraction.
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            tsdf_volume.ExtractTriangleMesh();
+    EXPECT_EQ(mesh->vertices_.size(), 6639u);
+    EXPECT_EQ(mesh->triangles_.size(), 12260u);
+    EXPECT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    std::unordered_set<Eigen::Vector3d, utility::hash_eigen<Eigen::Vector3d>>
+            unique_vertices(mesh->vertices_.begin(), mesh->vertices_.end());
+    EXPECT_EQ(unique_vertices.size(), mesh->vertices_.size());
+    Eigen::Vector3d vertex_sum(0, 0, 0);
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        vertex_sum += vertex;
+    }
+    ExpectEQ(vertex_sum, Eigen::Vector3d(1786.944251, 5.170266, 10211.224540),
+             /*threshold*/ 0.1);
+    Eigen::Vector3d color_sum(0, 0, 0);
+    for (const Eigen::Vector3d& color : mesh->vertex_colors_) {
+        color_sum += color;
+    }
+    ExpectEQ(color_sum, Eigen::Vector3d(2428.880025, 1537.278087, 3840.275737),
+             /*threshold*/ 0.1);
+    EXPECT_TRUE(mesh->IsEdgeManifold());
+
+    // The extraction result must not depend on the thread scheduling.
+    std::shared_ptr<geometry::TriangleMesh> mesh2 =
+            tsdf_volume.ExtractTriangleMesh();
+    EXPECT_EQ(mesh2->vertices_, mesh->vertices_);
+    EXPECT_EQ(mesh2->triangles_, mesh->triangles_);
+
+    std::shared_ptr<geometry::PointCloud> pcd = tsdf_volume.ExtractPointCloud();
+    EXPECT_EQ(pcd->points_.size(), 6583u);
+    EXPECT_EQ(pcd->colors_.size(), pcd->points_.size());
+    EXPECT_EQ(pcd->normals_.size(), pcd->points_.size());
+    color_sum << 0, 0, 0;
+    for (const Eigen::Vector3d& color : pcd->colors_) {
+        color_sum += color;
+    }
+    ExpectEQ(color_sum, Eigen::Vector3d(2399.616039, 1527.011752, 3802.970492),
+             /*threshold*/ 0.1);
+    Eigen::Vector3d normal_sum(0, 0, 0);
+    for (const Eigen::Vector3d& normal : pcd->normals_) {
+        normal_sum += normal;
+    }
+    ExpectEQ(normal_sum, Eigen::Vector3d(251.189667, -140.128877, -3897.708584),
+             /*threshold*/ 0.1);
+}
+
 TEST(ScalableTSDFVolume, DISABLED_Destructor) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_MemberData) { NotImplemented(); }
@@ -0,0 +1,186 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/FeatureMatching.h"
+
+#include <random>
+
+#include "open3d/pipelines/registration/Feature.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Features drawn around a few random centers, as FPFH features of a scene
+// are clustered.
+static pipelines::registration::Feature ClusteredFeatures(int dim,
+                                                          int num,
+                                                          int num_clusters,
+                                                          unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> center_dist(0.0, 100.0);
+    std::normal_distribution<double> noise(0.0, 5.0);
+    Eigen::MatrixXd centers(dim, num_clusters);
+    for (int c = 0; c < num_clusters; c++) {
+        for (int d = 0; d < dim; d++) {
+            centers(d, c) = center_dist(rng);
+        }
+    }
+    pipelines::registration::Feature feature;
+    feature.Resize(dim, num);
+    for (int i = 0; i < num; i++) {
+        for (int d = 0; d < dim; d++) {
+            feature.data_(d, i) = centers(d, i % num_clusters) + noise(rng);
+        }
+    }
+    return feature;
+}
+
+TEST(FeatureMatching, BruteForceMatchesKDTree) {
+    using namespace pipelines::registration;
+    const Feature target = ClusteredFeatures(33, 3000, 20, 0);
+    const Feature query = ClusteredFeatures(33, 500, 20, 1);
+
+    const std::vector<int> kdtree_matches =
+            FeatureMatcher(target,
+                           FeatureMatchingOption(FeatureMatchingMethod::KDTree))
+                    .Match(query);
+    const std::vector<int> brute_force_matches =
+            FeatureMatcher(target, FeatureMatchingOption(
+                                           FeatureMatchingMethod::BruteForce))
+                    .Match(query);
+    ExpectEQ(kdtree_matches, brute_force_matches);
+}
+
+TEST(FeatureMatching, InvertedFileAllProbesIsExact) {
+    using namespace pipelines::registration;
+    const Feature target = ClusteredFeatures(33, 3000, 20, 2);
+    const Feature query = ClusteredFeatures(33, 500, 20, 3);
+
+    const std::vector<int> exact_matches =
+            FeatureMatcher(target, FeatureMatchingOption(
+                                           FeatureMatchingMethod::BruteForce))
+                    .Match(query);
+    const std::vector<int> ivf_matches =
+            FeatureMatcher(target,
+                           FeatureMatchingOption(
+                                   FeatureMatchingMethod::InvertedFile, 32, 32))
+                    .Match(query);
+    ExpectEQ(exact_matches, ivf_matches);
+}
+
+TEST(FeatureMatching, InvertedFileRecall) {
+    using namespace pipelines::registration;
+    const Feature target = ClusteredFeatures(33, 10000, 50, 4);
+    const Feature query = ClusteredFeatures(33, 1000, 50, 5);
+
+    const std::vector<int> exact_matches =
+            FeatureMatcher(target, FeatureMatchingOption(
+                                           FeatureMatchingMethod::BruteForce))
+                    .Match(query);
+    const std::vector<int> ivf_matches =
+            FeatureMatcher(target, FeatureMatchingOption(
+                                           FeatureMatchingMethod::InvertedFile))
+                    .Match(query);
+    int num_correct = 0;
+    for (size_t i = 0; i < exact_matches.size(); i++) {
+        num_correct += exact_matches[i] == ivf_matches[i];
+    }
+    EXPECT_GE(num_correct, 0.9 * exact_matches.size());
+}
+
+TEST(FeatureMatching, InvertedFileDuplicatedFeatures) {
+    using namespace pipelines::registration;
+    // Three distinct features repeated, as in flat regions of a scene, leave
+    // most of the clusters empty.
+    const Feature distinct = ClusteredFeatures(33, 3, 3, 7);
+    Feature target;
+    target.Resize(33, 3000);
+    for (int i = 0; i < 3000; i++) {
+        target.data_.col(i) = distinct.data_.col(i % 3);
+    }
+    const Feature query = ClusteredFeatures(33, 300, 3, 8);
+
+    const FeatureMatchingOption option(FeatureMatchingMethod::InvertedFile, 32,
+                                       1);
+    const std::vector<int> matches =
+            FeatureMatcher(target, option).Match(query);
+    const std::vector<int> exact_matches =
+            FeatureMatcher(target, FeatureMatchingOption(
+                                           FeatureMatchingMethod::BruteForce))
+                    .Match(query);
+    ASSERT_EQ(matches.size(), exact_matches.size());
+    for (size_t i = 0; i < matches.size(); i++) {
+        ASSERT_GE(matches[i], 0);
+        ASSERT_LT(matches[i], 3000);
+        EXPECT_EQ(matches[i] % 3, exact_matches[i] % 3);
+    }
+
+    const CorrespondenceSet corres =
+            CorrespondencesFromFeatures(query, target, true, option);
+    for (const Eigen::Vector2i &c : corres) {
+        EXPECT_GE(c(1), 0);
+    }
+}
+
+TEST(FeatureMatching, CorrespondencesFromFeatures) {
+    using namespace pipelines::registration;
+    for (const FeatureMatchingMethod method :
+         {FeatureMatchingMethod::KDTree, FeatureMatchingMethod::BruteForce}) {
+        const FeatureMatchingOption option(method);
+        // The target is a permutation of the first 200 source features. The
+        // extra source feature 200 is close to source feature 5, so they share
+        // their nearest target feature but only feature 5 is a mutual match.
+        Feature source = ClusteredFeatures(33, 201, 10, 6);
+        source.data_.col(200) = source.data_.col(5);
+        source.data_(0, 200) += 1e-3;
+        Feature target;
+        target.Resize(33, 200);
+        for (int i = 0; i < 200; i++) {
+            target.data_.col(i) = source.data_.col(199 - i);
+        }
+
+        const CorrespondenceSet corres =
+                CorrespondencesFromFeatures(source, target, false, option);
+        ASSERT_EQ(corres.size(), 201u);
+        for (int i = 0; i < 200; i++) {
+            EXPECT_EQ(corres[i](0), i);
+            EXPECT_EQ(corres[i](1), 199 - i);
+        }
+        EXPECT_EQ(corres[200](0), 200);
+        EXPECT_EQ(corres[200](1), 194);
+
+        const CorrespondenceSet mutual_corres =
+                CorrespondencesFromFeatures(source, target, true, option);
+        ASSERT_EQ(mutual_corres.size(), 200u);
+        for (int i = 0; i < 200; i++) {
+            EXPECT_EQ(mutual_corres[i], corres[i]);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
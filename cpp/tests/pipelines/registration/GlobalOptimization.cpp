@@ -24,17 +24,105 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
+// Ring of poses connected by odometry edges and by uncertain loop closures
+// that skip one node. All edges agree with the ground truth poses; the
+// optimization starts from perturbed node poses.
+static std::tuple<pipelines::registration::PoseGraph,
+                  std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>>
+CreatePerturbedPoseGraph(int n_nodes) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses_gt;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d pose_vector;
+        pose_vector << 0.01 * i, -0.02 * i, 0.03 * i, 0.5 * i, 0.1 * i,
+                -0.2 * i;
+        poses_gt.push_back(utility::TransformVector6dToMatrix4d(pose_vector));
+    }
+
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d noise;
+        noise << 0.02, -0.01, 0.01, 0.05, -0.05, 0.02;
+        Eigen::Matrix4d pose =
+                i == 0 ? poses_gt[i]
+                       : utility::TransformVector6dToMatrix4d(noise * (i % 3)) *
+                                 poses_gt[i];
+        pose_graph.nodes_.emplace_back(pose);
+    }
+    for (int i = 0; i < n_nodes; i++) {
+        for (int step = 1; step <= 2; step++) {
+            int j = (i + step) % n_nodes;
+            Eigen::Matrix4d transformation =
+                    poses_gt[j].inverse() * poses_gt[i];
+            pose_graph.edges_.emplace_back(i, j, transformation,
+                                           Eigen::Matrix6d::Identity(),
+                                           /*uncertain=*/step > 1);
+        }
+    }
+    return std::make_tuple(pose_graph, poses_gt);
+}
+
+static void ExpectPosesEQ(
+        const pipelines::registration::PoseGraph &pose_graph,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &poses_gt) {
+    ASSERT_EQ(pose_graph.nodes_.size(), poses_gt.size());
+    for (size_t i = 0; i < poses_gt.size(); i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses_gt[i],
+                 1e-4);
+    }
+}
+
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    pipelines::registration::PoseGraph pose_graph;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses_gt;
+    std::tie(pose_graph, poses_gt) = CreatePerturbedPoseGraph(20);
+
+    pipelines::registration::GlobalOptimizationOption option(
+            /*max_correspondence_distance=*/0.075,
+            /*edge_prune_threshold=*/0.25,
+            /*preference_loop_closure=*/1.0,
+            /*reference_node=*/0);
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationGaussNewton(),
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            option);
+    ExpectPosesEQ(pose_graph, poses_gt);
+}
+
 TEST(GlobalOptimization, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    NotImplemented();
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    pipelines::registration::PoseGraph pose_graph;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses_gt;
+    std::tie(pose_graph, poses_gt) = CreatePerturbedPoseGraph(20);
+
+    pipelines::registration::GlobalOptimizationOption option(
+            /*max_correspondence_distance=*/0.075,
+            /*edge_prune_threshold=*/0.25,
+            /*preference_loop_closure=*/1.0,
+            /*reference_node=*/0);
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationLevenbergMarquardt(),
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            option);
+    ExpectPosesEQ(pose_graph, poses_gt);
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -28,11 +28,15 @@
 
 #include <gmock/gmock.h>
 
+#include <random>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/io/PointCloudIO.h"
 #include "tests/UnitTest.h"
+#include "tests/geometry/PointCloudTools.h"
 
 namespace open3d {
 namespace tests {
@@ -644,5 +648,226 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+// Points on the unit sphere, spread with the golden angle, followed by
+// num_outliers points far from the sphere.
+static std::vector<Eigen::Vector3d> CreateSpherePoints(int num_points,
+                                                       int num_outliers) {
+    std::vector<Eigen::Vector3d> points;
+    const double golden_angle = M_PI * (3 - std::sqrt(5.));
+    for (int i = 0; i < num_points; ++i) {
+        double z = 1 - 2 * (i + .5) / num_points;
+        double r = std::sqrt(1 - z * z);
+        points.emplace_back(r * std::cos(golden_angle * i),
+                            r * std::sin(golden_angle * i), z);
+    }
+    for (int i = 0; i < num_outliers; ++i) {
+        points.emplace_back(3. + i, -2. - .5 * i, 4. + .25 * i);
+    }
+    return points;
+}
+
+TEST_P(PointCloudPermuteDevices, SelectByMask) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}}, device));
+    pcd.SetPointAttr("labels",
+                     core::Tensor::Init<int64_t>({0, 1, 2, 3}, device));
+    core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, false, true}, device);
+
+    t::geometry::PointCloud selected = pcd.SelectByMask(mask);
+    EXPECT_TRUE(selected.GetPoints().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {3, 3, 3}}, device)));
+    EXPECT_TRUE(selected.GetPointAttr("labels").AllClose(
+            core::Tensor::Init<int64_t>({0, 3}, device)));
+
+    t::geometry::PointCloud inverted = pcd.SelectByMask(mask, true);
+    EXPECT_TRUE(inverted.GetPointAttr("labels").AllClose(
+            core::Tensor::Init<int64_t>({1, 2}, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, EstimateNormals) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy(CreateSpherePoints(2000, 0));
+    for (core::Dtype dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::FromLegacyPointCloud(
+                        pcd_legacy, dtype, device);
+        pcd.EstimateNormals(30, 0.2);
+        EXPECT_EQ(pcd.GetPointAttr("covariances").GetShape(),
+                  core::SizeVector({2000, 3, 3}));
+
+        // The points are their own (unoriented) normals.
+        core::Tensor normals = pcd.GetPointNormals().To(core::Float64);
+        core::Tensor dots = (normals * pcd.GetPoints().To(core::Float64))
+                                    .Sum({1})
+                                    .Abs();
+        EXPECT_TRUE(dots.AllClose(
+                core::Tensor::Ones({2000}, core::Float64, device), 1e-3,
+                1e-3));
+
+        // Existing normals orient the estimated ones.
+        pcd.RemovePointAttr("covariances");
+        pcd.SetPointNormals(pcd.GetPoints().Neg());
+        pcd.EstimateNormals(30, 0.2);
+        dots = (pcd.GetPointNormals() * pcd.GetPoints()).Sum({1});
+        EXPECT_TRUE(dots.Lt(0).All());
+    }
+}
+
+TEST(PointCloud, EstimateCovariancesAndNormalsKNN) {
+    geometry::PointCloud pcd_legacy(CreateSpherePoints(1000, 0));
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloud(pcd_legacy,
+                                                          core::Float64);
+    pcd_legacy.EstimateCovariances(geometry::KDTreeSearchParamKNN(20));
+    pcd.EstimateCovariances(20);
+    core::Tensor covariances_legacy({1000, 3, 3}, core::Float64);
+    for (int64_t i = 0; i < 1000; ++i) {
+        covariances_legacy[i] = core::eigen_converter::EigenMatrixToTensor(
+                pcd_legacy.covariances_[i]);
+    }
+    EXPECT_TRUE(pcd.GetPointAttr("covariances")
+                        .AllClose(covariances_legacy, 1e-6, 1e-10));
+
+    pcd_legacy.EstimateNormals(geometry::KDTreeSearchParamKNN(20));
+    pcd.EstimateNormals(20);
+    core::Tensor normals_legacy =
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    pcd_legacy.normals_, core::Float64, core::Device("CPU:0"));
+    core::Tensor dots = (pcd.GetPointNormals() * normals_legacy).Sum({1});
+    EXPECT_TRUE(dots.Abs().AllClose(core::Tensor::Ones({1000}, core::Float64),
+                                    1e-6, 1e-6));
+}
+
+TEST(PointCloud, RemoveStatisticalOutliers) {
+    geometry::PointCloud pcd_legacy(CreateSpherePoints(1000, 5));
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloud(pcd_legacy);
+
+    std::vector<size_t> indices_legacy;
+    std::tie(std::ignore, indices_legacy) =
+            pcd_legacy.RemoveStatisticalOutliers(20, 2.0);
+
+    t::geometry::PointCloud pcd_inliers;
+    core::Tensor mask;
+    std::tie(pcd_inliers, mask) = pcd.RemoveStatisticalOutliers(20, 2.0);
+    std::vector<int64_t> indices(indices_legacy.begin(),
+                                 indices_legacy.end());
+    EXPECT_EQ(mask.NonZero().Reshape({-1}).ToFlatVector<int64_t>(), indices);
+    EXPECT_EQ(pcd_inliers.GetPoints().GetLength(),
+              static_cast<int64_t>(indices.size()));
+    EXPECT_FALSE(mask.Slice(0, 1000, 1005).Any());
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{1.0, 1.0, 1.0},
+                                                           {1.1, 1.0, 1.0},
+                                                           {1.0, 1.1, 1.0},
+                                                           {1.0, 1.0, 1.1},
+                                                           {5.0, 5.0, 5.0},
+                                                           {5.1, 5.0, 5.0}},
+                                                          device));
+    pcd.SetPointColors(core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                                  {0.1, 0.1, 0.1},
+                                                  {0.2, 0.2, 0.2},
+                                                  {0.3, 0.3, 0.3},
+                                                  {0.4, 0.4, 0.4},
+                                                  {0.5, 0.5, 0.5}},
+                                                 device));
+
+    t::geometry::PointCloud pcd_inliers;
+    core::Tensor mask;
+    std::tie(pcd_inliers, mask) = pcd.RemoveRadiusOutliers(2, 0.3);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true, true, false, false}));
+    EXPECT_TRUE(pcd_inliers.GetPointColors().AllClose(
+            pcd.GetPointColors().Slice(0, 0, 4)));
+}
+
+TEST_P(PointCloudPermuteDevices, SegmentPlane) {
+    core::Device device = GetParam();
+    const t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    geometry::PointCloud(pointcloud_tools::MakeThreePlanes()),
+                    core::Float32, device);
+
+    for (int preverification_n : {0, 200}) {
+        core::Tensor plane_model, inliers;
+        std::tie(plane_model, inliers) =
+                pcd.SegmentPlane(0.01, 3, 10000, 0.9999, preverification_n);
+        EXPECT_TRUE(plane_model.Abs().AllClose(
+                core::Tensor::Init<double>({0, 0, 1, 0}, device), 1e-5,
+                1e-5));
+        EXPECT_TRUE(inliers.AllClose(
+                core::Tensor::Arange(0, 1200, 1, core::Int64, device)));
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, SegmentPlanes) {
+    core::Device device = GetParam();
+    const t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    geometry::PointCloud(pointcloud_tools::MakeThreePlanes()),
+                    core::Float32, device);
+
+    core::Tensor plane_models, labels;
+    std::tie(plane_models, labels) = pcd.SegmentPlanes(0.01, 3, 1000, 10, 50);
+    EXPECT_TRUE(plane_models.Abs().AllClose(
+            core::Tensor::Init<double>(
+                    {{0, 0, 1, 0}, {1, 0, 0, 0}, {0, 1, 0, 2}}, device),
+            1e-5, 1e-5));
+    std::vector<int64_t> expected_labels(2600, -1);
+    std::fill(expected_labels.begin(), expected_labels.begin() + 1200, 0);
+    std::fill(expected_labels.begin() + 1200, expected_labels.begin() + 2100,
+              1);
+    std::fill(expected_labels.begin() + 2100, expected_labels.begin() + 2500,
+              2);
+    EXPECT_EQ(labels.ToFlatVector<int64_t>(), expected_labels);
+}
+
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+
+    // Blobs of different densities and sizes, some touching, plus sparse
+    // noise.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::vector<Eigen::Vector3d> points;
+    for (int blob = 0; blob < 8; blob++) {
+        const Eigen::Vector3d center(blob % 4 * 0.6, blob / 4 * 0.6, 0.0);
+        const double sigma = 0.05 + 0.02 * blob;
+        for (int i = 0; i < 300 + 50 * blob; i++) {
+            points.push_back(center + sigma * Eigen::Vector3d(normal(rng),
+                                                              normal(rng),
+                                                              normal(rng)));
+        }
+    }
+    for (int i = 0; i < 500; i++) {
+        points.emplace_back(uniform(rng) * 3 - 0.5, uniform(rng) * 2 - 0.5,
+                            uniform(rng) - 0.5);
+    }
+    std::shuffle(points.begin(), points.end(), rng);
+    const geometry::PointCloud legacy_pcd(points);
+
+    for (double eps : {0.02, 0.05, 0.1}) {
+        const std::vector<int> legacy_labels =
+                legacy_pcd.ClusterDBSCAN(eps, 10);
+        for (core::Dtype dtype : {core::Float32, core::Float64}) {
+            const t::geometry::PointCloud pcd =
+                    t::geometry::PointCloud::FromLegacyPointCloud(
+                            legacy_pcd, dtype, device);
+            const core::Tensor labels = pcd.ClusterDBSCAN(eps, 10);
+            EXPECT_EQ(labels.GetDtype(), core::Int32);
+            EXPECT_EQ(labels.ToFlatVector<int>(), legacy_labels);
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include <cstdlib>
+
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
@@ -34,6 +36,7 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
 
@@ -115,6 +118,85 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(TSDFVoxelGridPermuteDevices, IntegrateSynthetic) {
+    core::Device device = GetParam();
+    const int width = 320;
+    const int height = 240;
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{300, 0, 159.5}, {0, 300, 119.5}, {0, 0, 1}});
+
+    // The small grid has to rehash while new blocks are activated.
+    float voxel_size = 0.008;
+    float block_size = voxel_size * 16;
+    t::geometry::TSDFVoxelGrid small_grid(
+            {{"tsdf", core::Float32}, {"weight", core::Float32}}, voxel_size,
+            0.04f, 16, 10, device);
+    t::geometry::TSDFVoxelGrid large_grid(
+            {{"tsdf", core::Float32}, {"weight", core::Float32}}, voxel_size,
+            0.04f, 16, 10000, device);
+
+    // A wavy surface seen from a translating camera.
+    std::vector<Eigen::Vector3i> surface_blocks;
+    for (int i = 0; i < 4; ++i) {
+        std::vector<uint16_t> depth_data(width * height);
+        for (int v = 0; v < height; ++v) {
+            for (int u = 0; u < width; ++u) {
+                depth_data[v * width + u] = static_cast<uint16_t>(
+                        1000 * (1.0 + 0.2 * std::sin(u / 30.0 + i) *
+                                              std::cos(v / 20.0)));
+            }
+        }
+        t::geometry::Image depth(core::Tensor(depth_data, {height, width, 1},
+                                              core::UInt16, device));
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        extrinsic(0, 3) = -0.05 * i;
+        core::Tensor extrinsic_t =
+                core::eigen_converter::EigenMatrixToTensor(extrinsic);
+
+        small_grid.Integrate(depth, intrinsic_t, extrinsic_t);
+        large_grid.Integrate(depth, intrinsic_t, extrinsic_t);
+
+        for (int v = 0; v < height; v += 4) {
+            for (int u = 0; u < width; u += 4) {
+                double d = depth_data[v * width + u] / 1000.0;
+                Eigen::Vector3d p((u - 159.5) * d / 300 + 0.05 * i,
+                                  (v - 119.5) * d / 300, d);
+                surface_blocks.emplace_back(
+                        (p / block_size).array().floor().cast<int>());
+            }
+        }
+    }
+
+    // Every surface point must lie in an active block.
+    auto large_hashmap = large_grid.GetBlockHashmap();
+    core::Tensor addrs, masks;
+    std::vector<int> surface_block_data;
+    for (const Eigen::Vector3i &block : surface_blocks) {
+        surface_block_data.insert(surface_block_data.end(),
+                                  block.data(), block.data() + 3);
+    }
+    large_hashmap->Find(
+            core::Tensor(surface_block_data,
+                         {static_cast<int64_t>(surface_blocks.size()), 3},
+                         core::Int32, device),
+            addrs, masks);
+    EXPECT_TRUE(masks.All());
+
+    // Rehashing must not change the integration result.
+    auto small_hashmap = small_grid.GetBlockHashmap();
+    EXPECT_EQ(small_hashmap->Size(), large_hashmap->Size());
+    core::Tensor small_addrs;
+    small_hashmap->GetActiveIndices(small_addrs);
+    small_addrs = small_addrs.To(core::Int64);
+    core::Tensor keys = small_hashmap->GetKeyTensor().IndexGet({small_addrs});
+    large_hashmap->Find(keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    EXPECT_TRUE(small_hashmap->GetValueTensor()
+                        .IndexGet({small_addrs})
+                        .AllClose(large_hashmap->GetValueTensor().IndexGet(
+                                {addrs.To(core::Int64)})));
+}
+
 TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
     core::Device device = GetParam();
     std::vector<core::HashmapBackend> backends;
@@ -223,5 +305,99 @@ TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
         }
     }
 }
+
+// Path of \p file_name in the system's temporary directory.
+static std::string GetTempFilePath(const std::string &file_name) {
+    for (const char *var : {"TMPDIR", "TEMP", "TMP"}) {
+        if (const char *dir = std::getenv(var)) {
+            return utility::filesystem::GetRegularizedDirectoryName(dir) +
+                   file_name;
+        }
+    }
+    return "/tmp/" + file_name;
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, SaveAppendLoad) {
+    core::Device device = GetParam();
+    const std::string file_name = GetTempFilePath("tsdf_voxel_grid.bin");
+    utility::filesystem::RemoveFile(file_name);
+
+    // Invalid block coordinates are rejected before anything is written.
+    t::geometry::TSDFVoxelGrid empty_grid(
+            {{"tsdf", core::Float32}, {"weight", core::UInt16}}, 0.008f,
+            0.04f, 16, 100, device);
+    EXPECT_THROW(empty_grid.Append(file_name,
+                                   core::Tensor({2, 3}, core::Int64, device)),
+                 std::runtime_error);
+    EXPECT_FALSE(utility::filesystem::FileExists(file_name));
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid(
+            {{"tsdf", core::Float32}, {"weight", core::UInt16}}, voxel_size,
+            0.04f, 16, 100, device);
+    auto hashmap = voxel_grid.GetBlockHashmap();
+
+    // Fill two blocks with a recognizable pattern and checkpoint them.
+    auto fill = [&](const core::Tensor &coords, uint8_t value) {
+        core::Tensor addrs, masks;
+        hashmap->Activate(coords, addrs, masks);
+        hashmap->Find(coords, addrs, masks);
+        core::Tensor values = hashmap->GetValueTensor();
+        core::SizeVector shape = values.GetShape();
+        shape[0] = coords.GetLength();
+        values.IndexSet({addrs.To(core::Int64)},
+                        core::Tensor::Full(shape, value, core::UInt8, device));
+    };
+    core::Tensor coords_init =
+            core::Tensor::Init<int32_t>({{0, 0, 0}, {1, 2, 3}}, device);
+    fill(coords_init, 7);
+    voxel_grid.Save(file_name);
+
+    // Update one block, add a new one and append them as a new segment.
+    core::Tensor coords_update =
+            core::Tensor::Init<int32_t>({{1, 2, 3}, {-4, 5, -6}}, device);
+    fill(coords_update, 9);
+    voxel_grid.Append(file_name, coords_update);
+
+    t::geometry::TSDFVoxelGrid loaded =
+            t::geometry::TSDFVoxelGrid::Load(file_name, device);
+    auto loaded_hashmap = loaded.GetBlockHashmap();
+    EXPECT_EQ(loaded_hashmap->Size(), 3);
+
+    core::Tensor coords_all = core::Tensor::Init<int32_t>(
+            {{0, 0, 0}, {1, 2, 3}, {-4, 5, -6}}, device);
+    core::Tensor addrs, masks, loaded_addrs, loaded_masks;
+    hashmap->Find(coords_all, addrs, masks);
+    loaded_hashmap->Find(coords_all, loaded_addrs, loaded_masks);
+    EXPECT_TRUE(loaded_masks.All());
+    EXPECT_TRUE(hashmap->GetValueTensor()
+                        .IndexGet({addrs.To(core::Int64)})
+                        .AllClose(loaded_hashmap->GetValueTensor().IndexGet(
+                                {loaded_addrs.To(core::Int64)})));
+
+    // Appending to an incompatible grid must fail.
+    t::geometry::TSDFVoxelGrid other(
+            {{"tsdf", core::Float32}, {"weight", core::Float32}}, voxel_size,
+            0.04f, 16, 100, device);
+    EXPECT_THROW(other.Append(file_name, coords_init), std::runtime_error);
+    t::geometry::TSDFVoxelGrid other_voxel_size(
+            {{"tsdf", core::Float32}, {"weight", core::UInt16}}, 0.01f, 0.04f,
+            16, 100, device);
+    EXPECT_THROW(other_voxel_size.Append(file_name, coords_init),
+                 std::runtime_error);
+    t::geometry::TSDFVoxelGrid other_sdf_trunc(
+            {{"tsdf", core::Float32}, {"weight", core::UInt16}}, voxel_size,
+            0.05f, 16, 100, device);
+    EXPECT_THROW(other_sdf_trunc.Append(file_name, coords_init),
+                 std::runtime_error);
+    // Same block size, but a different attribute dtype.
+    t::geometry::TSDFVoxelGrid other_dtype(
+            {{"tsdf", core::Float32}, {"weight", core::Int16}}, voxel_size,
+            0.04f, 16, 100, device);
+    EXPECT_THROW(other_dtype.Append(file_name, coords_init),
+                 std::runtime_error);
+
+    utility::filesystem::RemoveFile(file_name);
+}
 }  // namespace tests
 }  // namespace open3d
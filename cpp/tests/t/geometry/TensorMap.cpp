@@ -113,5 +113,27 @@ TEST_P(TensorMapPermuteDevices, Contains) {
     EXPECT_FALSE(tm.Contains("normals"));
 }
 
+TEST_P(TensorMapPermuteDevices, SelectRows) {
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm(
+            "points",
+            {{"points", core::Tensor::Init<float>(
+                                {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}}, device)},
+             {"labels", core::Tensor::Init<int64_t>({0, 1, 2}, device)}});
+    core::Tensor indices = core::Tensor::Init<int64_t>({2, 1}, device);
+
+    t::geometry::TensorMap selected = tm.SelectRows(indices);
+    EXPECT_EQ(selected.GetPrimaryKey(), "points");
+    EXPECT_EQ(selected.size(), 2);
+    EXPECT_TRUE(selected["points"].AllClose(
+            core::Tensor::Init<float>({{2, 2, 2}, {1, 1, 1}}, device)));
+    EXPECT_TRUE(selected["labels"].AllClose(
+            core::Tensor::Init<int64_t>({2, 1}, device)));
+
+    tm["colors"] = core::Tensor::Ones({5, 3}, core::Float32, device);
+    EXPECT_ANY_THROW(tm.SelectRows(indices));
+}
+
 }  // namespace tests
 }  // namespace open3d
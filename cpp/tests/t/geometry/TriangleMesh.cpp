@@ -27,6 +27,7 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorList.h"
 #include "tests/UnitTest.h"
 
@@ -290,6 +291,218 @@ TEST_P(TriangleMeshPermuteDevices, Rotate) {
             core::Tensor::Init<float>({{2, 2, 1}, {2, 2, 1}}, device)));
 }
 
+TEST_P(TriangleMeshPermuteDevices, SelectFacesByMask) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(device);
+    mesh.SetVertices(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}, {2, 2, 2}}, device));
+    mesh.SetVertexColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}, {4, 4, 4}}, device));
+    mesh.SetTriangles(core::Tensor::Init<int64_t>(
+            {{0, 1, 2}, {1, 3, 2}, {2, 3, 4}}, device));
+    mesh.SetTriangleNormals(core::Tensor::Init<float>(
+            {{0, 0, 1}, {0, 0, -1}, {1, 0, 0}}, device));
+
+    core::Tensor mask = core::Tensor::Init<bool>({false, true, false}, device);
+    t::geometry::TriangleMesh selected = mesh.SelectFacesByMask(mask);
+    EXPECT_TRUE(selected.GetVertices().AllClose(core::Tensor::Init<float>(
+            {{1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device)));
+    EXPECT_TRUE(selected.GetVertexColors().AllClose(core::Tensor::Init<float>(
+            {{1, 1, 1}, {2, 2, 2}, {3, 3, 3}}, device)));
+    EXPECT_TRUE(selected.GetTriangles().AllClose(
+            core::Tensor::Init<int64_t>({{0, 2, 1}}, device)));
+    EXPECT_TRUE(selected.GetTriangleNormals().AllClose(
+            core::Tensor::Init<float>({{0, 0, -1}}, device)));
+
+    // Nothing selected.
+    mask = core::Tensor::Zeros({3}, core::Bool, device);
+    selected = mesh.SelectFacesByMask(mask);
+    EXPECT_EQ(selected.GetVertices().GetShape(), core::SizeVector({0, 3}));
+    EXPECT_EQ(selected.GetTriangles().GetShape(), core::SizeVector({0, 3}));
+
+    EXPECT_ANY_THROW(mesh.SelectFacesByMask(
+            core::Tensor::Zeros({2}, core::Bool, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeNormals) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Float64, core::Int64, device);
+    legacy_mesh->ComputeVertexNormals();
+    mesh.ComputeVertexNormals();
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->triangle_normals_, core::Float64, device)));
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->vertex_normals_, core::Float64, device)));
+
+    // Unnormalized triangle normals are twice the triangle areas.
+    mesh.SetVertices(core::Tensor::Init<float>(
+            {{0, 0, 0}, {2, 0, 0}, {0, 2, 0}, {0, 0, 5}}, device));
+    mesh.SetTriangles(
+            core::Tensor::Init<int32_t>({{0, 1, 2}, {0, 2, 1}}, device));
+    mesh.RemoveTriangleAttr("normals");
+    mesh.ComputeTriangleNormals(false);
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::Tensor::Init<float>({{0, 0, 4}, {0, 0, -4}}, device)));
+
+    // Opposite triangles cancel out, and the unreferenced vertex has no
+    // adjacent triangle, so all vertex normals stay zero, as in legacy.
+    mesh.ComputeVertexNormals();
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::Tensor::Init<float>({{0, 0, 1}, {0, 0, -1}}, device)));
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            core::Tensor::Zeros({4, 3}, core::Float32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, GetSurfaceArea) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(device);
+    EXPECT_EQ(mesh.GetSurfaceArea(), 0);
+
+    mesh.SetVertices(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}, {0, 0, 3}}, device));
+    mesh.SetTriangles(core::Tensor::Init<int64_t>(
+            {{0, 1, 2}, {1, 3, 2}, {0, 1, 4}}, device));
+    EXPECT_TRUE(mesh.GetTriangleAreas().AllClose(
+            core::Tensor::Init<float>({0.5, 0.5, 1.5}, device)));
+    EXPECT_NEAR(mesh.GetSurfaceArea(), 2.5, 1e-6);
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh = t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+            *legacy_mesh, core::Float64, core::Int64, device);
+    EXPECT_NEAR(mesh.GetSurfaceArea(), legacy_mesh->GetSurfaceArea(), 1e-10);
+}
+
+TEST_P(TriangleMeshPermuteDevices, RemoveDuplicatedVertices) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(device);
+    mesh.SetVertices(core::Tensor::Init<float>({{0, 0, 0},
+                                                {1, 0, 0},
+                                                {0, 1, 0},
+                                                {1, 0, 0},
+                                                {0, -0.f, 0},
+                                                {1, 1, 0}},
+                                               device));
+    mesh.SetVertexColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}, {4, 4, 4}, {5, 5, 5}},
+            device));
+    mesh.SetTriangles(core::Tensor::Init<int32_t>(
+            {{0, 1, 2}, {3, 5, 2}, {4, 3, 5}}, device));
+
+    mesh.RemoveDuplicatedVertices();
+    EXPECT_TRUE(mesh.GetVertices().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device)));
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {5, 5, 5}}, device)));
+    EXPECT_EQ(mesh.GetTriangles().GetDtype(), core::Int32);
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(core::Tensor::Init<int32_t>(
+            {{0, 1, 2}, {1, 3, 2}, {0, 1, 3}}, device)));
+
+    // Same as legacy on a mesh with duplicated vertices at the seams.
+    auto legacy_mesh = geometry::TriangleMesh::CreateCylinder(1.0, 2.0, 8, 2);
+    *legacy_mesh += *legacy_mesh;
+    mesh = t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+            *legacy_mesh, core::Float64, core::Int64, device);
+    legacy_mesh->RemoveDuplicatedVertices();
+    mesh.RemoveDuplicatedVertices();
+    EXPECT_TRUE(mesh.GetVertices().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->vertices_, core::Float64, device)));
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(
+            core::eigen_converter::EigenVector3iVectorToTensor(
+                    legacy_mesh->triangles_, core::Int64, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, RemoveUnreferencedVertices) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(device);
+    mesh.SetVertices(core::Tensor::Init<float>(
+            {{0, 0, 0}, {9, 9, 9}, {1, 0, 0}, {0, 1, 0}, {8, 8, 8}}, device));
+    mesh.SetVertexColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}, {4, 4, 4}}, device));
+    mesh.SetTriangles(core::Tensor::Init<int64_t>({{0, 2, 3}}, device));
+
+    mesh.RemoveUnreferencedVertices();
+    EXPECT_TRUE(mesh.GetVertices().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}, device)));
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {2, 2, 2}, {3, 3, 3}}, device)));
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(
+            core::Tensor::Init<int64_t>({{0, 1, 2}}, device)));
+
+    // Without triangles, no vertex is referenced.
+    mesh.SetTriangles(core::Tensor({0, 3}, core::Int64, device));
+    mesh.RemoveUnreferencedVertices();
+    EXPECT_EQ(mesh.GetVertices().GetLength(), 0);
+    EXPECT_EQ(mesh.GetVertexColors().GetLength(), 0);
+}
+
+TEST_P(TriangleMeshPermuteDevices, MergeCloseVertices) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(device);
+    mesh.SetVertices(core::Tensor::Init<double>({{0, 0, 0},
+                                                 {1, 0, 0},
+                                                 {0, 1, 0},
+                                                 {1.01, 0, 0},
+                                                 {0, 0.99, 0},
+                                                 {1, 1, 0}},
+                                                device));
+    mesh.SetVertexColors(core::Tensor::Init<double>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}, {4, 4, 4}, {5, 5, 5}},
+            device));
+    mesh.SetVertexAttr("labels", core::Tensor::Init<int32_t>(
+                                         {0, 1, 2, 3, 4, 5}, device));
+    mesh.SetTriangles(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {3, 5, 4}}, device));
+    mesh.SetTriangleNormals(
+            core::Tensor::Init<double>({{0, 0, 1}, {0, 0, 1}}, device));
+
+    EXPECT_ANY_THROW(mesh.MergeCloseVertices(0));
+    mesh.MergeCloseVertices(0.05);
+
+    // Close vertices are averaged, the vertex order is kept, and the labels
+    // are taken from one vertex of each group.
+    const core::Tensor vertices = mesh.GetVertices();
+    ASSERT_EQ(vertices.GetLength(), 4);
+    EXPECT_TRUE(vertices.AllClose(core::Tensor::Init<double>(
+            {{0, 0, 0}, {1.005, 0, 0}, {0, 0.995, 0}, {1, 1, 0}}, device)));
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(core::Tensor::Init<double>(
+            {{0, 0, 0}, {2, 2, 2}, {3, 3, 3}, {5, 5, 5}}, device)));
+    const core::Tensor labels = mesh.GetVertexAttr("labels");
+    EXPECT_EQ(labels[0].Item<int32_t>(), 0);
+    EXPECT_TRUE(labels[1].Item<int32_t>() == 1 ||
+                labels[1].Item<int32_t>() == 3);
+    EXPECT_TRUE(labels[2].Item<int32_t>() == 2 ||
+                labels[2].Item<int32_t>() == 4);
+    EXPECT_EQ(labels[3].Item<int32_t>(), 5);
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {1, 3, 2}}, device)));
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::Tensor::Init<double>({{0, 0, 1}, {0, 0, 1}}, device)));
+
+    // A long chain of close vertices is merged into groups no wider than eps
+    // from their kept vertex.
+    const int64_t n = 1000;
+    mesh = t::geometry::TriangleMesh(device);
+    mesh.SetVertices(core::Tensor::Arange(0, n, 1, core::Float64, device)
+                             .Reshape({n, 1})
+                             .Mul(core::Tensor::Init<double>({{0.1, 0, 0}},
+                                                             device)));
+    mesh.MergeCloseVertices(0.15);
+    EXPECT_LT(mesh.GetVertices().GetLength(), n / 2 + 1);
+    EXPECT_GT(mesh.GetVertices().GetLength(), n / 3 - 1);
+}
+
 TEST_P(TriangleMeshPermuteDevices, FromLegacyTriangleMesh) {
     core::Device device = GetParam();
     geometry::TriangleMesh legacy_mesh;
@@ -0,0 +1,369 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <map>
+#include <random>
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraParameters.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class VoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelGrid,
+                         VoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Returns the voxels of a grid as a map from index to color, so that grids
+// can be compared independently of the hashmap order.
+static std::map<std::tuple<int, int, int>, Eigen::Vector3d> VoxelMap(
+        const open3d::geometry::VoxelGrid &voxel_grid) {
+    std::map<std::tuple<int, int, int>, Eigen::Vector3d> voxels;
+    for (const auto &it : voxel_grid.voxels_) {
+        const Eigen::Vector3i &index = it.second.grid_index_;
+        voxels[std::make_tuple(index(0), index(1), index(2))] =
+                it.second.color_;
+    }
+    return voxels;
+}
+
+static void ExpectSameVoxels(const open3d::geometry::VoxelGrid &expected,
+                             const t::geometry::VoxelGrid &voxel_grid) {
+    auto expected_voxels = VoxelMap(expected);
+    auto voxels = VoxelMap(voxel_grid.ToLegacyVoxelGrid());
+    ASSERT_EQ(expected_voxels.size(), voxels.size());
+    for (const auto &it : expected_voxels) {
+        ASSERT_EQ(voxels.count(it.first), 1u);
+        ExpectEQ(voxels[it.first], it.second, 1e-6);
+    }
+}
+
+static open3d::geometry::PointCloud RandomPointCloud(size_t num_points) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    open3d::geometry::PointCloud pcd;
+    for (size_t i = 0; i < num_points; ++i) {
+        pcd.points_.emplace_back(dist(rng), dist(rng), 0.5 * dist(rng));
+        pcd.colors_.emplace_back(0.5 + 0.5 * dist(rng), 0.5 + 0.5 * dist(rng),
+                                 0.5 + 0.5 * dist(rng));
+    }
+    return pcd;
+}
+
+TEST_P(VoxelGridPermuteDevices, Constructor) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid(
+            0.5, core::Tensor::Init<double>({1, 2, 3}), 10, device);
+    EXPECT_EQ(voxel_grid.GetGeometryType(),
+              t::geometry::Geometry::GeometryType::VoxelGrid);
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+    EXPECT_EQ(voxel_grid.GetVoxelSize(), 0.5);
+    EXPECT_TRUE(voxel_grid.GetOrigin().AllClose(
+            core::Tensor::Init<double>({1, 2, 3})));
+    EXPECT_EQ(voxel_grid.GetDevice(), device);
+    EXPECT_EQ(voxel_grid.GetVoxelIndices().GetShape(),
+              core::SizeVector({0, 3}));
+
+    EXPECT_ANY_THROW(t::geometry::VoxelGrid(0.0));
+    EXPECT_ANY_THROW(t::geometry::VoxelGrid(
+            1.0, core::Tensor::Zeros({2}, core::Float64)));
+}
+
+TEST_P(VoxelGridPermuteDevices, AddRemoveVoxels) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid(
+            1.0, core::Tensor::Zeros({3}, core::Float64), 2, device);
+    core::Tensor indices = core::Tensor::Init<int>(
+            {{0, 0, 0}, {1, 2, 3}, {-4, 5, 6}}, device);
+    core::Tensor colors = core::Tensor::Init<float>(
+            {{0.1, 0.2, 0.3}, {0.4, 0.5, 0.6}, {0.7, 0.8, 0.9}}, device);
+    voxel_grid.AddVoxels(indices, colors);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 3);
+
+    // Existing voxels are overwritten.
+    voxel_grid.AddVoxels(indices.Slice(0, 1, 2));
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 3);
+    auto voxels = VoxelMap(voxel_grid.ToLegacyVoxelGrid());
+    ExpectEQ(voxels[std::make_tuple(0, 0, 0)], Eigen::Vector3d(0.1, 0.2, 0.3),
+             1e-6);
+    ExpectEQ(voxels[std::make_tuple(1, 2, 3)], Eigen::Vector3d(0, 0, 0));
+    ExpectEQ(voxels[std::make_tuple(-4, 5, 6)], Eigen::Vector3d(0.7, 0.8, 0.9),
+             1e-6);
+
+    voxel_grid.RemoveVoxels(
+            core::Tensor::Init<int>({{1, 2, 3}, {9, 9, 9}}, device));
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 2);
+
+    voxel_grid.Clear();
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateDense) {
+    core::Device device = GetParam();
+
+    auto legacy = open3d::geometry::VoxelGrid::CreateDense(
+            Eigen::Vector3d(-1, -0.5, 0), Eigen::Vector3d(0.2, 0.4, 0.6), 0.1,
+            1.0, 0.7, 0.4);
+    t::geometry::VoxelGrid voxel_grid = t::geometry::VoxelGrid::CreateDense(
+            core::Tensor::Init<double>({-1, -0.5, 0}),
+            core::Tensor::Init<double>({0.2, 0.4, 0.6}), 0.1, 1.0, 0.7, 0.4,
+            device);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 10 * 7 * 4);
+    ExpectSameVoxels(*legacy, voxel_grid);
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromPointCloud) {
+    core::Device device = GetParam();
+
+    open3d::geometry::PointCloud pcd_legacy = RandomPointCloud(10000);
+    for (double voxel_size : {0.05, 0.2, 1.0}) {
+        auto legacy = open3d::geometry::VoxelGrid::CreateFromPointCloud(
+                pcd_legacy, voxel_size);
+        t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::FromLegacyPointCloud(
+                        pcd_legacy, core::Float64, device);
+        t::geometry::VoxelGrid voxel_grid =
+                t::geometry::VoxelGrid::CreateFromPointCloud(pcd, voxel_size);
+        EXPECT_EQ(voxel_grid.GetDevice(), device);
+        ExpectSameVoxels(*legacy, voxel_grid);
+        ExpectEQ(voxel_grid.ToLegacyVoxelGrid().origin_, legacy->origin_);
+
+        // Without colors, the voxels are black.
+        pcd.RemovePointAttr("colors");
+        voxel_grid =
+                t::geometry::VoxelGrid::CreateFromPointCloud(pcd, voxel_size);
+        EXPECT_EQ(voxel_grid.GetNumVoxels(),
+                  static_cast<int64_t>(legacy->voxels_.size()));
+        EXPECT_TRUE(voxel_grid.GetVoxelColors().AllClose(core::Tensor::Zeros(
+                {voxel_grid.GetNumVoxels(), 3}, core::Float32, device)));
+    }
+
+    EXPECT_TRUE(t::geometry::VoxelGrid::CreateFromPointCloud(
+                        t::geometry::PointCloud(device), 0.1)
+                        .IsEmpty());
+    EXPECT_ANY_THROW(t::geometry::VoxelGrid::CreateFromPointCloud(
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    pcd_legacy, core::Float64, device),
+            0.0));
+}
+
+TEST_P(VoxelGridPermuteDevices, GetVoxelCheckIfIncluded) {
+    core::Device device = GetParam();
+
+    open3d::geometry::PointCloud pcd_legacy = RandomPointCloud(1000);
+    auto legacy =
+            open3d::geometry::VoxelGrid::CreateFromPointCloud(pcd_legacy, 0.1);
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::FromLegacyVoxelGrid(*legacy, device);
+    ExpectSameVoxels(*legacy, voxel_grid);
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> dist(-1.2, 1.2);
+    std::vector<Eigen::Vector3d> queries;
+    for (int i = 0; i < 5000; ++i) {
+        queries.emplace_back(dist(rng), dist(rng), dist(rng));
+    }
+    std::vector<bool> expected_included = legacy->CheckIfIncluded(queries);
+
+    core::Tensor queries_t = core::eigen_converter::EigenVector3dVectorToTensor(
+            queries, core::Float64, device);
+    core::Tensor voxels = voxel_grid.GetVoxel(queries_t).To(
+            core::Device("CPU:0"));
+    core::Tensor included =
+            voxel_grid.CheckIfIncluded(queries_t).To(core::Device("CPU:0"));
+    ASSERT_EQ(included.GetShape(), core::SizeVector({5000}));
+    for (size_t i = 0; i < queries.size(); ++i) {
+        Eigen::Vector3i expected_voxel = legacy->GetVoxel(queries[i]);
+        EXPECT_EQ(voxels[i][0].Item<int>(), expected_voxel(0));
+        EXPECT_EQ(voxels[i][1].Item<int>(), expected_voxel(1));
+        EXPECT_EQ(voxels[i][2].Item<int>(), expected_voxel(2));
+        EXPECT_EQ(included[i].Item<bool>(), expected_included[i]);
+    }
+
+    EXPECT_EQ(voxel_grid
+                      .CheckIfIncluded(
+                              core::Tensor({0, 3}, core::Float32, device))
+                      .GetShape(),
+              core::SizeVector({0}));
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromTriangleMesh) {
+    core::Device device = GetParam();
+
+    auto mesh_legacy = open3d::geometry::TriangleMesh::CreateSphere(1.0, 10);
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *mesh_legacy, core::Float64, core::Int64, device);
+    const double voxel_size = 0.15;
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromTriangleMesh(mesh, voxel_size);
+    ASSERT_FALSE(voxel_grid.IsEmpty());
+
+    // Compare with testing every voxel of the bounding box against every
+    // triangle.
+    const open3d::geometry::VoxelGrid legacy = voxel_grid.ToLegacyVoxelGrid();
+    ExpectEQ(legacy.origin_,
+             Eigen::Vector3d(mesh_legacy->GetMinBound() -
+                             Eigen::Vector3d::Constant(voxel_size / 2)));
+    auto voxels = VoxelMap(legacy);
+    const Eigen::Vector3d half_size = Eigen::Vector3d::Constant(voxel_size / 2);
+    const int num = int(std::ceil(2.0 / voxel_size)) + 1;
+    size_t num_expected = 0;
+    for (int x = -1; x <= num; ++x) {
+        for (int y = -1; y <= num; ++y) {
+            for (int z = -1; z <= num; ++z) {
+                const Eigen::Vector3d center =
+                        legacy.origin_ +
+                        (Eigen::Vector3d(x, y, z).array() + 0.5).matrix() *
+                                voxel_size;
+                bool intersects = false;
+                for (const Eigen::Vector3i &tri : mesh_legacy->triangles_) {
+                    if (open3d::geometry::IntersectionTest::TriangleAABB(
+                                center, half_size,
+                                mesh_legacy->vertices_[tri(0)],
+                                mesh_legacy->vertices_[tri(1)],
+                                mesh_legacy->vertices_[tri(2)])) {
+                        intersects = true;
+                        break;
+                    }
+                }
+                EXPECT_EQ(voxels.count(std::make_tuple(x, y, z)),
+                          intersects ? 1u : 0u);
+                num_expected += intersects;
+            }
+        }
+    }
+    EXPECT_EQ(voxels.size(), num_expected);
+
+    // Every vertex lies in a voxel of the grid.
+    core::Tensor included =
+            voxel_grid.CheckIfIncluded(mesh.GetVertices()).To(core::Bool);
+    EXPECT_TRUE(included.All());
+}
+
+TEST_P(VoxelGridPermuteDevices, Carve) {
+    core::Device device = GetParam();
+
+    const int width = 64, height = 48;
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(width, height, 50, 50, 31.5, 23.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    camera.extrinsic_.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 0).normalized())
+                    .toRotationMatrix();
+    camera.extrinsic_.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, -0.2, 2.0);
+    core::Tensor intrinsics = core::eigen_converter::EigenMatrixToTensor(
+            camera.intrinsic_.intrinsic_matrix_);
+    core::Tensor extrinsics =
+            core::eigen_converter::EigenMatrixToTensor(camera.extrinsic_);
+
+    // A wavy depth map with a hole, and a disk-shaped silhouette.
+    open3d::geometry::Image depth_legacy, silhouette_legacy;
+    depth_legacy.Prepare(width, height, 1, 4);
+    silhouette_legacy.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            *depth_legacy.PointerAt<float>(u, v) =
+                    (u > 40 && v > 30) ? 0.0f
+                                       : 2.0f + 0.3f * std::sin(u / 7.0f) *
+                                                        std::cos(v / 5.0f);
+            *silhouette_legacy.PointerAt<float>(u, v) =
+                    (u - 30) * (u - 30) + (v - 20) * (v - 20) < 200 ? 1.0f
+                                                                     : 0.0f;
+        }
+    }
+    t::geometry::Image depth =
+            t::geometry::Image::FromLegacyImage(depth_legacy, device);
+    t::geometry::Image silhouette =
+            t::geometry::Image::FromLegacyImage(silhouette_legacy, device);
+
+    for (bool keep_voxels_outside_image : {false, true}) {
+        auto legacy = open3d::geometry::VoxelGrid::CreateDense(
+                Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(0, 0, 0), 0.1,
+                2.0, 2.0, 2.0);
+        t::geometry::VoxelGrid voxel_grid =
+                t::geometry::VoxelGrid::FromLegacyVoxelGrid(*legacy, device);
+
+        legacy->CarveDepthMap(depth_legacy, camera, keep_voxels_outside_image);
+        voxel_grid.CarveDepthMap(depth, intrinsics, extrinsics, 1.0f,
+                                 keep_voxels_outside_image);
+        EXPECT_LT(voxel_grid.GetNumVoxels(), 8000);
+        ExpectSameVoxels(*legacy, voxel_grid);
+
+        legacy->CarveSilhouette(silhouette_legacy, camera,
+                                keep_voxels_outside_image);
+        voxel_grid.CarveSilhouette(silhouette, intrinsics, extrinsics,
+                                   keep_voxels_outside_image);
+        EXPECT_GT(voxel_grid.GetNumVoxels(), 0);
+        ExpectSameVoxels(*legacy, voxel_grid);
+    }
+}
+
+TEST_P(VoxelGridPermuteDevices, ToAndClone) {
+    core::Device device = GetParam();
+
+    open3d::geometry::PointCloud pcd_legacy = RandomPointCloud(1000);
+    auto legacy =
+            open3d::geometry::VoxelGrid::CreateFromPointCloud(pcd_legacy, 0.2);
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::FromLegacyVoxelGrid(*legacy, device);
+
+    t::geometry::VoxelGrid cloned = voxel_grid.Clone();
+    cloned.Clear();
+    EXPECT_TRUE(cloned.IsEmpty());
+    EXPECT_FALSE(voxel_grid.IsEmpty());
+
+    t::geometry::VoxelGrid voxel_grid_cpu =
+            voxel_grid.To(core::Device("CPU:0"));
+    EXPECT_EQ(voxel_grid_cpu.GetDevice(), core::Device("CPU:0"));
+    ExpectSameVoxels(*legacy, voxel_grid_cpu);
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        const core::Tensor origin = core::Tensor::Zeros({3}, core::Float64);
+        t::geometry::VoxelGrid voxel_grid_tbb(0.2, origin, 16, device,
+                                              core::HashmapBackend::TBB);
+        voxel_grid_tbb.AddVoxels(voxel_grid.GetVoxelIndices());
+        t::geometry::VoxelGrid cloned_tbb = voxel_grid_tbb.Clone();
+        EXPECT_EQ(cloned_tbb.GetHashmapBackend(), core::HashmapBackend::TBB);
+        EXPECT_EQ(cloned_tbb.GetNumVoxels(), voxel_grid.GetNumVoxels());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
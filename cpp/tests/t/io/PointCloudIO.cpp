@@ -26,6 +26,7 @@
 
 #include "open3d/t/io/PointCloudIO.h"
 
+#include <cmath>
 #include <gtest/gtest.h>
 
 #include "core/CoreTest.h"
@@ -192,6 +193,52 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+// Binary PLY files are read in bulk, the result must match the rply reader
+// used for ASCII files.
+TEST(TPointCloudIO, ReadPointCloudFromBinaryPLY) {
+    const int64_t n = 1000;
+    std::vector<double> points(n * 3);
+    std::vector<float> normals(n * 3);
+    std::vector<uint8_t> colors(n * 3);
+    std::vector<int32_t> labels(n);
+    for (int64_t i = 0; i < n * 3; ++i) {
+        points[i] = std::sin(i * .8969920581) * 1000.;
+        normals[i] = static_cast<float>(std::sin(i * .4472367685));
+        colors[i] = static_cast<uint8_t>(i % 256);
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        labels[i] = static_cast<int32_t>(i * 7 - 300);
+    }
+    t::geometry::PointCloud pcd(core::Tensor(points, {n, 3}, core::Float64));
+    pcd.SetPointNormals(core::Tensor(normals, {n, 3}, core::Float32));
+    pcd.SetPointColors(core::Tensor(colors, {n, 3}, core::UInt8));
+    pcd.SetPointAttr("labels", core::Tensor(labels, {n, 1}, core::Int32));
+
+    EXPECT_TRUE(t::io::WritePointCloud("test_bulk_b.ply", pcd,
+                                       {false, false, false}));
+    EXPECT_TRUE(t::io::WritePointCloud("test_bulk_a.ply", pcd,
+                                       {true, false, false}));
+    t::geometry::PointCloud pcd_b, pcd_a;
+    EXPECT_TRUE(t::io::ReadPointCloud("test_bulk_b.ply", pcd_b,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(t::io::ReadPointCloud("test_bulk_a.ply", pcd_a,
+                                      {"auto", false, false, false}));
+
+    for (const std::string attr : {"points", "normals", "colors", "labels"}) {
+        SCOPED_TRACE(attr);
+        ASSERT_TRUE(pcd_b.HasPointAttr(attr));
+        EXPECT_EQ(pcd_b.GetPointAttr(attr).GetShape(),
+                  pcd.GetPointAttr(attr).GetShape());
+        EXPECT_EQ(pcd_b.GetPointAttr(attr).GetDtype(),
+                  pcd.GetPointAttr(attr).GetDtype());
+        EXPECT_TRUE(pcd_b.GetPointAttr(attr).AllClose(
+                pcd.GetPointAttr(attr), 0, 0));
+        EXPECT_TRUE(pcd_b.GetPointAttr(attr).AllClose(
+                pcd_a.GetPointAttr(attr), 1e-5, 1e-5));
+    }
+    EXPECT_FALSE(pcd_b.HasPointAttr("x"));
+}
+
 // Read write empty point cloud.
 TEST(TPointCloudIO, ReadWriteEmptyPTS) {
     t::geometry::PointCloud pcd, pcd_read;
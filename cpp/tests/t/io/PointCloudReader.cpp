@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudReader.h"
+
+#include <cmath>
+
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+struct PointCloudReaderArgs {
+    std::string filename;
+    bool write_ascii;
+    bool compressed;
+};
+
+t::geometry::PointCloud CreateTestPointCloud(int64_t num_points) {
+    std::vector<double> points(num_points * 3);
+    std::vector<double> normals(num_points * 3);
+    std::vector<double> colors(num_points * 3);
+    std::vector<double> intensities(num_points);
+    for (int64_t i = 0; i < num_points * 3; ++i) {
+        points[i] = std::sin(i * .8969920581) * 100.;
+        normals[i] = std::sin(i * .4472367685);
+        colors[i] = (i % 256) / 255.;
+    }
+    for (int64_t i = 0; i < num_points; ++i) {
+        intensities[i] = (i % 100) / 100.;
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {num_points, 3}, core::Float64));
+    pcd.SetPointNormals(core::Tensor(normals, {num_points, 3}, core::Float64));
+    pcd.SetPointColors(core::Tensor(colors, {num_points, 3}, core::Float64));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor(intensities, {num_points, 1}, core::Float64));
+    return pcd;
+}
+
+}  // namespace
+
+class PointCloudReaderTest
+    : public testing::TestWithParam<PointCloudReaderArgs> {};
+INSTANTIATE_TEST_SUITE_P(
+        PointCloudReader,
+        PointCloudReaderTest,
+        testing::ValuesIn(std::vector<PointCloudReaderArgs>{
+                {"test_reader_b.ply", false, false},
+                {"test_reader_a.ply", true, false},
+                {"test_reader_a.pcd", true, false},
+                {"test_reader_b.pcd", false, false},
+                {"test_reader.xyz", true, false},
+                {"test_reader.xyzn", true, false},
+                {"test_reader.xyzrgb", true, false},
+                {"test_reader.xyzi", true, false},
+                {"test_reader.pts", true, false}}));
+
+// Chunks must match the point cloud returned by ReadPointCloud.
+TEST_P(PointCloudReaderTest, ReadNext) {
+    const PointCloudReaderArgs args = GetParam();
+    const int64_t num_points = 1000;
+    const int64_t chunk_size = 128;
+    EXPECT_TRUE(t::io::WritePointCloud(args.filename,
+                                       CreateTestPointCloud(num_points),
+                                       {args.write_ascii, args.compressed}));
+    t::geometry::PointCloud pcd_ref;
+    EXPECT_TRUE(t::io::ReadPointCloud(args.filename, pcd_ref,
+                                      {"auto", false, false, false}));
+    ASSERT_EQ(pcd_ref.GetPoints().GetLength(), num_points);
+
+    t::io::PointCloudReader reader;
+    ASSERT_TRUE(reader.Open(args.filename, chunk_size, "auto", 2));
+    EXPECT_TRUE(reader.GetNumPoints() == num_points ||
+                reader.GetNumPoints() == -1);
+
+    int64_t offset = 0;
+    t::geometry::PointCloud chunk;
+    while (reader.ReadNext(chunk)) {
+        int64_t length = chunk.GetPoints().GetLength();
+        EXPECT_LE(length, chunk_size);
+        for (const auto &it : pcd_ref.GetPointAttr()) {
+            SCOPED_TRACE(it.first);
+            ASSERT_TRUE(chunk.HasPointAttr(it.first));
+            EXPECT_EQ(chunk.GetPointAttr(it.first).GetDtype(),
+                      it.second.GetDtype());
+            EXPECT_TRUE(chunk.GetPointAttr(it.first).AllClose(
+                    it.second.Slice(0, offset, offset + length), 0, 0));
+        }
+        offset += length;
+    }
+    EXPECT_EQ(offset, num_points);
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_FALSE(reader.HasFailed());
+    reader.Close();
+    EXPECT_FALSE(reader.IsOpened());
+
+    utility::filesystem::RemoveFile(args.filename);
+}
+
+// Closing the reader before the end of the file stops the background thread.
+TEST(PointCloudReader, CloseEarly) {
+    const std::string filename = "test_reader_close.ply";
+    EXPECT_TRUE(t::io::WritePointCloud(filename, CreateTestPointCloud(1000)));
+
+    t::io::PointCloudReader reader;
+    ASSERT_TRUE(reader.Open(filename, 10, "auto", 1));
+    t::geometry::PointCloud chunk;
+    EXPECT_TRUE(reader.ReadNext(chunk));
+    EXPECT_EQ(chunk.GetPoints().GetLength(), 10);
+    reader.Close();
+    EXPECT_FALSE(reader.ReadNext(chunk));
+
+    utility::filesystem::RemoveFile(filename);
+}
+
+TEST(PointCloudReader, OpenInvalid) {
+    t::io::PointCloudReader reader;
+    EXPECT_FALSE(reader.Open("does_not_exist.ply"));
+    EXPECT_FALSE(reader.Open("test_reader.unknown"));
+    EXPECT_FALSE(reader.IsOpened());
+}
+
+// Variants that cannot be streamed are rejected instead of being read whole.
+TEST(PointCloudReader, OpenCompressedPCD) {
+    const std::string filename = "test_reader_bc.pcd";
+    EXPECT_TRUE(t::io::WritePointCloud(filename, CreateTestPointCloud(100),
+                                       {false, true}));
+
+    t::io::PointCloudReader reader;
+    EXPECT_FALSE(reader.Open(filename));
+    EXPECT_FALSE(reader.IsOpened());
+
+    utility::filesystem::RemoveFile(filename);
+}
+
+// Malformed PCD headers are rejected instead of throwing.
+TEST(PointCloudReader, OpenMalformedPCD) {
+    const std::string filename = "test_reader_malformed.pcd";
+    for (const std::string header :
+         {"WIDTH 1\nHEIGHT two\n", "WIDTH one\nHEIGHT 1\n",
+          "SIZE 4 4 0\nWIDTH 1\nHEIGHT 1\n",
+          "COUNT 1 1 99999999\nWIDTH 1\nHEIGHT 1\n"}) {
+        FILE *file = utility::filesystem::FOpen(filename, "w");
+        ASSERT_NE(file, nullptr);
+        fputs(("FIELDS x y z\n" + header + "DATA ascii\n0 0 0\n").c_str(),
+              file);
+        fclose(file);
+
+        t::io::PointCloudReader reader;
+        EXPECT_FALSE(reader.Open(filename));
+    }
+    utility::filesystem::RemoveFile(filename);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace t_reg = open3d::t::pipelines::registration;
+namespace l_reg = open3d::pipelines::registration;
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Samples the non-periodic surface z = f(x, y) on a regular grid, with the
+// analytic normals of the surface.
+static geometry::PointCloud GetWavySurface() {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 30; ++i) {
+        for (int j = 0; j < 30; ++j) {
+            const double x = 0.05 * i;
+            const double y = 0.05 * j;
+            const double z = 0.3 * std::sin(2 * x) + 0.2 * std::cos(3 * y) +
+                             0.1 * x * y;
+            const double dzdx = 0.6 * std::cos(2 * x) + 0.1 * y;
+            const double dzdy = -0.6 * std::sin(3 * y) + 0.1 * x;
+            pcd.points_.emplace_back(x, y, z);
+            pcd.normals_.push_back(
+                    Eigen::Vector3d(-dzdx, -dzdy, 1.0).normalized());
+        }
+    }
+    return pcd;
+}
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+
+    const geometry::PointCloud pcd_legacy = GetWavySurface();
+    const double radius = 0.13;
+    const int max_nn = 100;
+
+    const auto fpfh_legacy = l_reg::ComputeFPFHFeature(
+            pcd_legacy, geometry::KDTreeSearchParamHybrid(radius, max_nn));
+    const core::Tensor fpfh_legacy_t =
+            core::eigen_converter::EigenMatrixToTensor(fpfh_legacy->data_)
+                    .T()
+                    .To(core::Float32);
+
+    for (const core::Dtype &dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::FromLegacyPointCloud(pcd_legacy,
+                                                              dtype, device);
+        const core::Tensor fpfh = t_reg::ComputeFPFHFeature(pcd, radius,
+                                                            max_nn);
+
+        EXPECT_EQ(fpfh.GetShape(), core::SizeVector({900, 33}));
+        EXPECT_EQ(fpfh.GetDtype(), core::Float32);
+        EXPECT_EQ(fpfh.GetDevice(), device);
+        EXPECT_TRUE(fpfh.To(core::Device("CPU:0"))
+                            .AllClose(fpfh_legacy_t, 1e-4, 1e-2));
+    }
+
+    // Normals are required.
+    t::geometry::PointCloud pcd_no_normals(
+            core::Tensor::Zeros({10, 3}, core::Float32, device));
+    EXPECT_ANY_THROW(t_reg::ComputeFPFHFeature(pcd_no_normals, radius));
+}
+
+TEST_P(FeaturePermuteDevices, CorrespondencesFromFeatures) {
+    core::Device device = GetParam();
+
+    const core::Tensor source_features = core::Tensor::Init<float>(
+            {{0, 0}, {1, 0}, {0, 1}, {5, 5}}, device);
+    const core::Tensor target_features =
+            core::Tensor::Init<float>({{0.1, 1}, {0.9, 0}, {0, 0.1}}, device);
+
+    const core::Tensor corres = t_reg::CorrespondencesFromFeatures(
+            source_features, target_features);
+    EXPECT_EQ(corres.GetDevice(), device);
+    EXPECT_TRUE(corres.AllClose(core::Tensor::Init<int64_t>(
+            {{0, 2}, {1, 1}, {2, 0}, {3, 0}}, device)));
+
+    // The nearest source of target 0 is source 2, so (3, 0) is removed.
+    const core::Tensor corres_mutual = t_reg::CorrespondencesFromFeatures(
+            source_features, target_features, true);
+    EXPECT_TRUE(corres_mutual.AllClose(core::Tensor::Init<int64_t>(
+            {{0, 2}, {1, 1}, {2, 0}}, device)));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -33,6 +33,7 @@
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/registration/Feature.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
 #include "open3d/t/pipelines/registration/RobustKernelImpl.h"
 #include "tests/UnitTest.h"
@@ -313,6 +314,191 @@ TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlane) {
     }
 }
 
+TEST_P(RegistrationPermuteDevices, MultiScaleICPContext) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        core::Tensor initial_transform_t =
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                            {-0.139, 0.967, -0.215, 0.7},
+                                            {0.487, 0.255, 0.835, -1.4},
+                                            {0.0, 0.0, 0.0, 1.0}},
+                                           core::Device("CPU:0"));
+
+        std::vector<double> voxel_sizes = {1.0, -1};
+        std::vector<double> max_correspondence_dists = {3.0, 1.5};
+        std::vector<t_reg::ICPConvergenceCriteria> criterias(
+                2, t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 2));
+
+        t_reg::RegistrationResult reg_multi_t =
+                t_reg::RegistrationMultiScaleICP(
+                        source_tpcd, target_tpcd, voxel_sizes, criterias,
+                        max_correspondence_dists, initial_transform_t);
+
+        // Repeated registrations reuse the cached target.
+        t_reg::MultiScaleICPContext context(target_tpcd, voxel_sizes,
+                                            max_correspondence_dists);
+        EXPECT_EQ(context.GetNumScales(), 2);
+        for (int i = 0; i < 2; ++i) {
+            t_reg::RegistrationResult reg_context_t = context.RegisterICP(
+                    source_tpcd, criterias, initial_transform_t);
+            EXPECT_DOUBLE_EQ(reg_context_t.fitness_, reg_multi_t.fitness_);
+            EXPECT_DOUBLE_EQ(reg_context_t.inlier_rmse_,
+                             reg_multi_t.inlier_rmse_);
+            EXPECT_TRUE(reg_context_t.transformation_.AllClose(
+                    reg_multi_t.transformation_));
+
+            const std::vector<t_reg::ICPIterationInfo>& info =
+                    context.GetIterationInfo();
+            EXPECT_EQ(info.size(), 4u);
+            EXPECT_EQ(info.front().scale_index_, 0);
+            EXPECT_EQ(info.back().scale_index_, 1);
+            EXPECT_EQ(info.back().iteration_index_, 1);
+        }
+
+        // Adding points gives the same downsampled targets as building the
+        // context from all points.
+        const int64_t num_target_points = target_tpcd.GetPoints().GetLength();
+        t::geometry::PointCloud target_first(device), target_second(device);
+        for (const auto& kv : target_tpcd.GetPointAttr()) {
+            target_first.SetPointAttr(kv.first, kv.second.Slice(0, 0, 20));
+            target_second.SetPointAttr(
+                    kv.first, kv.second.Slice(0, 20, num_target_points));
+        }
+        t_reg::MultiScaleICPContext context_incremental(
+                target_first, voxel_sizes, max_correspondence_dists);
+        context_incremental.AddTargetPoints(target_second);
+        for (int64_t i = 0; i < context.GetNumScales(); ++i) {
+            EXPECT_EQ(context_incremental.GetTarget(i).GetPoints().GetLength(),
+                      context.GetTarget(i).GetPoints().GetLength());
+        }
+        EXPECT_TRUE(context_incremental.GetTarget(1).GetPoints().AllClose(
+                target_tpcd.GetPoints()));
+
+        t_reg::RegistrationResult reg_incremental_t =
+                context_incremental.RegisterICP(source_tpcd, criterias,
+                                                initial_transform_t);
+        EXPECT_NEAR(reg_incremental_t.fitness_, reg_multi_t.fitness_, 0.0005);
+        EXPECT_NEAR(reg_incremental_t.inlier_rmse_, reg_multi_t.inlier_rmse_,
+                    0.0005);
+
+        EXPECT_ANY_THROW(t_reg::MultiScaleICPContext(
+                t::geometry::PointCloud(core::Tensor({0, 3}, dtype, device)),
+                voxel_sizes, max_correspondence_dists));
+    }
+}
+
+// Returns a non-periodic surface with normals and a copy of it moved by a
+// known transformation.
+static std::
+        tuple<t::geometry::PointCloud, t::geometry::PointCloud, core::Tensor>
+        GetRANSACTestPointClouds(const core::Device& device) {
+    std::vector<float> points, normals;
+    for (int i = 0; i < 30; ++i) {
+        for (int j = 0; j < 30; ++j) {
+            const double x = 0.05 * i;
+            const double y = 0.05 * j;
+            const double z = 0.3 * std::sin(2 * x) + 0.2 * std::cos(3 * y) +
+                             0.1 * x * y;
+            const Eigen::Vector3d normal =
+                    Eigen::Vector3d(-0.6 * std::cos(2 * x) - 0.1 * y,
+                                    0.6 * std::sin(3 * y) - 0.1 * x, 1.0)
+                            .normalized();
+            points.insert(points.end(), {float(x), float(y), float(z)});
+            normals.insert(normals.end(), {float(normal(0)), float(normal(1)),
+                                           float(normal(2))});
+        }
+    }
+    t::geometry::PointCloud source(device);
+    source.SetPoints(core::Tensor(points, {900, 3}, core::Float32, device));
+    source.SetPointNormals(
+            core::Tensor(normals, {900, 3}, core::Float32, device));
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            (Eigen::AngleAxisd(0.5, Eigen::Vector3d::UnitZ()) *
+             Eigen::AngleAxisd(0.2, Eigen::Vector3d::UnitX()))
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.1);
+    const core::Tensor transformation_t =
+            core::eigen_converter::EigenMatrixToTensor(transformation);
+
+    t::geometry::PointCloud target = source.Clone();
+    target.Transform(transformation_t.To(device, core::Float32));
+    return std::make_tuple(source, target, transformation_t);
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationRANSACBasedOnCorrespondence) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud source(device), target(device);
+    core::Tensor transformation;
+    std::tie(source, target, transformation) =
+            GetRANSACTestPointClouds(device);
+
+    // 40% of the correspondences are outliers.
+    std::vector<int64_t> corres;
+    for (int64_t i = 0; i < 900; ++i) {
+        corres.push_back(i);
+        corres.push_back(i % 5 < 2 ? (i * 7 + 13) % 900 : i);
+    }
+    const core::Tensor corres_t(corres, {900, 2}, core::Int64, device);
+
+    const t_reg::RegistrationResult result =
+            t_reg::RegistrationRANSACBasedOnCorrespondence(source, target,
+                                                           corres_t, 0.01);
+    EXPECT_TRUE(result.transformation_.AllClose(transformation, 1e-4, 1e-4));
+    EXPECT_NEAR(result.fitness_, 0.6, 0.01);
+    EXPECT_LT(result.inlier_rmse_, 1e-4);
+    EXPECT_EQ(result.correspondences_.GetDevice(), device);
+    const core::Tensor correspondences =
+            result.correspondences_.To(core::Device("CPU:0"));
+    EXPECT_EQ(correspondences.GetShape(), core::SizeVector({900, 1}));
+    EXPECT_EQ(correspondences[2][0].Item<int64_t>(), 2);
+    EXPECT_EQ(correspondences[0][0].Item<int64_t>(), -1);
+
+    // Another call draws other samples, but finds the same transformation.
+    const t_reg::RegistrationResult result_again =
+            t_reg::RegistrationRANSACBasedOnCorrespondence(source, target,
+                                                           corres_t, 0.01);
+    EXPECT_TRUE(result_again.transformation_.AllClose(result.transformation_));
+
+    // With ransac_n correspondences, every sample holds all of them.
+    const t_reg::RegistrationResult result_min =
+            t_reg::RegistrationRANSACBasedOnCorrespondence(
+                    source, target, corres_t.Slice(0, 2, 5), 0.01);
+    EXPECT_TRUE(
+            result_min.transformation_.AllClose(transformation, 1e-3, 1e-3));
+    EXPECT_DOUBLE_EQ(result_min.fitness_, 1.0);
+
+    // Too few correspondences.
+    EXPECT_TRUE(t_reg::RegistrationRANSACBasedOnCorrespondence(
+                        source, target, corres_t.Slice(0, 0, 2), 0.01)
+                        .transformation_.AllClose(core::Tensor::Eye(
+                                4, core::Float64, core::Device("CPU:0"))));
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationRANSACBasedOnFeatureMatching) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud source(device), target(device);
+    core::Tensor transformation;
+    std::tie(source, target, transformation) =
+            GetRANSACTestPointClouds(device);
+
+    const core::Tensor source_fpfh = t_reg::ComputeFPFHFeature(source, 0.13);
+    const core::Tensor target_fpfh = t_reg::ComputeFPFHFeature(target, 0.13);
+
+    const t_reg::RegistrationResult result =
+            t_reg::RegistrationRANSACBasedOnFeatureMatching(
+                    source, target, source_fpfh, target_fpfh, true, 0.01);
+    EXPECT_TRUE(result.transformation_.AllClose(transformation, 1e-3, 1e-3));
+    EXPECT_GT(result.fitness_, 0.5);
+}
+
 TEST_P(RegistrationPermuteDevices, RobustKernel) {
     double scaling_parameter = 1.0;
     double shape_parameter = 1.0;
@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/utility/Helper.h"
+
+#include <algorithm>
+#include <unordered_set>
+
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -31,5 +36,31 @@ namespace tests {
 
 TEST(Helper, DISABLED_SplitString) { NotImplemented(); }
 
+TEST(Helper, UniformRandDistinctInts) {
+    // Populations beyond the range of int.
+    const int64_t population = (int64_t(1) << 40) + 7;
+    for (int64_t n : {0, 1, 3, 1000}) {
+        const std::vector<int64_t> sampled =
+                utility::UniformRandDistinctInts(n, population);
+        EXPECT_EQ(int64_t(sampled.size()), n);
+        EXPECT_EQ(int64_t(std::unordered_set<int64_t>(sampled.begin(),
+                                                      sampled.end())
+                                  .size()),
+                  n);
+        for (int64_t value : sampled) {
+            EXPECT_GE(value, 0);
+            EXPECT_LT(value, population);
+        }
+    }
+
+    // Drawing the whole population returns a permutation.
+    std::vector<int64_t> sampled = utility::UniformRandDistinctInts(10, 10);
+    std::sort(sampled.begin(), sampled.end());
+    EXPECT_EQ(sampled, std::vector<int64_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    EXPECT_ANY_THROW(utility::UniformRandDistinctInts(11, 10));
+    EXPECT_ANY_THROW(utility::UniformRandDistinctInts(-1, 10));
+}
+
 }  // namespace tests
 }  // namespace open3d
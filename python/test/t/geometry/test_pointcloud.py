@@ -180,3 +180,30 @@ def test_member_functions(device):
     pcd_small_down = pcd.voxel_down_sample(1)
     assert pcd_small_down.point["points"].allclose(
         o3c.Tensor([[0, 0, 0]], dtype, device))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_segment_planes(device):
+    grid = np.stack(np.meshgrid(np.arange(30) * 0.05,
+                                np.arange(30) * 0.05),
+                    axis=-1).reshape(-1, 2)
+    floor = np.hstack((grid + 0.5, np.zeros((900, 1))))
+    wall = np.hstack((np.zeros((600, 1)), grid[:600] + 0.5))
+    points = np.vstack((floor, wall)).astype(np.float32)
+    pcd = o3d.t.geometry.PointCloud(o3c.Tensor(points, device=device))
+
+    plane_model, inliers = pcd.segment_plane(distance_threshold=0.01,
+                                             num_iterations=1000)
+    assert inliers.shape[0] == 900
+    np.testing.assert_allclose(np.abs(plane_model.cpu().numpy())[:3],
+                               [0, 0, 1],
+                               atol=1e-5)
+
+    plane_models, labels = pcd.segment_planes(distance_threshold=0.01,
+                                              num_iterations=1000,
+                                              min_num_inliers=100)
+    assert plane_models.shape == o3c.SizeVector([2, 4])
+    labels = labels.cpu().numpy()
+    assert (labels >= 0).all()
+    assert len(np.unique(labels[:900])) == 1
+    assert len(np.unique(labels[900:])) == 1
@@ -82,6 +82,40 @@ def test_add_triangle_mesh():
     np.testing.assert_equal(ans.numpy(), [2, 1, 0])
 
 
+def test_set_geometry_transform():
+    cube = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+        o3d.geometry.TriangleMesh.create_box())
+
+    scene = o3d.t.geometry.RaycastingScene()
+    static_id = scene.add_triangles(cube)
+    dynamic_id = scene.add_triangles(cube)
+
+    rays = o3d.core.Tensor(
+        [[5.5, 0.5, 10, 0, 0, -1], [0.5, 0.5, 10, 0, 0, -1]],
+        dtype=o3d.core.float32)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(ans['geometry_ids'].numpy(),
+                            [scene.INVALID_ID, static_id])
+
+    # Transformations do not accumulate.
+    transformation = np.eye(4)
+    transformation[:3, 3] = [5, 0, 1]
+    scene.set_geometry_transform(dynamic_id, o3d.core.Tensor(transformation))
+    scene.set_geometry_transform(dynamic_id, o3d.core.Tensor(transformation))
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(ans['geometry_ids'].numpy(),
+                            [dynamic_id, static_id])
+    np.testing.assert_allclose(ans['t_hit'].numpy(), [8, 9])
+
+    scene.remove_geometry(static_id)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(ans['geometry_ids'].numpy(),
+                            [dynamic_id, scene.INVALID_ID])
+
+    # IDs of removed geometries are not reused.
+    assert scene.add_triangles(cube) == dynamic_id + 1
+
+
 def test_count_intersections():
     cube = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
         o3d.geometry.TriangleMesh.create_box())
@@ -173,6 +207,54 @@ def test_compute_occupancy():
     np.testing.assert_allclose(ans.numpy(), [1.0, 0.0])
 
 
+def test_winding_number():
+    sphere = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+        o3d.geometry.TriangleMesh.create_sphere(resolution=40))
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(sphere)
+
+    rng = np.random.default_rng(0)
+    query_points = rng.uniform(-1.5, 1.5, size=(1000, 3)).astype(np.float32)
+    # Skip points close to the surface.
+    radius = np.linalg.norm(query_points, axis=1)
+    query_points = query_points[np.abs(radius - 1) > 0.05]
+    query_points = o3d.core.Tensor(query_points)
+
+    ans = scene.compute_occupancy(query_points, use_winding_number=True)
+    np.testing.assert_equal(ans.numpy(),
+                            scene.compute_occupancy(query_points).numpy())
+
+    ans = scene.compute_signed_distance(query_points, use_winding_number=True)
+    np.testing.assert_allclose(
+        ans.numpy(),
+        scene.compute_signed_distance(query_points).numpy())
+
+
+def test_cast_rays_pinhole():
+    sphere = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+        o3d.geometry.TriangleMesh.create_sphere())
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(sphere)
+
+    # Use an image size that is not a multiple of the packet size.
+    rays = o3d.t.geometry.RaycastingScene.create_rays_pinhole(
+        fov_deg=60,
+        center=o3d.core.Tensor([0, 0, 0]),
+        eye=o3d.core.Tensor([3, 1, 2]),
+        up=o3d.core.Tensor([0, 0, 1]),
+        width_px=63,
+        height_px=45)
+    ans = scene.cast_rays(rays)
+    ans_flat = scene.cast_rays(rays.reshape((-1, 6)))
+    for k, v in ans.items():
+        np.testing.assert_allclose(v.numpy().reshape(ans_flat[k].shape),
+                                   ans_flat[k].numpy(),
+                                   rtol=1e-5,
+                                   atol=1e-6)
+
+
 @pytest.mark.parametrize("shape", ([11], [1, 2, 3], [32, 14]))
 def test_output_shapes(shape):
     vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
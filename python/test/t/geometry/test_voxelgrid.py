@@ -169,3 +169,44 @@ def test_raycast(device):
                                  1e-5).sum()
             # Be tolerant to numerical differences
             assert discrepancy_count / vertexmap_gt.size < 1e-3
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_create_from_point_cloud(device):
+    points = np.random.rand(1000, 3)
+    colors = np.random.rand(1000, 3)
+    pcd_legacy = o3d.geometry.PointCloud()
+    pcd_legacy.points = o3d.utility.Vector3dVector(points)
+    pcd_legacy.colors = o3d.utility.Vector3dVector(colors)
+    pcd = o3d.t.geometry.PointCloud.from_legacy_pointcloud(
+        pcd_legacy, o3d.core.float64, device)
+
+    voxel_size = 0.1
+    vg = o3d.t.geometry.VoxelGrid.create_from_point_cloud(pcd, voxel_size)
+    vg_legacy = o3d.geometry.VoxelGrid.create_from_point_cloud(
+        pcd_legacy, voxel_size)
+    assert len(vg) == len(vg_legacy.get_voxels())
+    assert vg.check_if_included(pcd.point["points"]).cpu().numpy().all()
+
+    vg_converted = vg.to_legacy_voxel_grid()
+    indices = sorted(tuple(v.grid_index) for v in vg_converted.get_voxels())
+    indices_gt = sorted(tuple(v.grid_index) for v in vg_legacy.get_voxels())
+    assert indices == indices_gt
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_add_remove_voxels(device):
+    vg = o3d.t.geometry.VoxelGrid(0.5, device=device)
+    indices = o3d.core.Tensor([[0, 0, 0], [1, 2, 3], [-1, 0, 5]],
+                              o3d.core.int32, device)
+    colors = o3d.core.Tensor([[1, 0, 0], [0, 1, 0], [0, 0, 1]],
+                             o3d.core.float32, device)
+    vg.add_voxels(indices, colors)
+    assert len(vg) == 3
+
+    vg.remove_voxels(indices[1:2])
+    assert len(vg) == 2
+    included = vg.check_if_included(
+        o3d.core.Tensor([[0.25, 0.25, 0.25], [0.75, 1.25, 1.75]],
+                        o3d.core.float64, device))
+    np.testing.assert_equal(included.cpu().numpy(), [True, False])
@@ -219,3 +219,34 @@ def test_test_registration_icp_point_to_plane(device):
                                    reg_p2plane_legacy.inlier_rmse, 0.001)
         np.testing.assert_allclose(reg_p2plane_t.fitness,
                                    reg_p2plane_legacy.fitness, 0.001)
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_registration_ransac_based_on_correspondence(device):
+
+    rng = np.random.default_rng(0)
+    source_points = rng.uniform(-1, 1, size=(500, 3))
+    rotation = o3d.geometry.get_rotation_matrix_from_xyz([0.2, -0.1, 0.5])
+    transformation = np.eye(4)
+    transformation[:3, :3] = rotation
+    transformation[:3, 3] = [0.3, -0.2, 0.1]
+    target_points = source_points @ rotation.T + transformation[:3, 3]
+
+    source_t = o3d.t.geometry.PointCloud(
+        o3c.Tensor(source_points, o3c.float32, device))
+    target_t = o3d.t.geometry.PointCloud(
+        o3c.Tensor(target_points, o3c.float32, device))
+
+    # Every third correspondence is an outlier.
+    corres = np.stack([np.arange(500), np.arange(500)], axis=1)
+    corres[::3, 1] = (corres[::3, 1] * 7 + 13) % 500
+    corres_t = o3c.Tensor(corres, o3c.int64, device)
+
+    treg = o3d.t.pipelines.registration
+    result = treg.registration_ransac_based_on_correspondence(
+        source_t, target_t, corres_t, 0.01)
+
+    np.testing.assert_allclose(result.transformation.numpy(),
+                               transformation,
+                               atol=1e-4)
+    np.testing.assert_allclose(result.fitness, 2.0 / 3.0, atol=0.01)
@@ -162,3 +162,29 @@ def test_locate_leaf_node():
         assert node_info.depth == max_depth
         # Leaf node's size must match
         assert node_info.size == octree.size / np.power(2, max_depth)
+
+
+def test_linear_octree_convert_from_point_cloud():
+    pcd = o3d.geometry.PointCloud()
+    pcd.points = o3d.utility.Vector3dVector(_eight_cubes_points)
+    pcd.colors = o3d.utility.Vector3dVector(_eight_cubes_colors)
+
+    linear_octree = o3d.geometry.LinearOctree(1)
+    linear_octree.convert_from_point_cloud(pcd, 0.5)
+    assert not linear_octree.is_empty()
+    np.testing.assert_equal(linear_octree.leaf_codes, list(range(8)))
+    np.testing.assert_allclose(np.asarray(linear_octree.leaf_colors),
+                               _eight_cubes_colors)
+
+    octree = linear_octree.to_octree()
+    for i in range(8):
+        np.testing.assert_equal(octree.root_node.children[i].color,
+                                _eight_cubes_colors[i])
+        np.testing.assert_equal(octree.root_node.children[i].indices, [i])
+
+    # Every point must be located in the leaf holding its index
+    for idx, point in enumerate(_eight_cubes_points):
+        leaf, node_info = linear_octree.locate_leaf_node(point)
+        assert node_info.depth == 1
+        node = o3d.geometry.LinearOctreeNode(leaf, leaf + 1)
+        assert idx in linear_octree.get_point_indices(node)